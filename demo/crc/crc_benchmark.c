@@ -0,0 +1,103 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/***
+ * Demo: CRC check values and cycles per byte
+ * 
+ *   Timer0 runs in 1T mode as cycle counter, results are printed to UART1 in hex:
+ *   cycles of 64 bytes, cycles per byte. Build with CRC8_IMPL, CRC16_CCITT_IMPL,
+ *   CRC16_MODBUS_IMPL and CRC32_IMPL set to CRC_IMPL_BITWISE, CRC_IMPL_NIBBLE or
+ *   CRC_IMPL_TABLE to compare the variants
+*/
+
+#include "fw_hal.h"
+
+#define BUFF_SIZE 64
+
+__CODE uint8_t check[9] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+__XDATA uint8_t buff[BUFF_SIZE];
+
+void Counter_Start(void)
+{
+    TIM_Timer0_SetRunState(HAL_State_OFF);
+    TIM_Timer0_SetInitValue(0x00, 0x00);
+    TIM_Timer0_SetRunState(HAL_State_ON);
+}
+
+void Counter_Print(const char *name)
+{
+    uint16_t cycles;
+    TIM_Timer0_SetRunState(HAL_State_OFF);
+    cycles = (uint16_t)TH0 << 8 | TL0;
+    UART1_TxString((uint8_t *)name);
+    UART1_TxHex(cycles >> 8);
+    UART1_TxHex(cycles & 0xFF);
+    UART1_TxChar(' ');
+    cycles /= BUFF_SIZE;
+    UART1_TxHex(cycles >> 8);
+    UART1_TxHex(cycles & 0xFF);
+    UART1_TxString("\r\n");
+}
+
+void PrintCheck(const char *name, uint32_t crc, uint32_t expected)
+{
+    UART1_TxString((uint8_t *)name);
+    UART1_TxString(crc == expected? "OK\r\n" : "ERR\r\n");
+}
+
+void main(void)
+{
+    uint8_t i;
+
+    SYS_SetClock();
+    // UART1, baud 115200, baud source Timer1, 1T mode, no interrupt
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+    // Timer0 as cycle counter: 1T, 16-bit no reload, no interrupt
+    TIM_Timer0_Set1TMode(HAL_State_ON);
+    TIM_Timer0_SetMode(TIM_TimerMode_16Bit);
+
+    for (i = 0; i < BUFF_SIZE; i++)
+    {
+        buff[i] = i * 37;
+    }
+
+    while(1)
+    {
+        // Check values of "123456789"
+        PrintCheck("CRC8        :", CRC8_Calc(check, 9), 0xA1);
+        PrintCheck("CRC16 CCITT :", CRC16_CCITT_Calc(check, 9), 0x29B1);
+        PrintCheck("CRC16 Modbus:", CRC16_Modbus_Calc(check, 9), 0x4B37);
+        PrintCheck("CRC32       :", CRC32_Calc(check, 9), 0xCBF43926UL);
+
+        Counter_Start();
+        CRC8_Update(CRC8_INIT, buff, BUFF_SIZE);
+        Counter_Print("CRC8        :");
+
+        Counter_Start();
+        CRC16_CCITT_Update(CRC16_CCITT_INIT, buff, BUFF_SIZE);
+        Counter_Print("CRC16 CCITT :");
+
+        Counter_Start();
+        CRC16_Modbus_Update(CRC16_MODBUS_INIT, buff, BUFF_SIZE);
+        Counter_Print("CRC16 Modbus:");
+
+        Counter_Start();
+        CRC32_Update(CRC32_INIT, buff, BUFF_SIZE);
+        Counter_Print("CRC32       :");
+
+        UART1_TxString("\r\n");
+        SYS_Delay(1000);
+    }
+}
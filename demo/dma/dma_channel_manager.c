@@ -0,0 +1,91 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***
+ * Demo: DMA channel manager
+ * 
+ *   M2M copy runs with High priority, UART1 TX DMA with Highest priority.
+ *   Timer0 calls DMA_Channel_Tick() every 1ms, channel statistics are printed
+ *   through UART1 DMA every second
+*/
+
+#include "fw_hal.h"
+#include <stdio.h>
+
+#define BUFF_SIZE 1024
+
+__XDATA uint8_t buff_src[BUFF_SIZE];
+__XDATA uint8_t buff_dst[BUFF_SIZE];
+__XDATA char tx_buff[64];
+volatile uint16_t ticks = 0;
+
+INTERRUPT(Timer0_Routine, EXTI_VectTimer0)
+{
+    ticks++;
+    DMA_Channel_Tick();
+}
+
+INTERRUPT(DMA_M2M_Routine, EXTI_VectDMA_M2M)
+{
+    DMA_Channel_Dispatch(DMA_Channel_M2M);
+}
+
+INTERRUPT(DMA_UR1T_Routine, EXTI_VectDMA_UR1T)
+{
+    DMA_Channel_Dispatch(DMA_Channel_UR1T);
+}
+
+void UART1_TxDMA(uint8_t len)
+{
+    SFRX_ON();
+    DMA_UR1T_TXAH = (uint16_t)tx_buff >> 8;
+    DMA_UR1T_TXAL = (uint16_t)tx_buff & 0xFF;
+    DMA_UR1T_AMT = len - 1;
+    SFRX_OFF();
+    DMA_Channel_Start(DMA_Channel_UR1T, 0x40);
+}
+
+void main(void)
+{
+    DMA_ChannelStats_t stats;
+    uint8_t len;
+
+    SYS_SetClock();
+    // UART1, baud 115200, baud source Timer1, 1T mode, no interrupt
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+    // 1ms tick
+    TIM_Timer0_Config(HAL_State_ON, TIM_TimerMode_16BitAuto, 1000);
+    EXTI_Timer0_SetIntState(HAL_State_ON);
+    TIM_Timer0_SetRunState(HAL_State_ON);
+
+    DMA_Channel_Acquire(DMA_Channel_UR1T, DMA_BusPriority_Highest, NULL);
+    DMA_Channel_Acquire(DMA_Channel_M2M, DMA_BusPriority_High, DMA_M2M_IRQHandler);
+    EXTI_Global_SetIntState(HAL_State_ON);
+
+    while(1)
+    {
+        if (!DMA_M2M_IsBusy())
+        {
+            DMA_M2M_CopyAsync(buff_dst, buff_src, BUFF_SIZE, NULL);
+        }
+        if (ticks >= 1000)
+        {
+            ticks = 0;
+            DMA_Channel_GetStats(DMA_Channel_M2M, &stats);
+            DMA_Channel_ResetStats(DMA_Channel_M2M);
+            len = sprintf(tx_buff, "M2M: %lu bytes, %u done\r\n", stats.bytes, stats.completions);
+            UART1_TxDMA(len);
+        }
+    }
+}
@@ -0,0 +1,103 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***
+ * Demo: DMA memory to memory copy and fill, compared with memcpy/memset
+ * 
+ *   Timer0 runs in 1T mode as cycle counter, results are printed to UART1 in hex
+*/
+
+#include "fw_hal.h"
+#include <string.h>
+
+#define BUFF_SIZE 1024
+
+__XDATA uint8_t buff_src[BUFF_SIZE];
+__XDATA uint8_t buff_dst[BUFF_SIZE];
+__BIT async_done;
+
+INTERRUPT(DMA_M2M_Routine, EXTI_VectDMA_M2M)
+{
+    DMA_Channel_Dispatch(DMA_Channel_M2M);
+}
+
+void AsyncDone(void)
+{
+    async_done = SET;
+}
+
+void Counter_Start(void)
+{
+    TIM_Timer0_SetRunState(HAL_State_OFF);
+    TIM_Timer0_SetInitValue(0x00, 0x00);
+    TIM_Timer0_SetRunState(HAL_State_ON);
+}
+
+void Counter_Print(const char *name)
+{
+    TIM_Timer0_SetRunState(HAL_State_OFF);
+    UART1_TxString((uint8_t *)name);
+    UART1_TxHex(TH0);
+    UART1_TxHex(TL0);
+    UART1_TxString("\r\n");
+}
+
+void main(void)
+{
+    uint16_t i;
+
+    SYS_SetClock();
+    // UART1, baud 115200, baud source Timer1, 1T mode, no interrupt
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+    // Timer0 as cycle counter: 1T, 16-bit no reload, no interrupt
+    TIM_Timer0_Set1TMode(HAL_State_ON);
+    TIM_Timer0_SetMode(TIM_TimerMode_16Bit);
+    EXTI_DMA_M2M_SetIntPriority(EXTI_IntPriority_High);
+    EXTI_Global_SetIntState(HAL_State_ON);
+
+    for (i = 0; i < BUFF_SIZE; i++)
+    {
+        buff_src[i] = i & 0xFF;
+    }
+
+    while(1)
+    {
+        Counter_Start();
+        memcpy(buff_dst, buff_src, BUFF_SIZE);
+        Counter_Print("memcpy  :");
+
+        Counter_Start();
+        DMA_M2M_Copy(buff_dst, buff_src, BUFF_SIZE);
+        Counter_Print("DMA copy:");
+        UART1_TxString(memcmp(buff_dst, buff_src, BUFF_SIZE) == 0? "OK\r\n" : "ERR\r\n");
+
+        Counter_Start();
+        memset(buff_dst, 0x5A, BUFF_SIZE);
+        Counter_Print("memset  :");
+
+        Counter_Start();
+        DMA_M2M_Fill(buff_dst, 0xA5, BUFF_SIZE);
+        Counter_Print("DMA fill:");
+
+        // CPU is free while DMA is copying
+        async_done = RESET;
+        Counter_Start();
+        DMA_M2M_CopyAsync(buff_dst, buff_src, BUFF_SIZE, AsyncDone);
+        Counter_Print("DMA async start:");
+        while (!async_done);
+        UART1_TxString(memcmp(buff_dst, buff_src, BUFF_SIZE) == 0? "OK\r\n" : "ERR\r\n");
+
+        SYS_Delay(1000);
+    }
+}
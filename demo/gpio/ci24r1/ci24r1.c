@@ -17,57 +17,11 @@
 __IDATA uint8_t cbuf[2], xbuf[CI24R1_PLOAD_MAX_WIDTH + 1];
 uint8_t *xbuf_data = xbuf + 1;
 
-void CI24R1_WriteByte(uint8_t value)
-{
-    uint8_t i = 0;
-    CI24R1_CLK_LOW();
-    CI24R1_DATA_OUT();
-    for (i = 0; i < 8; i++)
-    {
-        CI24R1_CLK_LOW();
-        if (value & 0x80)
-        {
-            CI24R1_DATA_HIGH();
-        }
-        else
-        {
-            CI24R1_DATA_LOW();
-        }
-        CI24R1_CLK_HIGH();
-        value = value << 1;
-    }
-    CI24R1_CLK_LOW();
-}
-
-uint8_t CI24R1_ReadByte(void)
-{
-    uint8_t i = 0, RxData;
-
-    CI24R1_DATA_IN();
-    CI24R1_CLK_LOW();
-    for (i = 0; i < 8; i++)
-    {
-        RxData = RxData << 1;
-        CI24R1_CLK_HIGH();
-        if (CI24R1_DATA_READ())
-        {
-            RxData |= 0x01;
-        }
-        else
-        {
-            RxData &= 0xfe;
-        }
-        CI24R1_CLK_LOW();
-    }
-    CI24R1_CLK_LOW();
-    return RxData;
-}
-
 void CI24R1_WriteReg(uint8_t reg,uint8_t value)
 {
 	CI24R1_NSS_LOW();					
-	CI24R1_WriteByte(reg);
-	CI24R1_WriteByte(value);
+	SOFTSPI_Tx(reg);
+	SOFTSPI_Tx(value);
 	CI24R1_NSS_HIGH();
 }
 
@@ -75,8 +29,10 @@ uint8_t CI24R1_ReadReg(uint8_t reg)
 {
     uint8_t reg_val;
     CI24R1_NSS_LOW();
-    CI24R1_WriteByte(reg);
-    reg_val = CI24R1_ReadByte();
+    SOFTSPI_Tx(reg);
+    SOFTSPI_DataIn();
+    reg_val = SOFTSPI_Rx();
+    SOFTSPI_DataOut();
     CI24R1_NSS_HIGH();
     return reg_val;
 }
@@ -84,31 +40,25 @@ uint8_t CI24R1_ReadReg(uint8_t reg)
 void CI24R1_WriteCmd(uint8_t cmd)
 {
 	CI24R1_NSS_LOW();					
-	CI24R1_WriteByte(cmd);
+	SOFTSPI_Tx(cmd);
 	CI24R1_NSS_HIGH();
 }
 
 void CI24R1_WriteFromBuf(uint8_t reg, const uint8_t *pBuf, uint8_t len)
 {
-    uint8_t ctr;
     CI24R1_NSS_LOW();
-    CI24R1_WriteByte(reg);
-    for (ctr = 0; ctr < len; ctr++)
-    {
-        CI24R1_WriteByte(*pBuf++);
-    }
+    SOFTSPI_Tx(reg);
+    SOFTSPI_Write(pBuf, len);
     CI24R1_NSS_HIGH();
 }
 
 void CI24R1_ReadToBuf(uint8_t reg, uint8_t *pBuf, uint8_t len)
 {
-    uint8_t ctr;
     CI24R1_NSS_LOW();
-    CI24R1_WriteByte(reg);
-    for (ctr = 0; ctr < len; ctr++)
-    {
-        pBuf[ctr] = CI24R1_ReadByte();
-    }
+    SOFTSPI_Tx(reg);
+    SOFTSPI_DataIn();
+    SOFTSPI_Read(pBuf, len);
+    SOFTSPI_DataOut();
     CI24R1_NSS_HIGH();
 
 }
@@ -21,17 +21,11 @@
 #define CI24R1_PLOAD_WIDTH       16  // Payload width, 0:dynamic, [1,32]:fixed
 
 #define CI24R1_CSN  P35
-#define CI24R1_MOSI P34
-#define CI24R1_SCK  P32
+// SCK P3.2 and DATA P3.4 are the default SOFTSPI_SCK_PIN and SOFTSPI_MOSI_PIN of fw_softspi
 
-#define CI24R1_DATA_OUT()        GPIO_P3_SetMode(GPIO_Pin_4, GPIO_Mode_Output_PP)
-#define CI24R1_DATA_IN()         GPIO_P3_SetMode(GPIO_Pin_4, GPIO_Mode_Input_HIP)
-#define CI24R1_DATA_LOW()        CI24R1_MOSI = 0
-#define CI24R1_DATA_HIGH()       CI24R1_MOSI = 1
-#define CI24R1_DATA_READ()       CI24R1_MOSI
-
-#define CI24R1_CLK_LOW()         CI24R1_SCK = 0
-#define CI24R1_CLK_HIGH()        CI24R1_SCK = 1
+#define CI24R1_DATA_OUT()        SOFTSPI_DataOut()
+#define CI24R1_DATA_IN()         SOFTSPI_DataIn()
+#define CI24R1_DATA_READ()       PIN_READ(SOFTSPI_MOSI_PIN)
 
 #define CI24R1_NSS_LOW()         CI24R1_CSN = 0
 #define CI24R1_NSS_HIGH()        CI24R1_CSN = 1
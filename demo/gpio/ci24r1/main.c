@@ -38,8 +38,10 @@ extern uint8_t *xbuf_data;
 
 void GPIO_Init(void)
 {
-    // SCLK(P32) CSN(P35)
-    GPIO_P3_SetMode(GPIO_Pin_2|GPIO_Pin_5, GPIO_Mode_Output_PP);
+    // CSN(P35)
+    GPIO_P3_SetMode(GPIO_Pin_5, GPIO_Mode_Output_PP);
+    // SCLK(P32) DATA(P34)
+    SOFTSPI_Init();
 }
 
 int main(void)
@@ -0,0 +1,114 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/***
+ * Example code of DS18B20 bus manager, all sensors convert at the same time
+ * 
+ * Board: STC8H3K32
+ * 
+ *              P35   -> DQ
+ *              GND   -> GND
+ *              3.3V  -> VCC
+ *
+ * The first run searches the bus and saves the ROM table to EEPROM address 0x0000,
+ * later runs load it. Sensor 0 is set to 10-bit resolution to show per-sensor setting,
+ * the round takes as long as the slowest sensor.
+ */
+
+#include "fw_hal.h"
+#include "ds18b20_bus.h"
+
+#if (DS18B20_USE_ONEWIRE)
+INTERRUPT(UART2_Routine, EXTI_VectUART2)
+{
+    OW_UART_IRQHandler();
+}
+
+#if (__CONF_MCU_TYPE == 3)
+INTERRUPT(DMA_UR2R_Routine, EXTI_VectDMA_UR2R)
+{
+    DMA_Channel_Dispatch(DMA_Channel_UR2R);
+}
+#endif
+#endif
+
+void PrintRom(uint8_t index)
+{
+    uint8_t i, rom[8];
+    DS18B20_Bus_GetRom(index, rom);
+    for (i = 0; i < 8; i++)
+    {
+        UART1_TxHex(rom[i]);
+    }
+}
+
+int main(void)
+{
+    uint8_t i, n, polls;
+    int16_t raw;
+
+    SYS_SetClock();
+    // UART1, baud 115200, baud source Timer1, 1T mode, no interrupt
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+#if (DS18B20_USE_ONEWIRE)
+    OW_UART_Init(HAL_State_ON);
+    EXTI_Global_SetIntState(HAL_State_ON);
+#endif
+    DS18B20_Init();
+    n = DS18B20_Bus_Init();
+    UART1_TxString("Sensors: ");
+    UART1_TxHex(n);
+    UART1_TxString("\r\n");
+    for (i = 0; i < n; i++)
+    {
+        PrintRom(i);
+        UART1_TxChar(' ');
+        UART1_TxHex(DS18B20_Bus_GetResolution(i));
+        UART1_TxString("\r\n");
+    }
+    if (n > 0 && DS18B20_Bus_GetResolution(0) != DS18B20_Resolution_10bits)
+    {
+        DS18B20_Bus_SetResolution(0, DS18B20_Resolution_10bits);
+    }
+
+    while(1)
+    {
+        DS18B20_Bus_Start();
+        polls = 0;
+        while (DS18B20_Bus_Process() == HAL_BUSY)
+        {
+            // Free for other work during the conversion
+            polls++;
+            SYS_Delay(10);
+        }
+        UART1_TxHex(polls);
+        UART1_TxString(":");
+        for (i = 0; i < n; i++)
+        {
+            UART1_TxChar(' ');
+            if (DS18B20_Bus_GetTemperature(i, &raw) == HAL_OK)
+            {
+                UART1_TxHex(raw >> 8);
+                UART1_TxHex(raw & 0xFF);
+            }
+            else
+            {
+                UART1_TxString("----");
+            }
+        }
+        UART1_TxString("\r\n");
+        SYS_Delay(1000);
+    }
+}
@@ -0,0 +1,300 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "ds18b20_bus.h"
+
+#define DS18B20_BUS_MAGIC           0xD5
+
+#define DS18B20_BUS_STATE_IDLE      0x00
+#define DS18B20_BUS_STATE_CONVERT   0x01
+
+static __XDATA uint8_t ds18b20_bus_rom[DS18B20_BUS_MAX_SENSORS][8];
+static __XDATA uint8_t ds18b20_bus_resolution[DS18B20_BUS_MAX_SENSORS];
+static __XDATA int16_t ds18b20_bus_temperature[DS18B20_BUS_MAX_SENSORS];
+static __XDATA HAL_StatusTypeDef ds18b20_bus_status[DS18B20_BUS_MAX_SENSORS];
+static uint8_t ds18b20_bus_count, ds18b20_bus_state;
+
+static uint8_t DS18B20_Bus_EepromRead(uint16_t addr)
+{
+    IAP_CmdRead(addr);
+    return IAP_ReadData();
+}
+
+static void DS18B20_Bus_EepromWrite(uint16_t addr, uint8_t dat)
+{
+    IAP_WriteData(dat);
+    IAP_CmdWrite(addr);
+}
+
+static HAL_StatusTypeDef DS18B20_Bus_Load(void)
+{
+    uint8_t i, j, crc, dat;
+    uint16_t addr = DS18B20_BUS_EEPROM_ADDR;
+    HAL_StatusTypeDef status = HAL_ERROR;
+
+    IAP_SetWaitTime();
+    IAP_SetEnabled(HAL_State_ON);
+    if (DS18B20_Bus_EepromRead(addr++) == DS18B20_BUS_MAGIC)
+    {
+        ds18b20_bus_count = DS18B20_Bus_EepromRead(addr++);
+        crc = CRC8_Update(CRC8_INIT, &ds18b20_bus_count, 1);
+        if (ds18b20_bus_count <= DS18B20_BUS_MAX_SENSORS)
+        {
+            for (i = 0; i < ds18b20_bus_count; i++)
+            {
+                for (j = 0; j < 8; j++)
+                {
+                    dat = DS18B20_Bus_EepromRead(addr++);
+                    ds18b20_bus_rom[i][j] = dat;
+                    crc = CRC8_Update(crc, &dat, 1);
+                }
+                dat = DS18B20_Bus_EepromRead(addr++);
+                ds18b20_bus_resolution[i] = dat;
+                crc = CRC8_Update(crc, &dat, 1);
+            }
+            if (DS18B20_Bus_EepromRead(addr) == crc)
+            {
+                status = HAL_OK;
+            }
+        }
+    }
+    IAP_SetEnabled(HAL_State_OFF);
+    if (status != HAL_OK)
+    {
+        ds18b20_bus_count = 0;
+    }
+    return status;
+}
+
+static HAL_StatusTypeDef DS18B20_Bus_Save(void)
+{
+    uint8_t i, j, crc, dat;
+    uint16_t addr = DS18B20_BUS_EEPROM_ADDR;
+    HAL_StatusTypeDef status = HAL_OK;
+
+    IAP_SetWaitTime();
+    IAP_SetEnabled(HAL_State_ON);
+    IAP_CmdErase(DS18B20_BUS_EEPROM_ADDR);
+    DS18B20_Bus_EepromWrite(addr++, DS18B20_BUS_MAGIC);
+    DS18B20_Bus_EepromWrite(addr++, ds18b20_bus_count);
+    crc = CRC8_Update(CRC8_INIT, &ds18b20_bus_count, 1);
+    for (i = 0; i < ds18b20_bus_count; i++)
+    {
+        for (j = 0; j < 8; j++)
+        {
+            dat = ds18b20_bus_rom[i][j];
+            DS18B20_Bus_EepromWrite(addr++, dat);
+            crc = CRC8_Update(crc, &dat, 1);
+        }
+        dat = ds18b20_bus_resolution[i];
+        DS18B20_Bus_EepromWrite(addr++, dat);
+        crc = CRC8_Update(crc, &dat, 1);
+    }
+    DS18B20_Bus_EepromWrite(addr, crc);
+    // The fail flag is sticky, one check covers the erase and all writes
+    if (IAP_IsCmdFailed())
+    {
+        IAP_ClearCmdFailFlag();
+        status = HAL_ERROR;
+    }
+    IAP_SetEnabled(HAL_State_OFF);
+    return status;
+}
+
+/**
+ * Read scratchpad with CRC check, the reserved bits of the config register read 1,
+ * which also rejects an all-zero buffer from a shorted bus
+*/
+static HAL_StatusTypeDef DS18B20_Bus_ReadScratchpad(uint8_t index, uint8_t *buf)
+{
+    DS18B20_ReadScratchpadFromAddr(ds18b20_bus_rom[index], buf);
+    if (CRC8_Calc(buf, 8) != buf[8] || (buf[4] & 0x9F) != 0x1F)
+    {
+        return HAL_ERROR;
+    }
+    return HAL_OK;
+}
+
+/**
+ * Write resolution of the table to the sensor, alarm registers TH and TL are kept
+*/
+static HAL_StatusTypeDef DS18B20_Bus_WriteConfig(uint8_t index)
+{
+    uint8_t buf[9];
+    if (DS18B20_Bus_ReadScratchpad(index, buf) != HAL_OK)
+    {
+        return HAL_ERROR;
+    }
+    DS18B20_Reset();
+    DS18B20_Select(ds18b20_bus_rom[index]);
+    DS18B20_WriteByte(ONEWIRE_CMD_WSCRATCHPAD);
+    DS18B20_WriteByte(buf[2]);
+    DS18B20_WriteByte(buf[3]);
+    DS18B20_WriteByte(((ds18b20_bus_resolution[index] - DS18B20_Resolution_9bits) << DS18B20_RESOLUTION_R0) | 0x1F);
+    return HAL_OK;
+}
+
+static uint8_t DS18B20_Bus_Find(const uint8_t *rom)
+{
+    uint8_t i, j;
+    for (i = 0; i < ds18b20_bus_count; i++)
+    {
+        for (j = 0; j < 8 && ds18b20_bus_rom[i][j] == rom[j]; j++);
+        if (j == 8)
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+uint8_t DS18B20_Bus_Enumerate(void)
+{
+    uint8_t i, sp = 0, rom[8], stack[8], buf[9];
+
+    ds18b20_bus_count = 0;
+    for (i = 0; i < 8; i++)
+    {
+        rom[i] = 0;
+    }
+    do
+    {
+        sp = DS18B20_Search(rom, stack, sp);
+        // A failed search leaves the ROM of the previous device or zeros in rom
+        if (rom[0] != DS18B20_FAMILY_CODE || CRC8_Calc(rom, 7) != rom[7]
+            || ds18b20_bus_count == DS18B20_BUS_MAX_SENSORS)
+        {
+            continue;
+        }
+        if (DS18B20_Bus_Find(rom) < ds18b20_bus_count)
+        {
+            continue;
+        }
+        for (i = 0; i < 8; i++)
+        {
+            ds18b20_bus_rom[ds18b20_bus_count][i] = rom[i];
+        }
+        // Keep the resolution the sensor powers up with
+        ds18b20_bus_resolution[ds18b20_bus_count] = DS18B20_Resolution_12bits;
+        if (DS18B20_Bus_ReadScratchpad(ds18b20_bus_count, buf) == HAL_OK)
+        {
+            ds18b20_bus_resolution[ds18b20_bus_count] = ((buf[4] >> DS18B20_RESOLUTION_R0) & 0x03) + DS18B20_Resolution_9bits;
+        }
+        ds18b20_bus_count++;
+    } while (sp);
+    DS18B20_Bus_Save();
+    return ds18b20_bus_count;
+}
+
+uint8_t DS18B20_Bus_Init(void)
+{
+    uint8_t i;
+    ds18b20_bus_state = DS18B20_BUS_STATE_IDLE;
+    if (DS18B20_Bus_Load() != HAL_OK || ds18b20_bus_count == 0)
+    {
+        DS18B20_Bus_Enumerate();
+    }
+    for (i = 0; i < ds18b20_bus_count; i++)
+    {
+        ds18b20_bus_status[i] = HAL_ERROR;
+        DS18B20_Bus_WriteConfig(i);
+    }
+    return ds18b20_bus_count;
+}
+
+uint8_t DS18B20_Bus_GetCount(void)
+{
+    return ds18b20_bus_count;
+}
+
+void DS18B20_Bus_GetRom(uint8_t index, uint8_t *rom)
+{
+    uint8_t i;
+    for (i = 0; i < 8; i++)
+    {
+        rom[i] = ds18b20_bus_rom[index][i];
+    }
+}
+
+HAL_StatusTypeDef DS18B20_Bus_SetResolution(uint8_t index, DS18B20_Resolution_t resolution)
+{
+    if (index >= ds18b20_bus_count || resolution < DS18B20_Resolution_9bits
+        || resolution > DS18B20_Resolution_12bits)
+    {
+        return HAL_ERROR;
+    }
+    if (ds18b20_bus_state != DS18B20_BUS_STATE_IDLE)
+    {
+        return HAL_BUSY;
+    }
+    ds18b20_bus_resolution[index] = resolution;
+    if (DS18B20_Bus_WriteConfig(index) != HAL_OK)
+    {
+        return HAL_ERROR;
+    }
+    return DS18B20_Bus_Save();
+}
+
+DS18B20_Resolution_t DS18B20_Bus_GetResolution(uint8_t index)
+{
+    return ds18b20_bus_resolution[index];
+}
+
+HAL_StatusTypeDef DS18B20_Bus_Start(void)
+{
+    if (ds18b20_bus_state != DS18B20_BUS_STATE_IDLE)
+    {
+        return HAL_BUSY;
+    }
+    DS18B20_StartAll();
+    ds18b20_bus_state = DS18B20_BUS_STATE_CONVERT;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef DS18B20_Bus_Process(void)
+{
+    uint8_t i, buf[9];
+    if (ds18b20_bus_state == DS18B20_BUS_STATE_IDLE)
+    {
+        return HAL_ERROR;
+    }
+    // Read slots are answered with 0 until the slowest sensor is done
+    if (!DS18B20_AllDone())
+    {
+        return HAL_BUSY;
+    }
+    for (i = 0; i < ds18b20_bus_count; i++)
+    {
+        ds18b20_bus_status[i] = DS18B20_Bus_ReadScratchpad(i, buf);
+        if (ds18b20_bus_status[i] == HAL_OK)
+        {
+            // Clear the undefined low bits of lower resolutions
+            ds18b20_bus_temperature[i] = (int16_t)((uint16_t)buf[1] << 8 | buf[0])
+                & ~((1 << (DS18B20_Resolution_12bits - ds18b20_bus_resolution[i])) - 1);
+        }
+    }
+    ds18b20_bus_state = DS18B20_BUS_STATE_IDLE;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef DS18B20_Bus_GetTemperature(uint8_t index, int16_t *raw)
+{
+    if (index >= ds18b20_bus_count)
+    {
+        return HAL_ERROR;
+    }
+    *raw = ds18b20_bus_temperature[index];
+    return ds18b20_bus_status[index];
+}
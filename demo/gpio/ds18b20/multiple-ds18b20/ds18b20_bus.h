@@ -0,0 +1,79 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef __DS18B20_BUS_H__
+#define __DS18B20_BUS_H__
+
+#include "ds18b20.h"
+
+/**
+ * DS18B20 bus manager
+ *
+ * The bus is searched once and the ROM codes and resolutions are kept in an EEPROM
+ * table, later startups load the table instead of searching. One round converts on
+ * all sensors with SKIP ROM, polls the bus until the slowest one is done, then reads
+ * every scratchpad back to back, so a round takes one conversion time plus about
+ * 10ms per sensor with GPIO bit-bang. Call DS18B20_Bus_Process() in the main loop,
+ * it returns immediately while the conversion runs.
+ *
+ * Table in EEPROM: magic, count, count x (8-byte ROM, resolution), CRC8 of count and
+ * entries. It takes one 512-byte sector at DS18B20_BUS_EEPROM_ADDR.
+ *
+ * Polling needs normal power mode, parasite powered sensors don't answer read slots
+ * during conversion.
+*/
+
+#ifndef DS18B20_BUS_MAX_SENSORS
+#define DS18B20_BUS_MAX_SENSORS     20
+#endif
+
+#ifndef DS18B20_BUS_EEPROM_ADDR
+#define DS18B20_BUS_EEPROM_ADDR     0x0000
+#endif
+
+/**
+ * Load the ROM table from EEPROM, or search the bus and save the table if EEPROM
+ * holds no valid table. Resolutions in the table are written to the sensors.
+ * Returns the number of sensors
+*/
+uint8_t DS18B20_Bus_Init(void);
+/**
+ * Search the bus again and save the new table, e.g. after sensors are added or replaced
+*/
+uint8_t DS18B20_Bus_Enumerate(void);
+uint8_t DS18B20_Bus_GetCount(void);
+void DS18B20_Bus_GetRom(uint8_t index, uint8_t *rom);
+/**
+ * Write the resolution to the sensor scratchpad and save it in the table.
+ * Returns HAL_ERROR if the sensor doesn't answer or the table can't be saved
+*/
+HAL_StatusTypeDef DS18B20_Bus_SetResolution(uint8_t index, DS18B20_Resolution_t resolution);
+DS18B20_Resolution_t DS18B20_Bus_GetResolution(uint8_t index);
+/**
+ * Start conversion on all sensors, returns HAL_BUSY if a round is running
+*/
+HAL_StatusTypeDef DS18B20_Bus_Start(void);
+/**
+ * HAL_BUSY while converting, HAL_OK when the round has just been read out,
+ * HAL_ERROR if no round is running
+*/
+HAL_StatusTypeDef DS18B20_Bus_Process(void);
+/**
+ * Temperature of the last round in 1/16 degree, returns HAL_ERROR if the sensor
+ * didn't answer or its scratchpad failed CRC
+*/
+HAL_StatusTypeDef DS18B20_Bus_GetTemperature(uint8_t index, int16_t *raw);
+
+#endif
@@ -20,6 +20,10 @@
  *              P35   -> DQ
  *              GND   -> GND
  *              3.3V  -> VCC
+ *
+ * Built with DS18B20_USE_ONEWIRE=1 the bus runs on UART2, with DMA on STC8H
+ *
+ *              P11(TxD2, open-drain) -> P10(RxD2) -> DQ, 4.7K pull-up
  */
 
 #include "fw_hal.h"
@@ -27,6 +31,20 @@
 
 uint8_t DS18B20_Buff[9], addr[8], Search_Stack[8];
 
+#if (DS18B20_USE_ONEWIRE)
+INTERRUPT(UART2_Routine, EXTI_VectUART2)
+{
+    OW_UART_IRQHandler();
+}
+
+#if (__CONF_MCU_TYPE == 3)
+INTERRUPT(DMA_UR2R_Routine, EXTI_VectDMA_UR2R)
+{
+    DMA_Channel_Dispatch(DMA_Channel_UR2R);
+}
+#endif
+#endif
+
 void PrintArray(uint8_t *arr, uint8_t start, uint8_t end)
 {
     uint8_t i;
@@ -43,6 +61,10 @@ int main(void)
     SYS_SetClock();
     // UART1, baud 115200, baud source Timer1, 1T mode, no interrupt
     UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+#if (DS18B20_USE_ONEWIRE)
+    OW_UART_Init(HAL_State_ON);
+    EXTI_Global_SetIntState(HAL_State_ON);
+#endif
     DS18B20_Init();
 
     while(1)
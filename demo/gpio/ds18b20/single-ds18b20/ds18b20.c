@@ -14,6 +14,92 @@
 
 #include "ds18b20.h"
 
+#if (DS18B20_USE_ONEWIRE)
+
+void DS18B20_Init(void)
+{
+    /* DQ is released by OW_Init()/OW_UART_Init(), wait for possible capacitor charging */
+    SYS_Delay(1000);
+}
+
+__BIT DS18B20_Reset(void)
+{
+    OW_Reset();
+    /* Return value of presence pulse, 0 = OK, 1 = ERROR */
+    return OW_Wait() != HAL_OK;
+}
+
+__BIT DS18B20_ReadBit(void)
+{
+    uint8_t b = 0;
+    OW_ReadBit(&b);
+    OW_Wait();
+    return b;
+}
+
+uint8_t DS18B20_ReadByte(void)
+{
+    uint8_t byte = 0;
+    OW_Read(&byte, 1);
+    OW_Wait();
+    return byte;
+}
+
+void DS18B20_WriteBit(__BIT b)
+{
+    OW_WriteBit(b);
+    OW_Wait();
+}
+
+void DS18B20_WriteByte(uint8_t byte)
+{
+    OW_Write(&byte, 1);
+    OW_Wait();
+}
+
+void DS18B20_ReadScratchpad(uint8_t *buf)
+{
+    uint8_t cmd = ONEWIRE_CMD_RSCRATCHPAD;
+    /* Reset, skip ROM, command and 9 bytes in one operation */
+    OW_Transfer(NULL, &cmd, 1, buf, 9);
+    OW_Wait();
+}
+
+void DS18B20_StartAll(void)
+{
+    uint8_t cmd = DS18B20_CMD_CONVERTTEMP;
+    OW_Transfer(NULL, &cmd, 1, NULL, 0);
+    OW_Wait();
+}
+
+void DS18B20_Select(const uint8_t* addr)
+{
+    uint8_t i, buf[9];
+    buf[0] = ONEWIRE_CMD_MATCHROM;
+    for (i = 0; i < 8; i++)
+    {
+        buf[i + 1] = addr[i];
+    }
+    OW_Write(buf, 9);
+    OW_Wait();
+}
+
+void DS18B20_Start(const uint8_t *addr)
+{
+    uint8_t cmd = DS18B20_CMD_CONVERTTEMP;
+    OW_Transfer(addr, &cmd, 1, NULL, 0);
+    OW_Wait();
+}
+
+void DS18B20_ReadScratchpadFromAddr(const uint8_t *addr, uint8_t *buf)
+{
+    uint8_t cmd = ONEWIRE_CMD_RSCRATCHPAD;
+    OW_Transfer(addr, &cmd, 1, buf, 9);
+    OW_Wait();
+}
+
+#else
+
 void DS18B20_Init(void)
 {
     /* Pull up 2 seconds for possible capacitor charging */
@@ -148,28 +234,6 @@ void DS18B20_ReadScratchpad(uint8_t *buf)
     }
 }
 
-uint8_t DS18B20_Crc(uint8_t *addr, uint8_t len)
-{
-    uint8_t crc = 0, inbyte, i, mix;
-
-    while (len--) 
-    {
-        inbyte = *addr++;
-        for (i = 8; i; i--) 
-        {
-            mix = (crc ^ inbyte) & 0x01;
-            crc >>= 1;
-            if (mix) 
-            {
-                crc ^= 0x8C;
-            }
-            inbyte >>= 1;
-        }
-    }
-    /* Return calculated CRC */
-    return crc;
-}
-
 void DS18B20_StartAll(void)
 {
     /* Reset pulse */
@@ -180,27 +244,6 @@ void DS18B20_StartAll(void)
     DS18B20_WriteByte(DS18B20_CMD_CONVERTTEMP);
 }
 
-__BIT DS18B20_AllDone(void)
-{
-    /* If read bit is low, then device is not finished yet with calculation temperature */
-    return DS18B20_ReadBit();
-}
-
-void DS18B20_ReadRom(uint8_t *buf)
-{
-    uint8_t i = 0;
-    /* Reset pulse */
-    DS18B20_Reset();
-    /* Read rom */
-    DS18B20_WriteByte(ONEWIRE_CMD_READROM);
-    /* Get data */
-    for (i = 0; i < 8; i++) 
-    {
-        /* Read byte by byte */
-        *buf++ = DS18B20_ReadByte();
-    }
-}
-
 void DS18B20_Select(const uint8_t* addr)
 {
     uint8_t len = 8;
@@ -239,6 +282,34 @@ void DS18B20_ReadScratchpadFromAddr(const uint8_t *addr, uint8_t *buf)
     }
 }
 
+#endif
+
+uint8_t DS18B20_Crc(uint8_t *addr, uint8_t len)
+{
+    return CRC8_Calc(addr, len);
+}
+
+__BIT DS18B20_AllDone(void)
+{
+    /* If read bit is low, then device is not finished yet with calculation temperature */
+    return DS18B20_ReadBit();
+}
+
+void DS18B20_ReadRom(uint8_t *buf)
+{
+    uint8_t i = 0;
+    /* Reset pulse */
+    DS18B20_Reset();
+    /* Read rom */
+    DS18B20_WriteByte(ONEWIRE_CMD_READROM);
+    /* Get data */
+    for (i = 0; i < 8; i++) 
+    {
+        /* Read byte by byte */
+        *buf++ = DS18B20_ReadByte();
+    }
+}
+
 uint8_t DS18B20_Search(uint8_t *buff, uint8_t *stack, uint8_t split_point)
 {
     uint8_t len = 64, pos = 0;
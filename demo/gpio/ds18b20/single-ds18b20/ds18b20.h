@@ -23,8 +23,15 @@
  * To-92 Pins: 
  *   With the flat side facing you and with the leads pointing down, they are GND, DQ and Vdd
  * 
+ * Bus access is GPIO bit-bang by default. Build with DS18B20_USE_ONEWIRE=1 to run it on
+ * the fw_onewire master instead, then call OW_Init() (Timer0) or OW_UART_Init() (UART2)
+ * before DS18B20_Init() and route the interrupts as described in fw_onewire.h
 */
 
+#ifndef DS18B20_USE_ONEWIRE
+#define DS18B20_USE_ONEWIRE  0
+#endif
+
 #define DS18B20_DQ           P35
 #define DS18B20_DQ_PULLUP()  GPIO_SetPullUp(GPIO_Port_3, GPIO_Pin_5, HAL_State_ON)
 #define DS18B20_DQ_INPUT()   GPIO_P3_SetMode(GPIO_Pin_5, GPIO_Mode_Input_HIP)
@@ -100,7 +107,7 @@ void DS18B20_WriteBit(__BIT b);
 void DS18B20_WriteByte(uint8_t byte);
 
 /**
- * @brief 8-bit CRC calculation
+ * @brief 8-bit CRC calculation, CRC8_Calc() of fw_crc
  * 
  * @param addr 
  * @param len 
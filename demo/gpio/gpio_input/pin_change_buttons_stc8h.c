@@ -0,0 +1,72 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/***
+ * Demo: Buttons on pin change interrupts, STC8H
+ * 
+ *   P3.2  -> KEY1 -> GND
+ *   P3.3  -> KEY2 -> GND
+ *   P3.4  -> KEY3 -> GND
+ *   P3.0(RXD) -> USB-TTL TXD
+ *   P3.1(TXD) -> USB-TTL RXD
+ * 
+ * Keys are debounced for 10ms, each press and release is printed with
+ * the millisecond timestamp of its first edge, e.g. "K 1A F 03E8"
+ */
+
+#include "fw_hal.h"
+
+#define KEY_PINS        GPIO_PINS(3, GPIO_Pin_2 | GPIO_Pin_3 | GPIO_Pin_4)
+#define KEY_DEBOUNCE    10
+
+EXTI_PIN_ROUTINE(3)
+
+INTERRUPT(Timer0_Routine, EXTI_VectTimer0)
+{
+    EXTI_Pin_TickHandler();
+}
+
+int main(void)
+{
+    EXTI_PinEvent_t event;
+
+    SYS_SetClock();
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+
+    PINS_SetMode(KEY_PINS, GPIO_Mode_Input_HIP);
+    PINS_SetPullUp(KEY_PINS, HAL_State_ON);
+    EXTI_Pin_Init();
+    EXTI_Pin_Config(PIN_PORT(KEY_PINS), PINS_MASK(KEY_PINS), EXTI_PinEdge_Both, KEY_DEBOUNCE);
+    EXTI_Port_SetIntPriority(PIN_PORT(KEY_PINS), EXTI_IntPriority_High);
+
+    // 1ms tick
+    TIM_Timer0_Config(HAL_State_ON, TIM_TimerMode_16BitAuto, 1000);
+    EXTI_Timer0_SetIntState(HAL_State_ON);
+    EXTI_Global_SetIntState(HAL_State_ON);
+    TIM_Timer0_SetRunState(HAL_State_ON);
+
+    while(1)
+    {
+        if (EXTI_Pin_Read(&event) == HAL_OK)
+        {
+            UART1_TxString("K ");
+            UART1_TxHex(event.pin);
+            UART1_TxString((event.edge == EXTI_PinEdge_Fall)? " F " : " R ");
+            UART1_TxHex(event.timestamp >> 8);
+            UART1_TxHex(event.timestamp & 0xFF);
+            UART1_TxString("\r\n");
+        }
+    }
+}
@@ -0,0 +1,175 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "keymatrix.h"
+
+#define KEYMATRIX_COL_MASK      ((uint8_t)((0x01 << KEYMATRIX_COLS) - 1))
+
+static __XDATA KeyMatrix_KeyEvent_t km_queue[KEYMATRIX_QUEUE_SIZE];
+static volatile uint8_t km_head, km_tail;
+static uint16_t km_overruns;
+static uint16_t km_max_cost;
+
+// Debounced states and vertical counters, one byte per row
+static __XDATA uint8_t km_state[KEYMATRIX_ROWS];
+static __XDATA uint8_t km_ct0[KEYMATRIX_ROWS];
+static __XDATA uint8_t km_ct1[KEYMATRIX_ROWS];
+// Scans since a key went down
+static __XDATA uint8_t km_hold[KEYMATRIX_KEYS];
+// Row being driven
+static uint8_t km_row;
+
+// Used in interrupt only
+static uint16_t km_start;
+static uint8_t km_r, km_sample, km_toggle, km_mask, km_key;
+
+static uint16_t KeyMatrix_Timer0Counter(void)
+{
+    uint8_t th;
+    uint16_t counter;
+    do
+    {
+        th = TH0;
+        counter = (uint16_t)th << 8 | TL0;
+    } while (th != TH0);
+    return counter;
+}
+
+static void KeyMatrix_Push(uint8_t key, uint8_t type)
+{
+    uint8_t head = km_head;
+    if (((head + 1) & (KEYMATRIX_QUEUE_SIZE - 1)) == km_tail)
+    {
+        km_overruns++;
+        return;
+    }
+    km_queue[head].key = key;
+    km_queue[head].type = type;
+    km_head = (head + 1) & (KEYMATRIX_QUEUE_SIZE - 1);
+}
+
+void KeyMatrix_Init(void)
+{
+    uint8_t i;
+    // Columns are read through their pull-ups, rows are released
+    PINS_SET(KEYMATRIX_COL_PINS);
+    PINS_SET(KEYMATRIX_ROW_PINS);
+    for (i = 0; i < KEYMATRIX_ROWS; i++)
+    {
+        km_state[i] = 0x00;
+        km_ct0[i] = 0xFF;
+        km_ct1[i] = 0xFF;
+    }
+    km_head = 0;
+    km_tail = 0;
+    km_overruns = 0;
+    km_max_cost = 0;
+    km_row = 0;
+    PINS_CLR(GPIO_PINS(KEYMATRIX_ROW_PORT, 0x01 << KEYMATRIX_ROW_SHIFT));
+}
+
+void KeyMatrix_TickHandler(void)
+{
+    km_start = KEYMATRIX_COST_COUNTER();
+    // Sample the row driven since last tick, pressed keys read low
+    km_sample = ~(PINS_READ(KEYMATRIX_COL_PINS) >> KEYMATRIX_COL_SHIFT) & KEYMATRIX_COL_MASK;
+    km_r = km_row;
+    km_row = (km_r == KEYMATRIX_ROWS - 1)? 0 : km_r + 1;
+    PINS_SET(KEYMATRIX_ROW_PINS);
+    PINS_CLR(GPIO_PINS(KEYMATRIX_ROW_PORT, 0x01 << (km_row + KEYMATRIX_ROW_SHIFT)));
+
+    // Counters of keys equal to the debounced state are reset to 3, others count
+    // down and the key toggles when its counter rolls over
+    km_toggle = km_state[km_r] ^ km_sample;
+    km_ct0[km_r] = ~(km_ct0[km_r] & km_toggle);
+    km_ct1[km_r] = km_ct0[km_r] ^ (km_ct1[km_r] & km_toggle);
+    km_toggle &= km_ct0[km_r] & km_ct1[km_r];
+    km_state[km_r] ^= km_toggle;
+
+    // At most KEYMATRIX_COLS keys per tick
+    km_sample = km_state[km_r] | km_toggle;
+    km_key = km_r * KEYMATRIX_COLS;
+    for (km_mask = 0x01; km_sample != 0; km_mask <<= 1, km_key++)
+    {
+        if (!(km_sample & km_mask))
+        {
+            continue;
+        }
+        km_sample &= ~km_mask;
+        if (km_toggle & km_mask)
+        {
+            km_hold[km_key] = 0;
+            KeyMatrix_Push(km_key, (km_state[km_r] & km_mask)? KeyMatrix_Event_Down : KeyMatrix_Event_Up);
+        }
+        else if (++km_hold[km_key] == KEYMATRIX_HOLD_SCANS)
+        {
+            KeyMatrix_Push(km_key, KeyMatrix_Event_Hold);
+        }
+        else if (km_hold[km_key] == KEYMATRIX_HOLD_SCANS + KEYMATRIX_REPEAT_SCANS)
+        {
+            km_hold[km_key] = KEYMATRIX_HOLD_SCANS;
+            KeyMatrix_Push(km_key, KeyMatrix_Event_Repeat);
+        }
+    }
+
+    km_start = KEYMATRIX_COST_COUNTER() - km_start;
+    if (km_start > km_max_cost)
+    {
+        km_max_cost = km_start;
+    }
+}
+
+HAL_StatusTypeDef KeyMatrix_Read(KeyMatrix_KeyEvent_t *event)
+{
+    uint8_t tail = km_tail;
+    if (tail == km_head)
+    {
+        return HAL_ERROR;
+    }
+    event->key = km_queue[tail].key;
+    event->type = km_queue[tail].type;
+    km_tail = (tail + 1) & (KEYMATRIX_QUEUE_SIZE - 1);
+    return HAL_OK;
+}
+
+uint16_t KeyMatrix_GetOverruns(void)
+{
+    uint16_t overruns;
+    uint8_t ea = EA;
+    EA = 0;
+    overruns = km_overruns;
+    EA = ea;
+    return overruns;
+}
+
+uint8_t KeyMatrix_GetRow(uint8_t row)
+{
+    return km_state[row];
+}
+
+uint8_t KeyMatrix_IsPressed(uint8_t key)
+{
+    return (km_state[key / KEYMATRIX_COLS] >> (key % KEYMATRIX_COLS)) & 0x01;
+}
+
+uint16_t KeyMatrix_GetMaxCost(void)
+{
+    uint16_t cost;
+    uint8_t ea = EA;
+    EA = 0;
+    cost = km_max_cost;
+    EA = ea;
+    return cost;
+}
@@ -0,0 +1,107 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef __FW_KEYMATRIX__
+#define __FW_KEYMATRIX__
+
+#include "fw_hal.h"
+
+/**
+ * Key matrix scanned from a timer interrupt
+ *
+ * One row per tick: the handler reads the columns of the row driven low in the
+ * previous tick, so the lines have a whole tick to settle, then drives the next
+ * row. Each key is debounced by a 2-bit counter, the counters of a row are kept
+ * vertically in two bytes so 8 keys are filtered by a few logic operations, a key
+ * changes after 4 equal samples, i.e. 4 x ROWS ticks.
+ *
+ * Every key has its own state, any number of keys can be down at the same time
+ * (N-key rollover), this needs a diode on each key to avoid ghosting.
+ * Events: Down and Up on debounced changes, Hold after KEYMATRIX_HOLD_SCANS scans
+ * of the row, then Repeat every KEYMATRIX_REPEAT_SCANS scans.
+ *
+ * Rows and columns are consecutive pins, on the same port or on two ports, set them
+ * to quasi-bidirectional or open-drain with pull-ups.
+*/
+
+#ifndef KEYMATRIX_ROWS
+#define KEYMATRIX_ROWS          4
+#define KEYMATRIX_ROW_PORT      0
+#define KEYMATRIX_ROW_SHIFT     4
+#endif
+#ifndef KEYMATRIX_COLS
+#define KEYMATRIX_COLS          4
+#define KEYMATRIX_COL_PORT      0
+#define KEYMATRIX_COL_SHIFT     0
+#endif
+
+#ifndef KEYMATRIX_HOLD_SCANS
+#define KEYMATRIX_HOLD_SCANS    125
+#define KEYMATRIX_REPEAT_SCANS  25
+#endif
+
+#define KEYMATRIX_QUEUE_SIZE    16
+#define KEYMATRIX_KEYS          (KEYMATRIX_ROWS * KEYMATRIX_COLS)
+
+/**
+ * Counter of the timer calling KeyMatrix_TickHandler(), scan cost is measured in its clocks.
+ * Timer0 by default, read again until TH0 is stable so a TL0 rollover can't skew it
+*/
+#ifndef KEYMATRIX_COST_COUNTER
+#define KEYMATRIX_COST_COUNTER()    KeyMatrix_Timer0Counter()
+#endif
+
+#define KEYMATRIX_ROW_PINS      GPIO_PINS(KEYMATRIX_ROW_PORT, ((0x01 << KEYMATRIX_ROWS) - 1) << KEYMATRIX_ROW_SHIFT)
+#define KEYMATRIX_COL_PINS      GPIO_PINS(KEYMATRIX_COL_PORT, ((0x01 << KEYMATRIX_COLS) - 1) << KEYMATRIX_COL_SHIFT)
+
+typedef enum
+{
+    KeyMatrix_Event_Down    = 0x00,
+    KeyMatrix_Event_Up      = 0x01,
+    KeyMatrix_Event_Hold    = 0x02,
+    KeyMatrix_Event_Repeat  = 0x03,
+} KeyMatrix_Event_t;
+
+typedef struct
+{
+    uint8_t key;        // row * KEYMATRIX_COLS + column
+    uint8_t type;       // KeyMatrix_Event_t
+} KeyMatrix_KeyEvent_t;
+
+/**
+ * Release all rows and clear states, then call KeyMatrix_TickHandler() from a timer
+ * interrupt, e.g. every 1ms
+*/
+void KeyMatrix_Init(void);
+void KeyMatrix_TickHandler(void);
+/**
+ * Take one event from the queue, returns HAL_ERROR if it is empty
+*/
+HAL_StatusTypeDef KeyMatrix_Read(KeyMatrix_KeyEvent_t *event);
+/**
+ * Events dropped because the queue was full
+*/
+uint16_t KeyMatrix_GetOverruns(void);
+/**
+ * Debounced states of one row, bit n for column n, 1:pressed
+*/
+uint8_t KeyMatrix_GetRow(uint8_t row);
+uint8_t KeyMatrix_IsPressed(uint8_t key);
+/**
+ * Longest tick handler run in counter clocks, SYSCLK cycles for a 1T timer
+*/
+uint16_t KeyMatrix_GetMaxCost(void);
+
+#endif
@@ -0,0 +1,76 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/***
+ * Demo: 4x4 key matrix, prints events over UART1
+ * 
+ *   P0.4 - P0.7: rows, P0.0 - P0.3: columns, see keymatrix.h
+ *   P3.0(RXD) -> USB-TTL TXD
+ *   P3.1(TXD) -> USB-TTL RXD
+ * 
+ * Output is key number and event, D:down, U:up, H:hold, R:repeat. The longest
+ * scan tick in SYSCLK cycles is printed every second
+ */
+
+#include "fw_hal.h"
+#include "keymatrix.h"
+
+static __CODE char event_chars[4] = {'D', 'U', 'H', 'R'};
+static volatile uint16_t ms;
+
+INTERRUPT(Timer0_Routine, EXTI_VectTimer0)
+{
+    KeyMatrix_TickHandler();
+    ms++;
+}
+
+int main(void)
+{
+    KeyMatrix_KeyEvent_t event;
+    uint16_t cost;
+
+    SYS_SetClock();
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+    GPIO_P0_SetMode(GPIO_Pin_All, GPIO_Mode_InOut_QBD);
+
+    KeyMatrix_Init();
+    // 1T Timer0, scan cost is counted in SYSCLK cycles
+    TIM_Timer0_Config(HAL_State_ON, TIM_TimerMode_16BitAuto, 1000);
+    EXTI_Timer0_SetIntState(HAL_State_ON);
+    EXTI_Global_SetIntState(HAL_State_ON);
+    TIM_Timer0_SetRunState(HAL_State_ON);
+
+    while(1)
+    {
+        if (KeyMatrix_Read(&event) == HAL_OK)
+        {
+            UART1_TxHex(event.key);
+            UART1_TxChar(' ');
+            UART1_TxChar(event_chars[event.type]);
+            UART1_TxString("\r\n");
+        }
+        if (ms >= 1000)
+        {
+            EA = 0;
+            ms = 0;
+            EA = 1;
+            cost = KeyMatrix_GetMaxCost();
+            UART1_TxString("cost ");
+            UART1_TxHex(cost >> 8);
+            UART1_TxHex(cost & 0xFF);
+            UART1_TxString("\r\n");
+        }
+    }
+}
@@ -15,25 +15,15 @@
 /**
  * USB Keyboard Demo
  * 
- * P0:   8 bits for 4x4 Key matrix
+ * P0:   8 bits for 4x4 Key matrix, see keymatrix.h
  * P6.0: NumLock
  * P6.1: CapsLock
 */
 
 #include "fw_hal.h"
+#include "keymatrix.h"
 #include <string.h>
 
-#define KeyIO P0
-
-__BIT B_1ms;         // 1ms flag
-__BIT KeyChangeTemp;
-__BIT KeyChangeFlag;
-uint16_t cnt50ms;
-uint16_t KeyCode;       // code of key pressed
-uint16_t OldKeyCode;    // for key status changing check
-uint16_t NewKeyCode;    // new key status
-uint16_t KeyHoldTime;
-
 __CODE uint8_t DEVICEDESC[18];
 __CODE uint8_t CONFIGDESC[41];
 __CODE uint8_t HIDREPORTDESC[63];
@@ -48,19 +38,22 @@ USB_Request_t usb_request;
 USB_EP0_Stage_t usb_ep0_stage;
 
 void USB_Init(void);
-void KeyScan(void);
 void SendKeyStatus(void);
 
 void main()
 {
     uint8_t i;
+    KeyMatrix_KeyEvent_t event;
 
+    GPIO_P0_SetMode(GPIO_Pin_All, GPIO_Mode_InOut_QBD);
     GPIO_P1_SetMode(GPIO_Pin_All, GPIO_Mode_InOut_QBD);
     GPIO_P3_SetMode(GPIO_Pin_0 | GPIO_Pin_1, GPIO_Mode_Input_HIP);
     GPIO_P6_SetMode(GPIO_Pin_All, GPIO_Mode_Output_PP);
 
     USB_Init();
+    KeyMatrix_Init();
 
+    // One row per 1ms, keys are debounced in 16ms
     TIM_Timer0_Config(HAL_State_ON, TIM_TimerMode_16BitAuto, 1000);
     EXTI_Timer0_SetIntState(HAL_State_ON);
     EXTI_Timer0_SetIntPriority(EXTI_IntPriority_High);
@@ -74,19 +67,10 @@ void main()
 
     while (1)
     {
-        if (B_1ms) // every 1 ms
+        if (KeyMatrix_Read(&event) == HAL_OK
+            && (event.type == KeyMatrix_Event_Down || event.type == KeyMatrix_Event_Up))
         {
-            B_1ms = 0;
-            if (++cnt50ms >= 50) // scan every 50 ms
-            {
-                cnt50ms = 0;
-                KeyScan();
-            }
-            if (KeyChangeFlag) // if key status changed
-            {
-                KeyChangeFlag = 0;
-                SendKeyStatus();
-            }
+            SendKeyStatus();
         }
     }
 }
@@ -355,79 +339,44 @@ INTERRUPT(USB_Routine, EXTI_VectUSB)
     }
 }
 
-uint8_t KeyCount(uint16_t dat)
-{
-    uint8_t i;
-
-    i = 0;
-    while (dat)
-    {
-        if (dat & 0x8000) i++;
-        dat <<= 1;
-    }
-    return i;
-}
-
 //HidInput first byte for special keys，second byte is reserved，the reset 6 bytes for normal keys
 void SendKeyStatus(void)
 {
-    uint8_t i,n;
-    
-    if(KeyCode) // if key pressed
+    uint8_t i, n;
+
+    HidInput[0] = 0;
+    n = 2;
+    for (i = 0; i < KEYMATRIX_KEYS; i++)
     {
-        // allow 3 keys pressed simultaneously
-        if(KeyCount(KeyCode) > 3) 
+        if (!KeyMatrix_IsPressed(i))
+        {
+            continue;
+        }
+        if (i == 1) // left Ctrl
+        {
+            HidInput[0] |= 1;
+        }
+        else if (i == 2) // left alt
+        {
+            HidInput[0] |= 1 << 2;
+        }
+        else if (n < 8)
         {
-            return;  // too many keys
+            HidInput[n++] = KeyMap[i];
         }
         else
         {
-            n = 2;
-            for (i = 0; i < 16; i++)
+            // more than 6 keys, report ErrorRollOver in all slots
+            for (n = 2; n < 8; n++)
             {
-                if (i == 1)
-                {
-                    if (KeyCode & (1 << i)) // left Ctrl
-                    {
-                        HidInput[0] |= 1;
-                    }
-                    else
-                    {
-                        HidInput[0] &= ~1;
-                    }
-                }
-                else if (i == 2)
-                {
-                    if (KeyCode & (1 << i)) // left alt
-                    {
-                        HidInput[0] |= 1 << 2;
-                    }
-                    else
-                    {
-                        HidInput[0] &= ~(1 << 2);
-                    }
-                }
-                else
-                {
-                    if (KeyCode & (1 << i))
-                    {
-                        HidInput[n++] = KeyMap[i];
-                    }
-                }
-            }
-
-            for(; n<8; n++)
-            {
-                HidInput[n]=0;  // fill 0 to the rest
+                HidInput[n] = 0x01;
             }
+            break;
         }
     }
-    else // if no key pressed, return 0
+    for (; n < 8; n++)
     {
-        for (i = 0; i < 8; i++)
-        {
-            HidInput[i] = 0;
-        }
+        HidInput[n] = 0;  // fill 0 to the rest
     }
 
     // return 8 bytes data
@@ -441,11 +390,11 @@ void SendKeyStatus(void)
 
 INTERRUPT(Timer0_Routine, EXTI_VectTimer0)
 {
-    B_1ms = 1;
+    KeyMatrix_TickHandler();
 }
 
 /*****************************************************
-    Key Matrix Scan
+    Key Matrix
 
      Y   P04      P05      P06      P07
           |        |        |        |
@@ -458,69 +407,9 @@ P02 ---- K08 ---- K09 ---- K10 ---- K11 ----
           |        |        |        |
 P03 ---- K12 ---- K13 ---- K14 ---- K15 ----
           |        |        |        |
-******************************************************/
-
-void KeyScan(void)
-{
-    uint8_t temp;
 
-    KeyIO = 0x0F;
-    SYS_DelayUs(1);
-    if ((KeyIO & 0x0F) == 0x0F) // no key pressed
-    {
-        NewKeyCode = 0;
-    }
-    else // start scan
-    {
-        // scan first line
-        KeyIO = (uint8_t)~0x10;
-        SYS_DelayUs(1);
-        // save 4 keys status
-        temp = KeyIO & 0x0F;
-
-        // second line
-        KeyIO = (uint8_t)~0x20;
-        SYS_DelayUs(1);
-        temp |= KeyIO << 4;
-
-        // save current key status
-        NewKeyCode = (~temp) & 0xFF;
-
-        // third line
-        KeyIO = (uint8_t)~0x40;
-        SYS_DelayUs(1);
-        temp = KeyIO & 0x0F;
-
-        // 4th line
-        KeyIO = (uint8_t)~0x80;
-        SYS_DelayUs(1);
-        temp |= KeyIO << 4;
-
-        // save all 16 keys' status in 2 bytes, 1 indicates key pressed
-        NewKeyCode |= (((uint16_t)~temp) << 8);
-    }
-
-    if (NewKeyCode != OldKeyCode)
-    {
-        KeyHoldTime = 0;
-        OldKeyCode = NewKeyCode;
-        KeyChangeTemp = 1;
-    }
-    else
-    {
-        KeyHoldTime++;
-        if (KeyHoldTime >= 1)
-        {
-            KeyHoldTime = 1;
-            KeyCode = OldKeyCode;
-            if (KeyChangeTemp)
-            {
-                KeyChangeTemp = 0;
-                KeyChangeFlag = 1; // Set send flag
-            }
-        }
-    }
-}
+    Rows P04 - P07 are driven low in turn, columns P00 - P03 are read
+******************************************************/
 
 __CODE uint8_t DEVICEDESC[18] =
 {
@@ -0,0 +1,68 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/***
+ * Demo:  STC8G1K08A LED Blink with Pin Descriptors
+ * 
+ *   Pin connection:
+ * 
+ *                   ___
+ *            P5.4 -|   |- P3.3  <-- LED --> 4.7KR -> GND
+ *   3.3V ->   VCC -|   |- P3.2  <-- LED --> 4.7KR -> GND
+ *   KEY -> P5.5 -|   |- TX
+ *    GND ->   GND -|___|- RX   
+ * 
+ *   KEY connects P5.5 to GND, the LEDs blink alternately and stop while it is pressed
+ * 
+ * test-board: Minimum System; test-MCU: STC8G1K08A
+ */
+
+#include "fw_hal.h"
+
+/* Pinout lives in the defines only, the code below doesn't change if LEDs move */
+#define LED_A_PIN       GPIO_PIN(3, 2)
+#define LED_B_PIN       GPIO_PIN(3, 3)
+#define KEY_PIN         GPIO_PIN(5, 5)
+#define LED_PINS        GPIO_PINS(3, PIN_MASK(LED_A_PIN) | PIN_MASK(LED_B_PIN))
+
+void GPIO_Init(void)
+{
+    PINS_SetMode(LED_PINS, GPIO_Mode_Output_PP);
+    PIN_SetMode(KEY_PIN, GPIO_Mode_Input_HIP);
+    PIN_SetPullUp(KEY_PIN, HAL_State_ON);
+}
+
+int main(void)
+{
+    GPIO_Init();
+    /* One ANL/ORL on P3 for both LEDs */
+    PINS_WRITE(LED_PINS, PIN_MASK(LED_A_PIN));
+
+    while(1)
+    {
+        SYS_Delay(500);
+        if (PIN_READ(KEY_PIN))
+        {
+            /* One XRL on P3, both LEDs change in the same cycle */
+            PINS_TOGGLE(LED_PINS);
+        }
+        else
+        {
+            /* SETB/CLR on the bits */
+            PIN_CLR(LED_A_PIN);
+            PIN_CLR(LED_B_PIN);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/***
+ * Demo: 1-Wire ROM search in background
+ * 
+ *   P3.5  -> DQ of 1-Wire devices, e.g. DS18B20
+ *   P3.0(RXD) -> USB-TTL TXD
+ *   P3.1(TXD) -> USB-TTL RXD
+ * 
+ * Lists the ROM of each device on the bus and the number of main loop rounds
+ * run while the search was in progress
+ */
+
+#include "fw_hal.h"
+
+INTERRUPT(Timer0_Routine, EXTI_VectTimer0)
+{
+    OW_IRQHandler();
+}
+
+int main(void)
+{
+    uint8_t rom[8], i;
+    uint16_t rounds;
+
+    SYS_SetClock();
+    // UART1, baud 115200, baud source Timer1, 1T mode, no interrupt
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+    OW_Init();
+    EXTI_Global_SetIntState(HAL_State_ON);
+
+    while(1)
+    {
+        OW_Search_Reset();
+        while (OW_Search(OW_CMD_SEARCHROM, rom) == HAL_OK)
+        {
+            rounds = 0;
+            while (OW_IsBusy())
+            {
+                // CPU is free between slots
+                rounds++;
+            }
+            if (OW_GetStatus() != HAL_OK)
+            {
+                UART1_TxString("no device\r\n");
+                break;
+            }
+            for (i = 0; i < 8; i++)
+            {
+                UART1_TxHex(rom[i]);
+            }
+            UART1_TxChar(' ');
+            UART1_TxHex(rounds >> 8);
+            UART1_TxHex(rounds & 0xFF);
+            UART1_TxString("\r\n");
+        }
+        UART1_TxString("\r\n");
+        SYS_Delay(1000);
+    }
+}
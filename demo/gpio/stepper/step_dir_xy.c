@@ -0,0 +1,69 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***
+ * Demo: Two axes with STEP/DIR drivers (A4988, DRV8825, TMC2208), synchronized moves
+ *
+ *    MCU        Driver X     Driver Y
+ *    P10     => STEP
+ *    P11     => DIR
+ *    P12                  => STEP
+ *    P13                  => DIR
+ *
+ * Both axes start and stop together on every move, the longer axis runs the
+ * trapezoid profile at up to 8000 steps/s. Positions are printed after each move.
+ */
+
+#include "fw_hal.h"
+#include "stepper.h"
+#include <stdio.h>
+
+INTERRUPT(Timer0_Routine, EXTI_VectTimer0)
+{
+    Stepper_IRQHandler();
+}
+
+__CODE int32_t path[][2] = {
+    {3200, 0}, {3200, 1600}, {0, 3200}, {-1600, 800}, {0, 0},
+};
+
+void main(void)
+{
+    uint8_t i;
+    int32_t target[2];
+
+    SYS_SetClock();
+    // UART1, baud 115200 with Timer1, 1T mode, no interrupt
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+    GPIO_P1_SetMode(GPIO_Pin_0|GPIO_Pin_1|GPIO_Pin_2|GPIO_Pin_3, GPIO_Mode_Output_PP);
+    Stepper_Init();
+    Stepper_ConfigAxis(0, Stepper_Drive_StepDir, 1, 0);
+    Stepper_ConfigAxis(1, Stepper_Drive_StepDir, 1, 2);
+    Stepper_SetProfile(Stepper_Profile_Trapezoid, 8000, 20000);
+    EXTI_Timer0_SetIntPriority(EXTI_IntPriority_Highest);
+    EXTI_Global_SetIntState(HAL_State_ON);
+
+    while(1)
+    {
+        for (i = 0; i < sizeof(path) / sizeof(path[0]); i++)
+        {
+            target[0] = path[i][0];
+            target[1] = path[i][1];
+            Stepper_MoveTo(target);
+            while (Stepper_IsBusy());
+            printf("X:%ld Y:%ld\r\n", Stepper_GetPosition(0), Stepper_GetPosition(1));
+            SYS_Delay(200);
+        }
+    }
+}
@@ -0,0 +1,434 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "stepper.h"
+
+#define STEPPER_RAMP_ACCEL      0x00
+#define STEPPER_RAMP_RUN        0x01
+#define STEPPER_RAMP_DECEL      0x02
+// Longest interval in 24.8 fixed-point
+#define STEPPER_C_MAX           0xFFFF00UL
+
+/**
+ * Half-step coil table, full steps use the even entries with two coils on
+*/
+static __CODE uint8_t stepper_coils[8] = {0x09, 0x01, 0x03, 0x02, 0x06, 0x04, 0x0C, 0x08};
+
+/**
+ * S-curve velocity in Q15 over the ramp distance in 64 segments
+*/
+static __CODE uint16_t stepper_scurve[65] = {
+        0,  3381,  5367,  7033,  8520,  9887, 11165, 12373,
+    13525, 14630, 15694, 16720, 17671, 18547, 19360, 20118,
+    20828, 21495, 22124, 22718, 23281, 23816, 24324, 24807,
+    25267, 25706, 26124, 26524, 26906, 27270, 27619, 27952,
+    28270, 28574, 28864, 29141, 29406, 29658, 29899, 30128,
+    30346, 30553, 30750, 30936, 31113, 31279, 31436, 31584,
+    31722, 31851, 31971, 32082, 32185, 32279, 32365, 32442,
+    32511, 32571, 32624, 32668, 32704, 32732, 32752, 32764,
+    32768,
+};
+
+static __XDATA uint8_t stepper_drive[STEPPER_AXES], stepper_port[STEPPER_AXES], stepper_pin[STEPPER_AXES];
+static __XDATA uint8_t stepper_phase[STEPPER_AXES];
+static __XDATA int32_t stepper_position[STEPPER_AXES];
+static __XDATA uint32_t stepper_delta[STEPPER_AXES], stepper_error[STEPPER_AXES];
+
+static Stepper_Profile_t stepper_profile;
+static uint16_t stepper_speed = 100, stepper_accel = 100;
+// Planned move
+static uint32_t stepper_c0, stepper_cmin, stepper_inc;
+// Running move, c is the interval of the step after next
+static volatile uint8_t stepper_busy;
+static uint8_t stepper_ramp, stepper_mask, stepper_dir;
+static uint32_t stepper_c, stepper_n, stepper_total, stepper_done;
+
+static void Stepper_WritePort(uint8_t port, uint8_t mask, uint8_t value)
+{
+    switch (port)
+    {
+    case 0:
+        P0 = P0 & ~mask | value;
+        break;
+    case 1:
+        P1 = P1 & ~mask | value;
+        break;
+    case 2:
+        P2 = P2 & ~mask | value;
+        break;
+    case 3:
+        P3 = P3 & ~mask | value;
+        break;
+    case 4:
+        P4 = P4 & ~mask | value;
+        break;
+    case 5:
+        P5 = P5 & ~mask | value;
+        break;
+    case 6:
+        P6 = P6 & ~mask | value;
+        break;
+    default:
+        P7 = P7 & ~mask | value;
+        break;
+    }
+}
+
+static uint16_t Stepper_Sqrt(uint32_t value)
+{
+    uint32_t root = 0, bit = 0x40000000UL;
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t)root;
+}
+
+/**
+ * Interval of ramp step n on the S-curve, clamped to c0
+*/
+static uint32_t Stepper_SCurve(uint32_t n)
+{
+    uint32_t x = n * stepper_inc, c;
+    uint8_t i, frac;
+    uint16_t v;
+    if (x >= (64UL << 16))
+    {
+        return stepper_cmin;
+    }
+    i = x >> 16;
+    frac = (x >> 8) & 0xFF;
+    v = stepper_scurve[i] + (((uint32_t)(stepper_scurve[i + 1] - stepper_scurve[i]) * frac) >> 8);
+    if (v == 0)
+    {
+        return stepper_c0;
+    }
+    // cmin * 32768 / v in whole ticks, cmin is below 2^24
+    c = (stepper_cmin << 7) / v;
+    return (c >= (stepper_c0 >> 8))? stepper_c0 : c << 8;
+}
+
+/**
+ * Interval of the step after next, g is the number of intervals left after that step
+*/
+static void Stepper_NextInterval(uint32_t g)
+{
+    uint16_t reload;
+    if (stepper_ramp != STEPPER_RAMP_DECEL && g <= stepper_n)
+    {
+        stepper_ramp = STEPPER_RAMP_DECEL;
+    }
+    if (stepper_ramp == STEPPER_RAMP_ACCEL)
+    {
+        stepper_n++;
+        if (stepper_profile == Stepper_Profile_Trapezoid)
+        {
+            stepper_c -= (stepper_c << 1) / ((stepper_n << 2) + 1);
+        }
+        else
+        {
+            stepper_c = Stepper_SCurve(stepper_n);
+        }
+        if (stepper_c <= stepper_cmin)
+        {
+            stepper_c = stepper_cmin;
+            stepper_ramp = STEPPER_RAMP_RUN;
+        }
+    }
+    else if (stepper_ramp == STEPPER_RAMP_DECEL)
+    {
+        if (stepper_profile == Stepper_Profile_Trapezoid)
+        {
+            stepper_c += (stepper_c << 1) / ((g << 2) - 1);
+        }
+        else
+        {
+            stepper_c = Stepper_SCurve(g - 1);
+        }
+        if (stepper_c > STEPPER_C_MAX)
+        {
+            stepper_c = STEPPER_C_MAX;
+        }
+    }
+    reload = 0x10000UL - (stepper_c >> 8);
+    TH0 = reload >> 8;
+    TL0 = reload & 0xFF;
+}
+
+/**
+ * Bresenham, the axis with the most steps steps every time
+*/
+static uint8_t Stepper_NextMask(void)
+{
+    uint8_t i, mask = 0;
+    for (i = 0; i < STEPPER_AXES; i++)
+    {
+        stepper_error[i] += stepper_delta[i];
+        if (stepper_error[i] >= stepper_total)
+        {
+            stepper_error[i] -= stepper_total;
+            mask |= 0x01 << i;
+        }
+    }
+    return mask;
+}
+
+void Stepper_Init(void)
+{
+    TIM_Timer0_SetRunState(HAL_State_OFF);
+    TIM_Timer0_Set1TMode(HAL_State_OFF);
+    TIM_Timer0_SetFuncTimer;
+    TIM_Timer0_SetMode(TIM_TimerMode_16BitAuto);
+    EXTI_Timer0_SetIntState(HAL_State_ON);
+    stepper_busy = 0;
+}
+
+void Stepper_ConfigAxis(uint8_t axis, Stepper_Drive_t drive, uint8_t port, uint8_t pin)
+{
+    stepper_drive[axis] = drive;
+    stepper_port[axis] = port;
+    stepper_pin[axis] = pin;
+    stepper_phase[axis] = 0;
+    stepper_position[axis] = 0;
+    if (drive == Stepper_Drive_StepDir)
+    {
+        Stepper_WritePort(port, 0x03 << pin, 0x00);
+    }
+    else
+    {
+        Stepper_WritePort(port, 0x0F << pin, 0x00);
+    }
+}
+
+void Stepper_SetProfile(Stepper_Profile_t profile, uint16_t speed, uint16_t accel)
+{
+    stepper_profile = profile;
+    stepper_speed = (speed == 0)? 1 : speed;
+    stepper_accel = (accel == 0)? 1 : accel;
+}
+
+HAL_StatusTypeDef Stepper_MoveTo(int32_t *targets)
+{
+    uint8_t i;
+    uint32_t ramp;
+    uint16_t reload;
+    if (stepper_busy)
+    {
+        return HAL_BUSY;
+    }
+    stepper_total = 0;
+    stepper_dir = 0;
+    for (i = 0; i < STEPPER_AXES; i++)
+    {
+        if (targets[i] < stepper_position[i])
+        {
+            stepper_delta[i] = stepper_position[i] - targets[i];
+            stepper_dir |= 0x01 << i;
+        }
+        else
+        {
+            stepper_delta[i] = targets[i] - stepper_position[i];
+        }
+        if (stepper_delta[i] > stepper_total)
+        {
+            stepper_total = stepper_delta[i];
+        }
+        if (stepper_drive[i] == Stepper_Drive_StepDir)
+        {
+            Stepper_WritePort(stepper_port[i], 0x02 << stepper_pin[i],
+                (stepper_dir & (0x01 << i))? 0x02 << stepper_pin[i] : 0x00);
+        }
+    }
+    if (stepper_total == 0)
+    {
+        return HAL_OK;
+    }
+    for (i = 0; i < STEPPER_AXES; i++)
+    {
+        stepper_error[i] = stepper_total >> 1;
+    }
+
+    // c0 = 0.676 * f * sqrt(2/a) = f * 0.956 / sqrt(a), 244.7 = 0.956 * 256
+    stepper_c0 = (STEPPER_TICK_FREQ * 245UL) / Stepper_Sqrt((uint32_t)stepper_accel << 8) << 4;
+    stepper_cmin = (STEPPER_TICK_FREQ << 8) / stepper_speed;
+    if (stepper_c0 > STEPPER_C_MAX)
+    {
+        stepper_c0 = STEPPER_C_MAX;
+    }
+    if (stepper_cmin > STEPPER_C_MAX)
+    {
+        stepper_cmin = STEPPER_C_MAX;
+    }
+    // Ramp length v^2/2a, the S-curve table is indexed by n * inc >> 16
+    ramp = ((uint32_t)stepper_speed * stepper_speed) / ((uint32_t)stepper_accel << 1);
+    stepper_inc = (64UL << 16) / ((ramp == 0)? 1 : ramp);
+
+    stepper_n = 0;
+    stepper_done = 0;
+    stepper_c = stepper_c0;
+    stepper_ramp = STEPPER_RAMP_ACCEL;
+    if (stepper_c <= stepper_cmin)
+    {
+        stepper_c = stepper_cmin;
+        stepper_ramp = STEPPER_RAMP_RUN;
+    }
+    stepper_mask = Stepper_NextMask();
+
+    // First step after 64 ticks, writing to a stopped timer sets both counter and reload,
+    // a running timer takes the new reload value at next overflow
+    TIM_Timer0_SetRunState(HAL_State_OFF);
+    TF0 = 0;
+    stepper_busy = 1;
+    TIM_Timer0_SetInitValue(0xFF, 0xC0);
+    TIM_Timer0_SetRunState(HAL_State_ON);
+    reload = 0x10000UL - (stepper_c >> 8);
+    TH0 = reload >> 8;
+    TL0 = reload & 0xFF;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef Stepper_Move(uint8_t axis, int32_t steps)
+{
+    uint8_t i;
+    int32_t targets[STEPPER_AXES];
+    if (stepper_busy)
+    {
+        return HAL_BUSY;
+    }
+    for (i = 0; i < STEPPER_AXES; i++)
+    {
+        targets[i] = stepper_position[i];
+    }
+    targets[axis] += steps;
+    return Stepper_MoveTo(targets);
+}
+
+void Stepper_Stop(void)
+{
+    uint8_t ea = EA;
+    EA = 0;
+    // Leave as many intervals as the ramp has climbed
+    if (stepper_busy && stepper_total - stepper_done > stepper_n + 1)
+    {
+        stepper_total = stepper_done + stepper_n + 1;
+    }
+    EA = ea;
+}
+
+uint8_t Stepper_IsBusy(void)
+{
+    return stepper_busy;
+}
+
+int32_t Stepper_GetPosition(uint8_t axis)
+{
+    int32_t position;
+    uint8_t ea = EA;
+    EA = 0;
+    position = stepper_position[axis];
+    EA = ea;
+    return position;
+}
+
+void Stepper_SetPosition(uint8_t axis, int32_t position)
+{
+    uint8_t ea = EA;
+    EA = 0;
+    stepper_position[axis] = position;
+    EA = ea;
+}
+
+void Stepper_Release(uint8_t axis)
+{
+    if (!stepper_busy && stepper_drive[axis] != Stepper_Drive_StepDir)
+    {
+        Stepper_WritePort(stepper_port[axis], 0x0F << stepper_pin[axis], 0x00);
+    }
+}
+
+void Stepper_IRQHandler(void)
+{
+    static uint8_t i, mask, step;
+    if (!stepper_busy)
+    {
+        return;
+    }
+    // Output the steps planned in the previous interrupt
+    mask = stepper_mask;
+    for (i = 0; i < STEPPER_AXES; i++)
+    {
+        if (!(mask & (0x01 << i)))
+        {
+            continue;
+        }
+        if (stepper_dir & (0x01 << i))
+        {
+            stepper_position[i]--;
+            step = -1;
+        }
+        else
+        {
+            stepper_position[i]++;
+            step = 1;
+        }
+        switch (stepper_drive[i])
+        {
+        case Stepper_Drive_StepDir:
+            Stepper_WritePort(stepper_port[i], 0x01 << stepper_pin[i], 0x01 << stepper_pin[i]);
+            break;
+        case Stepper_Drive_FullStep:
+            step <<= 1;
+            // no break
+        default:
+            stepper_phase[i] = (stepper_phase[i] + step) & 0x07;
+            Stepper_WritePort(stepper_port[i], 0x0F << stepper_pin[i], stepper_coils[stepper_phase[i]] << stepper_pin[i]);
+            break;
+        }
+    }
+    stepper_done++;
+    if (stepper_done >= stepper_total)
+    {
+        TIM_Timer0_SetRunState(HAL_State_OFF);
+        stepper_busy = 0;
+    }
+    else
+    {
+        stepper_mask = Stepper_NextMask();
+        if (stepper_total - stepper_done > 1)
+        {
+            Stepper_NextInterval(stepper_total - stepper_done - 1);
+        }
+    }
+    // STEP pulse is as long as the calculation above
+    for (i = 0; i < STEPPER_AXES; i++)
+    {
+        if ((mask & (0x01 << i)) && stepper_drive[i] == Stepper_Drive_StepDir)
+        {
+            Stepper_WritePort(stepper_port[i], 0x01 << stepper_pin[i], 0x00);
+        }
+    }
+}
@@ -0,0 +1,93 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __FW_STEPPER__
+#define __FW_STEPPER__
+
+#include "fw_hal.h"
+
+/**
+ * Stepper motors timed by Timer0 interrupt
+ *
+ * Timer0 runs in 12T 16-bit auto-reload mode, one interrupt per step. The interval of
+ * the step after next is written to the reload registers, so step timing does not
+ * depend on interrupt latency. At 24MHz the tick is 0.5us, the slowest speed is
+ * 31 steps/s, intervals of slower speeds are clamped.
+ *
+ * All axes move together: the axis with the most steps follows the speed profile,
+ * the other axes are stepped by Bresenham so they start and arrive at the same time.
+ *
+ * Profiles, speed in steps/s and acceleration in steps/s^2:
+ *   Trapezoid  David Austin's approximation, c[n] = c[n-1] - 2c[n-1]/(4n+1), with
+ *              c[0] = 0.676 * f * sqrt(2/a), 24.8 fixed-point intervals
+ *   S-Curve    Linear acceleration ramp up and down, same ramp length as trapezoid with
+ *              the average acceleration, twice the peak, velocity from a table
+ * One 32-bit division per step during ramps, none at constant speed.
+*/
+
+#ifndef STEPPER_AXES
+#define STEPPER_AXES            2
+#endif
+
+#define STEPPER_TICK_FREQ       (__CONF_FOSC / 12)
+
+typedef enum
+{
+    Stepper_Drive_FullStep  = 0x00,     // ULN2003, two coils on, 4 pins from pin
+    Stepper_Drive_HalfStep  = 0x01,     // ULN2003, 4 pins from pin
+    Stepper_Drive_StepDir   = 0x02,     // STEP on pin, DIR on pin + 1
+} Stepper_Drive_t;
+
+typedef enum
+{
+    Stepper_Profile_Trapezoid   = 0x00,
+    Stepper_Profile_SCurve      = 0x01,
+} Stepper_Profile_t;
+
+/**
+ * Configure Timer0, enable its interrupt, route it with
+ *   INTERRUPT(Timer0_Routine, EXTI_VectTimer0) { Stepper_IRQHandler(); }
+*/
+void Stepper_Init(void);
+/**
+ * @param port: 0 - 7 for P0 - P7
+ * @param pin: lowest pin, ULN2003: 0 - 4, STEP/DIR: 0 - 6
+*/
+void Stepper_ConfigAxis(uint8_t axis, Stepper_Drive_t drive, uint8_t port, uint8_t pin);
+/**
+ * Applied to the next move
+*/
+void Stepper_SetProfile(Stepper_Profile_t profile, uint16_t speed, uint16_t accel);
+/**
+ * Move all axes to targets, returns HAL_BUSY if moving
+*/
+HAL_StatusTypeDef Stepper_MoveTo(int32_t *targets);
+/**
+ * Move one axis by steps relative to its position
+*/
+HAL_StatusTypeDef Stepper_Move(uint8_t axis, int32_t steps);
+/**
+ * Decelerate and stop the current move
+*/
+void Stepper_Stop(void);
+uint8_t Stepper_IsBusy(void);
+int32_t Stepper_GetPosition(uint8_t axis);
+void Stepper_SetPosition(uint8_t axis, int32_t position);
+/**
+ * Turn off the ULN2003 coils of an idle axis
+*/
+void Stepper_Release(uint8_t axis);
+void Stepper_IRQHandler(void);
+
+#endif
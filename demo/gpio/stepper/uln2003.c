@@ -24,22 +24,19 @@
  *                     VCC   =>  5V ~ 12V
  *                     GND   =>  GND
  * 
+ * Half steps timed by Timer0 with S-curve acceleration, 4096 half steps per turn,
+ * 1000 steps/s is about 15 RPM.
+ * 
  * test-board: Minimum System; test-MCU: STC8H1K08,STC8H3K64S2
  */
 
 #include "fw_hal.h"
+#include "stepper.h"
 
-// Clockwise, 8 steps
-uint8_t cw[8]={
-    0B00001001,
-    0B00000001,
-    0B00000011,
-    0B00000010,
-    0B00000110,
-    0B00000100,
-    0B00001100,
-    0B00001000
-};
+INTERRUPT(Timer0_Routine, EXTI_VectTimer0)
+{
+    Stepper_IRQHandler();
+}
 
 void GPIO_Init(void)
 {
@@ -49,32 +46,23 @@ void GPIO_Init(void)
 
 int main(void)
 {
-    uint8_t step;
-    uint16_t pos;
     SYS_SetClock();
     GPIO_Init();
+    Stepper_Init();
+    Stepper_ConfigAxis(0, Stepper_Drive_HalfStep, 1, 0);
+    Stepper_SetProfile(Stepper_Profile_SCurve, 1000, 1500);
+    EXTI_Timer0_SetIntPriority(EXTI_IntPriority_Highest);
+    EXTI_Global_SetIntState(HAL_State_ON);
 
     while(1)
     {
-        for (pos = 0; pos < 640; pos++)
-        {
-            step = 8;
-            while (step--)
-            {
-                P1 = P1 & 0xF0 | cw[7 - step];
-                SYS_Delay(5);
-            }
-        }
+        Stepper_Move(0, 4096);
+        while (Stepper_IsBusy());
+        Stepper_Release(0);
         SYS_Delay(500);
-        for (pos = 0; pos < 640; pos++)
-        {
-            step = 8;
-            while (step--)
-            {
-                P1 = P1 & 0xF0 | cw[step];
-                SYS_Delay(5);
-            }
-        }
+        Stepper_Move(0, -4096);
+        while (Stepper_IsBusy());
+        Stepper_Release(0);
         SYS_Delay(500);
     }
 }
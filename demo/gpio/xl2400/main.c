@@ -39,9 +39,10 @@ uint8_t XL2400_PrintStatus(void);
 
 void GPIO_Init(void)
 {
-    GPIO_P3_SetMode(GPIO_Pin_4, GPIO_Mode_InOut_QBD);
-    // SCLK(P32) CSN(P35)
-    GPIO_P3_SetMode(GPIO_Pin_2|GPIO_Pin_5, GPIO_Mode_Output_PP);
+    // CSN(P35)
+    GPIO_P3_SetMode(GPIO_Pin_5, GPIO_Mode_Output_PP);
+    // SCLK(P32) DATA(P34)
+    SOFTSPI_Init();
 }
 
 int main(void)
@@ -17,63 +17,11 @@
 __IDATA uint8_t cbuf[2], xbuf[XL2400_PL_WIDTH_MAX + 1];
 
 
-/**
- * Emulate SPI Write on GPIO pins
- */
-void XL2400_WriteByte(uint8_t value)
-{
-    uint8_t i = 0;
-    XL2400_CLK_LOW();
-    XL2400_DATA_OUT();
-    for (i = 0; i < 8; i++)
-    {
-        XL2400_CLK_LOW();
-        if (value & 0x80)
-        {
-            XL2400_DATA_HIGH();
-        }
-        else
-        {
-            XL2400_DATA_LOW();
-        }
-        XL2400_CLK_HIGH();
-        value = value << 1;
-    }
-    XL2400_CLK_LOW();
-}
-
-/**
- * Emulate SPI Read on GPIO pins
- */
-uint8_t XL2400_ReadByte(void)
-{
-    uint8_t i = 0, RxData;
-
-    XL2400_DATA_IN();
-    XL2400_CLK_LOW();
-    for (i = 0; i < 8; i++)
-    {
-        RxData = RxData << 1;
-        XL2400_CLK_HIGH();
-        if (XL2400_DATA_READ())
-        {
-            RxData |= 0x01;
-        }
-        else
-        {
-            RxData &= 0xfe;
-        }
-        XL2400_CLK_LOW();
-    }
-    XL2400_CLK_LOW();
-    return RxData;
-}
-
 void XL2400_WriteReg(uint8_t reg,uint8_t value)
 {
     XL2400_NSS_LOW();
-    XL2400_WriteByte(reg);
-    XL2400_WriteByte(value);
+    SOFTSPI_Tx(reg);
+    SOFTSPI_Tx(value);
     XL2400_NSS_HIGH();
 }
 
@@ -81,33 +29,29 @@ uint8_t XL2400_ReadReg(uint8_t reg)
 {
     uint8_t reg_val;
     XL2400_NSS_LOW();
-    XL2400_WriteByte(reg);
-    reg_val = XL2400_ReadByte();
+    SOFTSPI_Tx(reg);
+    SOFTSPI_DataIn();
+    reg_val = SOFTSPI_Rx();
+    SOFTSPI_DataOut();
     XL2400_NSS_HIGH();
     return reg_val;
 }
 
 void XL2400_WriteFromBuf(uint8_t reg, const uint8_t *pBuf, uint8_t len)
 {
-    uint8_t ctr;
     XL2400_NSS_LOW();
-    XL2400_WriteByte(reg);
-    for (ctr = 0; ctr < len; ctr++)
-    {
-        XL2400_WriteByte(*pBuf++);
-    }
+    SOFTSPI_Tx(reg);
+    SOFTSPI_Write(pBuf, len);
     XL2400_NSS_HIGH();
 }
 
 void XL2400_ReadToBuf(uint8_t reg, uint8_t *pBuf, uint8_t len)
 {
-    uint8_t ctr;
     XL2400_NSS_LOW();
-    XL2400_WriteByte(reg);
-    for (ctr = 0; ctr < len; ctr++)
-    {
-        pBuf[ctr] = XL2400_ReadByte();
-    }
+    SOFTSPI_Tx(reg);
+    SOFTSPI_DataIn();
+    SOFTSPI_Read(pBuf, len);
+    SOFTSPI_DataOut();
     XL2400_NSS_HIGH();
 }
 
@@ -19,20 +19,10 @@
 #include "string.h"
 
 #define XL2400_CSN  P35
-#define XL2400_SCK  P32
-#define XL2400_MOSI P34
+// SCK P3.2 and DATA P3.4 are the default SOFTSPI_SCK_PIN and SOFTSPI_MOSI_PIN of fw_softspi
 
 #define XL2400_PLOAD_WIDTH       32   // Payload width
 
-#define XL2400_DATA_OUT()        GPIO_P3_SetMode(GPIO_Pin_4, GPIO_Mode_Output_PP)
-#define XL2400_DATA_IN()         GPIO_P3_SetMode(GPIO_Pin_4, GPIO_Mode_Input_HIP)
-#define XL2400_DATA_LOW()        XL2400_MOSI = 0
-#define XL2400_DATA_HIGH()       XL2400_MOSI = 1
-#define XL2400_DATA_READ()       XL2400_MOSI
-
-#define XL2400_CLK_LOW()         XL2400_SCK = 0
-#define XL2400_CLK_HIGH()        XL2400_SCK = 1
-
 #define XL2400_NSS_LOW()         XL2400_CSN = 0
 #define XL2400_NSS_HIGH()        XL2400_CSN = 1
 
@@ -19,6 +19,8 @@
 
 /* SSD1306 data buffer */
 static __XDATA uint8_t SSD1306_Buffer_all[SSD1306_WIDTH * SSD1306_HEIGHT / 8];
+/* Changed column range of each page, clean when from > to */
+static __XDATA uint8_t SSD1306_DirtyFrom[SSD1306_HEIGHT / 8], SSD1306_DirtyTo[SSD1306_HEIGHT / 8];
 
 /* Private SSD1306 structure */
 typedef struct {
@@ -41,6 +43,43 @@ void SSD1306_WriteData(uint8_t dat)
     I2C_Write(SSD1306_I2C_ADDR, 0x40, &dat, 1);
 }
 
+static void SSD1306_MarkDirty(uint8_t page, uint8_t x)
+{
+    if (x < SSD1306_DirtyFrom[page])
+    {
+        SSD1306_DirtyFrom[page] = x;
+    }
+    if (x > SSD1306_DirtyTo[page])
+    {
+        SSD1306_DirtyTo[page] = x;
+    }
+}
+
+/**
+ * Mark the bytes that differ from dat, before the buffer is filled with it
+*/
+static void SSD1306_MarkFill(uint8_t dat)
+{
+    uint8_t page, x;
+    __XDATA uint8_t *pt = SSD1306_Buffer_all;
+    for (page = 0; page < SSD1306_HEIGHT / 8; page++)
+    {
+        for (x = 0; x < SSD1306_WIDTH; x++)
+        {
+            if (*pt++ != dat)
+            {
+                SSD1306_MarkDirty(page, x);
+            }
+        }
+    }
+}
+
+void SSD1306_Invalidate(void)
+{
+    memset(SSD1306_DirtyFrom, 0, sizeof(SSD1306_DirtyFrom));
+    memset(SSD1306_DirtyTo, SSD1306_WIDTH - 1, sizeof(SSD1306_DirtyTo));
+}
+
 void SSD1306_Init(void)
 {
     SYS_Delay(100);
@@ -147,6 +186,7 @@ void SSD1306_Init(void)
 
     /* Clear screen */
     SSD1306_Fill(SSD1306_COLOR_BLACK);
+    SSD1306_Invalidate();
 
     /* Update screen */
     SSD1306_UpdateScreen();
@@ -161,7 +201,27 @@ void SSD1306_Init(void)
 
 void SSD1306_UpdateScreen(void) 
 {
-    I2C_Write(SSD1306_I2C_ADDR, 0x40, SSD1306_Buffer_all, SSD1306_WIDTH * SSD1306_HEIGHT / 8);
+    uint8_t page, window[6];
+
+    for (page = 0; page < SSD1306_HEIGHT / 8; page++)
+    {
+        if (SSD1306_DirtyFrom[page] > SSD1306_DirtyTo[page])
+        {
+            continue;
+        }
+        /* Column and page address window of the changed span, horizontal addressing mode */
+        window[0] = 0x21;
+        window[1] = SSD1306_DirtyFrom[page];
+        window[2] = SSD1306_DirtyTo[page];
+        window[3] = 0x22;
+        window[4] = page;
+        window[5] = page;
+        I2C_Write(SSD1306_I2C_ADDR, 0x00, window, sizeof(window));
+        I2C_Write(SSD1306_I2C_ADDR, 0x40, SSD1306_Buffer_all + page * SSD1306_WIDTH + window[1],
+            window[2] - window[1] + 1);
+        SSD1306_DirtyFrom[page] = 0xFF;
+        SSD1306_DirtyTo[page] = 0;
+    }
 }
 
 void SSD1306_ToggleInvert(void) 
@@ -176,20 +236,35 @@ void SSD1306_ToggleInvert(void)
     {
         SSD1306_Buffer_all[i] = ~SSD1306_Buffer_all[i];
     }
+    SSD1306_Invalidate();
 }
 
 void SSD1306_Fill(uint8_t color)
 {
+    uint8_t dat;
     if (SSD1306.Inverted)
     {
         color = (uint8_t)!color;
     }
+    dat = (color == SSD1306_COLOR_BLACK) ? 0x00 : 0xFF;
+    SSD1306_MarkFill(dat);
     /* Set memory */
-    memset(SSD1306_Buffer_all, (color == SSD1306_COLOR_BLACK) ? 0x00 : 0xFF, SSD1306_WIDTH * SSD1306_HEIGHT / 8);
+#if (__CONF_MCU_TYPE == 3)
+    /* Fill with CPU if the M2M engine is busy with an async transfer */
+    if (DMA_M2M_Fill(SSD1306_Buffer_all, dat, SSD1306_WIDTH * SSD1306_HEIGHT / 8) != HAL_OK)
+    {
+        memset(SSD1306_Buffer_all, dat, SSD1306_WIDTH * SSD1306_HEIGHT / 8);
+    }
+#else
+    memset(SSD1306_Buffer_all, dat, SSD1306_WIDTH * SSD1306_HEIGHT / 8);
+#endif
 }
 
 void SSD1306_DrawPixel(uint16_t x, uint16_t y, uint8_t color)
 {
+    uint16_t i;
+    uint8_t dat;
+
     if (x >= SSD1306_WIDTH || y >= SSD1306_HEIGHT)
     {
         /* Error */
@@ -203,13 +278,21 @@ void SSD1306_DrawPixel(uint16_t x, uint16_t y, uint8_t color)
     }
 
     /* Set color */
+    i = x + (y / 8) * SSD1306_WIDTH;
+    dat = SSD1306_Buffer_all[i];
     if (color == SSD1306_COLOR_WHITE)
     {
-        SSD1306_Buffer_all[x + (y / 8) * SSD1306_WIDTH] |= 1 << (y % 8);
+        dat |= 1 << (y % 8);
     }
     else
     {
-        SSD1306_Buffer_all[x + (y / 8) * SSD1306_WIDTH] &= ~(1 << (y % 8));
+        dat &= ~(1 << (y % 8));
+    }
+    /* Only a change needs to be sent */
+    if (dat != SSD1306_Buffer_all[i])
+    {
+        SSD1306_Buffer_all[i] = dat;
+        SSD1306_MarkDirty(y / 8, x);
     }
 }
 
@@ -66,10 +66,17 @@ void SSD1306_Init(void);
 
 /** 
  * @brief  Updates buffer from internal RAM to LCD
- * @note   This function must be called each time you do some changes to LCD, to update buffer from RAM to LCD
+ * @note   This function must be called each time you do some changes to LCD, to update buffer from RAM to LCD.
+ *         Only the changed column span of each page is sent.
  */
 void SSD1306_UpdateScreen(void);
 
+/**
+ * @brief  Marks the whole buffer as changed, the next @ref SSD1306_UpdateScreen() sends the full frame
+ * @note   Call after writing to the LCD RAM directly
+ */
+void SSD1306_Invalidate(void);
+
 /**
  * @brief  Toggles pixels invertion inside internal RAM
  * @note   @ref SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
@@ -0,0 +1,158 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ili9341.h"
+
+static __XDATA uint8_t ILI9341_LineBuff[ILI9341_LINE_BUFF_SIZE];
+
+void ILI9341_WriteCommand(uint8_t command)
+{
+    LCM_WriteCmd(command);
+}
+
+void ILI9341_WriteData(uint8_t dat)
+{
+    LCM_WriteData(dat);
+}
+
+void ILI9341_Reset(void)
+{
+    ILI9341_RES = 1;
+    SYS_Delay(5);
+    ILI9341_RES = 0;
+    SYS_Delay(20);
+    ILI9341_RES = 1;
+    SYS_Delay(120);
+}
+
+void ILI9341_Init(void)
+{
+    // 8-bit 8080, setup and hold time 2 clocks
+    LCM_Config(LCM_Mode_I8080, LCM_DataWidth_8Bit, ILI9341_DATA_PORT, ILI9341_CTRL_PORT, 1, 1);
+    ILI9341_CS = 0;
+    ILI9341_Reset();
+
+    ILI9341_WriteCommand(ILI9341_SWRESET);
+    SYS_Delay(120);
+    ILI9341_WriteCommand(ILI9341_SLPOUT);
+    SYS_Delay(120);
+    ILI9341_WriteCommand(ILI9341_COLMOD);
+    ILI9341_WriteData(ILI9341_COLMOD_16BIT);
+    ILI9341_WriteCommand(ILI9341_MADCTL);
+#if (ILI9341_MODEL == ILI9341_MODEL_ST7789)
+    ILI9341_WriteData(0x00);
+    // ST7789 panels are usually in inverted color
+    ILI9341_WriteCommand(ILI9341_INVON);
+#else
+    ILI9341_WriteData(ILI9341_MADCTL_MX | ILI9341_MADCTL_BGR);
+#endif
+    ILI9341_WriteCommand(ILI9341_DISPON);
+    SYS_Delay(20);
+
+    ILI9341_FillRect(0, 0, ILI9341_WIDTH, ILI9341_HEIGHT, ILI9341_COLOR_BLACK);
+    ILI9341_SetBackLight(HAL_State_ON);
+}
+
+void ILI9341_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    ILI9341_WriteCommand(ILI9341_CASET);
+    ILI9341_WriteData(x0 >> 8);
+    ILI9341_WriteData(x0 & 0xFF);
+    ILI9341_WriteData(x1 >> 8);
+    ILI9341_WriteData(x1 & 0xFF);
+    ILI9341_WriteCommand(ILI9341_RASET);
+    ILI9341_WriteData(y0 >> 8);
+    ILI9341_WriteData(y0 & 0xFF);
+    ILI9341_WriteData(y1 >> 8);
+    ILI9341_WriteData(y1 & 0xFF);
+    ILI9341_WriteCommand(ILI9341_RAMWR);
+}
+
+void ILI9341_DrawPixel(uint16_t x, uint16_t y, uint16_t color)
+{
+    if (x >= ILI9341_WIDTH || y >= ILI9341_HEIGHT)
+    {
+        return;
+    }
+    ILI9341_SetWindow(x, y, x, y);
+    ILI9341_WriteData(color >> 8);
+    ILI9341_WriteData(color & 0xFF);
+}
+
+void ILI9341_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+    uint16_t i;
+    uint32_t size;
+
+    if (x >= ILI9341_WIDTH || y >= ILI9341_HEIGHT || w == 0 || h == 0)
+    {
+        return;
+    }
+    if (x + w > ILI9341_WIDTH) w = ILI9341_WIDTH - x;
+    if (y + h > ILI9341_HEIGHT) h = ILI9341_HEIGHT - y;
+
+    for (i = 0; i < ILI9341_LINE_BUFF_SIZE; i += 2)
+    {
+        ILI9341_LineBuff[i] = color >> 8;
+        ILI9341_LineBuff[i + 1] = color & 0xFF;
+    }
+    ILI9341_SetWindow(x, y, x + w - 1, y + h - 1);
+    size = (uint32_t)w * h * 2;
+    while (size > ILI9341_LINE_BUFF_SIZE)
+    {
+        LCM_WriteDataDMA(ILI9341_LineBuff, ILI9341_LINE_BUFF_SIZE);
+        size -= ILI9341_LINE_BUFF_SIZE;
+    }
+    LCM_WriteDataDMA(ILI9341_LineBuff, size);
+}
+
+/**
+ * Size of a blit source in bytes, 0 if the window is empty or doesn't fit in xdata
+*/
+static uint16_t ILI9341_BlitSize(uint16_t w, uint16_t h)
+{
+    uint32_t size = (uint32_t)w * h * 2;
+    return (size > 0xFFFF)? 0 : (uint16_t)size;
+}
+
+HAL_StatusTypeDef ILI9341_Blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t __XDATA *buf)
+{
+    uint16_t size = ILI9341_BlitSize(w, h);
+    if (size == 0)
+    {
+        return HAL_ERROR;
+    }
+    ILI9341_SetWindow(x, y, x + w - 1, y + h - 1);
+    return LCM_WriteDataDMA(buf, size);
+}
+
+HAL_StatusTypeDef ILI9341_BlitAsync(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t __XDATA *buf, LCM_Callback_t callback)
+{
+    uint16_t size = ILI9341_BlitSize(w, h);
+    if (size == 0)
+    {
+        return HAL_ERROR;
+    }
+    if (LCM_DMA_IsBusy())
+    {
+        return HAL_BUSY;
+    }
+    ILI9341_SetWindow(x, y, x + w - 1, y + h - 1);
+    return LCM_WriteDataDMAAsync(buf, size, callback);
+}
+
+void ILI9341_SetBackLight(HAL_State_t state)
+{
+    ILI9341_BL = state;
+}
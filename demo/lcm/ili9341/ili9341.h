@@ -0,0 +1,120 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __FW_ILI9341__
+#define __FW_ILI9341__
+
+#include "fw_hal.h"
+
+/**
+ * ILI9341, ST7789 on LCM 8-bit 8080 interface
+ * 
+ * Both use CASET(0x2A), RASET(0x2B), RAMWR(0x2C) for window addressing, only
+ * the initialization differs. Pixels are RGB565, high byte first.
+*/
+
+#define ILI9341_MODEL_ILI9341               0
+#define ILI9341_MODEL_ST7789                1
+
+#ifndef ILI9341_MODEL
+#define ILI9341_MODEL       ILI9341_MODEL_ILI9341
+#endif
+
+// Data: P2, RS: P45, RD: P44, WR: P42
+#define ILI9341_DATA_PORT   LCM_AlterDataPort_P2_P0
+#define ILI9341_CTRL_PORT   LCM_AlterCtrlPort_P45_P44_P42
+#define ILI9341_CS          P41
+#define ILI9341_RES         P43
+#define ILI9341_BL          P11
+
+// X width
+#define ILI9341_WIDTH       240
+// Y height
+#define ILI9341_HEIGHT      320
+
+/**
+ * Size of line buffer for FillRect, in bytes
+*/
+#ifndef ILI9341_LINE_BUFF_SIZE
+#define ILI9341_LINE_BUFF_SIZE  512
+#endif
+
+/* Commands */
+#define ILI9341_SWRESET     0x01 /* Software reset */
+#define ILI9341_SLPOUT      0x11 /* Sleep out */
+#define ILI9341_INVOFF      0x20 /* Display inversion off */
+#define ILI9341_INVON       0x21 /* Display inversion on */
+#define ILI9341_DISPOFF     0x28 /* Display off */
+#define ILI9341_DISPON      0x29 /* Display on */
+#define ILI9341_CASET       0x2A /* Column address set */
+#define ILI9341_RASET       0x2B /* Row(page) address set */
+#define ILI9341_RAMWR       0x2C /* Memory write */
+#define ILI9341_MADCTL      0x36 /* Memory access control */
+#define ILI9341_COLMOD      0x3A /* Pixel format set */
+
+#define ILI9341_MADCTL_MY   0x80
+#define ILI9341_MADCTL_MX   0x40
+#define ILI9341_MADCTL_MV   0x20
+#define ILI9341_MADCTL_BGR  0x08
+
+#define ILI9341_COLMOD_16BIT  0x55
+
+/* RGB565 colors */
+#define ILI9341_COLOR_BLACK   0x0000
+#define ILI9341_COLOR_WHITE   0xFFFF
+#define ILI9341_COLOR_RED     0xF800
+#define ILI9341_COLOR_GREEN   0x07E0
+#define ILI9341_COLOR_BLUE    0x001F
+
+#define ILI9341_RGB565(__R__, __G__, __B__) \
+    ((((uint16_t)(__R__) & 0xF8) << 8) | (((uint16_t)(__G__) & 0xFC) << 3) | ((__B__) >> 3))
+
+/**
+ * @brief  Configure LCM and initialize panel
+ */
+void ILI9341_Init(void);
+
+void ILI9341_WriteCommand(uint8_t command);
+void ILI9341_WriteData(uint8_t dat);
+
+/**
+ * @brief  Set drawing window and start memory write, pixels written
+ *         after this fill the window from left to right, top to bottom
+ */
+void ILI9341_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+void ILI9341_DrawPixel(uint16_t x, uint16_t y, uint16_t color);
+
+/**
+ * @brief  Fill a rectangle with one color
+ */
+void ILI9341_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * @brief  Copy w x h RGB565 pixels from xdata to the panel through DMA
+ * @param  buf: w * h * 2 bytes, high byte first
+ * @retval HAL_ERROR if the window is empty or w * h * 2 exceeds 65535 bytes,
+ *         draw larger areas in strips
+ */
+HAL_StatusTypeDef ILI9341_Blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t __XDATA *buf);
+
+/**
+ * @brief  Same as ILI9341_Blit() but returns when DMA starts, callback is
+ *         called from LCM_DMA_IRQHandler() when finished
+ */
+HAL_StatusTypeDef ILI9341_BlitAsync(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t __XDATA *buf, LCM_Callback_t callback);
+
+void ILI9341_SetBackLight(HAL_State_t state);
+
+#endif
@@ -0,0 +1,116 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***
+ * Demo: ILI9341 / ST7789 320x240 TFT on LCM 8-bit 8080 interface
+ * Board: STC8H8K64U
+ * 
+ *              P20-P27 -> D0-D7
+ *              P45     -> RS, DC
+ *              P44     -> RD
+ *              P42     -> WR
+ *              P41     -> CS
+ *              P43     -> RESET
+ *              P11     -> LED, Backlight
+ *              GND     -> GND
+ *              3.3V    -> VCC
+ * 
+ * The screen is drawn in strips of 5 lines, next strip is rendered by CPU
+ * while current strip is being sent by DMA. Frame count is printed to UART1 every second.
+ */
+
+#include "fw_hal.h"
+#include "ili9341.h"
+
+// Divides ILI9341_HEIGHT. Two strips and the 512-byte line buffer of the driver take
+// 5312 of the 8192 bytes xdata
+#define STRIP_LINES 5
+#define STRIP_SIZE  (ILI9341_WIDTH * STRIP_LINES * 2)
+
+__XDATA uint8_t strip[2][STRIP_SIZE];
+volatile uint16_t frames = 0, ticks = 0;
+
+INTERRUPT(DMA_LCM_Routine, EXTI_VectDMA_LCM)
+{
+    DMA_Channel_Dispatch(DMA_Channel_LCM);
+}
+
+INTERRUPT(Timer0_Routine, EXTI_VectTimer0)
+{
+    ticks++;
+}
+
+void GPIO_Init(void)
+{
+    // D0-D7
+    GPIO_P2_SetMode(GPIO_Pin_All, GPIO_Mode_Output_PP);
+    // WR, CS, RESET, RD, RS
+    GPIO_P4_SetMode(GPIO_Pin_1|GPIO_Pin_2|GPIO_Pin_3|GPIO_Pin_4|GPIO_Pin_5, GPIO_Mode_Output_PP);
+    // Backlight
+    GPIO_P1_SetMode(GPIO_Pin_1, GPIO_Mode_Output_PP);
+}
+
+void RenderStrip(uint8_t __XDATA *buf, uint16_t y0, uint8_t shift)
+{
+    uint16_t x, y, color;
+    for (y = y0; y < y0 + STRIP_LINES; y++)
+    {
+        for (x = 0; x < ILI9341_WIDTH; x++)
+        {
+            color = ILI9341_RGB565(x + shift, y + shift, (x ^ y) + shift);
+            *buf++ = color >> 8;
+            *buf++ = color & 0xFF;
+        }
+    }
+}
+
+void main(void)
+{
+    uint16_t y;
+    uint8_t i = 0, shift = 0;
+
+    SYS_SetClock();
+    GPIO_Init();
+    // UART1, baud 115200, baud source Timer1, 1T mode, no interrupt
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+    // 1ms tick
+    TIM_Timer0_Config(HAL_State_ON, TIM_TimerMode_16BitAuto, 1000);
+    EXTI_Timer0_SetIntState(HAL_State_ON);
+    TIM_Timer0_SetRunState(HAL_State_ON);
+    EXTI_DMA_LCM_SetIntPriority(EXTI_IntPriority_High);
+    EXTI_Global_SetIntState(HAL_State_ON);
+
+    ILI9341_Init();
+    ILI9341_FillRect(0, 0, ILI9341_WIDTH, ILI9341_HEIGHT, ILI9341_COLOR_BLUE);
+
+    while(1)
+    {
+        for (y = 0; y < ILI9341_HEIGHT; y += STRIP_LINES)
+        {
+            RenderStrip(strip[i], y, shift);
+            while (ILI9341_BlitAsync(0, y, ILI9341_WIDTH, STRIP_LINES, strip[i], NULL) == HAL_BUSY);
+            i = !i;
+        }
+        shift++;
+        frames++;
+        if (ticks >= 1000)
+        {
+            ticks = 0;
+            UART1_TxString("FPS:");
+            UART1_TxHex(frames & 0xFF);
+            UART1_TxString("\r\n");
+            frames = 0;
+        }
+    }
+}
@@ -0,0 +1,110 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***
+ * Demo: NEC infrared remote decoding with PCA capture
+ * Board: STC8G1K08A, 24MHz
+ *
+ *    IR receiver(VS1838B, HS0038)
+ *    OUT   -> P3.2 (CCP0)
+ *    VCC   -> 3.3V/5V
+ *    GND   -> GND
+ *
+ * Falling edges of the receiver output are timestamped by the PCA at 0.5us,
+ * the frame is decoded from the intervals between them:
+ *   13.5ms leader, 1.125ms bit 0, 2.25ms bit 1, 11.25ms repeat
+ */
+
+#include "fw_hal.h"
+#include <stdio.h>
+
+// Interval limits in 0.5us ticks
+#define NEC_LEADER_MIN      25000
+#define NEC_LEADER_MAX      29000
+#define NEC_REPEAT_MIN      21000
+#define NEC_REPEAT_MAX      24000
+#define NEC_BIT0_MIN        1800
+#define NEC_BIT0_MAX        2700
+#define NEC_BIT1_MIN        3800
+#define NEC_BIT1_MAX        5200
+
+INTERRUPT(PCA_Routine, EXTI_VectPCA)
+{
+    PCA_IRQHandler();
+}
+
+void main(void)
+{
+    PCA_CapEvent_t event;
+    uint32_t last = 0, interval, code = 0;
+    uint8_t bits = 0xFF;
+
+    SYS_SetClock();
+    // UART1, baud 115200, baud source Timer1, 1T mode, no interrupt
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+    GPIO_P3_SetMode(GPIO_Pin_2, GPIO_Mode_Input_HIP);
+    PCA_SetPort(PCA_AlterPort_G1K08A_P55_P32_P33_P54);
+    PCA_Timebase_Init(PCA_ClockSource_SysClkDiv12);
+    PCA_Capture_Start(PCA_Channel_0, PCA_WorkMode_CAP_16bitFalling);
+    EXTI_Global_SetIntState(HAL_State_ON);
+
+    while(1)
+    {
+        if (PCA_Capture_Read(&event) != HAL_OK)
+        {
+            continue;
+        }
+        interval = event.timestamp - last;
+        last = event.timestamp;
+        if (interval >= NEC_LEADER_MIN && interval <= NEC_LEADER_MAX)
+        {
+            bits = 0;
+            code = 0;
+        }
+        else if (interval >= NEC_REPEAT_MIN && interval <= NEC_REPEAT_MAX)
+        {
+            printf("repeat\r\n");
+            bits = 0xFF;
+        }
+        else if (bits < 32 && interval >= NEC_BIT0_MIN && interval <= NEC_BIT1_MAX)
+        {
+            // LSB first
+            code >>= 1;
+            if (interval >= NEC_BIT1_MIN)
+            {
+                code |= 0x80000000UL;
+            }
+            else if (interval > NEC_BIT0_MAX)
+            {
+                bits = 0xFF;
+                continue;
+            }
+            if (++bits == 32)
+            {
+                if ((uint8_t)(code >> 16) == (uint8_t)~(code >> 24))
+                {
+                    printf("addr:%04X cmd:%02X\r\n", (uint16_t)code, (uint8_t)(code >> 16));
+                }
+                else
+                {
+                    printf("bad code %08lX\r\n", code);
+                }
+            }
+        }
+        else
+        {
+            bits = 0xFF;
+        }
+    }
+}
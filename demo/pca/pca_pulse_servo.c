@@ -0,0 +1,76 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***
+ * Demo: Servo pulses from PCA high-speed output
+ * Board: STC8G1K08A, 24MHz
+ *
+ *    Servo(SG90, MG996R)
+ *    Signal -> P3.2 (CCP0)
+ *    VCC    -> 5V
+ *    GND    -> GND
+ *
+ * CCP0 outputs 50Hz pulses of 1.0 - 2.0ms. Both edges are set by compare match
+ * relative to the previous edge, so the pulse width doesn't change with interrupt
+ * latency. PCA1 runs as a 10ms compare timer which moves the servo.
+ */
+
+#include "fw_hal.h"
+
+// 0.5us ticks
+#define SERVO_PERIOD        40000
+#define SERVO_MIN           2000
+#define SERVO_MAX           4000
+
+static volatile uint8_t tick;
+
+INTERRUPT(PCA_Routine, EXTI_VectPCA)
+{
+    PCA_IRQHandler();
+}
+
+void Tick(void)
+{
+    tick = 1;
+}
+
+void main(void)
+{
+    uint16_t width = SERVO_MIN;
+    int8_t step = 4;
+
+    SYS_SetClock();
+    P32 = 0;
+    GPIO_P3_SetMode(GPIO_Pin_2, GPIO_Mode_Output_PP);
+    PCA_SetPort(PCA_AlterPort_G1K08A_P55_P32_P33_P54);
+    PCA_Timebase_Init(PCA_ClockSource_SysClkDiv12);
+    PCA_Pulse_Start(PCA_Channel_0, width, SERVO_PERIOD - width, 0);
+    PCA_Timer_Start(PCA_Channel_1, 20000, HAL_State_ON, Tick);
+    EXTI_Global_SetIntState(HAL_State_ON);
+
+    while(1)
+    {
+        if (!tick)
+        {
+            continue;
+        }
+        tick = 0;
+        width += step;
+        if (width >= SERVO_MAX || width <= SERVO_MIN)
+        {
+            step = -step;
+        }
+        PCA_Pulse_SetWidth(PCA_Channel_0, width, SERVO_PERIOD - width);
+    }
+}
@@ -0,0 +1,95 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Demo: Three-phase complementary PWM, V/f open loop ramp with SVPWM
+ * Board: STC8H3K32S2/STC8H8K64U
+ * 
+ *   P10/P11 (PWMA.1P/1N) -> phase U high/low side gate driver
+ *   P12/P13 (PWMA.2P/2N) -> phase V high/low side gate driver
+ *   P14/P15 (PWMA.3P/3N) -> phase W high/low side gate driver
+ *   PWMA break input     <- over-current comparator, active high
+ *   P02(ADC10)           <- low-side shunt amplifier
+ *
+ * PWM runs at 20kHz with 500ns dead-time, ADC samples the shunt current
+ * 1us before the counter peak, when all low-side switches are on.
+*/
+#include "fw_hal.h"
+
+#define PWM_FREQUENCY   20000
+#define TARGET_FREQ     500     // 50.0 Hz
+#define TARGET_AMP      0xE000
+
+volatile uint16_t current;
+
+INTERRUPT(PWMA_Routine, EXTI_VectPWMA)
+{
+    PWM_3Phase_IRQHandler();
+}
+
+INTERRUPT(ADC_Routine, EXTI_VectADC)
+{
+    ADC_ClearInterrupt();
+    current = (ADC_RES << 8) | ADC_RESL;
+}
+
+void main(void)
+{
+    uint16_t freq = 0;
+
+    SYS_SetClock();
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+
+    GPIO_P1_SetMode(GPIO_Pin_0|GPIO_Pin_1|GPIO_Pin_2|GPIO_Pin_3|GPIO_Pin_4|GPIO_Pin_5, GPIO_Mode_Output_PP);
+    PWMA_PWM1_SetPort(PWMA_PWM1_AlterPort_P10_P11);
+    PWMA_PWM2_SetPort(PWMA_PWM2_AlterPort_P12P54_P13);
+    PWMA_PWM3_SetPort(PWMA_PWM3_AlterPort_P14_P15);
+
+    GPIO_P0_SetMode(GPIO_Pin_2, GPIO_Mode_Input_HIP);
+    ADC_SetChannel(0x0A);
+    ADC_SetClockPrescaler(0x01);
+    ADC_SetResultAlignmentRight();
+    ADC_SetPowerState(HAL_State_ON);
+    EXTI_ADC_SetIntState(HAL_State_ON);
+
+    // 500ns dead-time in SYSCLK ticks
+    PWM_3Phase_Init(PWM_FREQUENCY, SYS_GetSysClock() / 2000000, PWM_3PhaseWave_SVPWM);
+    PWM_3Phase_SetBreak(HAL_State_ON, HAL_State_ON);
+    PWM_3Phase_SetAdcTrigger(HAL_State_ON, SYS_GetSysClock() / 1000000);
+    // Modulator runs before the ADC interrupt
+    EXTI_PWMA_SetIntPriority(EXTI_IntPriority_High);
+    EXTI_Global_SetIntState(HAL_State_ON);
+    PWM_3Phase_Start();
+
+    while(1)
+    {
+        if (PWM_3Phase_IsBroken())
+        {
+            UART1_TxString("Break\r\n");
+            SYS_Delay(1000);
+            freq = 0;
+            PWM_3Phase_Start();
+        }
+        // Ramp 0 -> 50Hz in 5 seconds, voltage in proportion to frequency
+        if (freq < TARGET_FREQ)
+        {
+            freq++;
+        }
+        PWM_3Phase_SetOutput(freq, (uint32_t)TARGET_AMP * freq / TARGET_FREQ);
+        UART1_TxHex(current >> 8);
+        UART1_TxHex(current & 0xFF);
+        UART1_TxString("\r\n");
+        SYS_Delay(10);
+    }
+}
@@ -18,12 +18,14 @@
  * 
  *  P1.0  -> 200R -> Speaker +
  *  GND           -> Speaker -
+ * 
+ * voice.c is IMA-ADPCM encoded by tools/audio_encode.py, 4 bits per sample
 */
 #include "fw_hal.h"
+#include "player.h"
 #include "voice.h"
 
-uint8_t dc = 0;
-uint16_t voice_pos = 0, voice_size = 27451;
+PLAYER_Clip_t voice = {VOICE_FORMAT, VOICE_RATE, VOICE_SAMPLES, voice_bulk};
 
 void PWM_Init()
 {
@@ -60,28 +62,25 @@ void PWM_Init()
     PWMA_SetCounterState(HAL_State_ON);
 }
 
-void Timer0_Init()
-{
-    TIM_Timer0_Config(HAL_State_ON, TIM_TimerMode_16BitAuto, 8000);
-    EXTI_Timer0_SetIntState(HAL_State_ON);
-    EXTI_Timer0_SetIntPriority(EXTI_IntPriority_High);
-    EXTI_Global_SetIntState(HAL_State_ON);
-    TIM_Timer0_SetRunState(HAL_State_ON);
-}
-
 INTERRUPT(Timer0_Routine, EXTI_VectTimer0)
 {
-    uint8_t dc;
-    dc = voice_bulk[voice_pos++];
-    PWMA_PWM1_SetCaptureCompareValue(dc);
-    if (voice_pos == voice_size) voice_pos = 0;
+    PLAYER_Tick();
 }
 
 void main(void)
 {
     SYS_SetClock();
     PWM_Init();
-    Timer0_Init();
+    EXTI_Timer0_SetIntPriority(EXTI_IntPriority_High);
+    EXTI_Global_SetIntState(HAL_State_ON);
 
-    while(1);
-}
\ No newline at end of file
+    while(1)
+    {
+        PLAYER_Play(&voice);
+        while (PLAYER_IsPlaying())
+        {
+            PLAYER_Process();
+        }
+        SYS_Delay(500);
+    }
+}
@@ -0,0 +1,131 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "player.h"
+
+static __XDATA uint8_t player_buf[PLAYER_HALF_SIZE * 2];
+static PLAYER_Clip_t *player_clip;
+static uint16_t player_pos, player_remain, player_underruns;
+static uint8_t player_rd, player_wr, player_dat, player_nibble;
+static volatile uint8_t player_ready, player_playing;
+static AUDIO_ADPCM_State_t player_adpcm;
+
+static uint8_t PLAYER_NextSample(void)
+{
+    switch (player_clip->format)
+    {
+    case AUDIO_Format_ULaw:
+        return AUDIO_SampleToU8(AUDIO_ULaw_Decode(player_clip->dat[player_pos++]));
+
+    case AUDIO_Format_IMA_ADPCM:
+        player_nibble = !player_nibble;
+        if (player_nibble)
+        {
+            player_dat = player_clip->dat[player_pos++];
+            return AUDIO_SampleToU8(AUDIO_ADPCM_Decode(&player_adpcm, player_dat & 0x0F));
+        }
+        return AUDIO_SampleToU8(AUDIO_ADPCM_Decode(&player_adpcm, player_dat >> 4));
+
+    default:
+        return player_clip->dat[player_pos++];
+    }
+}
+
+void PLAYER_Process(void)
+{
+    uint8_t i, ea;
+    uint8_t __XDATA *p;
+
+    while (player_playing && player_ready < 2 && player_remain != 0)
+    {
+        p = player_buf + player_wr;
+        for (i = 0; i < PLAYER_HALF_SIZE; i++)
+        {
+            if (player_remain == 0)
+            {
+                // Pad last half with silence
+                *p++ = 0x80;
+                continue;
+            }
+            *p++ = PLAYER_NextSample();
+            player_remain--;
+        }
+        player_wr ^= PLAYER_HALF_SIZE;
+        ea = EA;
+        EA = 0;
+        player_ready++;
+        EA = ea;
+    }
+}
+
+void PLAYER_Play(PLAYER_Clip_t *clip)
+{
+    PLAYER_Stop();
+    player_clip = clip;
+    player_pos = 0;
+    player_remain = clip->samples;
+    player_rd = player_wr = player_ready = 0;
+    player_nibble = 0;
+    player_underruns = 0;
+    AUDIO_ADPCM_Init(&player_adpcm);
+    player_playing = 1;
+    // Fill both halves before starting
+    PLAYER_Process();
+
+    TIM_Timer0_Config(HAL_State_ON, TIM_TimerMode_16BitAuto, clip->sampleRate);
+    EXTI_Timer0_SetIntState(HAL_State_ON);
+    TIM_Timer0_SetRunState(HAL_State_ON);
+}
+
+void PLAYER_Stop(void)
+{
+    TIM_Timer0_SetRunState(HAL_State_OFF);
+    player_playing = 0;
+    PLAYER_OUTPUT(0x80);
+}
+
+uint8_t PLAYER_IsPlaying(void)
+{
+    return player_playing;
+}
+
+uint16_t PLAYER_GetUnderruns(void)
+{
+    return player_underruns;
+}
+
+void PLAYER_Tick(void)
+{
+    if (player_ready == 0)
+    {
+        if (player_remain == 0)
+        {
+            // End of clip
+            TIM_Timer0_SetRunState(HAL_State_OFF);
+            player_playing = 0;
+        }
+        else
+        {
+            player_underruns++;
+        }
+        return;
+    }
+    PLAYER_OUTPUT(player_buf[player_rd]);
+    player_rd++;
+    if ((player_rd & (PLAYER_HALF_SIZE - 1)) == 0)
+    {
+        player_rd &= (PLAYER_HALF_SIZE * 2 - 1);
+        player_ready--;
+    }
+}
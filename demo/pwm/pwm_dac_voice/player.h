@@ -0,0 +1,63 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __PLAYER_H__
+#define __PLAYER_H__
+
+#include "fw_hal.h"
+#include "fw_audio.h"
+
+/**
+ * PWM DAC audio player
+ * 
+ * Timer0 interrupt outputs one sample per period from a double buffer, the
+ * ISR cost is fixed and doesn't depend on sample format. PLAYER_Process()
+ * decodes the clip into the free half of the buffer, call it in main loop.
+*/
+
+// Samples per half buffer, power of 2
+#define PLAYER_HALF_SIZE    32
+
+// Set 8-bit sample to output, PWMA.1 with 8-bit period
+#define PLAYER_OUTPUT(__DUTY__)     PWMA_PWM1_SetCaptureCompareValue(__DUTY__)
+
+typedef struct
+{
+    AUDIO_Format_t format;
+    uint16_t sampleRate;
+    uint16_t samples;
+    uint8_t __CODE *dat;
+} PLAYER_Clip_t;
+
+/**
+ * Start playing clip, sample rate is applied to Timer0
+*/
+void PLAYER_Play(PLAYER_Clip_t *clip);
+void PLAYER_Stop(void);
+uint8_t PLAYER_IsPlaying(void);
+/**
+ * Decode samples into free buffer halves, call it in main loop, at least once per
+ * PLAYER_HALF_SIZE samples
+*/
+void PLAYER_Process(void);
+/**
+ * Call this in Timer0 interrupt routine
+*/
+void PLAYER_Tick(void);
+/**
+ * Number of samples the buffer was empty while playing
+*/
+uint16_t PLAYER_GetUnderruns(void);
+
+#endif
@@ -1,3 +1,863 @@
 #include "voice.h"
 
-__CODE uint8_t voice_bulk[] = {125, 125, 128, 126, 126, 126, 125, 126, 125, 125, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 125, 126, 125, 126, 126, 126, 126, 125, 126, 126, 126, 125, 126, 126, 126, 126, 125, 126, 125, 126, 125, 126, 126, 126, 125, 125, 126, 126, 126, 125, 126, 125, 126, 125, 124, 125, 125, 125, 125, 125, 126, 126, 126, 126, 125, 125, 126, 126, 125, 125, 125, 126, 125, 126, 125, 125, 126, 125, 126, 125, 125, 125, 126, 126, 126, 126, 125, 126, 125, 128, 126, 125, 125, 126, 126, 126, 128, 124, 126, 126, 126, 126, 126, 126, 125, 126, 125, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126, 125, 126, 126, 125, 126, 126, 125, 125, 126, 125, 125, 126, 126, 126, 128, 126, 126, 126, 125, 125, 126, 126, 125, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 125, 126, 126, 125, 125, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 125, 125, 126, 126, 125, 126, 125, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 125, 126, 126, 125, 126, 125, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 125, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 125, 125, 126, 126, 125, 126, 126, 125, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 128, 125, 124, 126, 126, 126, 125, 125, 128, 128, 126, 124, 124, 125, 126, 126, 125, 125, 125, 126, 130, 130, 122, 122, 125, 130, 129, 120, 116, 128, 134, 126, 123, 122, 131, 130, 123, 118, 122, 130, 132, 126, 187, 240, 146, 112, 120, 100, 113, 117, 101, 114, 161, 151, 134, 75, 64, 116, 76, 66, 62, 9, 91, 162, 93, 195, 246, 118, 106, 109, 93, 115, 107, 36, 89, 189, 167, 172, 147, 129, 170, 157, 76, 54, 87, 112, 134, 114, 121, 178, 212, 181, 148, 124, 113, 128, 92, 66, 103, 145, 150, 154, 155, 130, 111, 68, 0, 19, 109, 122, 64, 42, 187, 255, 134, 86, 97, 122, 141, 97, 15, 80, 200, 169, 145, 122, 137, 193, 171, 71, 59, 118, 124, 113, 82, 95, 169, 196, 151, 124, 130, 138, 169, 153, 80, 81, 125, 140, 135, 124, 117, 162, 174, 112, 87, 93, 86, 96, 88, 63, 89, 119, 118, 178, 253, 116, 75, 130, 116, 132, 98, 45, 71, 206, 143, 107, 149, 135, 194, 155, 76, 90, 162, 116, 72, 77, 102, 179, 166, 107, 125, 185, 181, 219, 151, 17, 78, 144, 121, 98, 108, 126, 185, 171, 89, 106, 136, 109, 87, 69, 72, 125, 81, 0, 82, 254, 194, 73, 113, 137, 158, 116, 46, 62, 178, 152, 72, 122, 131, 190, 181, 92, 94, 162, 147, 110, 81, 79, 146, 154, 120, 108, 164, 187, 160, 131, 112, 135, 146, 96, 74, 124, 141, 145, 108, 74, 144, 170, 78, 61, 145, 193, 172, 39, 0, 119, 246, 136, 40, 166, 140, 153, 125, 62, 129, 173, 100, 81, 155, 109, 172, 141, 65, 136, 159, 154, 102, 91, 126, 168, 136, 78, 133, 167, 131, 115, 143, 142, 139, 123, 94, 119, 155, 121, 101, 134, 124, 130, 132, 92, 110, 151, 129, 111, 97, 93, 146, 110, 108, 206, 123, 79, 174, 170, 102, 109, 108, 121, 159, 86, 90, 154, 142, 104, 117, 124, 145, 163, 113, 126, 153, 126, 134, 132, 125, 161, 147, 105, 116, 136, 132, 117, 116, 125, 129, 146, 131, 101, 123, 139, 115, 99, 111, 118, 120, 103, 91, 124, 109, 85, 95, 219, 198, 57, 141, 156, 141, 148, 77, 93, 191, 133, 71, 118, 111, 157, 139, 42, 125, 202, 139, 126, 113, 128, 206, 161, 107, 143, 145, 144, 119, 97, 131, 151, 110, 96, 126, 150, 143, 98, 112, 147, 136, 119, 110, 104, 120, 120, 91, 91, 136, 114, 92, 70, 110, 229, 141, 63, 117, 145, 174, 137, 60, 117, 184, 136, 113, 104, 111, 167, 126, 69, 128, 153, 136, 139, 93, 130, 168, 128, 144, 128, 119, 150, 130, 94, 117, 132, 138, 106, 126, 136, 126, 140, 100, 138, 139, 166, 107, 93, 151, 135, 138, 108, 128, 135, 143, 124, 108, 128, 132, 121, 112, 117, 122, 135, 116, 115, 124, 128, 125, 112, 124, 136, 139, 123, 126, 143, 137, 139, 138, 136, 136, 139, 126, 124, 132, 124, 113, 118, 132, 136, 119, 117, 142, 137, 138, 130, 126, 138, 132, 124, 118, 129, 131, 121, 123, 130, 134, 136, 132, 125, 136, 141, 135, 133, 132, 135, 138, 132, 125, 129, 133, 131, 122, 119, 131, 126, 128, 129, 123, 136, 140, 124, 126, 135, 130, 128, 122, 121, 119, 121, 117, 115, 124, 123, 119, 126, 131, 126, 132, 128, 130, 131, 129, 128, 125, 123, 126, 125, 120, 123, 123, 124, 122, 122, 125, 123, 129, 131, 128, 125, 131, 133, 126, 128, 126, 130, 128, 123, 123, 125, 133, 126, 125, 128, 129, 131, 126, 124, 126, 128, 125, 124, 121, 122, 129, 125, 120, 123, 128, 126, 126, 124, 125, 128, 126, 126, 126, 128, 128, 129, 128, 125, 128, 128, 126, 125, 125, 126, 128, 128, 125, 128, 129, 128, 128, 126, 125, 128, 128, 126, 126, 126, 126, 125, 125, 128, 126, 124, 123, 124, 126, 123, 121, 123, 125, 125, 123, 122, 123, 125, 126, 124, 124, 126, 126, 125, 125, 123, 125, 126, 124, 123, 124, 126, 125, 123, 125, 126, 126, 126, 126, 126, 128, 128, 126, 128, 128, 125, 125, 125, 124, 124, 123, 123, 124, 123, 123, 124, 124, 125, 123, 123, 123, 124, 125, 122, 123, 125, 123, 124, 125, 124, 125, 126, 125, 126, 128, 129, 126, 128, 129, 129, 129, 129, 128, 128, 128, 126, 126, 126, 126, 126, 125, 125, 126, 126, 126, 126, 125, 125, 124, 125, 125, 125, 125, 125, 124, 125, 124, 124, 125, 125, 124, 124, 124, 125, 125, 124, 124, 125, 126, 125, 125, 124, 125, 125, 124, 125, 125, 126, 126, 125, 125, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 125, 126, 125, 125, 125, 125, 125, 124, 125, 125, 125, 125, 124, 124, 124, 124, 123, 124, 124, 125, 125, 125, 125, 126, 126, 126, 126, 128, 126, 128, 126, 126, 128, 128, 126, 128, 128, 126, 128, 126, 126, 126, 125, 126, 126, 126, 125, 126, 126, 125, 125, 124, 125, 124, 125, 124, 125, 125, 124, 124, 125, 123, 125, 124, 125, 123, 124, 125, 120, 126, 124, 126, 125, 125, 125, 126, 126, 125, 125, 128, 125, 126, 125, 126, 124, 131, 128, 118, 133, 124, 128, 126, 125, 126, 125, 126, 125, 129, 124, 126, 124, 126, 125, 126, 124, 126, 128, 121, 128, 125, 125, 125, 124, 125, 124, 126, 124, 125, 124, 125, 125, 125, 125, 126, 125, 126, 125, 126, 126, 125, 128, 126, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 128, 126, 126, 125, 126, 126, 125, 125, 125, 125, 126, 126, 125, 125, 125, 125, 125, 125, 126, 125, 125, 124, 125, 125, 125, 125, 126, 126, 128, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 128, 128, 124, 129, 125, 126, 128, 126, 126, 130, 126, 136, 122, 113, 134, 126, 129, 119, 126, 121, 148, 121, 103, 131, 125, 134, 120, 129, 123, 130, 123, 128, 126, 123, 132, 124, 123, 130, 128, 128, 134, 116, 124, 130, 129, 122, 125, 126, 123, 130, 142, 137, 119, 120, 116, 125, 140, 130, 125, 129, 130, 123, 126, 128, 126, 128, 130, 130, 123, 125, 125, 130, 126, 125, 126, 128, 126, 132, 119, 129, 123, 132, 122, 126, 110, 159, 159, 69, 121, 137, 145, 110, 129, 134, 125, 119, 121, 139, 120, 125, 129, 131, 126, 134, 115, 137, 129, 129, 124, 126, 130, 128, 133, 125, 123, 129, 133, 122, 125, 128, 126, 122, 134, 119, 130, 126, 122, 131, 125, 123, 126, 133, 118, 125, 128, 126, 129, 135, 120, 130, 131, 125, 130, 139, 189, 119, 68, 123, 111, 150, 149, 128, 234, 91, 26, 149, 166, 155, 79, 133, 143, 119, 99, 143, 167, 103, 108, 129, 152, 125, 119, 120, 136, 129, 132, 116, 115, 139, 133, 116, 123, 125, 142, 118, 106, 140, 137, 142, 99, 124, 128, 147, 121, 104, 141, 131, 137, 107, 135, 128, 135, 104, 138, 144, 115, 139, 103, 143, 132, 121, 123, 146, 116, 121, 129, 121, 133, 144, 96, 126, 150, 109, 133, 111, 147, 102, 138, 121, 157, 112, 113, 143, 124, 125, 119, 153, 103, 143, 117, 151, 104, 109, 139, 140, 119, 116, 124, 136, 133, 106, 130, 130, 136, 103, 148, 125, 133, 111, 124, 125, 132, 122, 113, 160, 118, 117, 141, 120, 114, 151, 120, 111, 135, 121, 135, 142, 117, 139, 129, 117, 126, 124, 126, 128, 125, 128, 150, 124, 89, 147, 139, 128, 108, 120, 141, 147, 101, 114, 152, 107, 149, 97, 119, 147, 129, 108, 107, 156, 114, 132, 111, 114, 178, 122, 101, 105, 193, 79, 93, 169, 104, 149, 110, 98, 148, 162, 74, 123, 157, 112, 119, 147, 132, 121, 137, 115, 96, 169, 133, 126, 121, 132, 118, 116, 128, 111, 165, 118, 98, 119, 168, 72, 164, 122, 109, 156, 142, 75, 167, 157, 63, 161, 102, 136, 117, 113, 109, 172, 108, 119, 124, 170, 109, 117, 148, 111, 125, 136, 108, 114, 168, 65, 116, 168, 121, 86, 156, 102, 153, 137, 94, 139, 165, 65, 136, 183, 51, 136, 160, 94, 123, 153, 81, 146, 122, 96, 168, 97, 96, 169, 144, 100, 149, 102, 110, 150, 83, 146, 131, 117, 137, 142, 53, 155, 154, 99, 150, 114, 72, 165, 116, 85, 163, 116, 157, 86, 153, 89, 170, 99, 85, 164, 119, 116, 98, 144, 131, 117, 93, 165, 122, 86, 148, 142, 134, 88, 101, 185, 131, 71, 115, 189, 110, 94, 100, 161, 159, 70, 93, 160, 162, 78, 114, 159, 107, 131, 101, 140, 168, 100, 93, 151, 154, 62, 140, 116, 136, 134, 132, 78, 164, 146, 100, 145, 79, 173, 125, 110, 91, 171, 102, 88, 135, 112, 150, 110, 117, 106, 169, 94, 72, 160, 125, 136, 141, 86, 121, 185, 124, 83, 192, 129, 103, 188, 122, 132, 181, 123, 103, 199, 135, 63, 193, 146, 87, 175, 93, 132, 169, 63, 100, 214, 53, 74, 202, 73, 113, 118, 67, 83, 143, 75, 104, 68, 0, 178, 225, 45, 65, 226, 154, 118, 134, 119, 216, 186, 69, 181, 209, 112, 105, 187, 159, 119, 153, 150, 145, 143, 122, 146, 169, 119, 137, 129, 115, 128, 131, 109, 103, 84, 82, 77, 74, 100, 65, 45, 40, 71, 220, 172, 47, 162, 225, 149, 166, 158, 106, 221, 167, 76, 168, 148, 66, 161, 114, 72, 204, 152, 164, 245, 110, 120, 240, 121, 109, 168, 95, 144, 152, 40, 118, 110, 14, 92, 91, 25, 105, 82, 13, 19, 119, 255, 124, 75, 211, 191, 165, 144, 78, 153, 204, 80, 70, 162, 132, 108, 96, 82, 172, 178, 92, 150, 233, 234, 119, 80, 170, 177, 106, 45, 117, 175, 113, 37, 94, 125, 79, 55, 47, 80, 91, 3, 82, 255, 129, 61, 174, 187, 146, 104, 67, 132, 215, 80, 44, 156, 131, 116, 91, 102, 161, 199, 121, 92, 183, 149, 186, 168, 61, 130, 184, 81, 85, 126, 112, 128, 92, 76, 152, 115, 28, 84, 95, 34, 162, 248, 68, 93, 215, 141, 124, 100, 68, 167, 170, 37, 90, 174, 104, 129, 110, 119, 198, 153, 92, 140, 160, 137, 119, 116, 169, 138, 107, 94, 129, 144, 105, 96, 100, 136, 114, 83, 78, 94, 75, 82, 237, 178, 22, 163, 208, 107, 94, 75, 126, 185, 101, 34, 154, 162, 99, 132, 111, 179, 187, 104, 85, 148, 151, 113, 104, 111, 187, 152, 88, 121, 152, 129, 98, 90, 112, 142, 111, 71, 84, 99, 81, 146, 255, 101, 42, 233, 157, 94, 91, 63, 150, 165, 60, 63, 182, 138, 131, 124, 122, 192, 157, 105, 101, 136, 125, 108, 93, 102, 145, 191, 167, 111, 143, 138, 98, 96, 94, 122, 146, 90, 63, 102, 72, 72, 185, 250, 102, 63, 213, 155, 110, 55, 60, 170, 149, 48, 67, 186, 157, 148, 113, 138, 207, 142, 89, 95, 136, 124, 96, 72, 106, 177, 143, 160, 189, 158, 156, 85, 68, 113, 105, 107, 129, 101, 69, 69, 54, 139, 248, 172, 37, 142, 216, 121, 72, 47, 135, 179, 80, 24, 150, 214, 135, 108, 122, 192, 187, 84, 77, 148, 133, 88, 79, 96, 160, 154, 112, 197, 210, 107, 113, 126, 110, 102, 80, 106, 158, 82, 32, 66, 86, 192, 255, 166, 55, 196, 194, 52, 92, 79, 149, 145, 24, 62, 189, 184, 92, 137, 164, 192, 156, 82, 128, 147, 92, 76, 112, 121, 129, 118, 157, 198, 181, 124, 110, 154, 140, 87, 54, 116, 159, 64, 12, 26, 109, 229, 243, 114, 72, 238, 179, 48, 92, 128, 171, 90, 7, 102, 202, 123, 56, 155, 198, 180, 118, 106, 178, 155, 74, 83, 140, 126, 108, 114, 158, 184, 155, 104, 145, 165, 112, 90, 73, 135, 107, 11, 11, 103, 236, 217, 46, 88, 255, 160, 69, 101, 141, 185, 78, 28, 137, 168, 70, 73, 158, 184, 168, 91, 132, 217, 141, 74, 131, 159, 124, 101, 120, 153, 154, 122, 102, 144, 141, 102, 88, 97, 132, 77, 0, 82, 241, 206, 18, 116, 254, 138, 81, 80, 165, 209, 52, 43, 190, 155, 58, 87, 146, 180, 138, 76, 152, 207, 106, 95, 160, 166, 129, 93, 149, 163, 118, 106, 129, 156, 114, 75, 96, 134, 112, 38, 35, 146, 246, 133, 17, 191, 230, 84, 75, 124, 213, 157, 27, 119, 214, 107, 52, 111, 161, 175, 77, 80, 191, 166, 98, 116, 156, 183, 137, 88, 160, 158, 114, 117, 112, 143, 119, 70, 114, 138, 116, 95, 75, 124, 208, 129, 46, 174, 159, 98, 121, 86, 165, 179, 83, 114, 172, 142, 125, 109, 115, 176, 133, 82, 120, 141, 141, 135, 115, 148, 170, 128, 121, 134, 142, 155, 117, 105, 151, 143, 123, 125, 126, 141, 113, 92, 107, 124, 134, 103, 84, 92, 97, 100, 101, 120, 134, 139, 134, 135, 164, 159, 150, 152, 142, 130, 116, 115, 140, 150, 133, 128, 139, 151, 143, 135, 157, 168, 148, 123, 121, 140, 143, 135, 125, 116, 113, 88, 71, 74, 113, 142, 82, 50, 80, 114, 113, 95, 123, 156, 152, 122, 146, 180, 170, 153, 151, 149, 121, 108, 133, 162, 143, 116, 125, 148, 157, 146, 151, 166, 158, 144, 129, 122, 142, 138, 115, 95, 87, 83, 46, 36, 101, 151, 83, 39, 83, 121, 125, 102, 126, 166, 159, 136, 157, 180, 169, 157, 141, 142, 112, 100, 139, 153, 135, 113, 122, 141, 147, 142, 158, 168, 147, 142, 143, 141, 139, 132, 128, 112, 80, 73, 67, 43, 45, 112, 140, 59, 44, 102, 140, 125, 107, 142, 177, 160, 132, 163, 186, 165, 135, 124, 129, 113, 110, 135, 150, 130, 110, 123, 137, 150, 150, 148, 158, 154, 147, 136, 134, 142, 138, 125, 108, 80, 75, 77, 56, 41, 100, 141, 85, 58, 76, 128, 154, 123, 119, 154, 166, 154, 151, 161, 169, 147, 131, 125, 120, 121, 126, 151, 144, 113, 118, 140, 159, 153, 140, 157, 163, 142, 129, 140, 150, 142, 120, 116, 103, 82, 73, 67, 52, 64, 130, 114, 64, 64, 104, 152, 124, 100, 142, 178, 150, 129, 166, 193, 155, 117, 134, 145, 124, 109, 142, 165, 125, 102, 131, 153, 144, 138, 165, 167, 132, 126, 149, 157, 137, 132, 151, 126, 83, 89, 109, 76, 26, 46, 145, 135, 48, 45, 97, 154, 113, 96, 145, 167, 142, 128, 176, 186, 151, 137, 161, 148, 103, 102, 154, 161, 108, 104, 155, 157, 121, 124, 164, 169, 130, 129, 153, 154, 130, 143, 161, 140, 108, 102, 120, 99, 57, 31, 56, 114, 108, 74, 42, 76, 141, 111, 99, 125, 162, 168, 128, 148, 199, 168, 139, 164, 151, 113, 108, 136, 157, 124, 98, 151, 153, 113, 128, 158, 160, 145, 116, 159, 162, 160, 153, 104, 180, 86, 119, 142, 71, 84, 41, 36, 56, 141, 35, 148, 109, 6, 208, 95, 96, 152, 123, 196, 119, 104, 231, 135, 104, 186, 133, 126, 109, 121, 160, 116, 102, 168, 144, 114, 152, 135, 152, 139, 136, 155, 117, 144, 156, 120, 149, 153, 106, 128, 121, 78, 98, 68, 59, 59, 116, 66, 73, 149, 11, 148, 149, 62, 152, 102, 166, 160, 84, 206, 174, 98, 195, 151, 105, 147, 118, 130, 152, 103, 144, 154, 104, 163, 157, 103, 165, 141, 98, 167, 149, 111, 153, 158, 135, 141, 110, 123, 108, 94, 108, 120, 62, 82, 68, 52, 170, 11, 124, 170, 0, 175, 122, 44, 176, 112, 141, 162, 86, 187, 162, 96, 184, 164, 102, 158, 151, 89, 160, 130, 107, 178, 89, 144, 140, 96, 173, 99, 125, 145, 113, 138, 107, 132, 164, 96, 134, 175, 81, 91, 155, 120, 91, 129, 89, 132, 106, 60, 161, 107, 87, 147, 88, 94, 160, 76, 119, 156, 106, 112, 119, 145, 128, 113, 153, 145, 133, 129, 130, 154, 119, 133, 140, 143, 108, 150, 132, 105, 181, 105, 141, 166, 79, 177, 141, 83, 166, 123, 116, 142, 155, 91, 156, 99, 115, 182, 72, 144, 162, 100, 109, 177, 94, 141, 149, 66, 197, 132, 53, 205, 118, 93, 160, 104, 150, 116, 107, 120, 136, 125, 95, 133, 138, 85, 154, 115, 73, 214, 79, 111, 194, 64, 178, 133, 102, 178, 115, 116, 155, 168, 54, 172, 179, 21, 210, 100, 73, 217, 42, 138, 148, 97, 150, 81, 182, 96, 68, 216, 69, 131, 172, 61, 165, 120, 135, 116, 130, 134, 106, 189, 32, 132, 172, 42, 211, 81, 94, 199, 88, 129, 108, 181, 55, 159, 140, 64, 212, 73, 130, 142, 153, 46, 193, 132, 45, 252, 38, 133, 188, 41, 132, 216, 35, 160, 164, 36, 236, 69, 131, 157, 92, 171, 80, 152, 129, 117, 100, 149, 163, 53, 194, 72, 120, 196, 29, 166, 169, 6, 180, 164, 45, 181, 104, 140, 96, 162, 134, 67, 192, 96, 103, 138, 163, 112, 65, 185, 120, 130, 116, 113, 180, 38, 195, 109, 76, 216, 68, 124, 176, 68, 122, 154, 162, 58, 114, 210, 2, 198, 129, 43, 205, 108, 120, 122, 133, 148, 72, 188, 100, 80, 236, 39, 169, 100, 114, 200, 27, 187, 149, 130, 69, 158, 186, 10, 158, 208, 26, 135, 188, 16, 192, 153, 30, 180, 177, 24, 188, 157, 2, 210, 111, 58, 206, 99, 89, 161, 146, 82, 144, 161, 63, 191, 94, 112, 187, 82, 118, 143, 139, 97, 162, 107, 99, 193, 89, 100, 178, 128, 74, 164, 149, 92, 123, 153, 116, 99, 158, 140, 96, 98, 198, 81, 86, 203, 70, 139, 194, 51, 128, 178, 98, 92, 164, 107, 136, 142, 112, 145, 54, 219, 97, 85, 180, 121, 112, 155, 99, 93, 196, 66, 139, 144, 110, 105, 196, 70, 116, 223, 23, 164, 191, 45, 116, 220, 29, 113, 211, 82, 90, 163, 168, 47, 143, 170, 81, 101, 213, 85, 89, 210, 55, 141, 183, 110, 33, 203, 147, 27, 178, 110, 158, 95, 139, 113, 153, 129, 67, 220, 71, 112, 133, 177, 104, 60, 206, 87, 160, 121, 61, 211, 117, 67, 165, 178, 53, 134, 194, 51, 155, 154, 43, 193, 130, 41, 185, 157, 68, 97, 201, 47, 134, 207, 41, 164, 153, 43, 204, 155, 44, 172, 138, 126, 89, 144, 131, 114, 159, 100, 122, 133, 131, 118, 143, 118, 121, 164, 77, 131, 181, 66, 156, 165, 60, 150, 179, 65, 148, 183, 65, 119, 151, 128, 147, 79, 145, 179, 51, 123, 242, 87, 33, 234, 136, 105, 81, 140, 191, 63, 130, 148, 148, 121, 85, 126, 185, 85, 94, 170, 161, 66, 93, 203, 118, 77, 145, 123, 174, 117, 41, 214, 162, 48, 60, 230, 107, 35, 181, 136, 129, 114, 81, 162, 191, 26, 125, 211, 77, 90, 173, 131, 119, 121, 124, 170, 89, 99, 190, 91, 114, 146, 90, 179, 93, 91, 154, 151, 105, 104, 154, 104, 173, 74, 122, 196, 78, 114, 128, 164, 124, 92, 137, 125, 156, 84, 111, 177, 111, 122, 107, 132, 121, 143, 109, 90, 193, 70, 117, 212, 45, 145, 146, 90, 163, 125, 131, 54, 206, 110, 102, 175, 74, 151, 126, 187, 62, 96, 221, 126, 47, 129, 168, 144, 123, 46, 124, 230, 145, 0, 164, 238, 55, 53, 187, 158, 65, 133, 173, 96, 86, 179, 124, 130, 123, 68, 176, 173, 49, 63, 245, 142, 13, 133, 200, 117, 49, 131, 204, 109, 50, 172, 182, 91, 92, 179, 146, 96, 102, 154, 192, 97, 44, 186, 221, 38, 50, 246, 171, 0, 146, 221, 95, 69, 128, 136, 165, 110, 28, 161, 204, 58, 43, 228, 123, 1, 141, 156, 115, 81, 91, 130, 172, 108, 63, 149, 188, 154, 47, 152, 243, 118, 90, 149, 170, 167, 141, 94, 148, 188, 108, 72, 181, 182, 69, 115, 170, 114, 96, 156, 120, 90, 130, 117, 103, 141, 70, 61, 165, 95, 42, 87, 93, 38, 181, 173, 0, 123, 224, 151, 67, 140, 217, 158, 143, 133, 165, 197, 120, 95, 141, 170, 98, 76, 153, 142, 80, 134, 198, 140, 109, 170, 185, 134, 137, 160, 138, 121, 138, 101, 115, 117, 61, 76, 108, 74, 35, 72, 70, 0, 49, 227, 136, 4, 180, 236, 104, 95, 161, 204, 156, 136, 124, 149, 196, 99, 63, 147, 169, 87, 65, 146, 152, 94, 139, 152, 158, 189, 198, 133, 119, 229, 151, 63, 141, 162, 99, 90, 116, 100, 88, 100, 59, 76, 89, 28, 0, 77, 255, 136, 0, 202, 230, 100, 78, 139, 208, 126, 114, 110, 137, 194, 73, 59, 141, 176, 106, 65, 157, 173, 124, 123, 139, 173, 171, 131, 161, 170, 142, 124, 112, 138, 125, 109, 115, 123, 119, 98, 93, 78, 72, 69, 26, 29, 219, 198, 0, 158, 242, 87, 85, 134, 192, 150, 91, 108, 114, 194, 115, 47, 122, 190, 136, 54, 141, 178, 130, 112, 114, 152, 161, 131, 103, 119, 226, 135, 45, 168, 167, 98, 108, 128, 140, 153, 117, 66, 128, 132, 17, 46, 89, 192, 212, 16, 124, 239, 84, 109, 113, 156, 189, 88, 101, 113, 193, 123, 40, 141, 173, 134, 79, 119, 152, 145, 142, 84, 136, 188, 112, 84, 130, 150, 164, 137, 86, 156, 171, 88, 100, 146, 160, 134, 95, 125, 130, 84, 50, 77, 116, 190, 150, 3, 162, 225, 60, 122, 140, 169, 183, 70, 96, 150, 194, 83, 41, 169, 162, 106, 86, 124, 161, 161, 119, 81, 172, 182, 91, 89, 138, 159, 136, 133, 97, 151, 195, 94, 101, 149, 144, 139, 96, 121, 152, 79, 38, 70, 69, 163, 210, 24, 79, 255, 117, 76, 156, 118, 203, 159, 40, 119, 205, 131, 44, 112, 164, 142, 103, 92, 128, 175, 157, 81, 119, 189, 132, 103, 97, 119, 190, 125, 82, 149, 145, 149, 150, 96, 133, 174, 126, 102, 121, 123, 79, 51, 47, 77, 197, 173, 17, 113, 226, 96, 117, 150, 93, 220, 173, 14, 146, 208, 94, 117, 109, 82, 186, 147, 55, 124, 158, 141, 138, 114, 99, 140, 168, 104, 104, 161, 136, 151, 151, 82, 142, 192, 112, 124, 149, 120, 155, 121, 56, 83, 90, 60, 92, 170, 113, 36, 131, 149, 100, 150, 112, 83, 183, 161, 81, 153, 148, 111, 191, 128, 66, 152, 142, 116, 146, 98, 115, 186, 117, 70, 148, 135, 119, 177, 115, 118, 197, 133, 116, 186, 145, 145, 166, 100, 112, 151, 103, 70, 55, 31, 69, 141, 101, 29, 93, 118, 93, 138, 125, 107, 155, 150, 121, 174, 171, 116, 192, 165, 87, 148, 129, 113, 173, 125, 85, 154, 142, 87, 124, 124, 116, 161, 135, 116, 156, 147, 146, 172, 146, 144, 162, 129, 120, 130, 95, 81, 60, 12, 48, 149, 108, 19, 89, 119, 103, 144, 112, 109, 172, 147, 124, 179, 173, 122, 182, 165, 96, 134, 126, 118, 164, 130, 94, 141, 140, 111, 129, 112, 97, 159, 148, 118, 149, 145, 141, 174, 153, 139, 168, 150, 132, 136, 110, 87, 71, 30, 22, 103, 148, 49, 34, 106, 115, 115, 114, 108, 141, 161, 134, 148, 197, 151, 153, 186, 112, 123, 142, 115, 147, 146, 109, 140, 151, 95, 111, 141, 109, 133, 149, 121, 141, 158, 145, 158, 164, 142, 153, 160, 148, 146, 122, 96, 99, 58, 14, 22, 103, 148, 49, 33, 106, 114, 109, 113, 113, 148, 164, 128, 159, 207, 138, 157, 197, 118, 108, 132, 125, 157, 153, 102, 132, 148, 110, 121, 136, 107, 128, 154, 132, 149, 153, 134, 156, 165, 152, 153, 153, 146, 145, 136, 114, 98, 52, 21, 26, 76, 151, 82, 9, 91, 136, 106, 113, 117, 120, 165, 159, 134, 191, 179, 146, 183, 150, 104, 124, 138, 137, 153, 123, 118, 154, 111, 93, 145, 129, 109, 154, 142, 134, 162, 144, 148, 174, 147, 151, 174, 141, 147, 155, 117, 105, 84, 43, 29, 22, 83, 153, 63, 16, 100, 123, 112, 120, 117, 134, 169, 153, 158, 203, 154, 148, 194, 141, 104, 121, 126, 140, 150, 123, 133, 147, 102, 103, 146, 122, 112, 158, 156, 144, 149, 140, 166, 171, 144, 161, 165, 139, 149, 155, 121, 102, 94, 53, 24, 22, 47, 137, 112, 15, 65, 120, 107, 114, 124, 133, 161, 159, 137, 194, 207, 158, 171, 150, 109, 131, 140, 120, 136, 134, 125, 149, 118, 89, 125, 137, 114, 148, 165, 126, 146, 171, 148, 154, 157, 148, 167, 163, 142, 155, 140, 109, 116, 90, 51, 40, 20, 33, 131, 110, 12, 69, 124, 98, 104, 121, 133, 169, 171, 137, 188, 217, 160, 173, 173, 111, 114, 142, 122, 134, 139, 109, 129, 131, 96, 119, 143, 117, 136, 165, 142, 151, 161, 143, 159, 164, 146, 154, 164, 148, 149, 153, 122, 118, 118, 76, 51, 52, 32, 33, 97, 98, 34, 64, 100, 95, 113, 131, 134, 159, 172, 152, 183, 201, 168, 176, 173, 128, 123, 128, 116, 132, 139, 119, 125, 134, 115, 119, 138, 129, 131, 153, 142, 142, 154, 143, 146, 156, 147, 141, 153, 155, 151, 148, 126, 121, 121, 96, 72, 68, 66, 58, 38, 50, 108, 78, 39, 85, 113, 113, 113, 132, 152, 174, 159, 148, 197, 180, 149, 161, 157, 132, 120, 118, 128, 139, 122, 124, 141, 131, 116, 129, 136, 129, 128, 132, 138, 137, 129, 133, 144, 134, 132, 141, 146, 145, 138, 126, 125, 128, 114, 109, 118, 110, 94, 93, 87, 74, 65, 83, 108, 88, 66, 88, 108, 109, 112, 120, 137, 149, 152, 142, 151, 151, 153, 166, 156, 151, 147, 144, 142, 149, 149, 149, 154, 146, 136, 132, 131, 120, 114, 109, 108, 110, 107, 102, 107, 114, 110, 113, 119, 122, 130, 139, 138, 142, 145, 141, 140, 143, 141, 139, 136, 126, 120, 124, 124, 104, 101, 105, 98, 91, 98, 105, 97, 90, 97, 112, 110, 106, 119, 136, 136, 137, 145, 153, 157, 155, 159, 158, 152, 149, 147, 143, 139, 137, 135, 129, 118, 109, 109, 113, 106, 99, 102, 108, 107, 103, 106, 105, 112, 120, 121, 130, 138, 138, 137, 143, 147, 149, 152, 153, 155, 154, 151, 147, 146, 150, 143, 130, 125, 121, 116, 114, 112, 110, 113, 121, 119, 112, 105, 105, 108, 113, 117, 116, 121, 121, 118, 120, 123, 122, 124, 131, 133, 136, 138, 139, 139, 137, 138, 138, 135, 134, 132, 130, 125, 122, 124, 126, 122, 115, 116, 121, 128, 124, 116, 119, 123, 125, 125, 124, 130, 129, 124, 126, 133, 138, 135, 131, 131, 133, 133, 135, 134, 124, 122, 128, 125, 121, 117, 118, 116, 113, 111, 118, 122, 116, 112, 115, 119, 118, 120, 121, 123, 121, 124, 124, 123, 128, 131, 131, 128, 128, 129, 132, 131, 122, 122, 130, 134, 129, 121, 119, 120, 123, 122, 120, 120, 126, 123, 119, 120, 121, 118, 116, 112, 111, 129, 141, 130, 110, 115, 129, 129, 116, 120, 141, 149, 130, 113, 123, 135, 132, 125, 131, 135, 123, 107, 106, 113, 133, 157, 149, 120, 107, 119, 128, 116, 113, 129, 147, 140, 117, 105, 113, 125, 130, 134, 129, 125, 135, 141, 121, 111, 126, 143, 134, 114, 111, 124, 124, 118, 124, 134, 130, 117, 116, 122, 122, 110, 115, 130, 134, 130, 129, 123, 124, 128, 129, 126, 128, 134, 135, 133, 130, 130, 128, 132, 132, 129, 130, 125, 122, 124, 126, 122, 122, 123, 122, 117, 112, 104, 112, 135, 143, 131, 108, 115, 122, 126, 121, 125, 133, 135, 130, 123, 129, 139, 161, 144, 96, 78, 119, 150, 141, 126, 132, 141, 125, 109, 113, 131, 133, 123, 118, 117, 115, 116, 126, 140, 139, 128, 123, 121, 117, 120, 135, 143, 139, 130, 122, 122, 122, 132, 144, 140, 125, 125, 135, 126, 106, 103, 128, 142, 129, 114, 120, 129, 122, 117, 125, 136, 131, 119, 118, 126, 129, 132, 133, 137, 134, 126, 128, 129, 129, 128, 134, 132, 134, 134, 126, 121, 123, 130, 128, 123, 118, 119, 120, 122, 124, 126, 122, 124, 126, 123, 121, 121, 126, 129, 125, 124, 125, 129, 131, 130, 132, 130, 129, 124, 126, 129, 130, 130, 130, 128, 126, 125, 128, 130, 130, 129, 126, 122, 121, 122, 118, 130, 137, 131, 119, 122, 130, 125, 123, 126, 129, 126, 123, 125, 131, 130, 129, 129, 129, 128, 126, 124, 124, 124, 129, 128, 130, 125, 124, 115, 135, 133, 191, 140, 57, 150, 117, 149, 162, 168, 124, 64, 157, 238, 235, 74, 99, 145, 52, 125, 186, 99, 107, 121, 135, 135, 108, 148, 137, 144, 128, 148, 138, 160, 142, 122, 116, 99, 193, 122, 75, 151, 106, 53, 156, 148, 146, 115, 86, 161, 110, 97, 182, 144, 83, 159, 128, 106, 131, 133, 135, 87, 129, 143, 118, 116, 149, 148, 57, 145, 171, 74, 123, 183, 104, 81, 147, 135, 109, 128, 145, 102, 103, 148, 155, 128, 126, 120, 95, 91, 105, 153, 155, 98, 138, 116, 75, 157, 122, 104, 169, 79, 132, 191, 99, 170, 130, 58, 141, 137, 121, 161, 105, 153, 128, 83, 155, 102, 128, 139, 117, 117, 137, 164, 83, 143, 137, 69, 152, 164, 117, 111, 142, 112, 130, 123, 111, 140, 105, 144, 187, 54, 150, 137, 47, 190, 89, 82, 176, 126, 74, 164, 114, 85, 160, 129, 115, 124, 136, 134, 117, 101, 138, 98, 108, 161, 61, 108, 176, 48, 155, 164, 66, 145, 118, 102, 143, 117, 125, 122, 112, 120, 123, 105, 107, 121, 69, 144, 106, 80, 168, 90, 91, 167, 65, 72, 188, 95, 84, 153, 68, 122, 133, 50, 142, 108, 80, 161, 70, 83, 158, 53, 115, 123, 61, 141, 109, 67, 133, 111, 90, 107, 78, 119, 103, 86, 103, 95, 91, 99, 96, 100, 111, 71, 92, 96, 91, 84, 98, 79, 80, 115, 66, 94, 100, 78, 120, 137, 72, 103, 128, 104, 162, 156, 105, 128, 123, 117, 144, 128, 135, 138, 108, 131, 116, 123, 145, 95, 136, 112, 120, 121, 138, 123, 100, 135, 122, 128, 132, 120, 109, 100, 105, 140, 90, 116, 107, 132, 111, 87, 88, 58, 81, 112, 173, 163, 174, 150, 117, 148, 156, 154, 203, 146, 161, 178, 143, 166, 146, 151, 126, 141, 160, 162, 179, 164, 171, 189, 165, 162, 148, 176, 181, 183, 165, 119, 168, 145, 134, 152, 143, 165, 130, 115, 146, 153, 166, 126, 142, 132, 95, 108, 112, 105, 96, 94, 55, 104, 158, 153, 149, 177, 146, 161, 187, 155, 180, 179, 173, 161, 166, 140, 146, 136, 136, 129, 139, 137, 133, 150, 141, 172, 191, 209, 182, 176, 168, 170, 156, 163, 149, 140, 135, 133, 118, 152, 132, 89, 120, 118, 144, 117, 151, 109, 132, 113, 88, 104, 65, 86, 49, 71, 115, 138, 157, 148, 151, 124, 136, 158, 180, 192, 184, 179, 142, 150, 116, 129, 109, 131, 119, 119, 126, 122, 133, 144, 168, 159, 189, 163, 209, 188, 181, 155, 146, 139, 130, 133, 117, 119, 118, 128, 100, 123, 101, 103, 125, 119, 130, 124, 91, 82, 81, 61, 28, 34, 94, 134, 163, 176, 159, 129, 121, 162, 160, 199, 188, 163, 148, 117, 110, 105, 121, 104, 111, 96, 116, 95, 133, 140, 159, 171, 177, 174, 161, 202, 177, 191, 153, 137, 101, 101, 105, 113, 130, 125, 123, 107, 106, 84, 94, 116, 120, 123, 86, 57, 45, 12, 25, 102, 151, 194, 184, 145, 131, 95, 166, 172, 221, 211, 176, 132, 98, 84, 76, 120, 108, 122, 97, 92, 78, 113, 141, 179, 192, 192, 182, 160, 162, 189, 205, 186, 147, 98, 74, 75, 103, 116, 124, 132, 116, 97, 92, 86, 102, 107, 115, 82, 56, 30, 0, 80, 142, 181, 216, 153, 135, 90, 124, 179, 214, 228, 174, 132, 84, 79, 78, 122, 107, 111, 74, 67, 70, 99, 149, 170, 209, 182, 173, 138, 158, 172, 218, 220, 170, 123, 53, 63, 74, 128, 135, 117, 98, 78, 79, 87, 97, 107, 107, 79, 70, 6, 13, 69, 120, 242, 231, 146, 90, 54, 147, 196, 226, 218, 115, 43, 50, 72, 118, 171, 102, 66, 49, 55, 123, 198, 192, 156, 150, 129, 160, 183, 195, 216, 173, 107, 58, 61, 67, 150, 157, 107, 99, 76, 83, 108, 93, 66, 95, 47, 42, 21, 8, 20, 177, 255, 188, 181, 105, 70, 152, 229, 162, 138, 51, 15, 121, 136, 130, 90, 43, 43, 150, 213, 187, 157, 78, 107, 160, 195, 161, 126, 84, 81, 210, 212, 156, 92, 48, 50, 174, 202, 138, 119, 48, 76, 144, 94, 41, 43, 13, 53, 57, 0, 136, 255, 174, 152, 144, 92, 167, 225, 97, 54, 93, 58, 170, 155, 26, 60, 105, 148, 205, 184, 81, 105, 163, 168, 178, 97, 55, 108, 169, 182, 175, 117, 85, 143, 151, 124, 121, 112, 121, 180, 133, 71, 71, 67, 72, 77, 55, 36, 41, 26, 193, 250, 108, 119, 149, 149, 199, 148, 17, 93, 168, 117, 137, 40, 31, 168, 166, 130, 114, 119, 163, 206, 136, 83, 117, 142, 161, 122, 88, 129, 186, 178, 131, 75, 91, 160, 171, 132, 94, 114, 142, 131, 75, 61, 71, 95, 103, 48, 8, 103, 255, 159, 72, 149, 164, 212, 168, 25, 72, 218, 144, 70, 67, 54, 167, 163, 59, 81, 163, 197, 171, 105, 86, 183, 193, 109, 68, 118, 198, 185, 97, 80, 143, 167, 138, 81, 105, 165, 169, 111, 71, 105, 134, 94, 47, 59, 94, 70, 35, 198, 214, 46, 166, 219, 151, 175, 98, 72, 217, 161, 23, 117, 93, 107, 143, 34, 90, 177, 156, 128, 124, 132, 193, 170, 96, 126, 162, 167, 153, 107, 117, 173, 118, 72, 110, 152, 153, 111, 109, 132, 134, 106, 74, 90, 119, 72, 30, 21, 98, 252, 130, 23, 211, 207, 149, 130, 77, 174, 221, 72, 38, 179, 125, 90, 71, 61, 183, 139, 67, 124, 167, 156, 147, 120, 141, 193, 135, 125, 176, 144, 123, 119, 100, 125, 122, 99, 119, 138, 135, 115, 111, 111, 122, 102, 95, 101, 94, 47, 31, 208, 199, 23, 162, 219, 116, 139, 100, 154, 216, 105, 43, 189, 141, 53, 122, 70, 142, 139, 54, 122, 179, 114, 116, 175, 138, 161, 147, 139, 195, 148, 102, 147, 138, 102, 103, 107, 132, 122, 108, 121, 136, 120, 94, 117, 141, 114, 76, 95, 88, 37, 182, 218, 14, 154, 224, 78, 141, 146, 155, 166, 104, 90, 207, 122, 23, 165, 108, 101, 100, 89, 158, 126, 81, 142, 188, 120, 142, 165, 160, 172, 147, 137, 157, 130, 87, 114, 134, 107, 91, 129, 131, 109, 124, 121, 112, 116, 141, 114, 106, 99, 80, 57, 133, 244, 47, 81, 248, 95, 93, 159, 170, 149, 103, 117, 184, 150, 31, 154, 146, 69, 105, 114, 133, 107, 97, 142, 181, 102, 131, 200, 147, 128, 177, 163, 129, 132, 122, 124, 98, 111, 116, 112, 117, 114, 132, 133, 112, 115, 140, 138, 108, 117, 114, 93, 63, 70, 236, 128, 9, 241, 149, 38, 166, 177, 134, 107, 144, 156, 162, 64, 131, 182, 46, 108, 146, 116, 85, 123, 130, 145, 126, 122, 189, 135, 121, 173, 176, 110, 135, 154, 119, 95, 113, 139, 93, 111, 136, 128, 120, 123, 142, 136, 105, 122, 160, 104, 104, 123, 86, 49, 97, 234, 70, 52, 255, 80, 67, 199, 155, 107, 134, 164, 143, 128, 83, 194, 112, 43, 174, 130, 66, 116, 155, 103, 125, 133, 148, 152, 114, 146, 164, 141, 131, 135, 138, 126, 113, 129, 112, 111, 132, 116, 134, 138, 124, 132, 144, 128, 117, 136, 123, 118, 111, 102, 92, 74, 47, 185, 177, 0, 201, 183, 23, 180, 190, 83, 125, 191, 116, 144, 124, 132, 149, 63, 150, 140, 76, 112, 149, 97, 115, 148, 116, 137, 131, 141, 134, 137, 131, 156, 121, 111, 158, 116, 118, 130, 126, 114, 129, 137, 137, 117, 133, 154, 100, 138, 144, 103, 128, 138, 108, 92, 108, 88, 69, 67, 207, 132, 4, 248, 119, 37, 210, 158, 78, 152, 189, 103, 150, 117, 158, 129, 66, 168, 124, 65, 136, 136, 74, 136, 132, 112, 129, 142, 126, 131, 146, 128, 148, 135, 125, 138, 135, 118, 121, 143, 116, 119, 144, 122, 118, 144, 135, 113, 143, 136, 131, 135, 134, 122, 105, 131, 110, 83, 105, 91, 47, 88, 213, 69, 57, 250, 66, 90, 238, 124, 69, 207, 164, 84, 164, 129, 149, 88, 116, 154, 75, 96, 156, 86, 85, 168, 101, 108, 150, 142, 110, 147, 152, 122, 135, 132, 144, 119, 117, 138, 118, 114, 134, 128, 122, 136, 130, 144, 136, 133, 149, 131, 135, 139, 130, 124, 124, 114, 112, 110, 100, 108, 103, 92, 97, 88, 76, 84, 224, 89, 55, 254, 46, 101, 231, 112, 71, 212, 136, 80, 192, 102, 138, 104, 133, 138, 86, 120, 152, 83, 107, 172, 83, 119, 156, 125, 95, 161, 134, 105, 144, 130, 124, 121, 142, 119, 124, 139, 129, 125, 140, 131, 117, 155, 130, 120, 148, 129, 126, 132, 137, 121, 124, 126, 125, 116, 128, 121, 117, 112, 117, 121, 95, 123, 107, 89, 101, 83, 143, 191, 8, 186, 174, 15, 208, 178, 60, 146, 227, 53, 170, 160, 108, 133, 119, 143, 97, 104, 140, 115, 60, 167, 105, 86, 147, 138, 94, 139, 159, 106, 138, 147, 134, 117, 143, 141, 108, 135, 136, 118, 125, 138, 122, 123, 148, 120, 137, 138, 139, 135, 143, 136, 136, 132, 135, 128, 123, 131, 124, 116, 116, 125, 104, 119, 114, 115, 100, 123, 112, 104, 117, 109, 95, 94, 95, 225, 86, 49, 251, 55, 108, 211, 139, 66, 200, 153, 80, 176, 130, 122, 101, 150, 110, 91, 122, 143, 64, 116, 164, 73, 118, 159, 115, 102, 164, 138, 106, 151, 149, 112, 131, 156, 116, 113, 151, 120, 108, 139, 132, 99, 143, 140, 109, 134, 149, 129, 125, 156, 136, 130, 147, 140, 130, 141, 132, 122, 123, 124, 118, 109, 124, 118, 112, 120, 124, 114, 125, 129, 119, 123, 123, 126, 117, 124, 107, 111, 114, 90, 99, 220, 53, 91, 234, 32, 122, 206, 114, 76, 219, 120, 101, 170, 133, 123, 96, 159, 110, 95, 130, 138, 66, 135, 152, 76, 130, 155, 110, 108, 162, 129, 109, 149, 140, 112, 128, 151, 108, 118, 150, 117, 112, 150, 132, 102, 154, 134, 115, 146, 149, 119, 143, 150, 125, 131, 145, 133, 117, 145, 131, 117, 131, 135, 119, 119, 140, 123, 118, 137, 134, 120, 132, 143, 124, 125, 143, 121, 125, 134, 119, 128, 119, 111, 115, 116, 98, 108, 92, 91, 86, 196, 69, 64, 232, 45, 115, 198, 117, 93, 207, 126, 112, 175, 130, 136, 109, 151, 112, 103, 126, 131, 72, 126, 141, 78, 128, 145, 104, 113, 155, 120, 115, 149, 136, 115, 135, 151, 112, 124, 151, 116, 118, 143, 125, 101, 145, 122, 107, 135, 129, 115, 126, 138, 123, 133, 147, 137, 140, 150, 142, 145, 142, 145, 141, 135, 140, 137, 128, 132, 126, 119, 122, 122, 118, 122, 123, 123, 125, 133, 121, 133, 129, 125, 131, 123, 125, 116, 126, 110, 95, 134, 92, 84, 129, 73, 90, 119, 163, 48, 140, 180, 56, 153, 177, 122, 108, 204, 118, 130, 151, 148, 113, 105, 150, 95, 95, 129, 115, 61, 138, 116, 83, 125, 134, 110, 112, 154, 125, 115, 148, 143, 116, 138, 154, 110, 131, 146, 118, 118, 141, 121, 107, 137, 122, 114, 125, 135, 118, 123, 140, 129, 119, 141, 136, 115, 147, 152, 117, 143, 155, 125, 136, 150, 131, 133, 147, 136, 130, 139, 141, 123, 126, 138, 119, 120, 140, 122, 118, 137, 129, 122, 130, 133, 120, 118, 130, 117, 112, 108, 119, 95, 101, 106, 98, 97, 107, 78, 93, 110, 136, 130, 55, 204, 112, 93, 193, 141, 106, 169, 165, 95, 168, 133, 124, 111, 130, 113, 91, 117, 119, 84, 100, 140, 88, 112, 139, 118, 109, 144, 138, 108, 146, 138, 121, 132, 143, 130, 117, 143, 129, 120, 132, 139, 113, 129, 142, 118, 125, 138, 129, 119, 140, 132, 121, 132, 136, 120, 130, 136, 123, 130, 144, 126, 132, 145, 133, 132, 140, 143, 128, 139, 142, 135, 131, 138, 134, 128, 134, 135, 123, 132, 137, 120, 128, 131, 121, 125, 121, 115, 120, 111, 124, 101, 108, 106, 103, 98, 99, 114, 85, 103, 101, 88, 108, 168, 75, 102, 202, 82, 114, 197, 120, 105, 187, 135, 119, 148, 138, 125, 100, 135, 121, 84, 120, 132, 69, 117, 142, 85, 118, 144, 114, 110, 149, 132, 115, 142, 139, 118, 131, 152, 118, 124, 147, 125, 119, 141, 133, 112, 139, 137, 118, 130, 141, 122, 122, 143, 131, 120, 138, 135, 118, 132, 137, 124, 120, 137, 129, 128, 137, 131, 135, 131, 141, 133, 133, 142, 138, 130, 142, 144, 123, 140, 139, 122, 126, 134, 126, 117, 122, 130, 107, 117, 129, 106, 115, 123, 104, 113, 120, 105, 116, 115, 110, 108, 122, 105, 107, 117, 109, 105, 96, 105, 132, 126, 88, 142, 139, 99, 139, 159, 113, 136, 161, 123, 136, 144, 135, 125, 124, 124, 120, 111, 121, 119, 101, 121, 126, 104, 124, 137, 114, 121, 141, 125, 122, 140, 135, 125, 135, 142, 125, 133, 142, 131, 129, 139, 132, 128, 137, 132, 128, 131, 132, 131, 131, 131, 133, 129, 129, 135, 130, 125, 135, 131, 124, 131, 139, 125, 128, 144, 123, 132, 143, 128, 131, 144, 131, 129, 140, 131, 126, 133, 131, 122, 126, 129, 123, 116, 129, 124, 111, 129, 125, 109, 121, 131, 115, 112, 126, 126, 108, 122, 130, 108, 116, 130, 106, 115, 125, 108, 113, 116, 104, 107, 101, 126, 130, 95, 136, 136, 110, 132, 151, 119, 138, 155, 130, 142, 143, 139, 129, 132, 130, 125, 114, 128, 120, 106, 124, 122, 113, 123, 133, 114, 130, 133, 126, 132, 133, 136, 133, 136, 137, 135, 133, 138, 135, 133, 137, 133, 131, 134, 132, 129, 134, 130, 128, 133, 130, 129, 133, 126, 126, 134, 128, 126, 129, 128, 131, 126, 130, 137, 124, 128, 140, 128, 129, 141, 129, 130, 137, 131, 131, 131, 129, 128, 125, 131, 128, 122, 128, 125, 120, 126, 128, 117, 123, 124, 119, 120, 124, 119, 123, 120, 123, 125, 113, 123, 129, 112, 120, 130, 115, 120, 122, 116, 111, 109, 114, 142, 108, 117, 146, 119, 124, 142, 139, 125, 148, 140, 142, 135, 141, 141, 125, 131, 135, 122, 116, 134, 113, 114, 124, 124, 113, 123, 131, 120, 128, 133, 132, 129, 135, 136, 134, 132, 137, 135, 132, 134, 136, 132, 128, 132, 131, 124, 130, 128, 124, 129, 126, 128, 128, 124, 129, 130, 123, 131, 131, 122, 130, 130, 123, 132, 130, 126, 134, 131, 131, 133, 135, 134, 132, 134, 136, 131, 131, 136, 129, 124, 131, 126, 120, 129, 125, 117, 123, 125, 115, 121, 129, 117, 117, 128, 120, 115, 123, 130, 118, 118, 131, 123, 119, 129, 126, 119, 122, 128, 120, 120, 130, 119, 110, 121, 122, 101, 105, 123, 122, 104, 129, 126, 113, 129, 133, 132, 130, 140, 136, 143, 132, 139, 139, 128, 128, 130, 121, 117, 125, 115, 115, 115, 118, 117, 122, 122, 124, 128, 126, 131, 132, 128, 132, 133, 126, 130, 131, 128, 126, 129, 125, 124, 123, 125, 124, 124, 124, 126, 125, 126, 126, 126, 128, 125, 125, 125, 128, 124, 126, 123, 123, 125, 124, 123, 125, 130, 126, 129, 131, 130, 129, 133, 129, 129, 134, 128, 131, 131, 126, 126, 126, 125, 123, 121, 122, 124, 118, 121, 125, 118, 122, 125, 122, 122, 124, 119, 129, 125, 116, 129, 131, 117, 124, 135, 116, 122, 133, 126, 115, 130, 135, 113, 120, 135, 120, 116, 126, 123, 118, 117, 118, 116, 123, 113, 110, 120, 118, 101, 115, 125, 106, 115, 126, 125, 114, 130, 131, 126, 130, 135, 136, 128, 134, 133, 130, 124, 129, 124, 119, 119, 122, 119, 116, 120, 122, 120, 121, 124, 122, 123, 125, 129, 124, 124, 129, 129, 123, 124, 133, 124, 122, 129, 128, 124, 124, 129, 124, 124, 131, 126, 124, 129, 129, 129, 126, 130, 131, 124, 126, 130, 124, 124, 126, 125, 125, 123, 126, 125, 125, 129, 130, 125, 130, 131, 130, 129, 131, 132, 131, 132, 128, 130, 130, 125, 129, 126, 123, 126, 124, 123, 119, 126, 123, 122, 121, 122, 122, 123, 126, 116, 121, 130, 126, 113, 130, 128, 123, 122, 124, 130, 120, 126, 125, 131, 122, 123, 133, 115, 125, 129, 125, 117, 124, 125, 119, 125, 116, 131, 120, 118, 124, 128, 119, 113, 133, 120, 120, 120, 118, 129, 122, 110, 121, 136, 115, 115, 128, 129, 119, 126, 129, 129, 130, 123, 137, 130, 132, 125, 137, 121, 125, 133, 124, 124, 119, 131, 120, 121, 114, 130, 126, 121, 122, 133, 133, 128, 129, 134, 140, 126, 131, 136, 139, 130, 126, 136, 134, 126, 124, 131, 133, 118, 124, 135, 126, 115, 126, 137, 121, 117, 132, 129, 126, 115, 128, 137, 119, 113, 129, 126, 124, 104, 128, 141, 104, 114, 126, 131, 108, 116, 113, 131, 131, 119, 120, 134, 134, 122, 129, 137, 133, 125, 139, 129, 135, 130, 120, 128, 133, 114, 122, 125, 124, 119, 120, 121, 126, 128, 122, 129, 128, 125, 124, 131, 129, 132, 119, 135, 125, 128, 125, 123, 135, 123, 130, 130, 126, 129, 130, 128, 126, 126, 137, 129, 123, 125, 137, 129, 123, 128, 134, 130, 121, 124, 134, 132, 116, 121, 138, 132, 112, 124, 139, 124, 117, 133, 132, 126, 123, 122, 136, 137, 111, 133, 136, 129, 121, 124, 138, 121, 122, 122, 139, 115, 121, 122, 130, 126, 112, 128, 135, 120, 119, 133, 118, 133, 124, 122, 126, 132, 123, 129, 130, 121, 130, 128, 120, 126, 134, 124, 121, 126, 137, 121, 123, 128, 131, 125, 117, 131, 136, 123, 123, 130, 131, 125, 122, 128, 136, 122, 125, 126, 124, 137, 114, 128, 128, 135, 119, 129, 129, 131, 133, 122, 135, 123, 135, 123, 136, 123, 131, 132, 128, 131, 123, 129, 131, 129, 120, 129, 136, 124, 113, 143, 123, 130, 122, 125, 131, 126, 130, 114, 137, 125, 140, 115, 122, 137, 132, 125, 116, 132, 140, 120, 115, 131, 131, 132, 114, 126, 136, 130, 117, 122, 128, 135, 120, 117, 125, 138, 122, 122, 123, 133, 129, 116, 131, 121, 137, 115, 138, 115, 133, 125, 129, 125, 122, 132, 122, 136, 117, 134, 120, 146, 115, 123, 129, 137, 129, 110, 133, 132, 138, 108, 125, 137, 134, 116, 125, 136, 131, 121, 120, 132, 133, 123, 121, 135, 123, 131, 129, 122, 128, 143, 115, 123, 128, 131, 130, 119, 133, 123, 137, 114, 124, 132, 134, 114, 124, 141, 114, 131, 124, 124, 135, 122, 114, 128, 135, 120, 125, 117, 135, 134, 111, 128, 121, 145, 119, 108, 133, 136, 124, 119, 119, 129, 138, 123, 112, 121, 142, 129, 110, 121, 142, 118, 125, 120, 124, 135, 123, 112, 132, 130, 106, 150, 120, 120, 126, 128, 123, 126, 123, 112, 149, 112, 126, 132, 129, 121, 125, 132, 120, 122, 131, 134, 114, 134, 119, 134, 129, 111, 123, 143, 116, 129, 125, 123, 129, 133, 124, 115, 140, 114, 143, 106, 124, 133, 136, 118, 116, 135, 125, 122, 123, 119, 138, 134, 116, 123, 122, 138, 113, 134, 110, 142, 116, 132, 115, 130, 131, 117, 129, 118, 138, 113, 140, 110, 125, 133, 128, 119, 123, 120, 139, 120, 116, 128, 130, 125, 122, 123, 124, 138, 120, 117, 135, 130, 119, 122, 120, 139, 115, 133, 117, 132, 121, 129, 123, 130, 126, 118, 134, 115, 141, 116, 135, 116, 137, 117, 123, 133, 123, 126, 113, 140, 121, 136, 114, 123, 128, 143, 119, 112, 130, 132, 139, 101, 131, 134, 134, 115, 121, 124, 134, 138, 107, 115, 140, 142, 109, 113, 136, 136, 125, 112, 121, 142, 129, 111, 121, 142, 125, 128, 107, 129, 145, 124, 112, 118, 139, 128, 122, 109, 140, 134, 114, 126, 121, 137, 126, 114, 126, 134, 121, 120, 138, 123, 123, 121, 123, 134, 130, 116, 120, 138, 136, 112, 119, 136, 132, 126, 109, 122, 145, 130, 107, 128, 138, 126, 125, 119, 130, 133, 123, 119, 129, 129, 131, 126, 116, 128, 128, 132, 121, 123, 138, 123, 115, 138, 113, 140, 128, 111, 138, 132, 122, 107, 152, 125, 134, 103, 119, 159, 122, 106, 114, 161, 135, 106, 110, 135, 148, 123, 99, 119, 155, 144, 99, 108, 144, 143, 122, 102, 124, 147, 125, 110, 121, 132, 138, 129, 112, 121, 135, 133, 117, 124, 118, 140, 131, 122, 107, 123, 145, 122, 122, 105, 143, 136, 122, 107, 124, 150, 130, 111, 107, 139, 142, 119, 106, 128, 139, 135, 112, 110, 137, 141, 126, 110, 120, 141, 137, 113, 106, 136, 141, 129, 103, 119, 152, 126, 124, 106, 125, 148, 130, 100, 114, 157, 133, 115, 105, 134, 134, 137, 108, 110, 156, 129, 116, 105, 146, 118, 137, 119, 110, 144, 130, 122, 108, 136, 118, 138, 122, 119, 125, 137, 121, 116, 123, 130, 130, 130, 113, 117, 149, 115, 125, 119, 130, 123, 137, 114, 115, 142, 124, 119, 125, 120, 128, 136, 121, 105, 131, 145, 108, 126, 112, 148, 121, 117, 120, 122, 148, 102, 123, 135, 137, 113, 120, 124, 120, 135, 120, 116, 135, 129, 119, 123, 114, 133, 129, 125, 122, 123, 126, 120, 129, 121, 131, 121, 130, 122, 115, 138, 120, 133, 124, 115, 121, 138, 122, 117, 130, 134, 130, 107, 123, 130, 135, 119, 116, 137, 130, 115, 118, 140, 122, 124, 114, 128, 134, 120, 131, 119, 121, 136, 129, 100, 133, 125, 143, 121, 112, 121, 131, 137, 103, 128, 132, 136, 120, 105, 123, 147, 124, 121, 107, 135, 133, 125, 109, 115, 150, 130, 116, 112, 132, 133, 132, 112, 117, 139, 137, 108, 123, 125, 131, 137, 117, 107, 133, 145, 120, 110, 121, 144, 135, 115, 110, 132, 139, 129, 110, 125, 136, 138, 111, 125, 130, 133, 129, 118, 117, 125, 145, 125, 118, 111, 144, 130, 123, 112, 134, 141, 124, 106, 124, 148, 128, 118, 123, 130, 128, 142, 103, 119, 150, 133, 111, 120, 121, 150, 120, 120, 121, 134, 139, 114, 126, 119, 144, 129, 119, 106, 132, 146, 125, 107, 131, 134, 147, 120, 102, 136, 146, 133, 101, 129, 141, 141, 116, 111, 134, 144, 125, 113, 126, 132, 139, 125, 115, 136, 135, 139, 110, 115, 149, 130, 128, 111, 133, 140, 123, 122, 119, 141, 124, 132, 126, 129, 135, 124, 121, 130, 131, 120, 135, 128, 134, 118, 132, 125, 137, 132, 121, 134, 126, 132, 128, 133, 123, 125, 134, 131, 122, 130, 128, 135, 126, 119, 133, 136, 125, 135, 121, 131, 137, 129, 119, 124, 141, 131, 121, 122, 138, 133, 128, 123, 134, 128, 139, 117, 132, 121, 142, 126, 120, 136, 123, 138, 114, 129, 125, 146, 121, 134, 123, 131, 124, 136, 116, 132, 133, 126, 135, 114, 137, 119, 145, 116, 128, 124, 142, 122, 124, 138, 121, 128, 140, 111, 128, 139, 128, 132, 119, 135, 122, 141, 112, 133, 128, 131, 124, 129, 132, 126, 131, 124, 131, 132, 129, 126, 132, 118, 133, 126, 136, 119, 129, 131, 132, 123, 123, 125, 141, 123, 130, 126, 123, 133, 129, 128, 108, 151, 115, 142, 110, 123, 133, 138, 128, 104, 143, 125, 140, 111, 128, 117, 151, 125, 106, 124, 143, 138, 108, 131, 113, 142, 122, 130, 113, 137, 134, 121, 121, 125, 132, 124, 140, 104, 133, 123, 146, 111, 116, 128, 133, 140, 109, 125, 122, 152, 117, 114, 121, 133, 141, 115, 112, 118, 150, 133, 112, 109, 134, 148, 119, 112, 115, 144, 136, 118, 110, 122, 145, 124, 118, 113, 132, 139, 116, 128, 106, 145, 136, 122, 111, 122, 144, 116, 131, 107, 133, 129, 134, 117, 115, 136, 130, 129, 115, 121, 128, 144, 121, 104, 131, 136, 129, 118, 122, 114, 145, 128, 112, 119, 129, 144, 113, 131, 108, 138, 133, 124, 110, 126, 142, 118, 131, 104, 135, 133, 128, 113, 116, 144, 118, 126, 122, 126, 124, 132, 126, 116, 132, 119, 125, 122, 134, 114, 122, 131, 125, 124, 128, 120, 124, 135, 121, 123, 122, 134, 123, 123, 121, 120, 128, 136, 110, 128, 128, 131, 122, 124, 122, 123, 144, 111, 128, 117, 142, 116, 130, 118, 119, 135, 122, 124, 112, 144, 116, 133, 117, 128, 118, 136, 129, 110, 129, 128, 131, 116, 132, 113, 134, 128, 121, 120, 131, 126, 119, 132, 121, 125, 128, 123, 120, 125, 131, 120, 121, 128, 126, 124, 122, 128, 122, 134, 117, 122, 129, 130, 122, 120, 128, 124, 130, 121, 121, 123, 132, 122, 122, 124, 125, 123, 130, 121, 125, 128, 125, 122, 122, 128, 123, 126, 124, 123, 124, 131, 119, 123, 126, 128, 122, 126, 124, 124, 130, 124, 123, 123, 129, 123, 122, 122, 128, 129, 125, 121, 122, 129, 130, 121, 122, 125, 129, 128, 121, 120, 126, 132, 125, 120, 123, 126, 130, 124, 122, 124, 128, 130, 123, 122, 124, 126, 126, 124, 121, 123, 128, 128, 120, 123, 128, 128, 125, 121, 125, 126, 129, 122, 122, 126, 128, 124, 120, 123, 125, 129, 123, 121, 124, 129, 126, 121, 122, 126, 130, 124, 122, 122, 126, 128, 124, 121, 124, 128, 126, 124, 123, 125, 128, 125, 121, 123, 125, 125, 125, 124, 124, 125, 126, 124, 123, 125, 128, 125, 124, 125, 125, 128, 125, 124, 124, 126, 125, 124, 125, 125, 126, 125, 126, 123, 124, 126, 126, 126, 124, 125, 126, 129, 124, 122, 125, 128, 126, 123, 124, 126, 128, 125, 123, 125, 126, 126, 125, 124, 125, 128, 125, 124, 124, 126, 128, 124, 124, 126, 128, 126, 125, 125, 128, 128, 125, 125, 126, 128, 128, 126, 125, 126, 128, 126, 126, 126, 128, 126, 126, 126, 125, 128, 126, 125, 125, 126, 128, 126, 125, 125, 128, 128, 126, 125, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 125, 125, 126, 128, 126, 126, 126, 128, 126, 126, 126, 126, 128, 126, 126, 126, 126, 128, 126, 126, 128, 126, 128, 126, 128, 126, 126, 126, 126, 126, 125, 126, 125, 126, 125, 126, 128, 126, 125, 126, 126, 126, 126, 128, 128, 126, 128, 126, 126, 125, 125, 126, 126, 125, 126, 126, 126, 125, 125, 126, 126, 126, 125, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 126, 128, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 128, 126, 125, 126, 126, 126, 125, 126, 126, 126, 126, 125, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 125, 126, 125, 126, 126, 126, 126, 125, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 125, 125, 125, 126, 126, 126, 126, 128, 126, 126, 126, 126, 126, 126, 128, 126, 125, 125, 126, 126, 126, 126, 126, 126, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 125, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 125, 126, 126, 126, 126, 125, 126, 125, 125, 125, 126, 125, 126, 125, 126, 126, 125, 126, 125, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 125, 126, 126, 126, 126, 126, 125, 126, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 125, 126, 128, 126, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 125, 125, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 125, 125, 126, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 125, 125, 126, 126, 126, 126, 126, 125, 125, 125, 125, 126, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 125, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 125, 125, 126, 125, 126, 126, 125, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 126, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 128, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 125, 125, 126, 126, 125, 125, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 125, 126, 125, 126, 126, 125, 126, 126, 126, 125, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 125, 126, 125, 126, 125, 126, 126, 126, 126, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 125, 125, 125, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 125, 126, 125, 125, 126, 126, 126, 125, 125, 126, 126, 125, 126, 126, 126, 126, 125, 126, 126, 126, 126, 125, 125, 126, 126, 125, 126, 126, 125, 126, 126, 128, 125, 126, 126, 126, 126, 126, 126, 125, 126, 126, 125, 126, 125, 126, 126, 126, 126, 125, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 126, 128, 126, 125, 126, 128, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 128, 126, 125, 125, 126, 128, 126, 125, 126, 125, 126, 128, 126, 126, 126, 125, 125, 128, 125, 125, 125, 128, 126, 126, 126, 126, 126, 126, 126, 126, 128, 125, 125, 126, 128, 126, 125, 126, 126, 125, 128, 126, 125, 124, 126, 128, 130, 125, 122, 125, 129, 129, 124, 123, 124, 129, 129, 125, 125, 124, 126, 126, 126, 126, 125, 125, 125, 128, 125, 124, 124, 128, 130, 123, 125, 126, 126, 126, 125, 124, 125, 125, 126, 129, 126, 124, 125, 128, 128, 126, 124, 128, 129, 126, 124, 126, 128, 125, 126, 128, 128, 123, 124, 130, 128, 125, 126, 125, 128, 128, 125, 124, 124, 125, 129, 128, 126, 125, 129, 125, 122, 132, 133, 125, 118, 126, 132, 131, 129, 114, 122, 132, 125, 134, 126, 118, 128, 126, 124, 137, 122, 122, 126, 126, 125, 130, 123, 120, 136, 129, 126, 122, 123, 125, 130, 125, 126, 125, 121, 123, 133, 132, 125, 123, 120, 126, 133, 124, 131, 128, 116, 126, 131, 135, 126, 119, 120, 134, 125, 126, 122, 125, 132, 129, 131, 123, 125, 131, 130, 115, 130, 135, 132, 115, 123, 134, 134, 120, 118, 138, 136, 119, 117, 135, 130, 130, 123, 123, 124, 130, 128, 131, 125, 118, 130, 135, 126, 119, 134, 133, 121, 119, 124, 136, 135, 122, 121, 125, 129, 132, 120, 129, 134, 121, 122, 126, 137, 131, 122, 126, 130, 124, 126, 130, 125, 125, 135, 117, 115, 145, 137, 116, 113, 133, 140, 123, 119, 123, 129, 141, 120, 117, 132, 128, 131, 118, 125, 136, 126, 121, 120, 132, 129, 122, 121, 129, 136, 121, 125, 133, 116, 119, 129, 132, 138, 125, 120, 120, 143, 139, 119, 110, 126, 128, 125, 134, 116, 124, 129, 119, 126, 136, 118, 131, 122, 124, 134, 131, 126, 117, 115, 135, 141, 121, 118, 110, 139, 128, 130, 119, 115, 134, 129, 132, 117, 125, 132, 124, 122, 126, 133, 121, 118, 135, 125, 124, 117, 126, 130, 124, 139, 113, 123, 131, 122, 132, 116, 121, 131, 131, 118, 121, 133, 125, 137, 113, 113, 131, 133, 144, 109, 111, 121, 137, 136, 114, 129, 116, 132, 122, 125, 119, 135, 133, 119, 123, 109, 135, 131, 133, 125, 113, 126, 131, 116, 131, 130, 125, 120, 111, 139, 137, 112, 123, 135, 119, 124, 125, 133, 114, 124, 133, 115, 128, 110, 147, 129, 120, 116, 120, 132, 123, 141, 108, 116, 132, 137, 120, 117, 112, 130, 134, 121, 126, 119, 128, 131, 132, 119, 113, 129, 118, 129, 124, 117, 114, 130, 142, 108, 114, 124, 145, 124, 125, 114, 131, 135, 114, 120, 113, 118, 128, 136, 117, 103, 117, 132, 147, 129, 97, 141, 135, 138, 132, 104, 105, 134, 128, 125, 131, 88, 132, 137, 108, 130, 137, 97, 141, 134, 125, 153, 114, 112, 124, 126, 111, 128, 118, 133, 108, 117, 134, 117, 123, 126, 128, 116, 140, 139, 126, 122, 132, 120, 131, 87, 116, 138, 123, 129, 122, 114, 107, 142, 130, 140, 106, 115, 146, 145, 120, 131, 107, 95, 130, 143, 135, 91, 126, 140, 117, 112, 145, 115, 106, 153, 134, 140, 102, 105, 161, 121, 121, 86, 125, 153, 134, 93, 102, 157, 120, 149, 110, 115, 137, 146, 108, 130, 122, 112, 159, 126, 99, 94, 152, 139, 123, 104, 115, 140, 144, 118, 112, 139, 123, 128, 115, 140, 124, 117, 132, 143, 116, 101, 153, 121, 122, 131, 139, 109, 111, 132, 130, 121, 111, 141, 140, 118, 106, 146, 138, 124, 118, 145, 120, 114, 154, 113, 118, 129, 110, 119, 131, 129, 106, 136, 137, 119, 126, 121, 145, 141, 129, 117, 129, 134, 129, 104, 130, 142, 114, 97, 135, 145, 111, 123, 139, 126, 101, 149, 145, 111, 131, 116, 121, 143, 136, 135, 121, 120, 90, 162, 139, 101, 135, 118, 148, 105, 132, 131, 108, 118, 123, 144, 118, 146, 134, 112, 124, 122, 144, 151, 144, 87, 103, 151, 139, 124, 124, 103, 128, 136, 107, 129, 134, 137, 133, 115, 107, 153, 138, 132, 119, 89, 149, 179, 136, 80, 98, 129, 153, 136, 126, 121, 103, 147, 145, 90, 108, 150, 107, 150, 137, 119, 133, 122, 116, 142, 150, 80, 160, 157, 118, 86, 113, 163, 118, 122, 103, 130, 152, 112, 115, 129, 146, 148, 122, 130, 107, 139, 138, 107, 138, 135, 114, 108, 137, 136, 144, 105, 111, 142, 130, 128, 119, 155, 111, 98, 141, 150, 144, 105, 134, 137, 118, 123, 131, 123, 105, 138, 143, 134, 115, 126, 105, 109, 143, 145, 124, 106, 132, 158, 140, 101, 147, 121, 106, 128, 134, 144, 141, 108, 77, 144, 135, 131, 129, 100, 135, 138, 139, 123, 130, 146, 146, 130, 92, 116, 148, 130, 114, 126, 113, 124, 133, 122, 116, 128, 146, 128, 123, 129, 132, 134, 141, 119, 124, 135, 107, 106, 140, 150, 120, 126, 121, 119, 117, 119, 159, 129, 115, 133, 123, 139, 119, 124, 149, 132, 106, 119, 129, 125, 128, 134, 154, 118, 117, 123, 120, 142, 151, 117, 113, 149, 94, 145, 154, 87, 145, 124, 117, 141, 122, 112, 133, 146, 97, 122, 129, 108, 105, 135, 113, 116, 141, 92, 120, 126, 121, 145, 138, 120, 151, 100, 136, 159, 140, 145, 81, 140, 180, 94, 75, 174, 140, 117, 97, 74, 172, 141, 97, 158, 82, 105, 155, 78, 156, 160, 66, 165, 181, 70, 166, 103, 41, 223, 151, 37, 146, 178, 112, 108, 167, 129, 143, 136, 117, 124, 104, 153, 134, 103, 139, 138, 103, 95, 155, 160, 38, 105, 161, 167, 110, 63, 168, 142, 45, 105, 164, 166, 148, 103, 102, 132, 165, 131, 177, 189, 128, 92, 112, 113, 130, 150, 147, 111, 95, 97, 105, 122, 112, 130, 107, 92, 87, 110, 94, 75, 66, 82, 95, 109, 199, 198, 148, 158, 104, 67, 99, 149, 182, 175, 186, 142, 135, 152, 166, 157, 148, 146, 101, 122, 142, 118, 145, 147, 97, 98, 80, 98, 118, 50, 9, 36, 77, 45, 0, 87, 247, 238, 209, 189, 79, 30, 63, 121, 156, 200, 180, 113, 105, 92, 102, 149, 179, 158, 120, 120, 91, 109, 226, 255, 235, 183, 67, 0, 37, 139, 180, 213, 179, 78, 39, 24, 35, 75, 94, 66, 23, 1, 134, 255, 241, 231, 157, 40, 19, 43, 84, 154, 229, 193, 118, 116, 77, 94, 159, 174, 178, 137, 97, 67, 106, 202, 203, 212, 171, 74, 54, 64, 113, 155, 191, 168, 78, 53, 14, 41, 83, 94, 74, 56, 206, 243, 198, 186, 94, 19, 27, 82, 138, 190, 231, 164, 104, 106, 81, 129, 163, 179, 150, 105, 101, 77, 138, 184, 179, 188, 155, 95, 63, 80, 122, 149, 185, 139, 65, 50, 44, 79, 97, 115, 75, 143, 255, 212, 167, 105, 20, 22, 86, 141, 187, 214, 196, 102, 81, 99, 106, 159, 173, 152, 100, 97, 101, 121, 192, 188, 164, 156, 109, 74, 83, 112, 142, 163, 166, 93, 48, 61, 73, 102, 121, 83, 112, 245, 234, 163, 120, 37, 6, 62, 133, 188, 225, 205, 115, 70, 96, 101, 143, 173, 150, 112, 98, 107, 102, 167, 194, 168, 164, 129, 88, 82, 108, 123, 147, 170, 121, 69, 65, 77, 102, 125, 98, 68, 188, 255, 203, 147, 55, 0, 29, 117, 189, 230, 222, 139, 58, 73, 99, 133, 186, 164, 121, 95, 99, 100, 136, 192, 170, 170, 155, 101, 86, 100, 108, 121, 159, 146, 99, 79, 75, 95, 118, 113, 61, 121, 254, 233, 165, 86, 7, 5, 86, 161, 211, 245, 181, 82, 55, 84, 110, 171, 191, 138, 106, 94, 93, 118, 173, 172, 168, 174, 125, 97, 104, 105, 99, 139, 149, 118, 101, 81, 88, 102, 115, 74, 85, 221, 247, 182, 114, 31, 3, 60, 139, 194, 248, 204, 95, 54, 70, 105, 172, 203, 147, 110, 83, 83, 119, 161, 178, 165, 173, 125, 101, 104, 105, 124, 126, 133, 118, 105, 90, 104, 114, 99, 76, 45, 162, 255, 217, 152, 49, 1, 20, 115, 188, 235, 231, 122, 58, 57, 98, 151, 197, 165, 115, 93, 70, 112, 153, 181, 173, 161, 130, 93, 102, 101, 134, 134, 131, 124, 100, 94, 96, 117, 99, 86, 45, 144, 255, 235, 170, 49, 0, 17, 104, 172, 230, 245, 141, 73, 41, 73, 143, 192, 182, 138, 102, 74, 101, 137, 167, 183, 174, 132, 86, 89, 102, 153, 147, 119, 104, 83, 98, 112, 128, 99, 74, 41, 151, 255, 228, 161, 41, 0, 24, 120, 192, 241, 229, 109, 57, 48, 96, 173, 196, 163, 119, 102, 68, 111, 152, 173, 197, 152, 109, 82, 101, 122, 159, 142, 109, 104, 75, 95, 129, 120, 98, 53, 69, 213, 255, 227, 124, 19, 4, 40, 142, 205, 251, 192, 95, 62, 49, 116, 181, 187, 161, 117, 80, 83, 139, 158, 193, 167, 114, 93, 83, 134, 166, 159, 111, 87, 75, 81, 123, 133, 118, 71, 42, 174, 251, 247, 170, 29, 0, 26, 119, 196, 254, 204, 105, 65, 39, 117, 176, 182, 162, 121, 97, 93, 135, 150, 184, 159, 105, 104, 108, 143, 160, 139, 96, 77, 87, 104, 131, 118, 95, 50, 60, 208, 255, 240, 132, 12, 0, 50, 146, 204, 247, 170, 92, 59, 65, 151, 176, 172, 131, 106, 103, 118, 163, 167, 162, 109, 92, 108, 139, 182, 157, 114, 65, 59, 96, 130, 142, 107, 70, 16, 125, 253, 249, 213, 57, 0, 9, 100, 194, 240, 221, 110, 75, 53, 112, 179, 185, 152, 98, 85, 105, 174, 193, 166, 117, 64, 95, 139, 189, 188, 116, 73, 44, 89, 119, 145, 129, 76, 22, 67, 232, 254, 230, 96, 0, 12, 78, 184, 229, 231, 126, 65, 58, 103, 186, 188, 153, 93, 74, 101, 163, 207, 174, 123, 61, 75, 136, 177, 195, 134, 78, 47, 69, 115, 145, 134, 84, 19, 60, 221, 254, 221, 96, 0, 12, 85, 187, 225, 234, 128, 66, 57, 91, 191, 192, 156, 92, 70, 100, 164, 203, 161, 118, 65, 80, 145, 177, 191, 143, 81, 41, 60, 105, 156, 161, 98, 31, 42, 200, 255, 230, 111, 1, 6, 72, 182, 226, 234, 145, 54, 57, 93, 189, 208, 145, 88, 73, 117, 158, 189, 146, 109, 80, 93, 161, 179, 177, 119, 59, 37, 77, 130, 146, 132, 63, 37, 161, 250, 238, 142, 19, 3, 61, 166, 209, 219, 163, 78, 71, 94, 162, 196, 158, 109, 79, 98, 146, 182, 154, 120, 88, 84, 144, 173, 178, 146, 86, 40, 45, 99, 154, 152, 87, 12, 101, 241, 252, 179, 48, 0, 33, 140, 211, 223, 187, 89, 62, 90, 144, 202, 168, 105, 80, 96, 146, 181, 156, 102, 92, 90, 145, 189, 171, 135, 78, 53, 74, 111, 137, 132, 99, 35, 73, 214, 250, 206, 87, 0, 18, 107, 202, 218, 195, 105, 55, 94, 140, 196, 171, 108, 84, 97, 148, 171, 160, 98, 87, 95, 135, 191, 169, 136, 92, 65, 69, 97, 132, 128, 111, 49, 55, 200, 255, 209, 89, 7, 18, 106, 203, 211, 187, 114, 62, 105, 146, 183, 164, 93, 83, 115, 162, 169, 151, 82, 76, 110, 150, 197, 163, 116, 86, 85, 91, 101, 116, 113, 112, 77, 54, 164, 254, 226, 111, 11, 6, 93, 202, 211, 178, 120, 67, 112, 157, 168, 155, 91, 83, 133, 176, 170, 138, 73, 72, 124, 155, 196, 162, 109, 84, 96, 107, 108, 108, 90, 101, 99, 75, 146, 251, 231, 124, 26, 1, 75, 193, 213, 163, 133, 88, 120, 167, 148, 141, 88, 82, 143, 190, 168, 122, 77, 67, 144, 157, 171, 156, 116, 109, 108, 102, 83, 91, 100, 117, 115, 73, 100, 219, 255, 159, 45, 5, 47, 163, 222, 170, 132, 105, 111, 169, 156, 124, 93, 81, 139, 195, 177, 112, 82, 68, 140, 171, 156, 146, 122, 118, 126, 118, 72, 77, 87, 118, 139, 102, 66, 136, 248, 219, 103, 14, 18, 107, 212, 198, 124, 116, 115, 159, 177, 123, 86, 78, 125, 184, 199, 123, 80, 78, 118, 182, 149, 117, 117, 147, 151, 134, 74, 54, 92, 118, 135, 111, 80, 74, 180, 255, 192, 62, 2, 53, 158, 221, 139, 86, 134, 170, 184, 134, 74, 79, 130, 168, 171, 141, 95, 112, 120, 137, 140, 116, 131, 154, 160, 125, 102, 78, 89, 101, 109, 109, 109, 110, 95, 168, 241, 201, 79, 14, 33, 132, 207, 150, 102, 142, 166, 178, 140, 67, 89, 138, 157, 148, 117, 120, 162, 142, 91, 90, 130, 179, 185, 125, 72, 110, 145, 122, 73, 46, 107, 146, 131, 78, 85, 203, 255, 155, 39, 32, 90, 171, 168, 91, 97, 182, 199, 161, 97, 69, 119, 155, 135, 113, 119, 149, 168, 122, 80, 109, 156, 174, 154, 100, 106, 154, 131, 83, 59, 69, 131, 149, 112, 65, 83, 197, 255, 171, 40, 31, 99, 166, 155, 68, 91, 198, 213, 163, 96, 77, 120, 141, 99, 125, 154, 160, 151, 94, 81, 143, 178, 137, 119, 124, 148, 151, 108, 79, 99, 103, 101, 114, 109, 112, 112, 84, 144, 246, 204, 69, 45, 108, 133, 130, 70, 88, 197, 211, 138, 101, 105, 141, 153, 84, 93, 169, 162, 129, 93, 99, 171, 179, 108, 102, 145, 156, 146, 108, 90, 113, 119, 96, 83, 113, 146, 107, 76, 78, 128, 225, 223, 89, 60, 136, 134, 98, 59, 76, 183, 215, 118, 100, 144, 173, 163, 83, 60, 152, 177, 104, 97, 122, 156, 174, 112, 101, 175, 164, 104, 97, 117, 153, 147, 72, 89, 138, 111, 101, 111, 96, 114, 111, 68, 174, 242, 122, 58, 131, 144, 106, 59, 56, 164, 204, 110, 110, 183, 165, 134, 96, 89, 139, 167, 112, 88, 115, 147, 173, 139, 108, 145, 155, 108, 114, 146, 124, 111, 120, 138, 138, 103, 90, 117, 126, 96, 99, 96, 73, 67, 175, 255, 124, 55, 146, 165, 99, 57, 61, 150, 191, 98, 106, 186, 164, 139, 111, 98, 149, 145, 93, 101, 124, 148, 143, 111, 131, 178, 137, 99, 138, 142, 142, 125, 110, 133, 153, 125, 95, 106, 123, 116, 106, 107, 107, 75, 77, 66, 72, 219, 236, 77, 93, 191, 129, 72, 58, 83, 180, 157, 73, 152, 189, 141, 117, 102, 145, 156, 88, 100, 154, 115, 118, 136, 130, 148, 144, 115, 140, 165, 129, 114, 123, 126, 124, 124, 115, 137, 144, 122, 114, 122, 125, 100, 92, 98, 107, 68, 30, 39, 132, 255, 200, 57, 122, 199, 113, 45, 54, 144, 186, 70, 66, 204, 192, 111, 103, 139, 183, 142, 58, 98, 150, 115, 97, 124, 160, 161, 128, 116, 157, 153, 120, 113, 128, 135, 119, 103, 119, 148, 140, 118, 136, 158, 130, 105, 112, 136, 129, 85, 67, 103, 94, 63, 13, 62, 220, 245, 122, 75, 199, 177, 58, 20, 75, 168, 143, 55, 124, 215, 159, 109, 116, 164, 180, 99, 64, 139, 128, 90, 114, 130, 152, 160, 116, 122, 165, 139, 105, 112, 126, 124, 117, 116, 133, 144, 137, 129, 150, 155, 137, 124, 140, 142, 109, 101, 112, 121, 115, 96, 70, 82, 87, 70, 39, 88, 217, 247, 103, 55, 180, 162, 65, 29, 80, 183, 174, 56, 130, 225, 165, 117, 102, 145, 180, 106, 54, 118, 143, 116, 104, 117, 156, 157, 110, 108, 148, 133, 101, 101, 114, 141, 133, 106, 132, 163, 151, 130, 133, 153, 155, 128, 124, 149, 143, 128, 122, 113, 131, 134, 102, 98, 111, 115, 105, 82, 85, 81, 57, 21, 46, 172, 255, 135, 59, 159, 179, 113, 44, 47, 148, 214, 76, 76, 201, 189, 147, 103, 105, 171, 154, 56, 86, 129, 134, 123, 101, 125, 176, 144, 88, 122, 139, 129, 113, 87, 109, 140, 129, 111, 156, 175, 153, 147, 133, 137, 129, 119, 115, 126, 139, 146, 136, 137, 155, 131, 99, 114, 132, 121, 126, 119, 109, 107, 91, 79, 82, 77, 76, 60, 78, 143, 249, 189, 51, 116, 161, 129, 79, 43, 90, 225, 163, 80, 163, 172, 173, 130, 61, 110, 176, 99, 69, 102, 128, 174, 137, 92, 142, 176, 133, 109, 98, 113, 147, 108, 85, 121, 157, 146, 129, 132, 142, 174, 160, 113, 104, 139, 144, 121, 101, 115, 159, 159, 136, 126, 136, 139, 132, 110, 117, 140, 131, 109, 96, 104, 122, 117, 91, 97, 117, 105, 99, 97, 74, 83, 140, 246, 175, 61, 104, 143, 145, 101, 41, 77, 227, 185, 93, 122, 147, 178, 149, 60, 67, 154, 145, 114, 81, 94, 181, 189, 112, 93, 136, 144, 136, 95, 78, 136, 155, 116, 109, 145, 152, 155, 125, 101, 140, 157, 121, 117, 148, 139, 154, 131, 110, 141, 152, 129, 125, 131, 131, 156, 133, 115, 129, 128, 114, 118, 111, 116, 132, 120, 113, 121, 123, 102, 86, 99, 103, 78, 70, 85, 109, 206, 241, 103, 84, 117, 111, 129, 92, 38, 136, 237, 156, 124, 115, 133, 171, 133, 51, 76, 139, 144, 148, 96, 108, 180, 180, 121, 102, 97, 114, 154, 106, 84, 120, 146, 148, 144, 123, 118, 150, 139, 112, 112, 126, 121, 136, 139, 128, 167, 169, 129, 123, 123, 117, 131, 117, 104, 141, 162, 149, 141, 116, 110, 130, 120, 115, 126, 126, 139, 144, 115, 101, 106, 108, 118, 110, 83, 88, 108, 119, 112, 80, 176, 255, 119, 66, 79, 91, 159, 141, 51, 94, 221, 189, 166, 106, 52, 132, 158, 113, 81, 97, 131, 181, 160, 105, 116, 140, 142, 130, 96, 72, 120, 155, 140, 125, 118, 121, 154, 155, 105, 102, 124, 136, 148, 140, 105, 118, 156, 143, 130, 117, 121, 163, 160, 116, 99, 100, 124, 153, 141, 120, 135, 145, 142, 133, 104, 107, 133, 144, 137, 134, 120, 120, 128, 107, 108, 114, 115, 119, 114, 100, 95, 95, 101, 82, 94, 213, 227, 101, 60, 66, 95, 170, 157, 64, 105, 192, 186, 178, 110, 46, 104, 158, 129, 104, 95, 112, 167, 184, 135, 112, 113, 105, 128, 121, 95, 107, 137, 147, 145, 132, 105, 120, 143, 128, 126, 118, 110, 139, 156, 120, 108, 122, 126, 146, 137, 113, 142, 165, 138, 116, 106, 104, 135, 158, 137, 136, 135, 123, 141, 135, 111, 112, 121, 132, 149, 142, 109, 100, 115, 121, 119, 113, 99, 98, 111, 108, 88, 89, 103, 84, 125, 239, 215, 90, 52, 50, 98, 184, 170, 81, 106, 173, 181, 195, 120, 37, 66, 135, 142, 138, 123, 107, 140, 170, 156, 118, 94, 73, 109, 143, 129, 114, 117, 132, 146, 151, 117, 106, 117, 125, 136, 134, 118, 122, 145, 131, 131, 131, 114, 120, 134, 137, 159, 164, 122, 103, 104, 114, 141, 147, 132, 135, 141, 132, 133, 122, 106, 115, 129, 137, 138, 137, 122, 108, 106, 112, 115, 119, 117, 111, 92, 79, 97, 98, 84, 87, 184, 249, 153, 69, 46, 62, 137, 187, 141, 87, 142, 165, 186, 173, 69, 34, 85, 149, 159, 155, 124, 93, 135, 171, 146, 116, 84, 71, 115, 155, 145, 123, 117, 121, 144, 148, 120, 103, 102, 120, 143, 151, 138, 125, 116, 117, 135, 136, 122, 115, 120, 144, 173, 154, 110, 93, 100, 130, 155, 147, 129, 128, 130, 137, 135, 119, 110, 116, 134, 151, 153, 128, 103, 97, 103, 107, 123, 135, 123, 103, 83, 79, 98, 110, 60, 113, 248, 221, 104, 52, 36, 84, 171, 194, 118, 110, 157, 145, 181, 152, 67, 38, 93, 145, 167, 176, 120, 94, 130, 163, 146, 112, 81, 65, 113, 167, 161, 132, 111, 109, 130, 151, 132, 99, 100, 124, 147, 161, 146, 110, 102, 125, 138, 139, 131, 117, 142, 166, 155, 119, 90, 96, 131, 153, 149, 145, 140, 126, 126, 123, 115, 112, 121, 133, 142, 148, 133, 107, 90, 94, 111, 121, 116, 99, 103, 106, 98, 92, 95, 176, 255, 179, 63, 27, 41, 111, 201, 208, 114, 115, 141, 155, 177, 124, 53, 38, 121, 164, 172, 162, 118, 95, 133, 161, 131, 103, 76, 80, 136, 179, 159, 120, 105, 104, 124, 147, 133, 105, 112, 131, 141, 158, 150, 110, 96, 125, 142, 151, 162, 137, 114, 122, 125, 121, 125, 124, 121, 146, 164, 155, 132, 100, 88, 111, 145, 152, 133, 119, 119, 125, 114, 93, 99, 112, 116, 105, 94, 88, 92, 96, 155, 244, 232, 112, 32, 28, 68, 154, 211, 161, 105, 145, 164, 172, 141, 69, 29, 77, 161, 183, 172, 133, 100, 111, 155, 149, 108, 86, 83, 113, 166, 178, 134, 106, 107, 116, 139, 143, 109, 95, 124, 154, 165, 159, 121, 91, 111, 151, 167, 156, 125, 99, 109, 142, 149, 126, 108, 118, 150, 167, 156, 119, 91, 94, 121, 144, 149, 135, 113, 107, 112, 113, 101, 104, 101, 85, 71, 87, 124, 176, 235, 246, 142, 31, 10, 48, 129, 192, 172, 129, 164, 171, 165, 141, 76, 25, 59, 146, 175, 181, 151, 114, 118, 152, 139, 99, 85, 81, 112, 162, 170, 138, 120, 119, 120, 131, 129, 108, 102, 129, 148, 152, 149, 134, 132, 149, 151, 125, 105, 102, 119, 150, 160, 144, 120, 117, 125, 133, 134, 133, 129, 121, 122, 120, 124, 128, 130, 112, 98, 99, 106, 123, 105, 69, 47, 70, 160, 229, 253, 211, 84, 11, 23, 86, 154, 177, 139, 144, 182, 183, 157, 99, 52, 49, 113, 153, 154, 143, 135, 143, 154, 142, 104, 85, 90, 115, 138, 145, 135, 129, 139, 137, 126, 110, 106, 112, 132, 145, 150, 160, 155, 146, 115, 105, 114, 132, 146, 144, 143, 136, 146, 135, 107, 100, 110, 132, 148, 149, 132, 110, 98, 111, 114, 103, 98, 112, 131, 113, 84, 46, 43, 125, 225, 255, 247, 144, 20, 15, 65, 121, 155, 149, 137, 189, 203, 159, 98, 54, 59, 106, 145, 139, 131, 126, 141, 146, 141, 113, 99, 111, 118, 122, 120, 121, 125, 136, 133, 129, 123, 115, 128, 165, 187, 150, 102, 97, 123, 145, 141, 133, 143, 164, 163, 139, 116, 110, 118, 131, 122, 117, 131, 142, 140, 109, 73, 72, 107, 136, 140, 101, 60, 79, 103, 101, 86, 72, 161, 250, 226, 120, 22, 31, 99, 179, 158, 101, 125, 186, 204, 159, 76, 31, 87, 151, 155, 125, 107, 121, 155, 150, 110, 88, 101, 131, 143, 135, 110, 116, 136, 138, 132, 134, 148, 144, 134, 116, 115, 138, 154, 156, 145, 130, 126, 138, 140, 133, 125, 120, 131, 146, 135, 117, 103, 106, 120, 126, 120, 105, 73, 78, 101, 106, 110, 118, 86, 72, 79, 79, 219, 240, 122, 55, 53, 95, 167, 179, 88, 122, 168, 182, 175, 93, 48, 108, 151, 132, 124, 113, 137, 158, 122, 75, 100, 130, 144, 151, 122, 114, 155, 168, 117, 96, 99, 116, 168, 169, 135, 138, 151, 139, 133, 114, 98, 136, 160, 146, 126, 111, 110, 141, 136, 111, 116, 116, 117, 124, 111, 104, 109, 109, 121, 121, 96, 87, 122, 129, 105, 91, 91, 94, 199, 236, 117, 81, 79, 96, 162, 152, 85, 134, 159, 155, 161, 107, 86, 130, 147, 113, 115, 129, 158, 165, 111, 113, 150, 123, 121, 133, 116, 142, 163, 130, 130, 137, 126, 136, 124, 132, 152, 135, 121, 129, 126, 132, 124, 108, 129, 153, 131, 109, 106, 114, 135, 139, 110, 84, 110, 160, 136, 105, 113, 93, 105, 113, 91, 117, 145, 89, 91, 130, 105, 153, 132, 56, 102, 151, 150, 145, 105, 82, 143, 147, 118, 120, 123, 124, 155, 146, 145, 182, 116, 75, 113, 159, 166, 146, 106, 109, 141, 155, 142, 117, 125, 124, 137, 131, 126, 125, 126, 124, 118, 132, 142, 144, 130, 117, 106, 133, 139, 121, 131, 123, 104, 125, 153, 121, 107, 108, 134, 151, 115, 83, 96, 116, 144, 113, 87, 116, 132, 125, 85, 103, 102, 125, 119, 84, 136, 163, 110, 67, 105, 142, 188, 171, 98, 96, 111, 147, 169, 131, 109, 151, 158, 152, 132, 109, 136, 137, 124, 115, 140, 143, 169, 135, 69, 91, 153, 182, 144, 102, 93, 129, 149, 148, 115, 122, 116, 121, 125, 147, 148, 125, 134, 83, 119, 142, 125, 137, 149, 102, 102, 114, 96, 161, 162, 99, 68, 92, 166, 199, 75, 6, 105, 200, 202, 107, 31, 75, 158, 148, 89, 106, 121, 150, 155, 89, 94, 173, 145, 105, 146, 112, 114, 128, 134, 174, 157, 84, 98, 142, 200, 186, 82, 72, 145, 156, 133, 139, 105, 145, 154, 135, 145, 142, 118, 116, 115, 107, 150, 168, 142, 100, 87, 134, 172, 153, 108, 108, 130, 146, 138, 107, 88, 114, 164, 137, 152, 116, 97, 120, 107, 126, 179, 115, 38, 82, 138, 154, 150, 105, 79, 110, 107, 189, 109, 52, 69, 134, 156, 167, 158, 40, 107, 177, 214, 135, 88, 121, 172, 113, 61, 152, 187, 203, 136, 89, 136, 181, 144, 100, 110, 132, 173, 171, 106, 99, 158, 145, 137, 131, 121, 157, 131, 108, 137, 157, 112, 99, 128, 152, 186, 130, 104, 106, 88, 142, 168, 152, 95, 87, 130, 144, 146, 90, 95, 110, 130, 118, 114, 113, 49, 86, 146, 184, 119, 69, 81, 125, 141, 99, 120, 141, 117, 163, 156, 48, 145, 184, 169, 142, 110, 179, 179, 82, 87, 184, 171, 154, 116, 95, 170, 208, 133, 64, 95, 203, 196, 100, 52, 124, 196, 162, 91, 93, 169, 151, 94, 97, 135, 202, 156, 70, 114, 141, 121, 123, 117, 47, 146, 156, 157, 161, 29, 88, 162, 83, 75, 126, 88, 115, 99, 138, 190, 83, 45, 117, 85, 172, 198, 110, 74, 124, 141, 159, 154, 56, 174, 183, 177, 203, 134, 75, 165, 112, 103, 196, 188, 189, 123, 45, 123, 205, 134, 148, 107, 118, 180, 134, 73, 102, 133, 172, 155, 113, 103, 114, 139, 150, 92, 85, 155, 106, 120, 104, 77, 109, 125, 114, 96, 76, 5, 79, 178, 147, 171, 112, 94, 142, 114, 84, 88, 137, 173, 172, 129, 90, 157, 163, 153, 107, 78, 182, 215, 154, 149, 186, 71, 103, 151, 150, 164, 165, 122, 158, 186, 110, 95, 100, 171, 161, 132, 95, 112, 122, 169, 145, 82, 128, 138, 90, 60, 137, 103, 110, 120, 41, 23, 43, 24, 65, 242, 223, 103, 108, 96, 96, 94, 96, 101, 177, 228, 145, 115, 83, 139, 152, 129, 106, 133, 178, 157, 142, 83, 121, 138, 182, 174, 151, 105, 126, 148, 83, 113, 144, 189, 162, 144, 83, 120, 126, 100, 149, 168, 150, 97, 85, 72, 77, 74, 120, 146, 105, 37, 0, 21, 193, 255, 144, 33, 74, 166, 170, 87, 34, 107, 200, 232, 134, 91, 108, 154, 129, 105, 120, 135, 167, 122, 118, 123, 154, 123, 116, 132, 144, 231, 164, 46, 44, 148, 153, 153, 150, 121, 169, 152, 94, 73, 135, 120, 134, 119, 89, 108, 93, 52, 36, 78, 29, 12, 175, 255, 178, 64, 36, 102, 159, 144, 76, 112, 193, 209, 140, 80, 80, 115, 146, 115, 116, 141, 170, 149, 108, 103, 124, 144, 131, 113, 117, 159, 136, 146, 201, 114, 27, 82, 161, 161, 168, 125, 116, 146, 129, 104, 84, 108, 109, 122, 86, 78, 79, 72, 28, 64, 244, 203, 95, 68, 96, 112, 138, 129, 97, 176, 198, 151, 92, 87, 103, 136, 121, 93, 123, 167, 183, 122, 100, 110, 140, 135, 102, 102, 119, 157, 156, 145, 151, 154, 109, 55, 78, 131, 176, 167, 140, 122, 142, 121, 68, 85, 118, 126, 96, 87, 74, 79, 122, 247, 189, 60, 69, 119, 141, 128, 101, 79, 201, 207, 134, 74, 102, 118, 131, 112, 84, 139, 180, 181, 101, 102, 122, 150, 120, 90, 96, 132, 161, 146, 130, 117, 151, 156, 105, 86, 108, 135, 146, 144, 125, 133, 139, 108, 106, 116, 125, 116, 108, 93, 98, 93, 122, 232, 229, 63, 33, 112, 143, 131, 78, 58, 186, 255, 147, 83, 97, 134, 136, 86, 52, 123, 191, 184, 109, 109, 155, 175, 118, 52, 72, 129, 157, 136, 123, 135, 177, 167, 120, 91, 99, 108, 113, 117, 140, 172, 173, 126, 103, 97, 94, 103, 102, 89, 95, 97, 111, 195, 255, 138, 30, 105, 138, 111, 54, 50, 150, 255, 173, 84, 128, 169, 155, 79, 27, 83, 171, 164, 116, 120, 177, 200, 148, 60, 70, 129, 132, 92, 97, 138, 185, 173, 141, 146, 133, 110, 74, 71, 112, 160, 166, 161, 152, 121, 89, 71, 92, 92, 96, 80, 101, 181, 255, 151, 36, 126, 152, 106, 49, 43, 125, 232, 145, 80, 162, 197, 167, 84, 49, 104, 149, 111, 78, 117, 181, 202, 150, 100, 131, 155, 111, 58, 81, 119, 164, 142, 134, 173, 180, 146, 93, 92, 101, 124, 112, 128, 155, 158, 105, 74, 102, 93, 74, 78, 136, 197, 255, 109, 52, 167, 150, 93, 40, 44, 149, 220, 75, 93, 202, 196, 176, 84, 70, 152, 147, 53, 63, 119, 167, 179, 110, 130, 193, 179, 99, 85, 104, 121, 123, 90, 144, 159, 173, 144, 112, 140, 146, 111, 92, 130, 129, 129, 81, 88, 99, 89, 58, 89, 180, 236, 213, 50, 119, 195, 134, 72, 15, 68, 191, 136, 31, 145, 200, 203, 166, 85, 139, 196, 100, 44, 68, 100, 171, 112, 69, 164, 208, 167, 121, 129, 149, 163, 110, 77, 97, 140, 145, 104, 123, 155, 169, 153, 119, 84, 120, 128, 81, 58, 72, 82, 54, 111, 233, 235, 76, 97, 189, 190, 150, 21, 39, 189, 141, 22, 81, 130, 190, 189, 77, 131, 222, 183, 128, 73, 77, 175, 138, 51, 83, 120, 153, 151, 95, 131, 223, 189, 120, 100, 121, 162, 126, 74, 114, 172, 159, 117, 71, 112, 161, 95, 41, 71, 117, 122, 56, 70, 231, 206, 77, 124, 156, 204, 195, 22, 46, 186, 153, 101, 60, 41, 196, 201, 61, 92, 143, 185, 221, 78, 43, 191, 190, 142, 88, 45, 148, 198, 111, 105, 117, 145, 188, 113, 84, 137, 143, 148, 124, 93, 153, 160, 105, 113, 112, 99, 123, 89, 70, 111, 101, 59, 147, 254, 151, 79, 110, 149, 230, 150, 26, 110, 169, 156, 136, 45, 66, 191, 149, 103, 112, 82, 170, 194, 88, 100, 152, 141, 184, 134, 53, 142, 173, 158, 148, 77, 114, 171, 136, 110, 76, 97, 173, 162, 100, 123, 133, 160, 155, 88, 113, 135, 146, 131, 84, 89, 137, 110, 79, 81, 125, 185, 130, 64, 98, 135, 125, 146, 104, 112, 185, 162, 122, 133, 148, 178, 166, 86, 85, 160, 169, 140, 70, 44, 152, 183, 129, 97, 94, 152, 216, 129, 101, 136, 145, 141, 90, 74, 130, 165, 119, 130, 114, 142, 180, 118, 103, 135, 119, 166, 130, 98, 138, 144, 133, 103, 93, 106, 138, 98, 81, 95, 122, 145, 117, 82, 107, 142, 162, 142, 119, 117, 159, 170, 143, 113, 105, 124, 140, 134, 103, 107, 122, 165, 136, 110, 114, 146, 155, 132, 113, 105, 150, 141, 119, 91, 129, 161, 129, 101, 95, 137, 149, 134, 109, 129, 147, 155, 119, 122, 135, 132, 144, 125, 130, 109, 121, 125, 106, 115, 130, 118, 128, 118, 110, 117, 118, 126, 121, 109, 117, 125, 112, 120, 114, 115, 129, 128, 135, 125, 136, 117, 135, 141, 120, 139, 122, 132, 130, 136, 120, 136, 125, 135, 122, 128, 116, 114, 130, 114, 133, 102, 145, 123, 131, 112, 135, 128, 140, 129, 128, 124, 125, 149, 111, 128, 106, 151, 102, 160, 98, 120, 142, 118, 128, 105, 140, 108, 142, 109, 119, 116, 128, 119, 122, 96, 134, 125, 115, 112, 108, 121, 125, 136, 99, 140, 112, 143, 133, 126, 136, 130, 133, 132, 123, 124, 135, 129, 112, 132, 124, 113, 141, 105, 131, 111, 118, 128, 123, 109, 104, 128, 119, 93, 103, 122, 120, 129, 133, 161, 130, 145, 143, 131, 135, 135, 136, 131, 126, 121, 125, 115, 113, 113, 116, 112, 114, 113, 123, 124, 118, 124, 129, 125, 126, 125, 124, 126, 124, 123, 123, 124, 120, 121, 122, 125, 125, 126, 129, 129, 130, 131, 129, 129, 130, 128, 130, 128, 126, 128, 126, 120, 120, 120, 125, 121, 121, 122, 123, 124, 123, 126, 122, 125, 128, 130, 129, 134, 133, 133, 132, 132, 137, 134, 134, 134, 135, 133, 131, 128, 129, 125, 123, 120, 120, 122, 121, 120, 120, 120, 120, 122, 122, 123, 122, 124, 124, 124, 128, 129, 129, 125, 126, 129, 129, 125, 124, 125, 124, 123, 124, 122, 123, 122, 120, 123, 123, 123, 124, 128, 125, 124, 126, 129, 130, 128, 128, 128, 128, 128, 126, 125, 125, 124, 124, 124, 125, 125, 125, 126, 125, 129, 129, 129, 130, 129, 132, 130, 130, 130, 126, 126, 126, 128, 125, 122, 124, 124, 124, 125, 125, 124, 125, 124, 124, 125, 126, 125, 125, 126, 125, 126, 126, 126, 128, 128, 128, 128, 129, 128, 126, 126, 126, 125, 125, 124, 124, 123, 123, 123, 123, 124, 123, 124, 125, 123, 125, 126, 128, 126, 128, 129, 129, 128, 129, 129, 129, 128, 128, 128, 128, 129, 126, 128, 128, 128, 129, 129, 129, 129, 130, 129, 128, 129, 129, 128, 128, 126, 126, 125, 125, 125, 124, 125, 124, 124, 125, 125, 126, 126, 125, 126, 128, 126, 126, 128, 126, 128, 128, 126, 126, 126, 126, 125, 126, 125, 125, 125, 125, 125, 124, 125, 124, 125, 125, 125, 126, 125, 126, 126, 126, 128, 126, 126, 126, 128, 128, 128, 128, 129, 130, 128, 129, 130, 130, 130, 130, 129, 130, 130, 130, 130, 129, 130, 129, 130, 130, 129, 129, 128, 128, 128, 128, 126, 126, 126, 124, 125, 125, 124, 125, 124, 125, 125, 125, 126, 125, 125, 125, 126, 128, 128, 128, 129, 128, 128, 129, 128, 126, 126, 126, 126, 125, 124, 125, 125, 124, 124, 124, 124, 123, 124, 125, 124, 124, 125, 126, 125, 128, 129, 129, 130, 130, 131, 131, 132, 132, 132, 132, 132, 132, 132, 132, 132, 131, 132, 131, 131, 131, 130, 130, 130, 130, 128, 128, 128, 126, 128, 126, 125, 126, 125, 124, 125, 124, 125, 126, 125, 126, 126, 126, 126, 126, 126, 126, 128, 126, 126, 126, 126, 126, 126, 126, 125, 125, 124, 124, 124, 124, 125, 124, 124, 123, 124, 124, 125, 128, 128, 129, 129, 131, 129, 130, 130, 130, 130, 132, 130, 130, 128, 129, 129, 129, 128, 128, 128, 128, 130, 126, 128, 126, 131, 125, 132, 128, 133, 125, 136, 129, 131, 120, 132, 128, 131, 119, 129, 132, 142, 145, 78, 170, 98, 93, 169, 226, 101, 14, 160, 227, 179, 35, 33, 178, 232, 66, 44, 105, 184, 157, 114, 95, 84, 128, 143, 170, 139, 93, 104, 172, 170, 136, 113, 137, 153, 128, 107, 106, 137, 160, 123, 129, 139, 125, 147, 166, 163, 125, 118, 151, 163, 196, 175, 95, 104, 173, 182, 111, 74, 40, 84, 171, 133, 30, 35, 80, 91, 92, 40, 7, 16, 147, 244, 80, 45, 165, 147, 195, 163, 92, 94, 172, 251, 103, 80, 115, 105, 153, 109, 71, 46, 126, 173, 58, 73, 122, 137, 167, 136, 96, 120, 222, 237, 112, 102, 149, 164, 170, 97, 80, 125, 188, 143, 63, 101, 116, 102, 81, 78, 105, 106, 85, 49, 56, 75, 3, 89, 254, 98, 9, 219, 191, 105, 110, 126, 164, 172, 185, 37, 134, 214, 94, 82, 81, 148, 112, 98, 92, 61, 173, 147, 74, 123, 173, 163, 116, 145, 162, 196, 173, 88, 129, 170, 136, 77, 103, 155, 134, 111, 92, 125, 139, 86, 89, 114, 130, 91, 86, 74, 87, 42, 64, 248, 89, 27, 246, 146, 59, 133, 170, 160, 114, 147, 96, 194, 139, 50, 155, 138, 120, 53, 160, 134, 63, 140, 116, 147, 123, 120, 140, 155, 150, 103, 184, 170, 108, 131, 147, 138, 103, 115, 132, 142, 111, 110, 149, 108, 103, 122, 112, 107, 115, 111, 101, 97, 36, 138, 225, 30, 102, 247, 81, 75, 166, 187, 99, 124, 162, 124, 182, 73, 149, 160, 85, 102, 138, 159, 41, 130, 157, 101, 105, 138, 153, 114, 131, 139, 156, 144, 144, 132, 150, 153, 104, 126, 144, 133, 104, 144, 142, 112, 111, 125, 130, 93, 109, 117, 111, 76, 98, 87, 155, 181, 1, 158, 230, 20, 111, 234, 129, 70, 192, 167, 106, 159, 117, 165, 122, 85, 149, 136, 92, 89, 156, 104, 95, 142, 124, 123, 122, 143, 141, 132, 129, 172, 173, 84, 150, 199, 84, 113, 191, 107, 109, 176, 120, 103, 137, 117, 101, 112, 91, 115, 98, 66, 68, 111, 221, 50, 60, 255, 62, 54, 251, 136, 45, 177, 198, 69, 155, 169, 109, 145, 96, 158, 123, 85, 136, 132, 103, 98, 154, 116, 101, 147, 131, 110, 137, 141, 122, 151, 146, 110, 158, 146, 101, 157, 143, 109, 156, 139, 101, 148, 129, 80, 141, 117, 68, 130, 106, 73, 77, 145, 181, 15, 123, 240, 22, 106, 250, 86, 68, 219, 161, 68, 183, 165, 115, 133, 119, 163, 106, 96, 148, 122, 89, 119, 148, 94, 113, 142, 114, 119, 133, 123, 130, 154, 134, 130, 152, 128, 139, 148, 122, 147, 154, 121, 130, 151, 111, 97, 135, 100, 80, 112, 88, 66, 81, 169, 136, 2, 177, 204, 1, 139, 239, 66, 77, 235, 144, 64, 193, 164, 111, 135, 133, 150, 113, 104, 137, 132, 87, 123, 160, 86, 105, 148, 112, 108, 133, 143, 129, 121, 140, 148, 126, 121, 160, 147, 114, 153, 157, 119, 131, 154, 115, 91, 125, 101, 77, 97, 87, 53, 90, 187, 89, 18, 212, 159, 4, 174, 204, 57, 119, 207, 117, 109, 175, 140, 161, 133, 115, 166, 116, 92, 136, 147, 98, 114, 152, 111, 106, 125, 125, 128, 113, 123, 146, 117, 115, 148, 138, 125, 155, 150, 126, 157, 150, 119, 137, 130, 109, 129, 122, 91, 100, 95, 76, 58, 96, 186, 81, 9, 208, 155, 19, 129, 158, 124, 111, 129, 163, 178, 121, 97, 190, 177, 103, 129, 159, 138, 107, 117, 151, 159, 124, 109, 144, 142, 101, 101, 125, 119, 118, 119, 113, 144, 131, 101, 155, 161, 124, 144, 150, 146, 183, 187, 134, 138, 132, 93, 131, 123, 75, 80, 57, 58, 134, 101, 32, 101, 135, 104, 93, 69, 121, 176, 129, 118, 167, 163, 144, 157, 144, 140, 159, 136, 123, 150, 151, 144, 151, 135, 118, 145, 144, 107, 118, 128, 118, 125, 115, 116, 132, 128, 131, 143, 143, 146, 154, 155, 152, 155, 154, 138, 128, 125, 116, 102, 78, 55, 56, 53, 82, 111, 52, 41, 96, 101, 100, 107, 114, 140, 153, 142, 159, 179, 163, 172, 174, 137, 134, 144, 134, 145, 139, 129, 147, 144, 118, 130, 137, 115, 125, 118, 106, 131, 133, 117, 131, 134, 124, 138, 148, 141, 154, 161, 148, 157, 142, 122, 137, 126, 94, 92, 85, 58, 50, 47, 97, 113, 33, 53, 119, 99, 89, 115, 124, 140, 153, 139, 158, 185, 155, 164, 178, 122, 124, 153, 136, 139, 143, 126, 149, 152, 112, 136, 150, 121, 123, 118, 110, 138, 136, 116, 143, 132, 118, 155, 145, 131, 161, 156, 149, 159, 128, 128, 142, 116, 112, 104, 75, 69, 59, 35, 78, 134, 60, 33, 107, 108, 98, 110, 108, 137, 160, 132, 150, 188, 157, 161, 186, 137, 125, 150, 133, 144, 154, 129, 140, 156, 128, 131, 140, 121, 128, 121, 99, 123, 142, 126, 125, 129, 125, 138, 148, 141, 145, 155, 162, 162, 149, 131, 133, 137, 123, 116, 89, 73, 71, 47, 37, 83, 121, 59, 40, 99, 101, 98, 114, 113, 130, 152, 141, 159, 188, 153, 162, 194, 147, 122, 139, 137, 156, 159, 124, 140, 157, 125, 138, 144, 113, 119, 125, 110, 116, 116, 117, 145, 135, 119, 133, 136, 141, 160, 161, 157, 156, 151, 155, 146, 126, 123, 125, 106, 86, 74, 51, 29, 38, 116, 117, 23, 48, 105, 96, 105, 121, 122, 136, 140, 141, 186, 187, 145, 178, 174, 131, 144, 140, 138, 153, 133, 132, 159, 131, 118, 144, 128, 117, 119, 106, 109, 121, 113, 122, 138, 126, 132, 133, 123, 148, 161, 159, 168, 160, 157, 162, 138, 136, 148, 128, 112, 97, 70, 59, 52, 28, 71, 130, 57, 30, 92, 83, 86, 118, 120, 142, 162, 138, 147, 184, 161, 173, 198, 145, 139, 156, 128, 145, 157, 132, 155, 154, 121, 140, 136, 108, 120, 115, 100, 109, 108, 110, 126, 116, 122, 138, 122, 131, 153, 152, 165, 175, 166, 170, 161, 142, 146, 145, 128, 117, 100, 83, 72, 49, 25, 46, 104, 79, 50, 95, 97, 85, 104, 110, 118, 144, 156, 168, 192, 170, 158, 180, 146, 126, 150, 147, 155, 159, 138, 139, 147, 125, 129, 141, 123, 119, 120, 104, 97, 103, 99, 110, 123, 120, 134, 133, 122, 140, 157, 164, 168, 166, 175, 177, 162, 152, 142, 138, 141, 133, 112, 92, 55, 13, 0, 23, 91, 120, 95, 101, 96, 83, 96, 98, 115, 166, 197, 204, 208, 164, 132, 156, 145, 136, 149, 151, 164, 155, 112, 103, 123, 130, 133, 136, 130, 129, 115, 83, 76, 90, 97, 111, 133, 137, 139, 139, 120, 128, 153, 176, 196, 188, 182, 185, 161, 138, 130, 118, 128, 134, 114, 90, 52, 14, 11, 12, 39, 122, 153, 111, 91, 69, 70, 110, 125, 152, 209, 221, 185, 162, 125, 121, 162, 162, 159, 175, 161, 130, 96, 76, 119, 163, 151, 142, 139, 113, 94, 75, 74, 109, 119, 105, 107, 113, 112, 119, 125, 147, 182, 189, 180, 177, 176, 179, 177, 167, 164, 156, 126, 106, 107, 100, 77, 62, 49, 24, 8, 0, 42, 138, 154, 112, 89, 83, 108, 122, 128, 185, 242, 221, 161, 131, 128, 143, 157, 161, 184, 170, 108, 77, 88, 114, 143, 145, 141, 147, 109, 61, 75, 109, 125, 123, 109, 110, 107, 82, 98, 156, 184, 182, 172, 169, 169, 160, 168, 197, 205, 182, 142, 106, 93, 91, 89, 101, 102, 54, 9, 1, 3, 27, 102, 195, 184, 106, 65, 68, 112, 163, 211, 242, 236, 161, 90, 99, 125, 164, 182, 171, 156, 90, 26, 64, 137, 161, 160, 148, 123, 90, 54, 86, 162, 174, 145, 113, 78, 61, 71, 120, 201, 219, 165, 130, 124, 131, 163, 204, 240, 227, 150, 84, 86, 109, 121, 121, 118, 77, 15, 7, 10, 28, 39, 81, 198, 223, 111, 60, 105, 166, 184, 193, 245, 242, 138, 60, 114, 160, 158, 157, 145, 112, 34, 2, 98, 168, 140, 131, 137, 106, 82, 108, 180, 214, 143, 91, 113, 102, 90, 136, 189, 185, 118, 87, 132, 157, 159, 200, 214, 173, 124, 120, 154, 153, 124, 112, 77, 32, 16, 8, 0, 7, 3, 41, 189, 240, 138, 99, 134, 138, 181, 235, 252, 235, 125, 66, 120, 134, 119, 139, 103, 41, 12, 29, 115, 146, 120, 147, 141, 99, 130, 205, 238, 211, 150, 123, 113, 93, 138, 167, 121, 91, 74, 69, 101, 135, 184, 191, 146, 142, 169, 177, 186, 170, 113, 68, 50, 68, 59, 9, 0, 0, 1, 136, 255, 186, 99, 120, 133, 173, 237, 250, 231, 105, 49, 117, 120, 113, 153, 78, 0, 15, 60, 145, 174, 154, 154, 101, 99, 218, 255, 226, 186, 114, 69, 84, 119, 159, 109, 51, 73, 55, 83, 181, 193, 166, 154, 150, 181, 203, 216, 198, 115, 65, 74, 72, 86, 74, 14, 0, 9, 15, 90, 214, 253, 151, 92, 136, 161, 231, 255, 203, 98, 27, 67, 118, 121, 129, 84, 0, 23, 116, 164, 203, 186, 138, 119, 130, 224, 241, 175, 141, 75, 34, 90, 125, 112, 77, 29, 56, 121, 174, 241, 211, 138, 148, 167, 186, 222, 203, 118, 60, 68, 77, 75, 85, 74, 21, 0, 30, 55, 78, 118, 185, 255, 203, 126, 181, 144, 137, 208, 150, 101, 48, 39, 67, 71, 122, 117, 53, 80, 171, 179, 203, 235, 155, 121, 137, 182, 167, 108, 108, 32, 19, 101, 114, 99, 107, 103, 109, 181, 243, 229, 187, 149, 126, 126, 169, 177, 131, 91, 70, 64, 90, 113, 74, 38, 81, 86, 88, 122, 76, 38, 74, 193, 255, 160, 106, 137, 62, 148, 224, 136, 94, 45, 80, 83, 133, 199, 94, 59, 121, 137, 174, 233, 176, 79, 88, 139, 154, 150, 163, 73, 9, 100, 130, 139, 151, 121, 75, 95, 222, 228, 179, 173, 86, 84, 167, 193, 157, 110, 104, 64, 102, 173, 104, 79, 78, 63, 101, 133, 116, 35, 27, 36, 111, 242, 225, 118, 131, 105, 85, 207, 190, 133, 43, 43, 80, 92, 194, 142, 65, 85, 113, 166, 221, 228, 136, 74, 124, 146, 150, 162, 95, 25, 56, 97, 122, 151, 144, 91, 87, 175, 215, 220, 198, 123, 84, 112, 162, 165, 136, 104, 53, 79, 136, 130, 129, 94, 73, 97, 141, 150, 108, 62, 16, 4, 104, 237, 235, 134, 113, 90, 70, 198, 205, 143, 74, 44, 58, 92, 201, 161, 103, 92, 81, 135, 207, 242, 149, 89, 90, 86, 163, 186, 120, 61, 41, 61, 120, 177, 171, 117, 99, 122, 174, 230, 216, 158, 94, 81, 116, 148, 159, 135, 87, 69, 86, 122, 147, 148, 131, 99, 108, 130, 134, 128, 82, 29, 2, 12, 147, 255, 214, 148, 98, 46, 95, 197, 207, 149, 100, 35, 25, 131, 173, 163, 139, 94, 69, 124, 204, 196, 172, 131, 72, 81, 139, 156, 140, 114, 69, 42, 86, 150, 171, 172, 147, 126, 139, 174, 195, 174, 148, 111, 81, 96, 126, 145, 134, 111, 85, 81, 131, 161, 151, 139, 129, 112, 109, 124, 107, 91, 68, 29, 5, 57, 224, 220, 187, 202, 74, 68, 142, 178, 171, 190, 143, 38, 85, 89, 93, 151, 143, 107, 92, 121, 131, 149, 189, 154, 141, 140, 103, 111, 117, 118, 109, 121, 117, 93, 117, 130, 152, 179, 185, 166, 141, 130, 111, 134, 143, 132, 134, 115, 103, 117, 125, 126, 144, 137, 111, 116, 119, 119, 134, 133, 111, 91, 79, 74, 79, 95, 98, 149, 195, 153, 132, 124, 70, 77, 121, 136, 170, 193, 167, 130, 113, 92, 95, 144, 159, 150, 141, 116, 88, 83, 91, 98, 125, 144, 130, 123, 124, 124, 128, 135, 141, 140, 130, 115, 116, 118, 119, 122, 118, 119, 124, 135, 143, 152, 151, 139, 144, 148, 145, 141, 131, 119, 105, 108, 118, 125, 137, 136, 125, 121, 129, 136, 137, 140, 133, 117, 113, 115, 112, 109, 113, 113, 114, 124, 132, 136, 143, 145, 138, 137, 130, 122, 129, 128, 120, 119, 112, 106, 109, 118, 125, 132, 133, 126, 126, 129, 131, 139, 133, 123, 121, 116, 119, 122, 124, 128, 129, 129, 128, 132, 137, 138, 138, 137, 131, 124, 128, 126, 123, 122, 116, 116, 124, 130, 134, 132, 131, 130, 131, 137, 137, 135, 133, 125, 121, 126, 130, 131, 136, 131, 121, 123, 125, 129, 137, 137, 130, 126, 128, 128, 130, 133, 130, 124, 122, 123, 128, 129, 126, 123, 123, 124, 126, 128, 129, 130, 128, 128, 130, 131, 130, 130, 128, 124, 124, 126, 126, 125, 125, 121, 118, 121, 123, 122, 124, 124, 122, 123, 124, 124, 123, 124, 123, 122, 122, 120, 120, 122, 124, 123, 125, 126, 128, 131, 132, 132, 132, 130, 129, 128, 125, 124, 124, 123, 123, 123, 124, 122, 122, 124, 125, 125, 126, 126, 124, 124, 124, 125, 126, 128, 128, 129, 129, 131, 132, 133, 133, 133, 132, 132, 131, 131, 130, 128, 126, 126, 126, 125, 125, 126, 125, 125, 129, 129, 128, 126, 128, 125, 124, 125, 125, 125, 124, 123, 123, 124, 126, 128, 129, 129, 129, 129, 129, 129, 129, 129, 126, 126, 125, 124, 124, 123, 122, 121, 121, 121, 121, 121, 121, 121, 120, 121, 121, 121, 122, 123, 123, 123, 124, 125, 126, 126, 128, 128, 128, 126, 126, 126, 126, 126, 126, 125, 124, 124, 124, 125, 125, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 125, 126, 128, 128, 128, 128, 126, 128, 129, 129, 129, 129, 129, 129, 129, 128, 128, 129, 128, 126, 126, 126, 125, 125, 125, 124, 124, 124, 124, 123, 123, 123, 124, 125, 125, 124, 125, 126, 125, 125, 126, 128, 126, 126, 126, 125, 126, 126, 126, 126, 125, 126, 125, 125, 125, 125, 125, 124, 124, 124, 124, 123, 123, 123, 123, 123, 124, 124, 124, 124, 125, 126, 125, 126, 126, 128, 128, 126, 128, 128, 128, 128, 128, 126, 126, 126, 126, 125, 126, 126, 125, 125, 125, 125, 125, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 125, 126, 125, 126, 126, 126, 126, 126, 125, 128, 126, 126, 128, 126, 126, 126, 128, 126, 126, 125, 126, 126, 126, 126, 125, 126, 125, 126, 126, 125, 126, 126, 125, 125, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 125, 126, 126, 125, 125, 125, 125, 126, 126, 125, 126, 126, 126, 125, 126, 126, 126, 126, 125, 125, 125, 126, 125, 126, 126, 126, 126, 126, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 125, 126, 126, 125, 126, 125, 125, 125, 126, 125, 125, 126, 126, 126, 126, 128, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 125, 126, 125, 126, 125, 126, 125, 126, 125, 126, 125, 126, 126, 126, 126, 126, 125, 125, 128, 125, 126, 126, 128, 126, 128, 123, 128, 129, 130, 124, 129, 125, 129, 125, 125, 126, 128, 124, 129, 128, 122, 131, 124, 133, 147, 176, 68, 98, 176, 200, 144, 129, 200, 59, 33, 166, 244, 159, 111, 66, 66, 111, 121, 140, 155, 147, 114, 114, 117, 134, 137, 150, 150, 139, 129, 138, 138, 132, 135, 137, 134, 126, 115, 122, 128, 142, 150, 141, 110, 73, 110, 151, 182, 175, 130, 53, 36, 124, 182, 175, 126, 117, 134, 121, 114, 119, 132, 155, 152, 137, 125, 125, 124, 126, 142, 133, 131, 125, 122, 119, 117, 129, 148, 141, 118, 122, 125, 119, 119, 132, 137, 125, 119, 124, 125, 135, 133, 118, 116, 133, 143, 131, 122, 124, 134, 153, 173, 144, 96, 87, 108, 123, 133, 134, 120, 121, 117, 114, 108, 101, 128, 140, 134, 129, 119, 123, 125, 117, 104, 113, 110, 110, 116, 112, 117, 125, 135, 129, 118, 103, 102, 114, 126, 130, 118, 120, 118, 102, 104, 106, 110, 117, 115, 114, 111, 111, 113, 107, 113, 117, 111, 113, 111, 105, 110, 115, 116, 110, 96, 101, 106, 123, 128, 116, 111, 102, 103, 105, 110, 119, 134, 130, 110, 110, 113, 107, 108, 104, 118, 137, 131, 128, 118, 110, 117, 121, 135, 137, 120, 116, 121, 126, 123, 126, 132, 134, 141, 130, 124, 124, 122, 126, 126, 128, 132, 125, 115, 109, 107, 111, 120, 123, 114, 111, 107, 102, 98, 104, 123, 145, 165, 177, 183, 182, 178, 168, 159, 150, 144, 145, 142, 144, 144, 137, 132, 122, 114, 108, 110, 111, 124, 138, 139, 140, 131, 132, 131, 124, 108, 98, 96, 86, 88, 79, 81, 84, 78, 89, 75, 55, 50, 75, 104, 129, 185, 197, 206, 209, 167, 154, 133, 106, 107, 109, 112, 117, 123, 106, 97, 90, 65, 70, 77, 83, 117, 146, 174, 208, 219, 213, 202, 174, 132, 106, 82, 67, 79, 87, 105, 123, 121, 120, 108, 86, 83, 89, 95, 113, 126, 128, 121, 98, 57, 28, 1, 11, 61, 73, 140, 198, 195, 248, 212, 167, 172, 109, 100, 114, 109, 123, 138, 134, 105, 108, 69, 45, 69, 48, 85, 131, 152, 204, 215, 218, 213, 194, 189, 176, 174, 158, 134, 115, 78, 65, 64, 70, 104, 131, 157, 168, 154, 135, 108, 94, 87, 90, 99, 87, 84, 44, 29, 100, 91, 153, 249, 211, 250, 230, 162, 196, 126, 106, 129, 99, 119, 120, 141, 117, 123, 122, 75, 114, 100, 103, 164, 169, 205, 236, 229, 223, 201, 171, 123, 128, 130, 119, 170, 155, 142, 163, 103, 115, 129, 118, 172, 185, 188, 190, 163, 118, 82, 64, 25, 23, 21, 0, 117, 137, 147, 255, 216, 219, 253, 150, 162, 149, 76, 124, 105, 120, 138, 137, 133, 102, 125, 77, 86, 110, 92, 160, 179, 195, 235, 223, 214, 185, 158, 115, 84, 84, 83, 105, 138, 150, 167, 171, 154, 138, 129, 137, 137, 155, 167, 141, 150, 114, 75, 69, 10, 2, 4, 59, 104, 140, 239, 234, 240, 244, 164, 170, 125, 71, 107, 75, 112, 117, 121, 139, 103, 126, 80, 76, 99, 76, 141, 158, 181, 232, 216, 218, 192, 156, 108, 81, 79, 50, 95, 110, 112, 168, 149, 147, 159, 131, 141, 142, 134, 136, 128, 120, 88, 84, 43, 8, 4, 23, 93, 106, 205, 244, 213, 255, 186, 167, 177, 69, 100, 75, 64, 106, 96, 130, 96, 125, 97, 61, 121, 65, 113, 170, 151, 225, 223, 212, 199, 167, 125, 88, 94, 47, 76, 98, 74, 138, 134, 118, 168, 133, 142, 165, 126, 132, 116, 80, 70, 46, 18, 3, 32, 86, 100, 187, 244, 217, 248, 208, 151, 170, 98, 83, 101, 69, 94, 94, 105, 81, 99, 86, 47, 115, 79, 107, 187, 158, 223, 235, 204, 210, 165, 133, 87, 86, 65, 51, 101, 66, 97, 131, 92, 153, 144, 142, 174, 138, 133, 108, 79, 46, 16, 12, 0, 72, 101, 121, 248, 222, 225, 246, 150, 152, 128, 65, 93, 86, 86, 102, 106, 98, 73, 91, 49, 57, 96, 74, 148, 189, 195, 252, 235, 213, 193, 146, 109, 75, 80, 56, 71, 94, 70, 111, 105, 98, 140, 131, 144, 156, 125, 124, 93, 55, 26, 5, 0, 51, 106, 126, 238, 233, 224, 250, 148, 148, 125, 63, 98, 80, 100, 101, 109, 103, 53, 91, 26, 42, 89, 70, 159, 194, 223, 252, 241, 229, 168, 153, 94, 59, 92, 41, 89, 101, 71, 117, 95, 98, 125, 126, 149, 143, 136, 113, 80, 51, 4, 0, 10, 79, 121, 182, 255, 221, 248, 203, 125, 144, 65, 69, 95, 77, 128, 111, 126, 92, 66, 64, 8, 65, 71, 110, 202, 211, 252, 242, 215, 188, 134, 113, 66, 81, 87, 80, 132, 104, 108, 110, 78, 102, 104, 124, 145, 142, 136, 100, 74, 24, 0, 6, 57, 114, 172, 251, 237, 241, 230, 129, 124, 86, 38, 94, 79, 114, 131, 128, 114, 72, 78, 20, 53, 84, 91, 200, 223, 237, 255, 213, 182, 124, 97, 58, 73, 110, 97, 153, 136, 102, 118, 74, 79, 105, 116, 151, 152, 148, 116, 71, 30, 0, 6, 71, 120, 189, 255, 239, 251, 223, 107, 97, 62, 25, 95, 103, 143, 157, 148, 99, 59, 54, 2, 68, 99, 140, 241, 246, 254, 237, 177, 115, 77, 73, 58, 123, 158, 151, 190, 128, 90, 71, 25, 70, 108, 157, 188, 194, 164, 94, 39, 2, 0, 33, 108, 169, 244, 255, 230, 225, 131, 53, 66, 32, 85, 151, 173, 190, 158, 118, 25, 21, 7, 36, 143, 175, 238, 253, 216, 191, 121, 71, 51, 75, 126, 152, 232, 200, 153, 126, 21, 26, 38, 81, 168, 207, 227, 191, 141, 70, 0, 10, 4, 44, 151, 214, 240, 255, 212, 139, 114, 20, 56, 122, 143, 220, 205, 155, 88, 24, 0, 21, 77, 124, 216, 244, 223, 209, 124, 72, 56, 81, 133, 183, 247, 201, 169, 122, 11, 27, 54, 84, 171, 206, 205, 190, 141, 71, 53, 61, 44, 85, 96, 78, 135, 191, 166, 183, 215, 128, 153, 169, 112, 159, 151, 135, 134, 112, 68, 31, 58, 36, 84, 154, 153, 214, 199, 154, 174, 150, 118, 154, 180, 146, 173, 183, 117, 105, 94, 60, 71, 111, 134, 167, 185, 149, 135, 105, 64, 67, 75, 48, 53, 28, 28, 195, 242, 212, 255, 162, 106, 117, 58, 133, 202, 205, 167, 97, 42, 0, 26, 86, 129, 200, 221, 147, 121, 120, 89, 146, 237, 200, 195, 199, 103, 72, 99, 97, 131, 186, 152, 105, 87, 57, 80, 159, 171, 147, 138, 84, 15, 21, 19, 15, 169, 255, 189, 211, 198, 59, 65, 153, 132, 179, 245, 146, 57, 45, 47, 51, 95, 193, 154, 87, 138, 113, 88, 198, 251, 178, 151, 171, 107, 94, 195, 204, 123, 108, 97, 42, 65, 158, 193, 135, 103, 100, 49, 64, 146, 143, 111, 69, 1, 99, 250, 234, 174, 142, 84, 46, 94, 192, 242, 168, 85, 96, 88, 82, 131, 169, 126, 57, 72, 148, 167, 148, 164, 171, 122, 90, 160, 234, 200, 128, 100, 96, 110, 144, 153, 140, 112, 72, 66, 113, 132, 89, 79, 119, 140, 120, 78, 95, 149, 150, 152, 169, 172, 131, 79, 76, 129, 169, 155, 118, 99, 108, 117, 117, 126, 128, 125, 154, 162, 118, 94, 129, 153, 143, 132, 129, 132, 149, 155, 144, 146, 162, 154, 131, 128, 138, 140, 133, 120, 100, 95, 115, 141, 135, 115, 100, 119, 153, 152, 151, 151, 130, 125, 137, 139, 131, 116, 113, 125, 114, 100, 120, 131, 120, 109, 115, 128, 145, 145, 120, 124, 146, 141, 129, 140, 150, 151, 147, 145, 144, 152, 155, 148, 147, 140, 120, 121, 135, 122, 113, 116, 112, 116, 121, 118, 119, 124, 130, 133, 128, 136, 136, 130, 132, 118, 119, 128, 124, 126, 128, 124, 120, 114, 119, 128, 128, 128, 129, 123, 120, 124, 130, 135, 134, 135, 133, 129, 136, 144, 142, 143, 140, 129, 124, 137, 138, 125, 119, 123, 124, 123, 126, 129, 125, 119, 124, 128, 128, 130, 132, 128, 126, 126, 129, 130, 133, 133, 126, 123, 121, 122, 124, 120, 116, 120, 122, 117, 111, 125, 126, 130, 118, 130, 134, 139, 124, 186, 175, 38, 120, 179, 205, 164, 6, 105, 235, 123, 106, 110, 63, 186, 249, 107, 21, 106, 245, 192, 47, 42, 135, 255, 150, 16, 75, 178, 217, 146, 31, 76, 195, 167, 115, 64, 97, 182, 167, 99, 44, 87, 181, 171, 89, 57, 126, 201, 126, 51, 99, 148, 154, 97, 59, 114, 180, 146, 81, 87, 119, 171, 147, 77, 85, 141, 198, 192, 44, 68, 192, 161, 129, 53, 88, 181, 184, 61, 74, 135, 110, 156, 54, 83, 152, 129, 114, 98, 88, 95, 139, 112, 115, 103, 79, 115, 131, 60, 57, 124, 130, 133, 73, 89, 164, 133, 75, 123, 174, 144, 122, 98, 136, 198, 128, 66, 150, 198, 163, 74, 51, 150, 198, 102, 73, 126, 147, 182, 88, 50, 158, 136, 103, 94, 85, 153, 146, 76, 55, 136, 117, 95, 101, 49, 124, 115, 29, 131, 177, 72, 101, 124, 118, 207, 135, 61, 168, 169, 162, 167, 86, 128, 210, 112, 90, 164, 158, 187, 108, 63, 169, 180, 119, 122, 114, 150, 170, 108, 79, 114, 132, 64, 94, 87, 132, 102, 50, 77, 76, 99, 39, 35, 140, 191, 53, 114, 175, 134, 180, 113, 124, 212, 165, 116, 176, 147, 138, 170, 86, 115, 172, 109, 161, 164, 69, 171, 198, 91, 168, 151, 107, 179, 135, 100, 142, 61, 54, 104, 48, 98, 71, 0, 68, 84, 0, 138, 219, 34, 124, 215, 163, 187, 114, 136, 243, 150, 71, 177, 177, 124, 116, 60, 153, 163, 32, 113, 213, 155, 126, 124, 156, 221, 151, 105, 167, 171, 130, 92, 64, 99, 79, 57, 30, 26, 74, 33, 0, 46, 230, 156, 26, 185, 230, 168, 143, 123, 199, 231, 85, 75, 205, 149, 78, 59, 85, 192, 84, 12, 184, 216, 99, 108, 190, 206, 162, 101, 148, 213, 129, 72, 102, 97, 80, 58, 28, 87, 60, 0, 30, 109, 244, 97, 57, 253, 206, 133, 152, 156, 201, 193, 48, 110, 210, 78, 54, 78, 98, 155, 62, 51, 228, 192, 63, 167, 206, 181, 164, 84, 178, 216, 67, 72, 138, 61, 40, 57, 63, 71, 30, 0, 99, 253, 98, 51, 247, 228, 174, 143, 122, 233, 186, 29, 122, 179, 74, 72, 40, 89, 161, 53, 102, 202, 162, 146, 157, 184, 216, 160, 110, 179, 181, 92, 93, 87, 63, 56, 22, 51, 57, 29, 15, 94, 234, 110, 98, 245, 208, 202, 135, 123, 234, 169, 18, 115, 192, 48, 41, 58, 92, 132, 53, 105, 217, 184, 126, 176, 235, 192, 135, 139, 177, 177, 93, 87, 112, 51, 26, 23, 60, 59, 16, 0, 96, 252, 109, 68, 249, 212, 145, 140, 143, 219, 152, 23, 125, 199, 32, 40, 90, 90, 138, 45, 86, 220, 181, 115, 182, 219, 174, 149, 136, 168, 175, 80, 84, 145, 80, 19, 40, 76, 79, 41, 24, 59, 210, 195, 27, 161, 246, 124, 124, 148, 159, 188, 74, 44, 200, 129, 0, 111, 123, 108, 106, 63, 166, 192, 92, 145, 222, 163, 151, 150, 135, 180, 121, 55, 151, 124, 57, 93, 86, 87, 106, 51, 83, 104, 134, 247, 71, 74, 255, 138, 110, 142, 119, 201, 125, 25, 130, 193, 35, 63, 153, 95, 152, 75, 103, 221, 119, 88, 191, 193, 135, 147, 143, 155, 154, 71, 106, 164, 83, 67, 108, 106, 100, 87, 73, 118, 97, 146, 243, 68, 126, 250, 99, 158, 149, 107, 196, 116, 46, 141, 157, 36, 115, 109, 84, 177, 62, 108, 202, 107, 121, 182, 171, 156, 159, 134, 161, 163, 81, 117, 143, 99, 92, 86, 104, 111, 94, 69, 89, 102, 84, 234, 163, 9, 227, 185, 86, 196, 90, 155, 234, 45, 78, 216, 104, 68, 137, 72, 151, 144, 14, 153, 169, 78, 148, 148, 147, 194, 139, 118, 188, 156, 113, 143, 106, 115, 145, 62, 88, 133, 84, 76, 83, 59, 136, 237, 75, 44, 221, 158, 130, 138, 94, 214, 195, 76, 107, 180, 153, 128, 95, 56, 191, 141, 24, 136, 122, 110, 150, 86, 121, 186, 133, 118, 159, 134, 157, 146, 66, 130, 173, 122, 134, 118, 124, 147, 110, 77, 97, 154, 150, 90, 57, 123, 146, 124, 102, 104, 156, 155, 144, 117, 133, 163, 161, 148, 105, 138, 140, 121, 136, 89, 108, 152, 121, 108, 120, 120, 131, 137, 113, 125, 163, 140, 136, 145, 145, 161, 126, 132, 148, 115, 130, 117, 95, 129, 102, 84, 116, 95, 100, 131, 99, 112, 142, 110, 134, 149, 130, 157, 142, 125, 157, 142, 128, 139, 135, 129, 125, 129, 125, 126, 130, 125, 123, 122, 132, 131, 126, 136, 129, 134, 139, 129, 137, 137, 130, 122, 123, 122, 113, 117, 111, 109, 114, 107, 101, 104, 115, 117, 111, 115, 130, 137, 134, 132, 135, 143, 141, 137, 137, 135, 136, 137, 131, 128, 135, 132, 126, 128, 128, 126, 129, 119, 116, 129, 121, 116, 124, 128, 128, 131, 131, 134, 135, 131, 131, 135, 128, 122, 125, 121, 119, 115, 111, 109, 109, 108, 109, 116, 117, 116, 125, 130, 131, 133, 130, 135, 137, 135, 129, 131, 131, 133, 131, 124, 121, 124, 126, 126, 128, 130, 135, 130, 124, 120, 129, 128, 125, 125, 126, 124, 122, 124, 123, 117, 117, 139, 139, 116, 106, 126, 132, 117, 109, 125, 137, 119, 108, 114, 125, 122, 117, 121, 129, 123, 117, 121, 129, 130, 129, 132, 134, 128, 124, 129, 129, 129, 130, 130, 130, 128, 121, 121, 122, 124, 129, 133, 128, 124, 126, 131, 133, 133, 135, 136, 136, 130, 129, 130, 124, 118, 113, 110, 114, 125, 121, 106, 101, 110, 118, 114, 107, 117, 130, 124, 119, 128, 140, 138, 137, 142, 143, 134, 129, 131, 135, 131, 128, 126, 126, 121, 116, 116, 120, 126, 124, 123, 121, 123, 120, 128, 124, 125, 125, 130, 130, 126, 122, 125, 130, 130, 123, 119, 124, 125, 124, 129, 123, 123, 138, 137, 161, 77, 104, 155, 126, 138, 118, 131, 124, 126, 110, 126, 124, 114, 121, 124, 140, 129, 104, 126, 129, 120, 130, 125, 136, 136, 124, 132, 136, 124, 135, 131, 138, 121, 125, 118, 137, 128, 124, 134, 113, 131, 113, 117, 107, 138, 110, 128, 121, 118, 115, 140, 131, 116, 146, 115, 147, 116, 160, 102, 156, 117, 132, 171, 146, 122, 97, 188, 76, 73, 99, 156, 123, 82, 97, 172, 121, 58, 125, 134, 176, 109, 94, 141, 189, 117, 93, 144, 141, 155, 114, 98, 141, 165, 108, 96, 143, 142, 129, 104, 110, 152, 137, 99, 115, 146, 130, 111, 108, 128, 147, 114, 96, 134, 140, 126, 103, 107, 157, 132, 111, 113, 144, 142, 152, 113, 110, 177, 129, 109, 102, 146, 156, 106, 64, 143, 174, 105, 119, 122, 157, 154, 112, 110, 172, 140, 109, 132, 120, 140, 118, 73, 97, 131, 78, 83, 64, 143, 184, 65, 83, 187, 178, 114, 121, 148, 209, 137, 71, 153, 180, 105, 86, 106, 135, 137, 64, 91, 154, 122, 90, 130, 140, 155, 143, 106, 153, 176, 117, 108, 134, 132, 132, 88, 99, 150, 125, 106, 126, 156, 170, 123, 131, 171, 157, 82, 70, 89, 93, 145, 75, 88, 143, 113, 119, 132, 130, 174, 171, 113, 172, 174, 132, 142, 121, 119, 136, 78, 94, 134, 84, 88, 122, 119, 139, 140, 131, 180, 164, 133, 163, 163, 133, 132, 109, 114, 118, 81, 92, 109, 99, 108, 113, 114, 147, 135, 135, 160, 153, 145, 152, 143, 140, 140, 113, 119, 124, 106, 109, 122, 111, 118, 124, 122, 139, 136, 131, 147, 142, 135, 139, 131, 131, 124, 114, 113, 120, 116, 111, 117, 133, 131, 123, 132, 146, 148, 131, 140, 148, 133, 125, 122, 125, 123, 110, 110, 112, 116, 120, 118, 122, 137, 138, 132, 145, 150, 146, 145, 146, 149, 140, 125, 123, 130, 110, 101, 97, 80, 35, 154, 189, 36, 121, 202, 139, 124, 136, 155, 202, 98, 81, 206, 121, 59, 125, 115, 117, 101, 60, 170, 152, 59, 151, 178, 128, 137, 135, 155, 160, 93, 114, 162, 102, 82, 116, 123, 116, 98, 107, 153, 137, 107, 152, 156, 131, 132, 136, 144, 131, 101, 119, 140, 101, 100, 124, 118, 115, 119, 135, 150, 128, 125, 155, 138, 122, 132, 130, 123, 110, 110, 124, 115, 109, 114, 124, 133, 119, 128, 142, 138, 132, 130, 136, 136, 123, 118, 129, 120, 112, 126, 124, 119, 124, 125, 138, 129, 117, 139, 138, 119, 119, 128, 128, 122, 115, 116, 129, 123, 115, 129, 132, 128, 131, 128, 129, 131, 130, 123, 122, 121, 117, 120, 117, 114, 124, 126, 118, 132, 135, 125, 135, 136, 130, 134, 126, 122, 128, 120, 117, 116, 116, 121, 120, 120, 125, 126, 130, 132, 131, 133, 131, 129, 126, 124, 123, 120, 118, 118, 119, 119, 121, 124, 126, 130, 131, 132, 134, 133, 130, 130, 129, 123, 120, 119, 117, 116, 117, 119, 121, 123, 126, 129, 131, 133, 133, 132, 131, 129, 126, 124, 122, 120, 119, 119, 120, 122, 123, 124, 126, 129, 130, 130, 131, 131, 130, 128, 126, 124, 123, 122, 122, 122, 121, 122, 123, 124, 125, 128, 128, 128, 129, 128, 128, 126, 126, 125, 124, 124, 124, 125, 124, 126, 125, 130, 128, 129, 129, 129, 129, 130, 128, 128, 126, 123, 125, 128, 131, 145, 143, 130, 145, 139, 132, 118, 122, 107, 111, 93, 88, 51, 121, 223, 49, 107, 232, 132, 100, 155, 140, 161, 101, 56, 186, 120, 42, 135, 141, 114, 137, 105, 177, 177, 77, 151, 192, 106, 109, 138, 122, 119, 84, 101, 154, 99, 92, 154, 138, 126, 134, 138, 153, 135, 112, 145, 131, 98, 122, 123, 112, 120, 119, 125, 145, 130, 134, 151, 142, 151, 152, 139, 143, 135, 115, 124, 116, 107, 112, 108, 108, 121, 100, 110, 120, 102, 74, 104, 237, 128, 67, 194, 176, 99, 106, 138, 149, 118, 50, 145, 173, 77, 105, 162, 151, 148, 114, 142, 196, 96, 93, 172, 133, 88, 114, 128, 134, 110, 101, 157, 162, 142, 155, 138, 135, 155, 113, 128, 137, 105, 119, 106, 76, 114, 115, 82, 89, 91, 50, 167, 253, 66, 119, 232, 139, 107, 101, 105, 173, 73, 38, 182, 123, 67, 142, 151, 170, 159, 97, 193, 183, 74, 129, 165, 111, 112, 100, 130, 159, 97, 118, 182, 151, 137, 149, 154, 164, 110, 89, 115, 99, 52, 71, 21, 21, 44, 179, 224, 112, 173, 225, 215, 131, 107, 137, 154, 49, 44, 122, 109, 80, 91, 148, 192, 156, 134, 215, 181, 131, 135, 143, 147, 120, 65, 117, 149, 93, 110, 166, 156, 153, 142, 157, 187, 110, 78, 130, 113, 33, 6, 0, 48, 39, 143, 233, 183, 176, 212, 218, 153, 108, 99, 143, 68, 28, 98, 125, 93, 96, 141, 209, 188, 137, 186, 191, 133, 111, 115, 140, 129, 46, 105, 159, 114, 118, 150, 174, 202, 130, 144, 221, 148, 103, 120, 92, 48, 21, 11, 52, 25, 0, 48, 203, 232, 126, 165, 232, 191, 112, 74, 119, 168, 51, 26, 125, 141, 105, 92, 132, 228, 196, 102, 160, 202, 143, 103, 101, 138, 145, 59, 76, 154, 155, 177, 166, 104, 197, 211, 106, 131, 148, 147, 126, 22, 67, 142, 31, 27, 55, 48, 67, 65, 205, 245, 116, 129, 202, 163, 118, 65, 85, 199, 85, 41, 142, 149, 122, 95, 143, 213, 184, 115, 130, 164, 148, 100, 82, 121, 158, 117, 72, 121, 178, 166, 135, 124, 169, 193, 132, 110, 149, 148, 106, 54, 81, 122, 87, 41, 48, 68, 82, 33, 59, 227, 135, 91, 174, 154, 139, 109, 47, 148, 195, 38, 112, 132, 118, 179, 94, 95, 234, 159, 98, 119, 83, 197, 173, 35, 103, 173, 137, 151, 94, 118, 220, 157, 113, 132, 116, 181, 156, 69, 119, 139, 113, 110, 76, 96, 145, 65, 93, 144, 58, 45, 125, 205, 189, 73, 58, 172, 203, 122, 63, 108, 190, 177, 94, 78, 134, 174, 148, 92, 89, 154, 184, 137, 88, 94, 153, 193, 134, 69, 118, 188, 200, 131, 87, 135, 166, 138, 90, 90, 145, 178, 158, 118, 109, 143, 160, 126, 83, 88, 115, 97, 51, 21, 16, 119, 214, 134, 47, 74, 134, 172, 139, 77, 114, 170, 164, 155, 131, 110, 124, 147, 163, 155, 112, 113, 172, 175, 132, 117, 135, 172, 166, 146, 145, 131, 130, 147, 130, 104, 112, 146, 171, 142, 119, 143, 153, 143, 135, 115, 111, 104, 92, 94, 81, 65, 46, 35, 75, 152, 133, 45, 34, 102, 159, 142, 78, 70, 142, 175, 168, 152, 123, 125, 166, 186, 170, 140, 111, 140, 186, 164, 129, 132, 146, 153, 137, 121, 150, 160, 126, 118, 133, 144, 144, 126, 137, 157, 153, 150, 135, 121, 133, 131, 113, 99, 92, 94, 88, 59, 45, 47, 79, 134, 83, 20, 67, 116, 119, 108, 85, 104, 165, 163, 149, 165, 150, 152, 185, 180, 154, 134, 123, 160, 178, 139, 135, 148, 143, 143, 140, 135, 130, 125, 141, 150, 128, 113, 125, 148, 157, 146, 137, 144, 158, 166, 159, 128, 113, 133, 129, 96, 75, 75, 78, 65, 34, 59, 123, 87, 29, 53, 108, 125, 100, 85, 112, 159, 156, 148, 156, 149, 155, 180, 181, 153, 134, 133, 161, 171, 141, 143, 160, 143, 130, 137, 137, 134, 117, 109, 135, 148, 129, 113, 124, 144, 154, 142, 128, 140, 161, 176, 164, 125, 110, 128, 135, 113, 83, 76, 92, 68, 23, 87, 129, 45, 40, 86, 103, 114, 88, 83, 139, 154, 136, 166, 158, 141, 182, 186, 167, 164, 130, 136, 177, 147, 135, 159, 140, 134, 144, 138, 135, 122, 109, 124, 125, 122, 138, 124, 115, 141, 152, 144, 130, 131, 172, 187, 160, 142, 129, 126, 136, 118, 99, 84, 64, 58, 54, 85, 97, 37, 40, 87, 98, 92, 81, 90, 124, 154, 147, 155, 160, 156, 188, 185, 160, 159, 143, 140, 164, 147, 139, 159, 138, 126, 142, 137, 136, 122, 107, 124, 128, 124, 137, 122, 118, 152, 158, 142, 131, 139, 175, 186, 158, 135, 125, 128, 134, 112, 83, 72, 67, 48, 73, 117, 55, 27, 74, 92, 106, 91, 75, 112, 146, 143, 154, 157, 144, 171, 193, 181, 164, 138, 129, 155, 154, 141, 154, 148, 129, 139, 139, 133, 125, 113, 117, 122, 120, 129, 122, 116, 140, 149, 153, 144, 132, 155, 176, 171, 155, 132, 119, 134, 124, 94, 80, 69, 52, 65, 112, 71, 21, 62, 88, 106, 96, 74, 105, 133, 137, 149, 157, 144, 162, 189, 175, 171, 155, 126, 142, 160, 142, 147, 154, 133, 135, 137, 134, 136, 116, 105, 128, 133, 126, 112, 111, 143, 153, 143, 138, 135, 148, 171, 162, 143, 126, 120, 126, 118, 90, 67, 65, 66, 106, 113, 33, 43, 91, 91, 104, 90, 87, 129, 146, 132, 142, 152, 145, 173, 180, 163, 156, 131, 135, 167, 146, 133, 154, 141, 130, 134, 132, 140, 128, 107, 126, 132, 116, 122, 117, 120, 137, 144, 145, 143, 137, 152, 164, 149, 136, 123, 120, 121, 105, 84, 73, 66, 76, 108, 79, 43, 69, 76, 93, 105, 86, 104, 139, 133, 140, 160, 147, 151, 175, 165, 166, 156, 132, 141, 147, 143, 151, 149, 134, 138, 136, 133, 133, 119, 114, 120, 118, 119, 120, 113, 123, 135, 142, 147, 142, 145, 152, 153, 147, 134, 120, 119, 112, 100, 90, 69, 68, 104, 103, 53, 58, 77, 88, 99, 93, 96, 125, 141, 134, 148, 151, 142, 162, 172, 164, 162, 142, 141, 151, 145, 148, 152, 144, 138, 139, 133, 135, 126, 114, 119, 119, 114, 116, 114, 117, 130, 134, 140, 144, 139, 144, 148, 137, 132, 129, 120, 116, 107, 95, 86, 86, 105, 107, 74, 63, 78, 87, 99, 100, 97, 112, 130, 135, 148, 142, 136, 142, 154, 161, 169, 151, 139, 163, 152, 147, 156, 145, 136, 129, 128, 154, 148, 116, 109, 150, 153, 133, 117, 113, 133, 118, 125, 175, 173, 117, 126, 129, 119, 76, 33, 74, 71, 21, 3, 26, 188, 242, 93, 73, 91, 179, 255, 159, 81, 126, 174, 204, 186, 45, 23, 123, 143, 146, 77, 13, 107, 179, 156, 134, 96, 120, 230, 216, 131, 113, 99, 164, 231, 128, 69, 93, 113, 187, 147, 60, 121, 187, 187, 173, 84, 59, 133, 128, 67, 9, 0, 21, 40, 143, 244, 124, 70, 151, 185, 255, 192, 54, 112, 203, 174, 132, 46, 21, 145, 155, 87, 72, 42, 130, 231, 152, 101, 145, 172, 220, 206, 83, 89, 146, 148, 155, 81, 52, 130, 158, 129, 105, 91, 155, 227, 185, 138, 104, 91, 138, 123, 36, 2, 0, 3, 33, 145, 250, 144, 86, 152, 193, 255, 203, 89, 115, 181, 159, 123, 55, 5, 100, 125, 81, 86, 55, 122, 218, 165, 139, 172, 166, 199, 217, 131, 98, 115, 118, 163, 131, 50, 61, 102, 133, 149, 122, 122, 176, 195, 182, 147, 74, 90, 124, 69, 33, 13, 0, 33, 190, 240, 112, 74, 108, 182, 253, 199, 100, 96, 152, 184, 181, 83, 12, 67, 98, 129, 128, 52, 63, 142, 176, 187, 176, 125, 142, 200, 191, 177, 136, 77, 112, 156, 130, 99, 65, 54, 119, 161, 144, 144, 138, 139, 150, 139, 126, 118, 93, 84, 90, 74, 51, 45, 155, 193, 112, 113, 78, 106, 202, 194, 151, 155, 133, 107, 192, 167, 105, 105, 53, 76, 140, 137, 122, 106, 80, 116, 193, 195, 157, 144, 111, 117, 165, 159, 144, 129, 81, 76, 106, 116, 136, 126, 110, 129, 150, 161, 156, 136, 106, 123, 155, 149, 138, 112, 101, 111, 117, 103, 97, 139, 122, 101, 112, 72, 77, 117, 128, 133, 132, 103, 103, 138, 147, 154, 157, 145, 137, 151, 157, 161, 166, 146, 132, 137, 137, 134, 134, 114, 107, 112, 107, 116, 126, 125, 128, 132, 129, 132, 134, 132, 141, 148, 142, 134, 129, 126, 136, 139, 132, 126, 132, 145, 146, 142, 132, 122, 121, 116, 116, 115, 104, 88, 85, 87, 92, 96, 105, 112, 122, 130, 131, 141, 148, 151, 151, 149, 141, 139, 135, 132, 133, 129, 130, 132, 131, 135, 139, 140, 141, 138, 135, 135, 132, 128, 126, 125, 121, 117, 115, 111, 111, 111, 114, 122, 124, 124, 123, 131, 142, 146, 144, 144, 144, 148, 144, 132, 125, 113, 111, 109, 112, 114, 111, 103, 97, 101, 108, 117, 117, 116, 116, 118, 123, 123, 126, 128, 132, 135, 131, 132, 130, 135, 140, 143, 145, 144, 143, 140, 142, 142, 137, 132, 130, 122, 118, 117, 114, 117, 120, 114, 114, 117, 118, 123, 129, 130, 133, 134, 135, 133, 131, 130, 135, 149, 150, 139, 120, 121, 133, 130, 118, 116, 120, 118, 110, 106, 107, 108, 113, 110, 110, 111, 110, 111, 118, 123, 126, 130, 130, 128, 126, 128, 130, 133, 135, 138, 139, 135, 132, 133, 137, 139, 139, 137, 133, 131, 124, 122, 122, 124, 120, 115, 115, 115, 116, 117, 120, 120, 122, 125, 126, 123, 125, 130, 131, 138, 143, 140, 130, 128, 136, 136, 129, 126, 133, 134, 125, 119, 119, 119, 118, 117, 118, 116, 108, 106, 107, 108, 109, 113, 117, 119, 118, 119, 123, 129, 132, 134, 135, 142, 148, 139, 130, 131, 135, 134, 131, 139, 142, 133, 123, 124, 126, 121, 116, 121, 125, 119, 113, 113, 120, 121, 120, 121, 125, 123, 120, 121, 129, 133, 135, 135, 131, 142, 147, 138, 129, 135, 139, 137, 132, 132, 136, 131, 122, 118, 120, 117, 118, 116, 115, 111, 107, 107, 111, 112, 108, 111, 115, 116, 116, 121, 126, 129, 130, 136, 139, 137, 136, 138, 140, 138, 138, 141, 140, 137, 142, 139, 129, 123, 123, 120, 117, 124, 130, 122, 112, 112, 120, 120, 116, 114, 121, 123, 119, 120, 128, 134, 135, 137, 139, 139, 135, 135, 136, 140, 138, 140, 138, 132, 129, 132, 132, 123, 121, 120, 118, 116, 118, 118, 114, 109, 111, 110, 110, 111, 118, 129, 120, 111, 114, 125, 125, 125, 131, 139, 140, 135, 137, 140, 140, 139, 140, 134, 126, 124, 131, 132, 132, 126, 128, 131, 124, 116, 113, 118, 121, 122, 121, 119, 120, 123, 124, 128, 130, 128, 130, 132, 132, 131, 133, 138, 139, 136, 134, 134, 133, 131, 131, 131, 131, 128, 121, 119, 116, 112, 133, 139, 118, 102, 111, 129, 123, 114, 115, 128, 125, 117, 114, 120, 117, 118, 128, 134, 131, 124, 130, 129, 129, 126, 135, 137, 132, 126, 129, 129, 124, 128, 132, 134, 126, 122, 121, 123, 122, 124, 129, 130, 126, 126, 126, 125, 125, 126, 131, 132, 130, 130, 128, 129, 129, 124, 128, 135, 133, 123, 122, 126, 126, 121, 123, 128, 125, 120, 122, 123, 129, 131, 128, 119, 121, 126, 118, 115, 113, 124, 126, 132, 128, 132, 124, 120, 110, 126, 125, 148, 197, 95, 62, 124, 143, 151, 124, 198, 185, 47, 82, 136, 155, 120, 116, 123, 158, 137, 111, 132, 117, 122, 160, 222, 116, 66, 115, 241, 150, 16, 82, 164, 204, 104, 67, 100, 157, 120, 126, 129, 169, 196, 44, 55, 166, 186, 158, 139, 71, 74, 147, 135, 126, 90, 97, 144, 141, 117, 118, 142, 98, 83, 100, 159, 180, 145, 114, 80, 138, 167, 142, 129, 121, 126, 132, 187, 197, 145, 88, 80, 162, 168, 124, 81, 110, 171, 193, 154, 89, 122, 146, 154, 141, 131, 110, 114, 153, 137, 112, 97, 131, 139, 86, 61, 74, 112, 90, 44, 26, 138, 210, 135, 118, 78, 108, 176, 195, 148, 102, 137, 125, 174, 161, 102, 85, 86, 125, 123, 134, 89, 60, 101, 147, 150, 117, 108, 111, 184, 231, 181, 125, 103, 121, 164, 174, 118, 92, 132, 166, 172, 103, 51, 68, 118, 132, 111, 79, 61, 83, 92, 71, 17, 10, 8, 125, 255, 128, 34, 88, 138, 191, 201, 133, 23, 121, 203, 154, 152, 55, 56, 111, 170, 119, 61, 100, 73, 145, 168, 120, 88, 128, 157, 150, 176, 140, 171, 179, 176, 130, 75, 99, 117, 153, 115, 115, 103, 136, 160, 112, 59, 28, 104, 145, 128, 49, 8, 20, 23, 3, 132, 255, 94, 79, 171, 150, 233, 206, 85, 69, 222, 185, 128, 143, 6, 85, 164, 123, 54, 59, 109, 135, 201, 141, 107, 156, 205, 199, 173, 135, 103, 213, 244, 137, 66, 58, 93, 177, 160, 39, 72, 163, 196, 197, 86, 20, 103, 176, 133, 67, 12, 8, 40, 36, 207, 213, 26, 130, 177, 195, 254, 136, 53, 141, 247, 132, 115, 55, 23, 165, 111, 53, 12, 97, 160, 158, 145, 82, 153, 223, 220, 148, 128, 143, 171, 201, 165, 91, 57, 91, 128, 119, 66, 78, 133, 182, 179, 138, 90, 103, 146, 108, 83, 57, 32, 20, 0, 51, 249, 166, 24, 169, 159, 202, 246, 97, 59, 195, 210, 96, 121, 25, 74, 194, 78, 22, 69, 160, 145, 154, 114, 109, 224, 233, 168, 128, 141, 154, 199, 152, 100, 104, 89, 101, 111, 95, 94, 151, 135, 141, 178, 160, 137, 138, 106, 85, 126, 87, 45, 13, 0, 95, 251, 131, 25, 198, 177, 203, 203, 71, 105, 239, 186, 49, 105, 62, 116, 173, 41, 26, 113, 175, 149, 131, 104, 156, 248, 200, 125, 141, 155, 172, 165, 96, 108, 141, 114, 73, 87, 103, 135, 162, 121, 138, 191, 183, 136, 121, 94, 101, 133, 81, 23, 26, 9, 118, 255, 75, 41, 224, 188, 225, 189, 41, 125, 255, 157, 46, 93, 70, 139, 150, 17, 38, 143, 172, 151, 107, 110, 190, 240, 185, 107, 145, 176, 163, 134, 78, 111, 160, 118, 70, 83, 109, 158, 164, 110, 137, 205, 191, 134, 119, 92, 117, 134, 56, 19, 43, 11, 85, 255, 106, 29, 222, 185, 197, 212, 58, 105, 251, 158, 54, 100, 67, 131, 153, 45, 41, 120, 170, 145, 137, 113, 163, 240, 190, 122, 126, 157, 160, 139, 72, 90, 159, 120, 91, 91, 91, 145, 187, 126, 123, 179, 175, 169, 135, 82, 85, 120, 91, 54, 25, 17, 54, 214, 211, 14, 144, 213, 194, 245, 143, 61, 174, 241, 85, 90, 60, 46, 159, 92, 39, 67, 128, 160, 172, 145, 133, 194, 210, 188, 146, 118, 123, 146, 123, 64, 95, 130, 109, 125, 100, 91, 159, 169, 143, 173, 185, 158, 165, 134, 79, 88, 79, 48, 41, 9, 0, 0, 144, 255, 105, 68, 153, 193, 251, 177, 76, 76, 178, 169, 120, 71, 8, 109, 123, 115, 104, 57, 113, 187, 190, 148, 157, 143, 159, 199, 139, 88, 98, 104, 107, 135, 106, 63, 114, 148, 153, 157, 107, 123, 189, 192, 167, 126, 89, 106, 124, 93, 71, 31, 22, 64, 37, 17, 213, 237, 94, 158, 121, 174, 251, 155, 100, 102, 104, 115, 198, 55, 9, 104, 55, 150, 173, 78, 92, 155, 161, 210, 208, 99, 131, 156, 137, 158, 110, 45, 74, 131, 138, 129, 109, 92, 140, 174, 154, 162, 137, 137, 175, 157, 130, 100, 59, 56, 85, 65, 59, 32, 0, 12, 183, 255, 141, 169, 79, 113, 255, 186, 142, 98, 57, 91, 200, 121, 66, 77, 0, 129, 185, 125, 163, 90, 79, 190, 227, 178, 170, 85, 68, 169, 144, 123, 98, 51, 93, 145, 150, 156, 121, 93, 128, 159, 186, 198, 141, 108, 121, 103, 109, 90, 55, 58, 53, 50, 52, 13, 80, 255, 175, 203, 173, 19, 207, 190, 191, 197, 82, 35, 92, 128, 102, 180, 27, 46, 100, 78, 210, 170, 104, 118, 136, 146, 230, 184, 116, 139, 55, 103, 147, 117, 141, 99, 55, 111, 138, 150, 188, 122, 123, 155, 142, 165, 167, 113, 98, 77, 38, 105, 90, 78, 56, 5, 0, 81, 255, 206, 247, 128, 7, 166, 124, 233, 226, 120, 68, 68, 66, 115, 201, 66, 117, 39, 30, 161, 149, 192, 183, 119, 99, 156, 130, 199, 182, 97, 114, 52, 83, 151, 144, 152, 143, 60, 101, 133, 139, 209, 163, 138, 133, 118, 128, 149, 107, 94, 89, 51, 90, 58, 52, 43, 0, 95, 225, 191, 249, 143, 60, 150, 72, 210, 221, 170, 144, 88, 46, 84, 133, 83, 176, 63, 85, 91, 78, 170, 168, 183, 165, 153, 103, 154, 122, 153, 152, 102, 113, 98, 106, 120, 147, 98, 160, 109, 140, 165, 133, 186, 144, 163, 137, 130, 98, 94, 94, 99, 105, 70, 60, 8, 10, 0, 85, 224, 197, 252, 144, 98, 134, 60, 192, 193, 225, 188, 130, 53, 40, 77, 60, 188, 109, 140, 87, 53, 96, 111, 188, 195, 218, 144, 156, 96, 119, 134, 122, 153, 118, 144, 86, 111, 89, 121, 148, 150, 176, 159, 158, 143, 170, 140, 166, 128, 114, 96, 78, 98, 81, 82, 50, 37, 7, 0, 41, 203, 202, 239, 194, 106, 160, 65, 173, 171, 200, 200, 147, 110, 54, 62, 27, 137, 94, 158, 133, 92, 110, 79, 152, 163, 218, 200, 197, 113, 109, 98, 100, 153, 125, 174, 112, 106, 79, 89, 133, 154, 186, 178, 185, 143, 167, 126, 154, 152, 122, 134, 80, 92, 66, 80, 63, 62, 61, 36, 29, 23, 166, 175, 224, 229, 131, 193, 66, 140, 148, 172, 231, 158, 167, 55, 80, 13, 99, 101, 135, 177, 102, 137, 64, 122, 124, 195, 192, 205, 173, 111, 123, 63, 129, 118, 162, 149, 138, 119, 96, 129, 113, 178, 165, 200, 172, 163, 163, 137, 156, 114, 139, 94, 104, 77, 65, 98, 61, 86, 69, 60, 71, 34, 76, 190, 153, 230, 185, 136, 178, 61, 173, 133, 189, 204, 156, 141, 77, 84, 44, 138, 85, 172, 140, 111, 131, 68, 140, 128, 183, 172, 186, 147, 125, 106, 100, 134, 122, 154, 141, 141, 124, 141, 137, 164, 164, 170, 185, 150, 170, 137, 146, 146, 128, 130, 98, 106, 95, 97, 94, 95, 102, 103, 102, 89, 82, 67, 43, 86, 174, 144, 228, 158, 120, 159, 50, 171, 146, 188, 210, 162, 150, 101, 103, 74, 146, 112, 155, 139, 96, 119, 75, 116, 133, 151, 168, 153, 129, 120, 115, 129, 138, 149, 145, 146, 143, 129, 149, 148, 163, 144, 149, 146, 119, 138, 137, 148, 154, 136, 130, 139, 122, 100, 106, 123, 144, 135, 110, 117, 101, 87, 78, 81, 68, 48, 94, 145, 115, 162, 139, 90, 176, 81, 147, 194, 152, 224, 164, 132, 156, 117, 115, 173, 128, 141, 134, 74, 103, 103, 91, 139, 133, 116, 143, 99, 113, 139, 124, 152, 145, 131, 139, 120, 111, 153, 143, 147, 171, 128, 141, 132, 119, 147, 145, 160, 157, 137, 149, 144, 116, 122, 145, 106, 119, 131, 107, 137, 112, 106, 96, 95, 110, 104, 94, 98, 100, 89, 103, 131, 125, 121, 131, 106, 112, 130, 142, 154, 161, 157, 148, 134, 131, 144, 142, 142, 145, 133, 125, 122, 115, 124, 119, 114, 119, 124, 124, 122, 121, 118, 121, 120, 118, 126, 122, 130, 129, 119, 134, 135, 131, 138, 138, 136, 142, 135, 138, 142, 135, 138, 139, 139, 142, 138, 137, 144, 142, 142, 144, 140, 135, 131, 124, 120, 121, 123, 121, 121, 117, 113, 109, 112, 117, 112, 120, 121, 123, 126, 122, 123, 124, 123, 129, 131, 128, 129, 122, 120, 128, 126, 128, 132, 134, 134, 132, 132, 135, 133, 134, 129, 128, 129, 121, 125, 123, 120, 125, 123, 125, 125, 120, 123, 123, 121, 125, 128, 124, 124, 124, 123, 125, 124, 129, 129, 128, 130, 129, 130, 130, 131, 133, 132, 131, 131, 133, 132, 132, 129, 123, 124, 129, 128, 121, 123, 135, 139, 129, 120, 123, 125, 124, 125, 130, 134, 131, 124, 122, 123, 121, 120, 124, 129, 125, 129, 136, 131, 122, 121, 125, 126, 122, 119, 120, 120, 119, 117, 120, 121, 123, 120, 119, 119, 121, 121, 126, 130, 132, 130, 129, 128, 126, 126, 126, 124, 125, 126, 128, 124, 120, 123, 122, 126, 125, 124, 118, 126, 123, 138, 115, 147, 183, 84, 66, 135, 168, 124, 104, 117, 141, 134, 107, 116, 129, 130, 125, 128, 124, 129, 124, 132, 141, 124, 129, 129, 129, 128, 119, 141, 144, 134, 125, 145, 182, 152, 69, 67, 111, 158, 167, 138, 74, 112, 189, 134, 88, 77, 107, 145, 161, 108, 87, 110, 146, 140, 110, 98, 126, 129, 123, 149, 122, 125, 111, 155, 137, 126, 122, 103, 132, 134, 139, 122, 107, 110, 149, 138, 134, 151, 90, 116, 169, 103, 74, 91, 120, 149, 107, 72, 125, 136, 106, 133, 125, 116, 121, 88, 156, 172, 105, 68, 114, 158, 124, 92, 63, 117, 148, 132, 108, 89, 101, 147, 145, 95, 82, 121, 130, 109, 63, 52, 123, 113, 82, 75, 88, 160, 185, 136, 105, 130, 155, 171, 149, 96, 101, 130, 153, 134, 66, 80, 138, 133, 112, 100, 105, 135, 157, 126, 110, 119, 138, 159, 152, 132, 129, 144, 140, 138, 121, 130, 122, 131, 142, 146, 144, 143, 135, 138, 144, 114, 107, 114, 143, 128, 104, 90, 119, 141, 106, 51, 77, 90, 93, 72, 32, 34, 45, 0, 73, 252, 124, 91, 125, 138, 214, 196, 24, 86, 210, 142, 147, 57, 41, 184, 169, 67, 118, 94, 160, 221, 90, 69, 157, 157, 164, 123, 42, 121, 183, 109, 77, 89, 102, 166, 148, 79, 111, 172, 157, 154, 110, 115, 185, 193, 130, 111, 122, 149, 171, 103, 95, 159, 169, 147, 126, 109, 166, 176, 112, 85, 104, 145, 155, 97, 68, 123, 146, 119, 88, 74, 102, 110, 83, 72, 94, 81, 53, 26, 166, 255, 105, 81, 163, 188, 163, 118, 21, 131, 233, 95, 56, 100, 134, 167, 119, 47, 147, 207, 143, 102, 95, 135, 191, 139, 52, 96, 165, 136, 89, 84, 121, 166, 139, 85, 122, 182, 153, 115, 108, 134, 176, 154, 81, 106, 188, 181, 112, 101, 145, 192, 174, 90, 97, 184, 175, 91, 100, 150, 169, 135, 74, 100, 175, 148, 84, 106, 154, 160, 118, 83, 114, 152, 114, 54, 81, 133, 116, 84, 62, 74, 75, 167, 255, 143, 63, 184, 220, 107, 75, 85, 121, 185, 96, 34, 152, 195, 101, 89, 144, 174, 171, 113, 91, 151, 169, 92, 67, 125, 153, 113, 78, 102, 154, 158, 105, 105, 158, 165, 125, 104, 125, 155, 146, 109, 120, 151, 142, 120, 124, 144, 148, 129, 128, 170, 159, 105, 116, 154, 135, 108, 125, 142, 146, 137, 130, 147, 163, 140, 119, 141, 143, 126, 121, 123, 126, 136, 125, 114, 133, 139, 118, 117, 130, 116, 108, 100, 89, 85, 80, 84, 66, 35, 165, 255, 131, 71, 185, 211, 103, 72, 120, 174, 129, 68, 112, 179, 146, 75, 112, 180, 160, 106, 114, 148, 138, 102, 98, 125, 138, 104, 87, 116, 141, 123, 103, 124, 154, 135, 112, 130, 145, 130, 111, 121, 143, 140, 114, 114, 140, 149, 122, 123, 149, 148, 126, 124, 135, 136, 119, 136, 185, 117, 104, 176, 144, 104, 139, 142, 126, 152, 128, 138, 181, 132, 111, 163, 155, 111, 124, 151, 133, 129, 132, 132, 131, 122, 105, 95, 125, 121, 90, 106, 109, 82, 93, 114, 84, 62, 103, 73, 130, 221, 131, 96, 175, 190, 84, 96, 143, 130, 115, 101, 137, 151, 136, 94, 131, 172, 120, 94, 141, 147, 88, 89, 139, 125, 92, 111, 125, 123, 114, 110, 126, 144, 129, 107, 130, 144, 124, 114, 131, 139, 130, 131, 137, 131, 130, 137, 135, 134, 133, 132, 131, 129, 123, 117, 124, 125, 114, 124, 134, 141, 187, 124, 91, 202, 172, 73, 125, 200, 129, 90, 158, 167, 133, 119, 135, 147, 143, 124, 129, 157, 146, 105, 130, 150, 105, 90, 116, 125, 95, 96, 117, 116, 101, 87, 103, 113, 96, 80, 107, 109, 40, 138, 217, 93, 102, 196, 156, 80, 117, 141, 122, 117, 109, 133, 150, 120, 93, 144, 157, 101, 109, 159, 129, 88, 123, 144, 108, 106, 126, 119, 111, 114, 113, 123, 132, 116, 122, 145, 132, 115, 141, 145, 124, 130, 146, 131, 121, 139, 142, 125, 129, 138, 132, 131, 130, 129, 134, 125, 122, 130, 129, 125, 122, 133, 131, 172, 146, 90, 174, 163, 90, 137, 182, 122, 106, 170, 150, 117, 135, 150, 149, 129, 126, 143, 136, 115, 116, 146, 126, 94, 125, 126, 85, 100, 134, 109, 93, 120, 132, 94, 95, 133, 97, 79, 111, 99, 96, 77, 117, 165, 98, 119, 177, 130, 82, 139, 152, 100, 116, 138, 140, 110, 108, 146, 136, 107, 129, 158, 123, 100, 135, 137, 111, 114, 132, 135, 103, 101, 133, 121, 99, 120, 141, 119, 113, 138, 139, 128, 125, 143, 145, 122, 128, 139, 135, 121, 129, 146, 134, 124, 139, 144, 124, 129, 142, 130, 121, 132, 129, 121, 129, 124, 152, 142, 105, 157, 155, 101, 140, 167, 126, 117, 156, 141, 117, 128, 143, 141, 117, 141, 145, 122, 122, 130, 131, 117, 119, 124, 124, 109, 115, 124, 114, 106, 108, 119, 105, 95, 123, 114, 97, 118, 118, 110, 100, 104, 110, 100, 79, 102, 143, 98, 107, 160, 137, 105, 135, 151, 114, 115, 136, 132, 119, 126, 136, 129, 131, 129, 128, 133, 122, 125, 125, 122, 132, 123, 121, 122, 121, 117, 118, 119, 116, 125, 121, 121, 136, 135, 128, 135, 144, 136, 128, 140, 144, 130, 133, 144, 138, 125, 133, 142, 134, 126, 138, 139, 121, 125, 138, 128, 119, 141, 140, 120, 136, 134, 120, 131, 136, 133, 131, 136, 136, 132, 131, 131, 132, 132, 132, 128, 130, 128, 123, 128, 130, 126, 128, 128, 116, 115, 118, 122, 118, 120, 124, 112, 115, 121, 118, 114, 121, 120, 108, 115, 114, 106, 108, 110, 107, 102, 101, 105, 111, 109, 121, 132, 121, 122, 137, 128, 114, 133, 140, 130, 130, 146, 140, 130, 136, 142, 135, 128, 137, 133, 124, 130, 136, 131, 124, 126, 123, 120, 120, 122, 121, 120, 124, 126, 126, 126, 132, 132, 129, 136, 138, 134, 134, 140, 136, 135, 138, 135, 133, 135, 133, 131, 135, 132, 129, 131, 128, 124, 122, 124, 125, 128, 137, 132, 133, 130, 122, 131, 140, 134, 129, 141, 139, 132, 130, 136, 137, 133, 134, 131, 126, 126, 130, 124, 126, 131, 129, 124, 121, 119, 116, 118, 121, 118, 118, 123, 119, 115, 121, 121, 117, 118, 120, 116, 114, 113, 114, 116, 117, 113, 107, 107, 109, 110, 114, 116, 116, 121, 126, 129, 126, 128, 131, 133, 136, 135, 133, 137, 139, 139, 138, 136, 136, 132, 129, 130, 131, 129, 129, 129, 126, 124, 124, 122, 121, 121, 121, 121, 123, 122, 124, 129, 129, 129, 130, 133, 132, 134, 136, 136, 135, 135, 135, 135, 134, 132, 131, 131, 131, 129, 128, 128, 126, 129, 132, 130, 125, 126, 132, 134, 132, 130, 131, 133, 131, 129, 130, 130, 131, 131, 131, 130, 129, 128, 126, 129, 126, 124, 124, 126, 122, 121, 123, 123, 118, 117, 119, 122, 122, 121, 120, 119, 119, 116, 116, 117, 119, 119, 120, 120, 118, 113, 114, 117, 118, 116, 112, 110, 110, 112, 113, 119, 121, 120, 118, 121, 123, 126, 130, 132, 133, 132, 130, 128, 132, 134, 136, 136, 136, 132, 128, 126, 126, 126, 128, 129, 128, 125, 123, 124, 123, 123, 121, 121, 121, 120, 119, 121, 126, 130, 131, 129, 130, 131, 132, 133, 133, 136, 136, 134, 132, 132, 131, 131, 134, 135, 133, 132, 132, 129, 130, 133, 133, 132, 131, 129, 129, 130, 129, 128, 128, 128, 125, 124, 124, 126, 128, 128, 126, 126, 126, 124, 126, 126, 126, 125, 125, 124, 124, 124, 123, 124, 126, 125, 120, 119, 120, 120, 118, 119, 121, 118, 113, 114, 117, 118, 117, 113, 113, 112, 112, 112, 116, 118, 116, 115, 117, 117, 115, 117, 121, 125, 129, 130, 129, 129, 129, 129, 133, 134, 134, 133, 133, 132, 130, 132, 133, 131, 128, 126, 128, 126, 124, 123, 124, 126, 125, 123, 121, 122, 123, 124, 128, 129, 129, 129, 129, 130, 132, 132, 133, 133, 134, 133, 132, 132, 133, 134, 133, 134, 133, 133, 132, 130, 130, 131, 133, 132, 130, 130, 131, 132, 132, 130, 129, 130, 129, 128, 129, 128, 129, 130, 132, 130, 126, 124, 124, 126, 128, 128, 126, 126, 126, 125, 125, 124, 123, 122, 123, 121, 121, 124, 124, 122, 122, 124, 124, 124, 120, 119, 120, 123, 122, 121, 121, 121, 120, 119, 120, 119, 119, 122, 123, 121, 122, 119, 119, 120, 123, 121, 122, 123, 121, 122, 125, 124, 123, 126, 126, 125, 124, 128, 129, 132, 131, 130, 128, 129, 125, 124, 128, 131, 132, 129, 130, 129, 129, 126, 128, 129, 130, 128, 126, 126, 128, 129, 130, 130, 128, 128, 128, 129, 129, 132, 133, 134, 134, 134, 133, 132, 132, 133, 137, 137, 136, 133, 132, 131, 131, 129, 128, 130, 130, 129, 129, 126, 123, 125, 125, 123, 120, 121, 121, 123, 124, 124, 122, 122, 123, 124, 126, 126, 126, 123, 122, 123, 124, 125, 124, 124, 124, 122, 120, 119, 118, 119, 121, 121, 119, 117, 118, 118, 118, 120, 119, 118, 117, 119, 120, 122, 123, 121, 120, 123, 124, 126, 130, 130, 130, 129, 130, 129, 130, 130, 130, 130, 129, 129, 126, 128, 129, 130, 129, 128, 124, 123, 124, 125, 126, 128, 128, 122, 122, 124, 125, 126, 129, 130, 128, 128, 129, 129, 131, 133, 134, 133, 133, 133, 131, 131, 133, 132, 129, 130, 130, 128, 128, 131, 130, 128, 128, 124, 122, 123, 125, 124, 124, 125, 123, 121, 123, 124, 123, 124, 126, 122, 121, 126, 124, 122, 128, 128, 123, 125, 126, 122, 124, 125, 121, 122, 126, 123, 117, 125, 126, 118, 119, 124, 119, 114, 123, 123, 116, 121, 128, 119, 116, 126, 123, 119, 121, 126, 122, 121, 129, 123, 120, 126, 126, 122, 123, 128, 123, 123, 126, 123, 124, 126, 126, 124, 128, 125, 121, 128, 128, 124, 126, 131, 128, 121, 132, 131, 123, 130, 134, 128, 125, 131, 130, 122, 132, 134, 125, 129, 133, 131, 125, 133, 133, 123, 126, 132, 129, 130, 129, 131, 124, 135, 126, 148, 141, 106, 121, 135, 135, 104, 138, 130, 121, 124, 119, 122, 120, 131, 115, 130, 130, 120, 120, 130, 124, 113, 129, 135, 119, 123, 131, 125, 123, 128, 128, 126, 129, 122, 122, 126, 122, 117, 121, 123, 120, 122, 128, 117, 121, 126, 119, 116, 128, 125, 114, 128, 132, 117, 120, 135, 125, 118, 130, 130, 116, 123, 132, 125, 129, 134, 124, 121, 125, 120, 117, 128, 132, 126, 130, 132, 126, 124, 126, 122, 124, 133, 132, 129, 132, 132, 125, 129, 132, 126, 128, 133, 129, 128, 133, 130, 124, 130, 133, 121, 124, 133, 123, 118, 132, 131, 117, 126, 134, 122, 124, 130, 123, 124, 130, 124, 122, 133, 126, 119, 130, 133, 121, 125, 135, 122, 122, 131, 122, 118, 128, 128, 120, 126, 128, 119, 122, 124, 119, 121, 129, 124, 124, 128, 123, 126, 131, 123, 118, 128, 131, 118, 121, 133, 129, 120, 128, 135, 125, 123, 128, 125, 123, 126, 125, 123, 130, 128, 123, 128, 131, 125, 125, 131, 129, 124, 128, 129, 126, 125, 129, 126, 125, 131, 134, 129, 125, 132, 131, 123, 123, 130, 129, 126, 128, 132, 132, 131, 123, 124, 132, 124, 120, 130, 134, 125, 122, 130, 129, 123, 125, 126, 126, 129, 125, 123, 126, 129, 125, 124, 128, 129, 128, 125, 122, 128, 129, 121, 123, 133, 130, 120, 124, 129, 125, 122, 122, 124, 124, 125, 126, 125, 125, 126, 124, 123, 125, 124, 128, 128, 123, 124, 129, 125, 123, 130, 131, 124, 126, 134, 131, 123, 126, 129, 125, 124, 125, 126, 126, 125, 125, 128, 129, 125, 123, 126, 129, 125, 126, 129, 128, 125, 124, 125, 128, 129, 126, 128, 132, 131, 128, 126, 128, 126, 124, 128, 126, 126, 128, 129, 125, 125, 126, 124, 125, 126, 125, 124, 129, 128, 122, 126, 128, 123, 125, 129, 126, 126, 128, 124, 125, 129, 124, 123, 129, 130, 125, 124, 126, 126, 124, 122, 123, 125, 128, 125, 124, 129, 129, 124, 123, 125, 125, 124, 125, 128, 129, 126, 125, 128, 128, 124, 124, 128, 128, 125, 126, 129, 128, 125, 125, 125, 126, 126, 125, 126, 128, 126, 126, 126, 128, 128, 126, 126, 128, 128, 126, 126, 128, 128, 128, 128, 128, 125, 126, 128, 126, 125, 125, 126, 126, 126, 126, 126, 128, 126, 125, 126, 126, 126, 125, 125, 125, 128, 126, 125, 128, 128, 126, 125, 125, 128, 128, 128, 126, 126, 128, 128, 124, 125, 128, 126, 126, 126, 128, 125, 125, 126, 125, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 125, 125, 126, 126, 126, 128, 126, 124, 126, 126, 124, 126, 126, 125, 126, 126, 126, 125, 126, 126, 125, 126, 128, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 125, 125, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 125, 125, 126, 125, 125, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 126, 125, 125, 126, 125, 126, 126, 126, 126, 125, 126, 126, 125, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 125, 125, 125, 126, 126, 126, 126, 125, 126, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 125, 125, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 125, 125, 126, 126, 126, 126, 125, 126, 125, 126, 126, 126, 126, 126, 125, 126, 126, 125, 126, 126, 126, 126, 126, 126, 126, 125};
\ No newline at end of file
+// 27451 samples, 8000 Hz, adpcm, generated by tools/audio_encode.py
+__CODE uint8_t voice_bulk[13726] = {
+    0xFF, 0xF4, 0xDF, 0x3B, 0x0C, 0x03, 0x3D, 0xC0, 0x83, 0x80, 0x80, 0xE0, 0xB3, 0x84, 0x80, 0x3C,
+    0x80, 0x3D, 0x00, 0xD8, 0xB3, 0xB4, 0x03, 0xD8, 0x30, 0x80, 0x3D, 0x4B, 0xCB, 0x83, 0x80, 0x50,
+    0x08, 0xC8, 0x30, 0xD0, 0x80, 0xB4, 0xC3, 0x30, 0x4C, 0x0B, 0x48, 0x08, 0xC8, 0xB3, 0x97, 0x0A,
+    0x82, 0x70, 0x1E, 0x80, 0x80, 0xA0, 0xA2, 0x80, 0x80, 0x80, 0x80, 0x85, 0x4B, 0xB8, 0x84, 0x0B,
+    0xC4, 0x30, 0x08, 0xB7, 0x08, 0x8A, 0x83, 0x4B, 0x08, 0x08, 0xD8, 0x84, 0xC0, 0x83, 0x80, 0xD0,
+    0x03, 0x3C, 0xD0, 0x83, 0x0B, 0x84, 0xC0, 0x03, 0x88, 0x00, 0x88, 0x3F, 0x4B, 0xB8, 0x84, 0x80,
+    0x80, 0xF0, 0x83, 0x4B, 0x08, 0x08, 0x08, 0x0E, 0x83, 0x3C, 0x4B, 0x08, 0xC8, 0x84, 0x4B, 0xB8,
+    0x84, 0x80, 0x3C, 0x80, 0x80, 0x3D, 0x4B, 0x08, 0x08, 0x80, 0x80, 0x08, 0x3F, 0x3D, 0xC0, 0xC3,
+    0x03, 0x08, 0x08, 0x3E, 0x80, 0x80, 0x3D, 0x4B, 0x08, 0xC8, 0x03, 0x3C, 0x80, 0x80, 0x3E, 0x80,
+    0xD0, 0x03, 0x3C, 0x08, 0xC8, 0x58, 0xB8, 0x84, 0x4B, 0xB8, 0x03, 0x3C, 0x80, 0x80, 0x80, 0xF7,
+    0x39, 0x80, 0x0A, 0x07, 0xBA, 0x28, 0x01, 0x8A, 0x30, 0x37, 0xCF, 0x42, 0xF8, 0x59, 0xA1, 0x09,
+    0x83, 0xBB, 0x52, 0xB1, 0x77, 0xCA, 0xA0, 0x02, 0x1A, 0x87, 0xE9, 0x38, 0x9A, 0xC8, 0x36, 0x5B,
+    0xC1, 0x88, 0x18, 0xC8, 0x52, 0x88, 0x98, 0x82, 0x8D, 0x01, 0x81, 0x48, 0xA2, 0x9A, 0x19, 0xBB,
+    0x35, 0x00, 0xB0, 0xFA, 0x0C, 0x06, 0x9A, 0x27, 0x9C, 0x10, 0xA0, 0x3B, 0x97, 0x88, 0x20, 0xD9,
+    0x28, 0x80, 0x09, 0x14, 0x9A, 0x00, 0x92, 0x8F, 0x12, 0x88, 0x38, 0xF1, 0x09, 0x18, 0xA8, 0x22,
+    0x60, 0xE5, 0x29, 0x08, 0xB9, 0x71, 0x99, 0x92, 0xA3, 0x0C, 0xA4, 0x09, 0x50, 0xB8, 0x31, 0x28,
+    0xED, 0x21, 0x98, 0x10, 0x93, 0x0D, 0xA2, 0x98, 0x30, 0xFB, 0x73, 0xB9, 0x01, 0xA1, 0x0B, 0x87,
+    0x1A, 0x20, 0xC8, 0x38, 0xA8, 0x89, 0x05, 0x8A, 0x14, 0x9A, 0x19, 0xD1, 0x39, 0x01, 0xCB, 0x17,
+    0x8D, 0x13, 0xE8, 0x49, 0xB3, 0x4B, 0x08, 0xA9, 0x23, 0x9C, 0xA4, 0x93, 0x3C, 0x81, 0x9B, 0x33,
+    0xDB, 0x33, 0x9B, 0x02, 0xA8, 0x2C, 0xB5, 0x39, 0x19, 0xE8, 0x41, 0xA9, 0x09, 0xA6, 0x78, 0xAA,
+    0x04, 0x0B, 0x18, 0xD2, 0x30, 0xA9, 0x01, 0x11, 0x0C, 0xA2, 0x81, 0x59, 0xC9, 0x20, 0x98, 0x18,
+    0x30, 0xEB, 0x22, 0xAB, 0x11, 0xC0, 0x7A, 0xA9, 0x71, 0xF3, 0x01, 0x08, 0x1C, 0xA4, 0x1A, 0x20,
+    0xE9, 0x23, 0x8A, 0x08, 0xA5, 0x2A, 0x08, 0x9A, 0x22, 0x9C, 0x23, 0xD9, 0x31, 0xA9, 0x98, 0x02,
+    0x0D, 0x95, 0xAA, 0x74, 0xC9, 0x12, 0xA1, 0x2D, 0xA3, 0x89, 0x40, 0xCA, 0x13, 0x08, 0x2C, 0xB3,
+    0xA1, 0x38, 0xDA, 0x12, 0xC0, 0x12, 0x29, 0x3F, 0x28, 0x9D, 0x84, 0xA0, 0x01, 0x90, 0x2A, 0x90,
+    0x09, 0x31, 0x8D, 0x02, 0xB8, 0x43, 0xC0, 0x40, 0x09, 0x90, 0x10, 0x8D, 0xB2, 0x1B, 0x16, 0x8D,
+    0x85, 0x90, 0x29, 0xA8, 0x39, 0xC0, 0x11, 0x11, 0xBA, 0x16, 0x99, 0x18, 0xB1, 0x2B, 0x92, 0x9F,
+    0x95, 0x00, 0x6A, 0xC0, 0x20, 0x89, 0x89, 0x19, 0x8A, 0x84, 0x39, 0xB3, 0xA4, 0x11, 0x8A, 0xAB,
+    0x94, 0x2D, 0x18, 0x0A, 0xB3, 0x27, 0xAA, 0x15, 0x1D, 0x29, 0xB9, 0x10, 0xB7, 0x28, 0x10, 0x8C,
+    0x10, 0x99, 0x0A, 0x97, 0x2B, 0x93, 0x98, 0x30, 0x0A, 0x38, 0x10, 0xF9, 0x83, 0x9A, 0x28, 0x03,
+    0x3F, 0x91, 0xB8, 0x69, 0xA8, 0x80, 0x90, 0x68, 0xAA, 0x19, 0xE3, 0x3A, 0x82, 0x9B, 0x42, 0xB1,
+    0x48, 0xA0, 0xD0, 0x23, 0x9D, 0x41, 0xB9, 0x23, 0x08, 0x08, 0x86, 0x4B, 0xD8, 0x08, 0x0A, 0x0A,
+    0xA2, 0x38, 0x30, 0x8F, 0x28, 0xF3, 0x30, 0x1B, 0xA2, 0x22, 0x3B, 0x17, 0x2D, 0x01, 0x08, 0x0A,
+    0xD8, 0x80, 0x08, 0x8A, 0x03, 0x08, 0x0D, 0x3C, 0x08, 0x08, 0x3D, 0x0B, 0x03, 0x0D, 0x48, 0xB8,
+    0x58, 0xB3, 0xC8, 0x03, 0x3C, 0x30, 0xD0, 0x30, 0x80, 0x80, 0xF0, 0x83, 0x80, 0x80, 0x3D, 0x8B,
+    0x08, 0xE8, 0x03, 0x80, 0x8D, 0x80, 0x3D, 0x40, 0x08, 0x58, 0x08, 0x78, 0x4B, 0x0B, 0x84, 0x3C,
+    0xC0, 0xB3, 0x08, 0x2A, 0x80, 0x3B, 0xD0, 0xB0, 0xC3, 0xB3, 0x84, 0x8B, 0xE5, 0xA3, 0xC2, 0x21,
+    0x4F, 0x19, 0x88, 0x10, 0x98, 0x78, 0x1B, 0x19, 0x7B, 0xF8, 0xA5, 0x81, 0x08, 0x08, 0x28, 0x1B,
+    0x2A, 0x19, 0x2A, 0xF2, 0xA3, 0x80, 0x08, 0x28, 0x2B, 0x2A, 0x08, 0x38, 0x3B, 0x4B, 0xB8, 0x97,
+    0x84, 0x00, 0x88, 0x00, 0x88, 0xB4, 0x8F, 0x29, 0xA8, 0x08, 0x48, 0xB8, 0x80, 0x80, 0x60, 0x8B,
+    0x3C, 0x80, 0x50, 0x78, 0x0B, 0x08, 0xA8, 0x02, 0x08, 0x78, 0xF1, 0xB4, 0x20, 0x0A, 0xB6, 0xD7,
+    0x7B, 0x19, 0x1A, 0x79, 0xAB, 0x84, 0x90, 0x91, 0x91, 0x81, 0x39, 0x8B, 0x83, 0x38, 0x0F, 0x82,
+    0x1B, 0x90, 0x54, 0xE9, 0x90, 0x42, 0x9A, 0x01, 0x0A, 0x91, 0x01, 0xD0, 0x81, 0x92, 0x19, 0xA1,
+    0xF6, 0x92, 0xB2, 0xE1, 0x17, 0x1F, 0x01, 0x2B, 0x88, 0x08, 0xB2, 0x01, 0x90, 0xC1, 0x94, 0x90,
+    0x10, 0x18, 0x8B, 0x12, 0x0C, 0x81, 0x7A, 0x2C, 0x98, 0x92, 0x08, 0xF3, 0x01, 0x18, 0xD1, 0x02,
+    0x19, 0x73, 0xCF, 0x94, 0x83, 0x79, 0x9D, 0x13, 0xB8, 0x02, 0x99, 0x13, 0x0D, 0x11, 0x8A, 0x10,
+    0x09, 0x89, 0x94, 0x1A, 0x30, 0xAD, 0x86, 0xC0, 0x82, 0xB2, 0x59, 0x19, 0x3C, 0x19, 0x3C, 0xC1,
+    0xC2, 0x94, 0x08, 0xC2, 0x10, 0x19, 0xF2, 0x21, 0x2B, 0x5B, 0x2C, 0x28, 0x0C, 0x92, 0x88, 0xD4,
+    0xA3, 0xC2, 0x20, 0xA0, 0x18, 0x81, 0x3C, 0x18, 0x5E, 0x1A, 0x1A, 0x00, 0x99, 0xB7, 0x20, 0x8A,
+    0xB4, 0x28, 0x19, 0xC1, 0x93, 0x1A, 0x08, 0x80, 0x70, 0xEB, 0x85, 0x98, 0x20, 0xD0, 0x30, 0x4B,
+    0x1D, 0x92, 0x0A, 0xB4, 0x91, 0x70, 0x8B, 0x68, 0x0C, 0xA2, 0xA2, 0x38, 0xE0, 0x12, 0x0A, 0x91,
+    0x18, 0x9A, 0x97, 0x88, 0x80, 0x18, 0x59, 0x9B, 0x41, 0x3F, 0x89, 0x81, 0x5B, 0xC8, 0xA4, 0x81,
+    0x88, 0xB3, 0x00, 0xD3, 0x20, 0x0A, 0xB1, 0x51, 0x1F, 0xA2, 0x39, 0x2A, 0xB8, 0x23, 0x2F, 0xF2,
+    0x02, 0x1A, 0xC1, 0x93, 0x49, 0x8B, 0x94, 0x29, 0x1B, 0xD2, 0x83, 0x19, 0xF0, 0x84, 0x19, 0xA9,
+    0x95, 0x39, 0x2A, 0x3C, 0x4B, 0x8B, 0xA4, 0x90, 0x93, 0xA8, 0xA6, 0x39, 0x88, 0x0B, 0x97, 0x2B,
+    0xB5, 0x09, 0x03, 0x0E, 0x83, 0x1C, 0xA2, 0xA1, 0x13, 0x8D, 0x03, 0x3F, 0x09, 0x80, 0x6B, 0xA8,
+    0xB2, 0xA5, 0x88, 0xB4, 0x28, 0x29, 0x0A, 0x58, 0x9C, 0x95, 0x80, 0x2A, 0xB3, 0x7B, 0x99, 0xA4,
+    0x28, 0x9A, 0xA6, 0x5A, 0xA9, 0xB3, 0x12, 0x1D, 0xD4, 0x40, 0x1C, 0xA0, 0x21, 0x1B, 0xCA, 0x27,
+    0x0D, 0xA5, 0x09, 0x48, 0xD8, 0x13, 0x8B, 0x93, 0x2A, 0x88, 0xA0, 0x22, 0x1D, 0x89, 0x81, 0x8A,
+    0x8B, 0x88, 0xD5, 0x8A, 0x74, 0xE1, 0x23, 0x0B, 0xB0, 0x96, 0x3B, 0xB8, 0x94, 0x6A, 0x09, 0xE3,
+    0x40, 0x8B, 0xA1, 0x82, 0x2D, 0xB8, 0x83, 0x5B, 0xB9, 0x60, 0xC4, 0x59, 0x98, 0xA8, 0x23, 0x8F,
+    0x93, 0x88, 0x48, 0xC0, 0x32, 0xE0, 0x39, 0xB0, 0x3A, 0xB2, 0x2C, 0xB2, 0x89, 0x12, 0x2F, 0xA7,
+    0x4A, 0x90, 0x99, 0x42, 0x9D, 0x94, 0x88, 0x20, 0xC2, 0x49, 0x19, 0xD8, 0x22, 0x0D, 0x81, 0x90,
+    0x49, 0xC9, 0x02, 0x7B, 0xE2, 0x31, 0x8A, 0x99, 0x05, 0x1D, 0xA2, 0x91, 0x40, 0xB9, 0x12, 0x99,
+    0x48, 0x9A, 0x39, 0xC1, 0x09, 0xA4, 0x8A, 0xA1, 0x70, 0xF4, 0x13, 0x8C, 0x28, 0xB1, 0x6B, 0xA0,
+    0x81, 0x02, 0x8C, 0x02, 0x8A, 0x60, 0xB9, 0x12, 0xA9, 0x18, 0xB3, 0x1C, 0xA1, 0x77, 0xAC, 0xA6,
+    0x89, 0x38, 0xD0, 0x40, 0x89, 0x80, 0xA3, 0x8A, 0x82, 0x99, 0x50, 0xA3, 0x2D, 0xB8, 0x80, 0x32,
+    0x9F, 0xA2, 0x70, 0xE3, 0x59, 0x99, 0x0A, 0x84, 0x0C, 0x84, 0x98, 0x21, 0xBA, 0x20, 0xA8, 0x29,
+    0x97, 0x11, 0x0A, 0x8E, 0x82, 0x18, 0xA9, 0x98, 0x67, 0xCA, 0x23, 0xAB, 0x49, 0xD2, 0x49, 0xA1,
+    0x08, 0x02, 0x8D, 0x82, 0x8A, 0x41, 0xA8, 0x05, 0x8C, 0x91, 0x98, 0x32, 0xAE, 0x02, 0x26, 0xCB,
+    0x04, 0x1D, 0x28, 0xD0, 0x40, 0xB0, 0x11, 0x90, 0x2B, 0xC1, 0x18, 0x01, 0x49, 0xA3, 0x8D, 0x93,
+    0xAC, 0x34, 0x9F, 0x30, 0x05, 0x9C, 0x95, 0x1C, 0x20, 0xCB, 0x43, 0xAA, 0x23, 0xA9, 0x59, 0xB9,
+    0x30, 0x99, 0x40, 0xA1, 0x3C, 0xC1, 0x99, 0x95, 0x8E, 0x44, 0xE8, 0x51, 0xBA, 0x11, 0xD2, 0x39,
+    0xC1, 0x30, 0x80, 0x1C, 0xA4, 0x2B, 0x91, 0x19, 0x82, 0xAA, 0x85, 0x9B, 0x31, 0xCF, 0x64, 0xE9,
+    0x43, 0xAB, 0x30, 0xF2, 0x48, 0xB8, 0x20, 0x91, 0x4B, 0xD2, 0x28, 0x90, 0x3A, 0xB1, 0x29, 0xC2,
+    0x2B, 0xA3, 0x9F, 0x37, 0xBC, 0x06, 0x8C, 0x31, 0xE9, 0x32, 0xAB, 0x22, 0xD0, 0x40, 0xB8, 0x11,
+    0xA1, 0x5B, 0xA8, 0x80, 0x92, 0x3C, 0x91, 0xAA, 0x56, 0xCB, 0x85, 0x1A, 0x39, 0xD0, 0x21, 0x99,
+    0x08, 0xA4, 0x2B, 0x01, 0xA8, 0x33, 0x8D, 0x10, 0xD1, 0x48, 0x99, 0x00, 0xB1, 0x2B, 0x22, 0xAE,
+    0x01, 0x00, 0x23, 0x91, 0x70, 0x98, 0x90, 0xBA, 0x78, 0xA1, 0x29, 0xA2, 0x59, 0xC2, 0x8B, 0x03,
+    0xA9, 0x9A, 0xBF, 0x61, 0xF3, 0x19, 0x82, 0x29, 0x83, 0x3B, 0x84, 0x8A, 0xC8, 0x39, 0xA5, 0x1B,
+    0x13, 0x1A, 0xA3, 0xCB, 0x6A, 0xC8, 0x9A, 0xF8, 0x58, 0xC3, 0x2A, 0x02, 0x19, 0x84, 0x2A, 0x92,
+    0xA9, 0xD0, 0x59, 0xA1, 0x1A, 0x12, 0x39, 0xC1, 0x88, 0x88, 0x99, 0xFD, 0x88, 0x0B, 0x37, 0x8E,
+    0x22, 0x89, 0x22, 0xA9, 0x32, 0xBB, 0x1A, 0x8B, 0x25, 0xBB, 0x32, 0x83, 0x38, 0xA9, 0x8D, 0x92,
+    0xCD, 0x8E, 0xB0, 0x7A, 0xB5, 0x09, 0x14, 0x89, 0x12, 0x89, 0x11, 0xAB, 0x99, 0x10, 0x86, 0x0D,
+    0x32, 0xA9, 0x13, 0x9D, 0x21, 0xCA, 0xB8, 0x9C, 0xB9, 0x73, 0xE2, 0x38, 0xA5, 0x39, 0xA3, 0x4A,
+    0xC2, 0x1B, 0xA1, 0x49, 0xC2, 0x3A, 0x92, 0x48, 0xE0, 0x28, 0x90, 0x39, 0xDC, 0x10, 0xDB, 0x71,
+    0xC0, 0x10, 0x92, 0x39, 0x91, 0x49, 0xA0, 0x29, 0xD9, 0x48, 0xB0, 0x48, 0xB0, 0x40, 0xC0, 0x10,
+    0xA0, 0x21, 0xCB, 0x39, 0xFB, 0x2A, 0x85, 0xAA, 0x63, 0x99, 0x22, 0xB0, 0x51, 0x9A, 0x81, 0x8C,
+    0x22, 0xBB, 0x87, 0x1A, 0x02, 0xB9, 0x85, 0x80, 0x5E, 0x1C, 0xB0, 0xA1, 0x18, 0xD5, 0x94, 0x7B,
+    0x0B, 0x91, 0xB3, 0x78, 0x8B, 0xA3, 0x88, 0x20, 0x8B, 0x94, 0x3A, 0x19, 0x09, 0xD2, 0x12, 0x2C,
+    0xD0, 0x81, 0x1B, 0x9B, 0x70, 0x0A, 0xF6, 0x04, 0x3B, 0x3A, 0xC8, 0x85, 0x3A, 0x9A, 0x91, 0x01,
+    0x3B, 0xD1, 0x84, 0x4B, 0xA9, 0x94, 0x29, 0xA0, 0xB1, 0x91, 0x2A, 0xF1, 0x90, 0x79, 0x3D, 0xF2,
+    0x95, 0x4A, 0x09, 0xA0, 0x94, 0x4A, 0xA9, 0x83, 0x3B, 0x99, 0xC5, 0x82, 0x4A, 0x1B, 0xA1, 0xA1,
+    0x32, 0x1F, 0xD2, 0x20, 0x99, 0xA2, 0x92, 0x7C, 0x99, 0xA2, 0x30, 0x1C, 0xB2, 0x00, 0x92, 0x49,
+    0x89, 0x08, 0xC2, 0x01, 0xD0, 0x94, 0x7A, 0x1B, 0xD1, 0x94, 0x4A, 0x89, 0x10, 0x3B, 0x0B, 0xD5,
+    0x02, 0x0A, 0xC3, 0x01, 0x6C, 0xB9, 0xB6, 0x28, 0x2A, 0x89, 0x00, 0xA8, 0x03, 0x5D, 0xAA, 0xB7,
+    0x21, 0x3D, 0x89, 0xA2, 0x10, 0xF1, 0x03, 0x5E, 0x9A, 0xD5, 0x83, 0x29, 0x5B, 0x8B, 0xC5, 0x02,
+    0x4B, 0x09, 0x19, 0x98, 0xE5, 0x12, 0x5C, 0x0C, 0xB3, 0x91, 0xE3, 0x83, 0x6B, 0x1C, 0x00, 0x5C,
+    0xAA, 0xE7, 0x22, 0x2D, 0xF3, 0x84, 0x6C, 0x2D, 0xA0, 0xC3, 0x93, 0x88, 0x02, 0x4F, 0x1B, 0xE2,
+    0x84, 0x5D, 0xC8, 0xA4, 0x91, 0x92, 0x6A, 0x0B, 0x11, 0xAA, 0xA6, 0x80, 0x20, 0x4E, 0x9A, 0xC5,
+    0x21, 0x1C, 0x01, 0x1C, 0xF3, 0xA5, 0x6A, 0x0B, 0x00, 0xC0, 0xB5, 0x68, 0x4E, 0x0A, 0xF3, 0x95,
+    0xA8, 0x13, 0x3F, 0xE1, 0x13, 0x5E, 0xC8, 0x84, 0x4C, 0xD8, 0xB6, 0x59, 0x0B, 0x82, 0x3B, 0xD0,
+    0xB5, 0x30, 0x1C, 0x80, 0x39, 0x8B, 0xB6, 0x48, 0x9A, 0x83, 0x2B, 0xA1, 0x59, 0xA9, 0x78, 0x8B,
+    0xC5, 0x12, 0x2C, 0xB1, 0x38, 0x1A, 0xA0, 0xE2, 0xB7, 0x38, 0x8A, 0xA1, 0x68, 0x2C, 0x98, 0x30,
+    0x1D, 0xF3, 0x04, 0x2D, 0xF3, 0x32, 0x0C, 0x82, 0x3C, 0xB0, 0x51, 0x8C, 0xC4, 0x12, 0xBA, 0x97,
+    0x4C, 0x19, 0x1A, 0x18, 0xB9, 0xB7, 0x11, 0xB1, 0x7A, 0x2B, 0xA9, 0xB7, 0x39, 0xE1, 0x22, 0x3D,
+    0xC8, 0xA5, 0x5B, 0xB8, 0x41, 0x2D, 0xD2, 0x83, 0x6B, 0xC9, 0x94, 0x88, 0x81, 0x28, 0x1B, 0x80,
+    0x28, 0x0B, 0xE6, 0x12, 0x3D, 0xC0, 0x12, 0x2C, 0xD1, 0x02, 0x08, 0x3B, 0xF2, 0x41, 0xAC, 0xB7,
+    0x98, 0x22, 0x2E, 0x80, 0x98, 0x31, 0x0E, 0x02, 0x0C, 0xA4, 0x29, 0x28, 0xCB, 0x87, 0x0C, 0xB5,
+    0x5A, 0x89, 0x98, 0x04, 0x3E, 0xD2, 0x30, 0x89, 0x08, 0xD2, 0x40, 0x0B, 0xA1, 0xB4, 0x38, 0xA8,
+    0x48, 0x4B, 0x1D, 0xD3, 0x01, 0xA1, 0x29, 0x28, 0x1D, 0xC3, 0x80, 0x81, 0xB1, 0x79, 0x1C, 0xD4,
+    0x02, 0x3A, 0x89, 0x7B, 0x0A, 0xC2, 0x82, 0xE2, 0x41, 0xAB, 0x13, 0x89, 0x3C, 0xB5, 0x5D, 0xD1,
+    0x48, 0xB8, 0x12, 0x8B, 0x95, 0x88, 0x6A, 0xB8, 0x78, 0xCA, 0x23, 0xAB, 0x33, 0xBC, 0x06, 0x0B,
+    0x93, 0x0A, 0x22, 0xAE, 0x16, 0x0E, 0xA6, 0x4D, 0xC2, 0x18, 0x10, 0xCA, 0x15, 0x8D, 0xB6, 0x4B,
+    0x80, 0x09, 0x11, 0xAB, 0x25, 0xDA, 0x43, 0x8C, 0x01, 0x90, 0x3A, 0xD2, 0x59, 0xB8, 0x21, 0x9A,
+    0xA3, 0x29, 0x98, 0xE4, 0x58, 0xAA, 0x02, 0x7B, 0xE0, 0x33, 0xBA, 0x33, 0x9A, 0x28, 0xE2, 0x29,
+    0xC1, 0x59, 0xB8, 0x33, 0xAB, 0x04, 0x0B, 0xA2, 0x19, 0x1C, 0xE0, 0x20, 0xBA, 0x03, 0x2F, 0x97,
+    0x5C, 0xC1, 0x10, 0x91, 0x98, 0x31, 0x9E, 0x03, 0x9B, 0x85, 0x2A, 0x00, 0x02, 0x8D, 0xA6, 0x3B,
+    0xA0, 0x18, 0x89, 0xB0, 0x11, 0x9F, 0x74, 0xCA, 0x15, 0x8C, 0x21, 0x8B, 0x10, 0xF3, 0x28, 0xB1,
+    0x49, 0x90, 0x08, 0x82, 0x2A, 0xA0, 0x9A, 0x93, 0x1A, 0x91, 0x9C, 0x9A, 0xF8, 0x79, 0xE7, 0x34,
+    0x8D, 0x21, 0xA9, 0x00, 0xB4, 0x3C, 0xA3, 0x3D, 0x91, 0x09, 0x02, 0xAA, 0x71, 0xDA, 0x04, 0x0A,
+    0x00, 0x90, 0x4B, 0xF0, 0x10, 0x04, 0x3E, 0xD3, 0x00, 0x11, 0x0D, 0x30, 0xBB, 0x05, 0x99, 0x11,
+    0x08, 0x2C, 0xC3, 0x29, 0x01, 0xD9, 0x04, 0x0C, 0x02, 0xA9, 0x02, 0xAC, 0x32, 0x97, 0x4F, 0xE2,
+    0x02, 0x01, 0x0D, 0x12, 0x9C, 0x84, 0x89, 0x11, 0x98, 0x5A, 0xC0, 0x28, 0x91, 0xA8, 0x24, 0x0E,
+    0x81, 0xA0, 0x11, 0xAC, 0x01, 0x17, 0x1F, 0xC6, 0x39, 0x39, 0xDA, 0x32, 0xBB, 0x23, 0xA9, 0x28,
+    0x94, 0x1E, 0xA3, 0x89, 0x51, 0xAB, 0x84, 0x80, 0x2B, 0xB4, 0x1A, 0xC0, 0x8A, 0x73, 0xF1, 0x32,
+    0x1D, 0xA0, 0x95, 0x4D, 0xB1, 0x00, 0x49, 0xB9, 0x13, 0x09, 0x8A, 0x23, 0x8E, 0x94, 0x00, 0x3D,
+    0xD2, 0x10, 0x19, 0xC9, 0x01, 0x2A, 0xA6, 0x4B, 0xA1, 0xA2, 0x69, 0xB8, 0x83, 0x5A, 0xBA, 0x84,
+    0x29, 0x1B, 0xB5, 0x4A, 0x98, 0xB3, 0x68, 0x9A, 0xA4, 0x10, 0x0C, 0xB2, 0x99, 0x39, 0xA6, 0x3C,
+    0x91, 0x93, 0x49, 0xA8, 0x04, 0x4C, 0xC9, 0x93, 0x49, 0xAA, 0x84, 0x2B, 0x90, 0xA4, 0x49, 0x09,
+    0xA2, 0x28, 0x9C, 0xC1, 0xA9, 0x2E, 0x97, 0x3B, 0x81, 0xA2, 0x58, 0x99, 0x83, 0x5B, 0xC9, 0x82,
+    0x28, 0xBA, 0x85, 0x09, 0x89, 0x86, 0x2A, 0x88, 0xA3, 0x39, 0xAA, 0xC0, 0xBB, 0x8F, 0x27, 0x8D,
+    0x02, 0x80, 0x28, 0xA1, 0x41, 0x0B, 0xF2, 0x10, 0x19, 0xA8, 0x12, 0x0D, 0xA2, 0x12, 0x2B, 0xA2,
+    0x02, 0x2B, 0xB1, 0xF8, 0x0B, 0xBF, 0x70, 0xD2, 0x28, 0x00, 0x08, 0x11, 0x2A, 0xD4, 0x11, 0x8C,
+    0x81, 0x82, 0x2C, 0xA0, 0x10, 0x2B, 0xA3, 0x02, 0x4B, 0xA1, 0x80, 0x89, 0xFA, 0xFA, 0x0A, 0x64,
+    0xBB, 0x24, 0x89, 0x00, 0x83, 0x5A, 0xA8, 0xA2, 0x1C, 0x81, 0xB1, 0x58, 0x9C, 0x84, 0x4A, 0x98,
+    0x92, 0x30, 0x0B, 0xE3, 0x10, 0x9C, 0xCA, 0x89, 0x37, 0x9D, 0x13, 0x88, 0x10, 0x92, 0x40, 0x8C,
+    0xB4, 0x1B, 0x10, 0xB1, 0x11, 0x8E, 0x94, 0x49, 0x90, 0x90, 0x03, 0x2B, 0xC0, 0x11, 0x9F, 0xC8,
+    0x8A, 0x72, 0xE0, 0x21, 0x08, 0x00, 0x81, 0x49, 0xC1, 0x91, 0x2B, 0xA0, 0x82, 0x39, 0xCC, 0x04,
+    0x39, 0xC1, 0x31, 0x1B, 0x90, 0x93, 0x2C, 0xEB, 0xB0, 0x8E, 0x1A, 0x07, 0x2D, 0x92, 0x00, 0x21,
+    0xA8, 0x24, 0x0C, 0xD0, 0x28, 0x09, 0xA0, 0x82, 0x2C, 0xA2, 0x42, 0x1B, 0xA1, 0x12, 0x1C, 0xB2,
+    0x18, 0x9F, 0xE8, 0x8A, 0x89, 0x07, 0x2C, 0x01, 0x11, 0x38, 0xB1, 0x24, 0x1C, 0xE8, 0x08, 0x18,
+    0xA0, 0x10, 0x0A, 0xA3, 0x60, 0x89, 0xA2, 0x20, 0x9A, 0x13, 0x99, 0xAF, 0xE0, 0x8B, 0x98, 0x2C,
+    0x97, 0x5B, 0x01, 0x28, 0x21, 0x99, 0x97, 0x1A, 0xA8, 0x89, 0x11, 0x0A, 0xA3, 0x3B, 0xA2, 0x18,
+    0x82, 0x1C, 0xB5, 0x38, 0x82, 0xFB, 0x18, 0x8D, 0x91, 0x8D, 0xB8, 0x5A, 0xB5, 0x4B, 0x02, 0x10,
+    0x23, 0xB1, 0x02, 0x50, 0x9A, 0x99, 0x38, 0x08, 0xD2, 0x9C, 0xC8, 0x9A, 0x08, 0xB9, 0x53, 0x2A,
+    0x13, 0x45, 0x28, 0xA1, 0x18, 0x99, 0xFA, 0x1B, 0xF0, 0x1B, 0xAA, 0x23, 0xBB, 0x73, 0x90, 0x45,
+    0x08, 0x21, 0x81, 0x81, 0x9A, 0xA9, 0x9A, 0xD9, 0xBE, 0x10, 0xBB, 0x32, 0xB8, 0x82, 0x46, 0x40,
+    0x83, 0x38, 0x02, 0x02, 0x92, 0xDA, 0x38, 0xFE, 0x89, 0x99, 0x88, 0x31, 0xC8, 0x0B, 0x31, 0x82,
+    0x03, 0x2B, 0x94, 0x72, 0x21, 0x01, 0xA0, 0x81, 0x9B, 0xBB, 0xBF, 0x12, 0xEC, 0x20, 0xA5, 0x1B,
+    0x12, 0x88, 0x85, 0x1B, 0x25, 0xA9, 0x18, 0x10, 0xF8, 0x4B, 0xA9, 0x0A, 0xA9, 0x69, 0xB2, 0x1A,
+    0x83, 0x11, 0xA1, 0x04, 0x69, 0x02, 0x0B, 0x40, 0xF9, 0x59, 0xA1, 0x9B, 0x20, 0x99, 0x50, 0xAA,
+    0x10, 0x9B, 0x9C, 0x77, 0xD8, 0x21, 0xA8, 0x50, 0xB1, 0x2C, 0x82, 0x1A, 0xB1, 0x8E, 0x42, 0x95,
+    0x9C, 0x11, 0x8A, 0x43, 0xC9, 0x1A, 0x12, 0x91, 0x39, 0xF1, 0x3A, 0xA4, 0x8B, 0x02, 0x19, 0x93,
+    0x8D, 0x82, 0x1C, 0x05, 0x88, 0x89, 0x82, 0x08, 0x03, 0x99, 0x98, 0x03, 0x0B, 0xAF, 0x12, 0x0C,
+    0x80, 0xBD, 0x3E, 0x37, 0xEA, 0x10, 0x80, 0x20, 0x90, 0x2A, 0x73, 0xFA, 0x4B, 0x93, 0x09, 0xA1,
+    0x0A, 0x04, 0x8A, 0x88, 0x38, 0x84, 0xAA, 0x98, 0x71, 0x81, 0xAA, 0x08, 0x53, 0xC9, 0x38, 0xFA,
+    0x48, 0xA2, 0x0A, 0x92, 0x29, 0xA3, 0x8C, 0x03, 0x01, 0x92, 0x0D, 0x00, 0x38, 0x19, 0xF0, 0x1A,
+    0x93, 0xBB, 0x01, 0x21, 0xD2, 0x21, 0xAB, 0x60, 0xB2, 0x08, 0x24, 0x29, 0x9A, 0x1F, 0x02, 0x80,
+    0xAA, 0x59, 0x01, 0xC9, 0x8C, 0xC0, 0x57, 0xBA, 0x30, 0x99, 0x11, 0xA9, 0x51, 0x88, 0x08, 0xA8,
+    0x0A, 0x78, 0x18, 0x8C, 0x7E, 0x78, 0xFA, 0x93, 0x02, 0xB0, 0x5D, 0x83, 0x0F, 0xB1, 0x23, 0x0C,
+    0x00, 0x90, 0x82, 0x90, 0x91, 0xA3, 0x8B, 0x7B, 0xC9, 0xA6, 0x5A, 0x08, 0x99, 0xA4, 0x48, 0xB9,
+    0x94, 0x19, 0x00, 0x2C, 0x91, 0x28, 0xF0, 0x13, 0x1E, 0xB2, 0x38, 0x99, 0x11, 0x0B, 0x13, 0x8B,
+    0xC8, 0x28, 0x07, 0x2D, 0xA9, 0x95, 0x38, 0x2E, 0xC2, 0x92, 0x4B, 0x88, 0xB2, 0x92, 0x6B, 0x1A,
+    0x90, 0x18, 0xE2, 0x82, 0x5B, 0xA0, 0x28, 0x1A, 0x98, 0xC3, 0x43, 0x2F, 0xC8, 0xB5, 0x48, 0xA9,
+    0x93, 0x39, 0x99, 0x01, 0x98, 0x49, 0x0B, 0xF5, 0x21, 0x3C, 0xC0, 0x82, 0x18, 0x09, 0x88, 0x00,
+    0x09, 0xE1, 0xA5, 0x48, 0x0B, 0xE3, 0x40, 0x8A, 0xB2, 0x02, 0x3D, 0x89, 0xC3, 0x30, 0x2D, 0xA8,
+    0x94, 0x3A, 0x98, 0x90, 0x93, 0x19, 0x89, 0x81, 0x20, 0x1F, 0x80, 0x18, 0x8A, 0xD6, 0x02, 0x4A,
+    0xD1, 0x11, 0x49, 0xB8, 0x01, 0x39, 0x1A, 0xC0, 0x92, 0x30, 0x2F, 0x09, 0x10, 0xC9, 0x94, 0x01,
+    0x9A, 0x19, 0xD6, 0x81, 0xA2, 0x0A, 0x2C, 0x64, 0x08, 0xA9, 0x02, 0x68, 0x0B, 0xB1, 0xA2, 0xB1,
+    0x31, 0x30, 0x1B, 0xC4, 0xB8, 0x06, 0xA0, 0x3F, 0x99, 0x81, 0xC2, 0x39, 0x11, 0x1E, 0xB9, 0x01,
+    0x98, 0xF8, 0x34, 0x08, 0xB2, 0x31, 0x2C, 0x80, 0x0A, 0x0C, 0x09, 0x29, 0x98, 0xA5, 0x27, 0xB1,
+    0x98, 0xA0, 0xB1, 0x9A, 0xC8, 0x97, 0x2E, 0x28, 0x4A, 0x1C, 0xA9, 0xD2, 0xA1, 0x51, 0x11, 0x88,
+    0x1A, 0x32, 0x81, 0xF9, 0xB0, 0xA1, 0xA3, 0x10, 0x29, 0x63, 0x59, 0x6B, 0x89, 0x9A, 0x88, 0xA0,
+    0x08, 0xD1, 0xB3, 0x30, 0x39, 0xFA, 0x89, 0xDB, 0x70, 0x22, 0x90, 0x8A, 0x84, 0x94, 0xA9, 0x9A,
+    0x28, 0x1A, 0x4B, 0x6B, 0x11, 0x11, 0xA8, 0xA7, 0xB1, 0xCA, 0x00, 0x20, 0x88, 0x0B, 0x1D, 0x13,
+    0xF0, 0x9B, 0x1C, 0x37, 0x82, 0x8B, 0x7B, 0x20, 0x99, 0xAB, 0x88, 0x83, 0xB1, 0xA8, 0x26, 0x04,
+    0x90, 0x0A, 0x23, 0xFA, 0x9C, 0x28, 0x01, 0xA1, 0x8A, 0x39, 0x20, 0xBF, 0xCB, 0x47, 0x11, 0x9A,
+    0x2B, 0x24, 0xC1, 0xCA, 0x80, 0x93, 0xB0, 0x09, 0x44, 0x32, 0x9A, 0x2C, 0x51, 0xD0, 0xDA, 0x00,
+    0x03, 0x99, 0x89, 0x01, 0x01, 0x9C, 0x8F, 0x24, 0x07, 0x9B, 0x39, 0x22, 0xF8, 0x0A, 0x20, 0xB2,
+    0x8A, 0x40, 0x84, 0x89, 0x29, 0x11, 0xC1, 0xBD, 0x00, 0x06, 0x8A, 0x09, 0x81, 0x2A, 0x8C, 0x9A,
+    0x71, 0x87, 0xA8, 0x39, 0xA4, 0xC9, 0x49, 0x00, 0xAA, 0x60, 0x92, 0xB9, 0x31, 0x91, 0xBA, 0x78,
+    0xA2, 0xBB, 0x70, 0xA1, 0xB8, 0x41, 0xAA, 0x98, 0x02, 0x7C, 0xA4, 0x88, 0x3A, 0xF3, 0x19, 0x49,
+    0xC8, 0x20, 0x11, 0xD8, 0x11, 0x00, 0x9C, 0x32, 0x80, 0x9C, 0x03, 0x89, 0x19, 0xA6, 0x8C, 0x80,
+    0x90, 0x09, 0x79, 0xB7, 0x00, 0x20, 0xEB, 0x22, 0x1A, 0x8C, 0x05, 0x89, 0x28, 0xB1, 0x2B, 0x12,
+    0xBB, 0x44, 0xB8, 0x1D, 0x04, 0xAA, 0x21, 0xD9, 0x08, 0x11, 0xAD, 0x66, 0xAB, 0x12, 0x91, 0x0F,
+    0xA5, 0x0A, 0x48, 0xB8, 0x40, 0x91, 0x8B, 0x05, 0xAB, 0x52, 0xC8, 0x28, 0x91, 0x1B, 0x84, 0xAB,
+    0x22, 0xCB, 0x30, 0xBA, 0x67, 0x3D, 0xA2, 0xB0, 0x79, 0xC9, 0x93, 0x10, 0x1C, 0x94, 0x88, 0x30,
+    0xC9, 0x11, 0x80, 0x0B, 0xB5, 0x3B, 0x83, 0x8B, 0x02, 0xBC, 0x41, 0xBD, 0x78, 0xB6, 0x6B, 0xA0,
+    0xA8, 0x24, 0x9E, 0xA5, 0x88, 0x58, 0xA9, 0x12, 0x88, 0x19, 0xC3, 0x38, 0xAA, 0xA0, 0x02, 0x2B,
+    0x83, 0x9B, 0x20, 0x9D, 0x91, 0xCF, 0x47, 0x4E, 0xB1, 0x90, 0x32, 0x9E, 0x94, 0x2A, 0x3A, 0xC8,
+    0x32, 0x8B, 0xA4, 0x81, 0x48, 0xBB, 0x83, 0x0B, 0x20, 0x99, 0x22, 0xEB, 0x33, 0xDC, 0x81, 0x7D,
+    0xF2, 0x24, 0x2D, 0x08, 0xA0, 0x58, 0xCA, 0x94, 0x08, 0x28, 0xA9, 0x24, 0x1C, 0x00, 0x90, 0x19,
+    0xC9, 0x12, 0xAA, 0x04, 0x1A, 0x90, 0x40, 0x8C, 0xA9, 0x7B, 0xD7, 0x51, 0x8C, 0x02, 0x99, 0x30,
+    0xFA, 0x03, 0x1B, 0x10, 0x99, 0x23, 0x1E, 0xA3, 0x39, 0xA9, 0x90, 0xB0, 0x11, 0x08, 0x38, 0xD0,
+    0x40, 0xC8, 0x81, 0xCC, 0x71, 0xF8, 0xB7, 0x4B, 0x90, 0x18, 0x00, 0x2D, 0xD1, 0x11, 0x89, 0x01,
+    0x90, 0x40, 0x8B, 0x03, 0x1E, 0xA1, 0x19, 0xB1, 0x21, 0x89, 0x20, 0xE8, 0x42, 0x8D, 0xA1, 0x4B,
+    0xC7, 0x68, 0x0D, 0x93, 0x19, 0x91, 0xB8, 0xA7, 0x5A, 0xA9, 0x12, 0x0A, 0x10, 0xB0, 0x22, 0x9A,
+    0x00, 0xA9, 0xB3, 0x58, 0x2A, 0xB1, 0x31, 0xAC, 0xA4, 0x99, 0xAA, 0xDE, 0x47, 0x5F, 0xD8, 0x04,
+    0x1B, 0xB2, 0x81, 0x00, 0x3E, 0xA8, 0x21, 0x1B, 0xA2, 0x81, 0x91, 0x80, 0xD4, 0x48, 0x0B, 0x80,
+    0x29, 0x81, 0x3B, 0xF4, 0x02, 0x2C, 0xB0, 0x19, 0xAA, 0x78, 0xF2, 0xB7, 0x6A, 0xA9, 0x12, 0x2C,
+    0x19, 0xB9, 0x96, 0x3A, 0xA8, 0x02, 0x19, 0x90, 0x10, 0x29, 0x9A, 0x82, 0x0B, 0xC5, 0x30, 0x8B,
+    0x95, 0x5B, 0x98, 0x00, 0xBA, 0xA5, 0x2C, 0xF9, 0x73, 0x8C, 0xD6, 0x50, 0x9B, 0x94, 0x3A, 0x09,
+    0x2B, 0xC1, 0x30, 0x0C, 0xB4, 0x20, 0x98, 0x02, 0x1B, 0x10, 0x8B, 0xC3, 0x38, 0x98, 0xA3, 0x94,
+    0x49, 0x0B, 0xB1, 0x89, 0x9B, 0xD8, 0x92, 0x1D, 0xCA, 0x72, 0xEA, 0xB7, 0x72, 0x9B, 0xA4, 0x49,
+    0x0A, 0x19, 0xA0, 0x21, 0x1D, 0xD3, 0x11, 0x99, 0x93, 0x29, 0x98, 0x10, 0x0A, 0x92, 0x28, 0xB9,
+    0x97, 0x39, 0x8A, 0x10, 0x0B, 0x80, 0x4A, 0x9A, 0x19, 0xF2, 0xB3, 0x2D, 0x7B, 0xF7, 0x84, 0x6D,
+    0xB9, 0x23, 0x3F, 0x98, 0x80, 0xA1, 0x20, 0xC9, 0xA6, 0x28, 0x98, 0x12, 0x2C, 0x90, 0x29, 0xB8,
+    0x03, 0x0A, 0xB2, 0x50, 0x2C, 0x80, 0x18, 0x09, 0x19, 0x9A, 0xA2, 0x8B, 0xF5, 0x92, 0xB0, 0x96,
+    0x29, 0xB9, 0x08, 0xC7, 0x7C, 0x2B, 0xA5, 0x5A, 0xA9, 0x93, 0x98, 0xA2, 0x28, 0xF1, 0x12, 0x2C,
+    0xA1, 0x38, 0xA9, 0x84, 0x1A, 0xB1, 0x48, 0x9A, 0x83, 0x4D, 0xA8, 0x12, 0x8A, 0xA4, 0x28, 0x99,
+    0x92, 0x8A, 0x90, 0x5B, 0x99, 0x12, 0x4B, 0xC1, 0x81, 0xB1, 0xF3, 0x00, 0x1E, 0xF7, 0x51, 0x2D,
+    0xB2, 0x69, 0x9A, 0xA3, 0x90, 0xB3, 0x28, 0xE0, 0x03, 0x2C, 0xA1, 0x48, 0x8A, 0x82, 0x1A, 0xD2,
+    0x21, 0x8B, 0x94, 0x6B, 0x99, 0x02, 0x3B, 0xB0, 0x20, 0xB9, 0x95, 0x2A, 0xB0, 0x50, 0x8B, 0x83,
+    0x3B, 0xE3, 0x30, 0x0D, 0xB2, 0xA2, 0x1A, 0xE0, 0xB2, 0x98, 0xD7, 0x78, 0x2C, 0xB3, 0x69, 0x8A,
+    0x92, 0x98, 0x92, 0x29, 0xC8, 0x13, 0x2D, 0xA1, 0x30, 0x8B, 0x94, 0x2A, 0xD2, 0x30, 0x0C, 0xA2,
+    0x6A, 0x8A, 0x82, 0x1A, 0xA2, 0x21, 0x09, 0xA2, 0x80, 0xA1, 0x2A, 0xD9, 0xA1, 0x1B, 0xA0, 0x02,
+    0x10, 0xD7, 0x94, 0x29, 0x0A, 0x3C, 0xBE, 0xB7, 0x69, 0x1C, 0x31, 0x2F, 0xE2, 0x12, 0x8A, 0xB4,
+    0x10, 0x98, 0x28, 0x8B, 0x93, 0x4E, 0xA8, 0x12, 0x0A, 0xA3, 0x49, 0xB8, 0x13, 0x1E, 0xA1, 0x20,
+    0xAA, 0x94, 0x19, 0xB2, 0x40, 0x9A, 0x84, 0x5C, 0xC0, 0x12, 0x1B, 0xB2, 0x20, 0x9A, 0x02, 0x0E,
+    0xC2, 0x40, 0x8B, 0x93, 0x29, 0xC0, 0x38, 0x9C, 0x38, 0x0F, 0x90, 0x28, 0x1F, 0x42, 0xF8, 0xA7,
+    0x38, 0x9A, 0x83, 0x4B, 0x89, 0x19, 0x99, 0x82, 0x1B, 0xC6, 0x21, 0x8A, 0x83, 0x4B, 0xA8, 0x21,
+    0xAA, 0xA5, 0x18, 0xD1, 0x12, 0x1B, 0x91, 0x5A, 0x99, 0x11, 0x2C, 0xB1, 0x41, 0x1C, 0xA2, 0x28,
+    0xE1, 0x02, 0x99, 0x92, 0x2A, 0xD0, 0x13, 0x1F, 0x90, 0x80, 0x1A, 0x5B, 0x1E, 0x88, 0x09, 0xF3,
+    0x82, 0x3A, 0xE7, 0x51, 0x0C, 0xB3, 0x48, 0x8A, 0x81, 0x98, 0x92, 0x3B, 0xE1, 0x12, 0x2B, 0xB2,
+    0x48, 0x99, 0x83, 0x2B, 0xE3, 0x20, 0x9A, 0x94, 0x3A, 0xB8, 0x22, 0x0C, 0xA4, 0x4A, 0xB8, 0x03,
+    0x8B, 0x95, 0x28, 0x1A, 0x49, 0x8A, 0x93, 0x6B, 0xF0, 0x02, 0x0B, 0xA2, 0x1A, 0xF2, 0x21, 0x1D,
+    0xB1, 0x11, 0x2B, 0x90, 0x59, 0x0C, 0x92, 0xA9, 0x72, 0xF0, 0x84, 0x3A, 0xC1, 0x21, 0x1B, 0x80,
+    0x89, 0x88, 0x3A, 0xD9, 0x04, 0x3B, 0xD3, 0x40, 0x8A, 0x93, 0x2A, 0xD2, 0x21, 0x9A, 0xA3, 0x39,
+    0xA9, 0x11, 0x09, 0x28, 0x0C, 0xB5, 0x7B, 0xA9, 0x33, 0x0F, 0xC4, 0x21, 0x0B, 0xB3, 0x38, 0xAB,
+    0x83, 0x1D, 0xA1, 0x6B, 0xC9, 0x85, 0x2B, 0xC2, 0x38, 0xD8, 0x13, 0x1D, 0xD2, 0x11, 0x0A, 0xA0,
+    0x90, 0x07, 0x4D, 0xB0, 0x22, 0x2B, 0xC2, 0x01, 0xA8, 0x80, 0xB8, 0xA4, 0x5B, 0x98, 0x22, 0x3E,
+    0x90, 0x00, 0x91, 0x81, 0x88, 0x92, 0x29, 0xAA, 0xA3, 0x6B, 0x9A, 0xA3, 0x38, 0x8F, 0xA5, 0x19,
+    0x28, 0x2B, 0xE6, 0x31, 0x0C, 0xB3, 0x38, 0x8A, 0x90, 0xA8, 0x94, 0x3C, 0xB9, 0x14, 0x1F, 0x90,
+    0x10, 0x2A, 0x2A, 0xF1, 0x22, 0x1F, 0xB2, 0x01, 0x9A, 0x29, 0xC7, 0x61, 0x0B, 0x82, 0x4A, 0x88,
+    0x08, 0xC0, 0x01, 0xAA, 0xC5, 0x10, 0xA0, 0x22, 0x2B, 0x81, 0x28, 0x90, 0x38, 0xB9, 0x22, 0xBD,
+    0x94, 0x3D, 0xA9, 0x93, 0x81, 0x4C, 0xD0, 0x04, 0x2C, 0xB0, 0x84, 0x4A, 0x09, 0x01, 0x98, 0x21,
+    0x0D, 0xD3, 0x3A, 0xBB, 0x96, 0x2C, 0xD1, 0x22, 0x8C, 0xA4, 0x29, 0xD3, 0x48, 0x8A, 0x93, 0x0A,
+    0xC3, 0x58, 0xBB, 0x04, 0x0F, 0x83, 0x5C, 0xA8, 0x03, 0x88, 0x92, 0xB2, 0x82, 0x0C, 0xB0, 0x39,
+    0x8D, 0x10, 0x28, 0x00, 0x93, 0x04, 0x3B, 0xF1, 0x01, 0x99, 0xB2, 0x88, 0x91, 0x00, 0x92, 0x01,
+    0x58, 0x0D, 0x48, 0x1C, 0x8A, 0x92, 0x39, 0xA7, 0x22, 0x89, 0xC5, 0x40, 0x1C, 0xB0, 0x08, 0xA9,
+    0x09, 0xF3, 0x21, 0x2D, 0xA1, 0x10, 0x7C, 0xB9, 0x05, 0x2C, 0xD2, 0x21, 0xAA, 0x14, 0x1E, 0xB2,
+    0x28, 0x99, 0x00, 0x39, 0x8D, 0x83, 0x2F, 0xC2, 0x21, 0xA8, 0x04, 0x19, 0x01, 0x2B, 0x98, 0x3B,
+    0xCB, 0x10, 0xB9, 0x14, 0x09, 0xA3, 0x21, 0xC6, 0x30, 0xD8, 0x60, 0x8B, 0x93, 0x89, 0xB3, 0x68,
+    0x9A, 0x03, 0xA8, 0x13, 0x0F, 0xB2, 0x18, 0x08, 0x3A, 0x09, 0x15, 0x3E, 0x80, 0x18, 0x91, 0xE1,
+    0x01, 0x2D, 0xA9, 0x92, 0xC9, 0x96, 0x88, 0x80, 0x21, 0x1F, 0x94, 0x4E, 0x98, 0x00, 0xB1, 0x82,
+    0xC2, 0x40, 0x2F, 0x80, 0x1A, 0x90, 0xB1, 0xA7, 0x18, 0xB1, 0x79, 0x0A, 0x88, 0xA3, 0x3B, 0xD5,
+    0x20, 0xA8, 0x02, 0x80, 0x6A, 0x09, 0x3A, 0x0C, 0xA2, 0x98, 0xB4, 0xB0, 0x87, 0x09, 0x83, 0x09,
+    0x31, 0x1F, 0x10, 0x9B, 0x84, 0x8B, 0x03, 0x1F, 0xA2, 0x4B, 0xD3, 0x49, 0x98, 0x3A, 0xD2, 0x49,
+    0x88, 0x4D, 0xD1, 0x10, 0xB1, 0x80, 0x03, 0x8A, 0x84, 0x1A, 0x82, 0x5B, 0x1A, 0xB9, 0x13, 0x1F,
+    0x80, 0x09, 0x10, 0xB1, 0x83, 0x89, 0x95, 0xF2, 0xA4, 0x80, 0x49, 0x2B, 0xA0, 0x01, 0x98, 0x78,
+    0x9A, 0x50, 0xAA, 0x22, 0xCA, 0x41, 0xE8, 0x40, 0xD8, 0x22, 0x9B, 0x84, 0x89, 0x48, 0xF0, 0x02,
+    0x98, 0x20, 0x0B, 0x58, 0x0C, 0x10, 0xA9, 0x23, 0x8C, 0xC3, 0xA4, 0x18, 0xA1, 0x01, 0x3B, 0xC8,
+    0x42, 0x8C, 0x41, 0x0D, 0x01, 0xA9, 0x14, 0x0C, 0x01, 0x99, 0x42, 0x0E, 0x80, 0xE4, 0x82, 0xB1,
+    0x02, 0x18, 0x4B, 0x3B, 0x3C, 0x2B, 0x90, 0xC1, 0x12, 0xC9, 0x33, 0xBE, 0x97, 0x90, 0x01, 0x08,
+    0x5C, 0x29, 0x1D, 0x81, 0x99, 0x23, 0x9D, 0x03, 0xC8, 0x22, 0xB9, 0x11, 0xE3, 0x29, 0xC4, 0x80,
+    0x93, 0x4C, 0x3A, 0x4D, 0x2B, 0x19, 0x89, 0xA2, 0xD4, 0xA3, 0xD4, 0x01, 0x91, 0x4B, 0x18, 0x1D,
+    0x82, 0x1B, 0x82, 0x0B, 0x03, 0x8C, 0xB5, 0x82, 0x2A, 0xF5, 0x01, 0x80, 0x3A, 0x3A, 0x1E, 0x01,
+    0x1C, 0xD3, 0x92, 0x10, 0x9A, 0x13, 0x1B, 0x7B, 0xC8, 0x82, 0xC4, 0x39, 0x90, 0x09, 0x12, 0xBB,
+    0x72, 0xC9, 0x32, 0x0C, 0x08, 0xA2, 0x6B, 0xC8, 0xA6, 0x00, 0x88, 0x80, 0x69, 0x1B, 0x80, 0x08,
+    0x90, 0x28, 0xD0, 0xA4, 0x92, 0x2B, 0xC5, 0x81, 0x18, 0x90, 0x6A, 0x4B, 0x1D, 0x01, 0x8A, 0xA3,
+    0x08, 0x48, 0xC8, 0x81, 0xE3, 0xC3, 0xA4, 0xA1, 0x02, 0x2A, 0x4A, 0x3C, 0x1C, 0x81, 0x09, 0x48,
+    0x9B, 0x03, 0x99, 0x00, 0xC6, 0x38, 0xB8, 0x80, 0xC7, 0xA2, 0x92, 0x91, 0x81, 0x5A, 0x4C, 0x3B,
+    0x3B, 0x1C, 0xA2, 0xB0, 0xA7, 0xB2, 0x01, 0xD3, 0x39, 0x10, 0x2F, 0x80, 0x1A, 0x10, 0xF1, 0x30,
+    0xD0, 0x20, 0xA0, 0x19, 0xA3, 0x2B, 0xB5, 0xC0, 0x24, 0xAB, 0x41, 0x8A, 0x7B, 0xA8, 0x81, 0xA2,
+    0x29, 0xB1, 0x68, 0x8A, 0x08, 0x93, 0x0C, 0x85, 0x1D, 0x82, 0xB9, 0x63, 0xCA, 0x13, 0x0A, 0x29,
+    0xA0, 0x39, 0x00, 0xCA, 0x04, 0xD1, 0x50, 0x9B, 0xC5, 0x94, 0x3A, 0x98, 0x7B, 0x09, 0x2B, 0xB5,
+    0x09, 0xA6, 0x89, 0x12, 0xBA, 0x53, 0xD9, 0x30, 0xA0, 0x2A, 0xB3, 0x2A, 0x02, 0xD9, 0x22, 0xC8,
+    0x91, 0x96, 0xA9, 0x52, 0x8B, 0x7A, 0x98, 0x19, 0xA3, 0x8B, 0x06, 0x9B, 0x13, 0xC8, 0x58, 0xA0,
+    0x1A, 0x84, 0x8C, 0x04, 0xC9, 0x42, 0x0B, 0x2A, 0xB3, 0x2D, 0xA5, 0x99, 0x03, 0xD0, 0x50, 0x8A,
+    0x49, 0x2A, 0x9A, 0x95, 0xA8, 0xA3, 0xA3, 0x18, 0xC2, 0x18, 0x81, 0xD0, 0x70, 0x1B, 0x29, 0x29,
+    0x8C, 0xA5, 0x08, 0x18, 0xB1, 0x7B, 0xD1, 0x81, 0xB3, 0x08, 0x50, 0x1E, 0x81, 0x1A, 0x80, 0xA1,
+    0x38, 0xA8, 0xA0, 0x86, 0x89, 0x00, 0x39, 0x4B, 0x3B, 0xAB, 0xA7, 0x92, 0x1A, 0xB5, 0x39, 0x91,
+    0x2F, 0x01, 0x8B, 0x95, 0x0A, 0xB5, 0x90, 0x12, 0x3B, 0x0C, 0x94, 0x4F, 0x29, 0x9A, 0x11, 0xE0,
+    0x02, 0xB1, 0x3A, 0xB5, 0xA8, 0x85, 0xA8, 0x60, 0xA9, 0x38, 0x08, 0x1C, 0x83, 0x1D, 0x10, 0xB0,
+    0x6A, 0xB1, 0x2A, 0x94, 0x8B, 0x14, 0xCA, 0x13, 0xE0, 0x02, 0x80, 0x8A, 0x52, 0x8C, 0x69, 0x89,
+    0x29, 0xB1, 0x4B, 0xB3, 0x09, 0x81, 0xF4, 0x40, 0xB9, 0x01, 0xB4, 0x08, 0x11, 0x1D, 0x48, 0x9A,
+    0x5A, 0xA1, 0x4B, 0x10, 0xAC, 0x15, 0xBA, 0x23, 0xC8, 0x38, 0xC2, 0x2A, 0x11, 0xAB, 0x86, 0xE1,
+    0x40, 0x89, 0x3A, 0xA0, 0x88, 0xA4, 0x91, 0x10, 0x8B, 0x03, 0x4D, 0x19, 0x3C, 0x4A, 0xB9, 0xA4,
+    0x92, 0xB1, 0x40, 0xB9, 0x93, 0xC4, 0x5A, 0xB1, 0xD3, 0x12, 0xBA, 0x62, 0xAA, 0x40, 0x98, 0x39,
+    0x4A, 0x2F, 0x4A, 0x9A, 0xA3, 0xE3, 0x82, 0xD3, 0x91, 0x81, 0xB1, 0x83, 0x29, 0x4E, 0x5B, 0x1B,
+    0x28, 0x0B, 0xB2, 0x31, 0x1F, 0xA2, 0xA0, 0xA3, 0xE4, 0x82, 0x90, 0x01, 0x19, 0x19, 0x90, 0x28,
+    0x3F, 0x29, 0x2D, 0x00, 0x8A, 0x60, 0x1B, 0x89, 0x92, 0xF0, 0xB7, 0xB3, 0x01, 0xA1, 0x7B, 0x19,
+    0x2B, 0x49, 0xAB, 0x23, 0xE8, 0x92, 0xB3, 0xA1, 0x84, 0x0A, 0x10, 0x49, 0x2F, 0x39, 0x0D, 0x01,
+    0xC1, 0x81, 0xC4, 0x00, 0x01, 0x8B, 0x60, 0xA9, 0x38, 0xD2, 0x08, 0x93, 0x9A, 0x52, 0x9B, 0x38,
+    0xE2, 0xB1, 0x87, 0x99, 0x21, 0x2B, 0x3C, 0x08, 0x8A, 0x94, 0xB0, 0x11, 0xC4, 0x5B, 0x80, 0x0A,
+    0x79, 0xA9, 0x11, 0xC1, 0xB2, 0x84, 0xA9, 0x33, 0x1E, 0x5B, 0x88, 0x0A, 0xB4, 0x81, 0x80, 0x81,
+    0x4A, 0x1B, 0x38, 0x1E, 0x91, 0x00, 0x1A, 0xC4, 0x80, 0xB3, 0x90, 0x30, 0xF4, 0x01, 0xA0, 0x80,
+    0x70, 0x1D, 0x49, 0x2B, 0x0A, 0xA2, 0xA0, 0xB7, 0xA2, 0xA2, 0x94, 0x3B, 0x00, 0x3C, 0x4C, 0x89,
+    0x28, 0x99, 0xB3, 0x11, 0x9A, 0x32, 0x0F, 0x82, 0x89, 0xB2, 0xC7, 0x11, 0xA0, 0x39, 0x29, 0x8C,
+    0x41, 0x0C, 0x00, 0x39, 0x1C, 0x91, 0x89, 0xA4, 0x91, 0x08, 0xD7, 0x01, 0xA0, 0x92, 0x30, 0x9B,
+    0x50, 0x9B, 0x40, 0xA0, 0x1B, 0x06, 0x0D, 0x11, 0xB8, 0x49, 0xC3, 0x1A, 0x22, 0x9C, 0x31, 0xE1,
+    0x08, 0x01, 0xA9, 0x51, 0xE8, 0x21, 0xA0, 0x3A, 0x20, 0x8E, 0x12, 0xBA, 0x22, 0xE3, 0x29, 0xA3,
+    0x0C, 0x43, 0x8D, 0x28, 0xA1, 0x3B, 0xA4, 0x99, 0x42, 0xCB, 0x21, 0x80, 0x09, 0x11, 0x9C, 0x63,
+    0x9B, 0x01, 0xB4, 0x0A, 0x93, 0x2A, 0x38, 0x3B, 0x8F, 0x04, 0xC8, 0x12, 0xE6, 0x29, 0x92, 0x1B,
+    0x22, 0xAC, 0x12, 0x90, 0x2A, 0xB6, 0x89, 0x33, 0x8F, 0x22, 0x9A, 0x58, 0xC0, 0x00, 0x02, 0x9B,
+    0x41, 0x0B, 0x48, 0x8B, 0xA0, 0xA7, 0x09, 0x31, 0xAB, 0x78, 0xA0, 0x19, 0x08, 0x2A, 0x80, 0x80,
+    0x80, 0xD0, 0x48, 0xB6, 0x08, 0xB4, 0x08, 0x68, 0x8B, 0x80, 0xB5, 0x48, 0x3B, 0x4B, 0x8B, 0x80,
+    0xB0, 0xB3, 0xC3, 0x73, 0x9B, 0x01, 0x08, 0x06, 0x3C, 0x8B, 0x0A, 0x02, 0x3B, 0x08, 0x0D, 0x83,
+    0xC0, 0x03, 0x08, 0x3E, 0x80, 0x80, 0x3D, 0x80, 0x80, 0x3D, 0x70, 0xAB, 0x02, 0x08, 0x08, 0x08,
+    0x3E, 0x80, 0xB7, 0x2A, 0x80, 0x4B, 0x08, 0xB8, 0x84, 0xC0, 0x83, 0x00, 0x88, 0x80, 0x00, 0x3F,
+    0x3D, 0x3B, 0x80, 0xD0, 0xC3, 0x03, 0x80, 0x80, 0x80, 0x08, 0x80, 0x3F, 0x8D, 0x40, 0x80, 0x70,
+    0x8B, 0x80, 0x80, 0xB7, 0x0A, 0x02, 0x08, 0x08, 0x0D, 0x83, 0x80, 0x80, 0x80, 0xF0, 0xC3, 0x03,
+    0x08, 0xD8, 0x03, 0x08, 0xE8, 0x03, 0x80, 0x08, 0xF0, 0x83, 0x80, 0x80, 0x80, 0x3F, 0x3B, 0x80,
+    0xD0, 0xC3, 0x80, 0xB4, 0xB4, 0x83, 0x4B, 0x3C, 0x80, 0xD0, 0x03, 0x3C, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x3F, 0x08, 0x08, 0x08, 0x80, 0x08, 0xDF, 0x86, 0x80, 0xD0, 0xB3, 0x48, 0x80,
+    0x80, 0x80, 0x80, 0x3F, 0x80, 0x3C, 0xB7, 0x80, 0x3A, 0xB8, 0x03, 0x08, 0xE8, 0x03, 0x3C, 0x80,
+    0x80, 0x8D, 0x04, 0x08, 0x08, 0xE8, 0x03, 0x08, 0x08, 0x08, 0x3F, 0x08, 0x3C, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xF0, 0x83, 0x80, 0xF0, 0x03, 0x88, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x3F, 0x08,
+    0xAF, 0xB6, 0x48, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x58, 0x08, 0x08, 0x0D, 0x08, 0x84, 0xC0,
+    0x03, 0x3D, 0x80, 0x80, 0x80, 0x08, 0x80, 0xF8, 0xD3, 0x03, 0x08, 0x08, 0x3E, 0x80, 0x8C, 0xB4,
+    0x84, 0x4B, 0x3B, 0x08, 0x80, 0x08, 0x08, 0x3F, 0xD0, 0x83, 0xC0, 0x48, 0x80, 0x08, 0x80, 0x08,
+    0x80, 0x3F, 0x70, 0x8B, 0xB0, 0x03, 0x08, 0x08, 0x0E, 0x83, 0x0C, 0x03, 0x08, 0xE8, 0x03, 0x08,
+    0x08, 0x3E, 0x80, 0x80, 0x3D, 0x80, 0x80, 0x80, 0x3F, 0x4B, 0xB8, 0x03, 0xE0, 0x83, 0x80, 0x4C,
+    0x08, 0x08, 0x08, 0x08, 0xF8, 0x03, 0x3C, 0x3C, 0x3B, 0x80, 0xD0, 0x48, 0x80, 0x80, 0x80, 0xF0,
+    0x83, 0x80, 0x8C, 0x40, 0x80, 0x3C, 0x00, 0x08, 0xF8, 0xB3, 0x48, 0x80, 0x0C, 0x03, 0x3D, 0x80,
+    0xD0, 0x83, 0x80, 0x0C, 0x03, 0x3D, 0xC0, 0x03, 0xD7, 0x81, 0x80, 0x80, 0x3A, 0xB8, 0xB3, 0x84,
+    0x80, 0x3C, 0x00, 0x3D, 0x08, 0x08, 0xF0, 0x83, 0x4B, 0x08, 0xB7, 0x2A, 0xB5, 0x2A, 0x80, 0x08,
+    0x80, 0x08, 0xB7, 0x0A, 0x62, 0xAB, 0xA2, 0x62, 0x0B, 0xA8, 0x70, 0x8B, 0x50, 0x8A, 0x80, 0x80,
+    0x80, 0xD5, 0x00, 0xB3, 0x19, 0xA0, 0xA7, 0x89, 0x32, 0xF3, 0x2C, 0x03, 0x8D, 0x40, 0xA8, 0x88,
+    0x82, 0x08, 0x89, 0x60, 0x9B, 0x50, 0xF2, 0x00, 0x80, 0x88, 0x00, 0x40, 0xAB, 0x41, 0xA8, 0x6A,
+    0xA0, 0x2A, 0xC2, 0x21, 0xF8, 0x50, 0x99, 0x80, 0x82, 0x9A, 0x00, 0x96, 0x89, 0xB4, 0x7B, 0xC2,
+    0x4B, 0x82, 0xF9, 0x31, 0x2A, 0xBA, 0x84, 0x58, 0x8C, 0x01, 0x18, 0x9A, 0x97, 0x98, 0x00, 0x91,
+    0x80, 0x1A, 0x86, 0x9A, 0x39, 0xC4, 0x92, 0x3D, 0x11, 0xBB, 0x70, 0x0A, 0x19, 0x82, 0xC0, 0x21,
+    0xF8, 0x13, 0xD9, 0x31, 0xC8, 0x68, 0xB8, 0x48, 0x88, 0x89, 0x20, 0x19, 0xAA, 0x15, 0xAB, 0x86,
+    0x9A, 0x42, 0xC8, 0x18, 0x01, 0x3C, 0xD1, 0x00, 0x94, 0x1B, 0xA1, 0x11, 0x8A, 0xD7, 0x68, 0xB8,
+    0x38, 0xB1, 0x19, 0x31, 0x8E, 0x82, 0xB0, 0x32, 0xAB, 0x68, 0xA8, 0x38, 0xE2, 0x20, 0x0D, 0x12,
+    0xC1, 0x09, 0x86, 0xAB, 0x04, 0x29, 0x1C, 0xA1, 0x31, 0x2E, 0x09, 0x92, 0xA9, 0x79, 0xC1, 0x98,
+    0x96, 0x90, 0x38, 0x09, 0x2B, 0xA1, 0x18, 0xC2, 0x69, 0x0A, 0x3A, 0x90, 0xF5, 0x11, 0x19, 0x1B,
+    0x82, 0x1B, 0xA3, 0xF4, 0x38, 0x10, 0x0F, 0x20, 0xB8, 0xB3, 0x93, 0x90, 0x84, 0x0B, 0x7C, 0x08,
+    0xA9, 0x12, 0x3B, 0x98, 0xA9, 0x17, 0x1D, 0xA1, 0x81, 0xD2, 0x21, 0x2C, 0x7B, 0x99, 0x00, 0x91,
+    0xD2, 0x20, 0xA0, 0x98, 0x04, 0x1A, 0x3A, 0x00, 0x9D, 0xA4, 0x82, 0x9A, 0x26, 0x0F, 0x21, 0x0B,
+    0x29, 0xD1, 0x91, 0x20, 0xC1, 0x2A, 0x24, 0xFB, 0x84, 0x80, 0x8B, 0x84, 0x08, 0x4E, 0xB0, 0x02,
+    0x4C, 0x88, 0xC2, 0x18, 0xA0, 0x92, 0xC2, 0x21, 0x1A, 0x00, 0x6B, 0x98, 0x29, 0x2A, 0x1F, 0xA3,
+    0x80, 0x9A, 0x87, 0xD1, 0x21, 0xB0, 0xB1, 0x6A, 0x81, 0x2E, 0xA1, 0x48, 0x8B, 0x95, 0xB0, 0x50,
+    0x8A, 0x3A, 0x92, 0x0D, 0xA5, 0xB2, 0x20, 0xC0, 0x92, 0x58, 0xAA, 0x68, 0x98, 0x09, 0x02, 0x9A,
+    0xA4, 0xA1, 0xA4, 0x18, 0xD2, 0x79, 0x0A, 0x00, 0x8A, 0x02, 0x99, 0x85, 0xAA, 0x86, 0x89, 0xB3,
+    0x69, 0x0B, 0xA1, 0x11, 0xC8, 0x04, 0x0A, 0x48, 0xA8, 0x29, 0x90, 0x4D, 0xC1, 0x5A, 0xB1, 0x20,
+    0xC9, 0x86, 0x1A, 0x09, 0x82, 0x98, 0xD8, 0x87, 0x2A, 0x29, 0x2C, 0x98, 0x00, 0xB3, 0x93, 0x1C,
+    0x30, 0x91, 0x9F, 0x86, 0x89, 0x29, 0xC1, 0x02, 0x80, 0x9A, 0x87, 0x89, 0x7B, 0xA1, 0x1C, 0x21,
+    0x99, 0x98, 0x85, 0x1C, 0xB2, 0x94, 0x19, 0x98, 0x13, 0x4F, 0xA8, 0x2A, 0xB4, 0x90, 0x12, 0x0C,
+    0x21, 0xB8, 0xC1, 0x04, 0x3C, 0xA8, 0x59, 0x18, 0x0D, 0x93, 0x98, 0xC5, 0x38, 0x80, 0x2C, 0xA0,
+    0x01, 0xB8, 0x06, 0xA9, 0xA1, 0x60, 0xA0, 0x3A, 0xA3, 0x4F, 0x8A, 0x01, 0x81, 0xBC, 0x87, 0x80,
+    0x3A, 0x08, 0x09, 0x82, 0xEA, 0x32, 0xAA, 0xA2, 0x12, 0x9A, 0x52, 0x8B, 0x10, 0x10, 0x1F, 0xD1,
+    0x58, 0xA0, 0x80, 0x88, 0x70, 0x9A, 0x81, 0xA1, 0x40, 0xBA, 0x21, 0x09, 0x52, 0x0F, 0x80, 0x12,
+    0x8D, 0xD4, 0x03, 0x3D, 0x89, 0x91, 0x18, 0xD1, 0x02, 0x0A, 0xA2, 0x30, 0x1F, 0x81, 0x81, 0x39,
+    0x2F, 0x91, 0xE0, 0x23, 0x9D, 0x95, 0x88, 0x49, 0xA8, 0xC3, 0x20, 0x4B, 0xD0, 0x03, 0x3C, 0xAA,
+    0x97, 0x3B, 0xB1, 0x30, 0x0A, 0x98, 0x90, 0x94, 0x3A, 0xC8, 0x78, 0xF0, 0x21, 0xA0, 0x5A, 0xB9,
+    0x32, 0x88, 0x0B, 0x22, 0x4B, 0xD1, 0x1A, 0x18, 0x82, 0x9C, 0x10, 0x91, 0xB2, 0x8A, 0xA4, 0xAB,
+    0x33, 0x74, 0xB5, 0xC0, 0x2A, 0x24, 0x08, 0x8C, 0x11, 0x98, 0xE0, 0x11, 0x3A, 0xF0, 0x90, 0x11,
+    0x9E, 0x21, 0xBA, 0x57, 0x88, 0xC8, 0x09, 0x12, 0x92, 0x8B, 0x19, 0x33, 0xCA, 0xB0, 0x72, 0x85,
+    0xEA, 0x09, 0x14, 0x90, 0xAB, 0x08, 0x12, 0xB9, 0x7A, 0x87, 0xB0, 0x8C, 0x10, 0x33, 0xC9, 0x98,
+    0x40, 0x00, 0xAA, 0x3A, 0x07, 0xA0, 0x8D, 0x20, 0x21, 0xE9, 0x99, 0x21, 0x90, 0x79, 0x93, 0xC8,
+    0x0B, 0x32, 0x23, 0xAD, 0x98, 0x23, 0xA1, 0x8C, 0x6A, 0x82, 0xA0, 0xAC, 0x31, 0x32, 0xEC, 0x88,
+    0x11, 0xB1, 0x56, 0x99, 0xCA, 0x20, 0x22, 0x91, 0x8E, 0x00, 0x02, 0xB8, 0x08, 0x61, 0x90, 0xB9,
+    0x1A, 0x32, 0x01, 0xCF, 0x10, 0x11, 0x2A, 0x17, 0xAB, 0x9C, 0x33, 0x33, 0xF9, 0x1A, 0x10, 0x92,
+    0x8B, 0x80, 0x17, 0x89, 0xAA, 0x18, 0x21, 0xE3, 0x8B, 0x20, 0xA2, 0x7C, 0x95, 0xBA, 0x1A, 0x34,
+    0x82, 0xBD, 0x10, 0x22, 0xA9, 0x0A, 0x30, 0x96, 0x90, 0x8D, 0x00, 0x31, 0xC9, 0x0A, 0x21, 0xF8,
+    0x74, 0xA8, 0xAB, 0x48, 0x22, 0xB1, 0x9D, 0x11, 0x13, 0x9C, 0x88, 0x42, 0x88, 0xC0, 0x09, 0x88,
+    0x14, 0x9B, 0x0A, 0x12, 0x0E, 0x47, 0xBA, 0x9B, 0x53, 0x22, 0xEA, 0x09, 0x31, 0xB1, 0x9A, 0x38,
+    0x13, 0x19, 0x9E, 0x80, 0x01, 0xA1, 0xA9, 0x12, 0xDA, 0x7D, 0x97, 0xC9, 0x09, 0x33, 0x82, 0x9E,
+    0x18, 0x12, 0xA9, 0x99, 0x33, 0x92, 0xC8, 0x1B, 0x48, 0x88, 0xB8, 0x08, 0xB3, 0xFB, 0x77, 0xA8,
+    0x9C, 0x30, 0x22, 0xE1, 0x99, 0x21, 0x82, 0xAA, 0x19, 0x23, 0x91, 0xCC, 0x00, 0x85, 0x8A, 0x1A,
+    0x21, 0xAC, 0x7B, 0x07, 0xCA, 0x09, 0x33, 0x82, 0x9F, 0x28, 0x12, 0xA9, 0x99, 0x32, 0x21, 0xBC,
+    0x2B, 0x42, 0xB9, 0xB9, 0x62, 0x99, 0x1D, 0x47, 0xC8, 0x8B, 0x41, 0x21, 0xCA, 0x89, 0x23, 0x90,
+    0xAA, 0x58, 0x11, 0xC9, 0x89, 0x14, 0xB8, 0x8A, 0x40, 0x91, 0xAD, 0x57, 0xA8, 0x8D, 0x30, 0x23,
+    0xDA, 0x89, 0x23, 0x90, 0xAA, 0x30, 0x31, 0xFA, 0x08, 0x12, 0xC9, 0x19, 0x21, 0xB9, 0x0D, 0x67,
+    0xB8, 0x8C, 0x31, 0x22, 0xBC, 0x88, 0x05, 0x98, 0x09, 0x30, 0x08, 0x8D, 0x20, 0xA3, 0xDB, 0x28,
+    0x13, 0xAC, 0x7D, 0x03, 0xE9, 0x89, 0x43, 0x81, 0x8D, 0x29, 0x83, 0xA9, 0x19, 0x05, 0xA9, 0x2B,
+    0x43, 0xD8, 0x9A, 0x22, 0x92, 0xBD, 0x73, 0x93, 0xBD, 0x20, 0x14, 0xB8, 0x8B, 0x43, 0xA0, 0x9B,
+    0x42, 0xA3, 0xCC, 0x31, 0x12, 0xAD, 0x1A, 0x23, 0xD8, 0x2C, 0x27, 0xC9, 0x8A, 0x33, 0x02, 0x9E,
+    0x18, 0x03, 0xBA, 0x18, 0x24, 0xBA, 0x1C, 0x24, 0xB0, 0x9D, 0x30, 0x03, 0xCD, 0x70, 0x82, 0xBC,
+    0x28, 0x14, 0xB0, 0x0C, 0x41, 0xA0, 0x9A, 0x22, 0xB2, 0xAA, 0x61, 0x81, 0xBC, 0x39, 0x13, 0xF8,
+    0x69, 0x02, 0xBC, 0x28, 0x14, 0x98, 0x8C, 0x21, 0xA2, 0xAA, 0x31, 0xA3, 0xCB, 0x68, 0x82, 0xD9,
+    0x0A, 0x33, 0xD0, 0x4C, 0x05, 0xDA, 0x19, 0x33, 0xA0, 0x8D, 0x20, 0xA3, 0x9B, 0x31, 0xA3, 0x9D,
+    0x40, 0x93, 0xDB, 0x19, 0x22, 0xB8, 0x2F, 0x17, 0xC9, 0x0A, 0x33, 0x80, 0x9D, 0x21, 0x92, 0xAB,
+    0x41, 0x91, 0x8C, 0x20, 0x95, 0xAA, 0x0A, 0x32, 0x98, 0x8F, 0x37, 0xD9, 0x0A, 0x33, 0x80, 0xAC,
+    0x12, 0x82, 0x8D, 0x21, 0x80, 0x8D, 0x31, 0xB3, 0xBB, 0x00, 0x11, 0x88, 0xAE, 0x77, 0xC8, 0x8A,
+    0x43, 0x90, 0xAA, 0x22, 0x90, 0x8C, 0x33, 0xB8, 0x0E, 0x22, 0xA2, 0x9C, 0x10, 0x08, 0x1A, 0xB8,
+    0x77, 0xC0, 0x8B, 0x43, 0xA1, 0xA9, 0x22, 0x89, 0x8C, 0x34, 0xB9, 0x9B, 0x07, 0x80, 0x8A, 0x80,
+    0x09, 0x20, 0xE8, 0x72, 0xB2, 0x9E, 0x41, 0x91, 0x89, 0x38, 0xA8, 0x8A, 0x44, 0xB9, 0x8A, 0x15,
+    0x88, 0x8A, 0x91, 0x0C, 0x30, 0xC2, 0x7B, 0x86, 0xAC, 0x38, 0x84, 0x8A, 0x28, 0xB1, 0x8A, 0x53,
+    0xC0, 0x8A, 0x52, 0xA9, 0x10, 0x90, 0x9C, 0x22, 0xA1, 0x8B, 0x77, 0xC9, 0x19, 0x23, 0xAB, 0x22,
+    0xB0, 0x0C, 0x33, 0xA8, 0x1D, 0x10, 0xA0, 0x31, 0xD0, 0xAA, 0x11, 0x81, 0x80, 0x7B, 0x07, 0x9F,
+    0x30, 0xB3, 0x19, 0x11, 0xDB, 0x21, 0x81, 0x8A, 0x94, 0x8C, 0x43, 0xC0, 0x2B, 0x92, 0x9D, 0x24,
+    0xB9, 0x70, 0xC3, 0x8C, 0x22, 0xB0, 0x40, 0x90, 0xAB, 0x23, 0x99, 0x30, 0xD1, 0x2B, 0x15, 0xCA,
+    0x30, 0xC9, 0x1A, 0x15, 0xCA, 0x71, 0xB2, 0x8D, 0x22, 0xC0, 0x40, 0x90, 0x9A, 0x12, 0x1A, 0x01,
+    0xD8, 0x48, 0xA1, 0x09, 0x02, 0xAC, 0x01, 0x18, 0x08, 0xD0, 0x67, 0xD9, 0x28, 0x80, 0x1A, 0x05,
+    0xAA, 0x20, 0xC0, 0x40, 0x98, 0x0A, 0x05, 0x8C, 0x02, 0xA8, 0x29, 0xA0, 0x39, 0xC4, 0x0A, 0x65,
+    0xE0, 0x28, 0x98, 0x09, 0x15, 0x9B, 0x12, 0xD8, 0x59, 0xA0, 0x18, 0x01, 0x8B, 0x85, 0x8B, 0x21,
+    0xE8, 0x30, 0x8A, 0x80, 0x81, 0x7C, 0xD3, 0x29, 0xA0, 0x89, 0x16, 0x8B, 0x83, 0x9A, 0x38, 0xC1,
+    0x29, 0x22, 0xBB, 0x04, 0x0C, 0x92, 0x1A, 0x02, 0x9E, 0x03, 0x0B, 0xC8, 0x78, 0xB7, 0x4A, 0xA0,
+    0x0A, 0x14, 0x0B, 0x83, 0x9A, 0x49, 0xC0, 0x10, 0x01, 0x2B, 0xB5, 0x3B, 0x00, 0xAA, 0x24, 0xBC,
+    0x21, 0x99, 0x80, 0x0E, 0x1A, 0x77, 0x0C, 0x92, 0x8A, 0x50, 0xB8, 0x13, 0x9A, 0x28, 0xE1, 0x30,
+    0x8A, 0x81, 0x01, 0x2B, 0xD3, 0x19, 0x80, 0x88, 0x13, 0x8D, 0x00, 0x9C, 0x11, 0xBF, 0x70, 0x97,
+    0x1C, 0xB3, 0x8A, 0x24, 0x8D, 0x04, 0x8B, 0x12, 0xCA, 0x22, 0x8A, 0x21, 0xB0, 0x49, 0xB0, 0x29,
+    0xA0, 0x3A, 0x95, 0x2A, 0xD3, 0x0A, 0x83, 0xAF, 0x83, 0xEB, 0x73, 0xD3, 0x49, 0xC8, 0x29, 0x93,
+    0x3B, 0xA4, 0x0A, 0x03, 0x9D, 0x83, 0x1A, 0x11, 0xC1, 0x30, 0xBA, 0x10, 0x90, 0x38, 0x92, 0x6A,
+    0xB1, 0x4B, 0xF0, 0x08, 0x81, 0xBB, 0x11, 0xFB, 0x75, 0xC1, 0x39, 0xB8, 0x29, 0x85, 0x2C, 0xA3,
+    0x8A, 0x12, 0xBC, 0x14, 0x99, 0x21, 0xC0, 0x38, 0xA9, 0x18, 0x83, 0x3C, 0x94, 0x0B, 0x03, 0x8D,
+    0x83, 0x9A, 0x39, 0xF1, 0x29, 0xA0, 0x0B, 0xD9, 0x2E, 0x67, 0xAB, 0x13, 0xBB, 0x50, 0xD2, 0x48,
+    0x98, 0x09, 0x82, 0x1D, 0x01, 0x98, 0x31, 0xCA, 0x11, 0x98, 0x2A, 0x93, 0x7A, 0xA1, 0x88, 0x88,
+    0x89, 0x12, 0xA1, 0x40, 0xDC, 0x21, 0x09, 0x99, 0xB8, 0x1B, 0x89, 0x4E, 0x77, 0xD9, 0x12, 0xA9,
+    0x29, 0x97, 0x3B, 0x80, 0xC9, 0x32, 0x9C, 0x11, 0xA3, 0x3B, 0xC3, 0x99, 0x41, 0xAB, 0x43, 0x99,
+    0x10, 0x94, 0x8E, 0x02, 0x9A, 0x51, 0xA0, 0x19, 0x90, 0x1B, 0x94, 0xAB, 0x41, 0xD9, 0x21, 0x99,
+    0xD8, 0x71, 0x97, 0x1C, 0x81, 0xB9, 0x72, 0xB8, 0x01, 0x91, 0x0C, 0x84, 0x99, 0x50, 0xC0, 0x18,
+    0x00, 0x9A, 0x04, 0x8A, 0x03, 0xA8, 0x4A, 0xB1, 0x38, 0x29, 0xCB, 0x15, 0x8B, 0x81, 0xB4, 0x2A,
+    0xA8, 0x90, 0x41, 0x9B, 0x02, 0xAF, 0x02, 0x9D, 0x42, 0x67, 0x8D, 0x00, 0x90, 0x5B, 0xA3, 0x89,
+    0x20, 0xEA, 0x21, 0x00, 0x0B, 0x85, 0x9A, 0x18, 0xC3, 0x29, 0x02, 0xA8, 0x48, 0xB9, 0x28, 0x28,
+    0xA0, 0x17, 0x8D, 0x90, 0xA2, 0x59, 0x92, 0xB9, 0x38, 0x8A, 0x82, 0x04, 0xAE, 0x81, 0x92, 0x0E,
+    0x22, 0xE9, 0x57, 0x9C, 0x80, 0x83, 0x1D, 0x95, 0xA8, 0x4A, 0x90, 0x09, 0x31, 0xB9, 0x20, 0x88,
+    0xAC, 0x25, 0x99, 0x08, 0x84, 0x8D, 0x02, 0x81, 0x1C, 0x93, 0x99, 0x70, 0xB8, 0x89, 0x33, 0xB9,
+    0x12, 0xA8, 0x0E, 0x23, 0x89, 0x8B, 0xE2, 0x00, 0x10, 0xC9, 0x88, 0xD1, 0x72, 0xC7, 0x89, 0x41,
+    0xC8, 0x31, 0x80, 0xBC, 0x33, 0x9A, 0x18, 0x05, 0x9B, 0x90, 0x82, 0x1B, 0x05, 0xA0, 0x2B, 0xA3,
+    0x98, 0x7A, 0xC2, 0x19, 0x30, 0xD9, 0x24, 0xAB, 0x89, 0x25, 0x8A, 0x98, 0x93, 0x0D, 0x11, 0x93,
+    0x9F, 0x02, 0x88, 0x0B, 0x82, 0x8D, 0xC3, 0x77, 0xD0, 0x89, 0x32, 0xC8, 0x30, 0x00, 0xCC, 0x31,
+    0x08, 0x89, 0x22, 0xB9, 0x9B, 0x34, 0xA9, 0x20, 0x02, 0x9E, 0x11, 0x81, 0x0A, 0xA5, 0x80, 0x1B,
+    0x03, 0x16, 0xAF, 0x10, 0x12, 0x0A, 0x90, 0xA0, 0x2C, 0x22, 0x80, 0xBD, 0x28, 0x10, 0xA8, 0xBF,
+    0x84, 0x0A, 0x77, 0xD9, 0x08, 0x33, 0xBB, 0x14, 0x91, 0x9F, 0x31, 0x80, 0xA9, 0x23, 0xAA, 0x9B,
+    0x35, 0xA8, 0x08, 0x03, 0x9D, 0x28, 0x13, 0xAA, 0x0A, 0x85, 0x9A, 0x61, 0xA4, 0x9E, 0x30, 0x82,
+    0x8A, 0x10, 0xB8, 0x1A, 0x35, 0xE0, 0x8B, 0x10, 0x22, 0xDA, 0x8B, 0x14, 0x3F, 0x17, 0x9D, 0x29,
+    0x13, 0x8C, 0x82, 0x92, 0x9E, 0x22, 0x01, 0xAB, 0x23, 0xB9, 0xAB, 0x37, 0xA8, 0x89, 0x22, 0xCA,
+    0x38, 0x13, 0xEA, 0x28, 0x01, 0xA9, 0x44, 0xD9, 0x0A, 0x33, 0x88, 0xA9, 0x88, 0x99, 0x33, 0x23,
+    0xEE, 0x0A, 0x13, 0xB9, 0x10, 0xAA, 0x71, 0x27, 0xBF, 0x40, 0x03, 0x0D, 0x10, 0xA0, 0x8C, 0x14,
+    0x80, 0x9A, 0x22, 0xAA, 0x0B, 0x27, 0xA9, 0x09, 0x21, 0xB9, 0x30, 0x31, 0xFA, 0x3A, 0x12, 0xC1,
+    0x1B, 0x80, 0x00, 0x79, 0x92, 0xDB, 0x29, 0x05, 0xA9, 0x00, 0xB9, 0x30, 0xA0, 0x9B, 0x11, 0x77,
+    0xD6, 0x8A, 0x31, 0xA3, 0x2B, 0x01, 0xEB, 0x3A, 0x05, 0x98, 0x0A, 0x83, 0x9B, 0x38, 0x06, 0xAB,
+    0x10, 0x02, 0x9D, 0x33, 0x81, 0xAE, 0x41, 0x81, 0xBB, 0x41, 0xA0, 0x1A, 0x15, 0xD8, 0x8A, 0x33,
+    0xA0, 0x9B, 0x81, 0x0A, 0xD8, 0x4B, 0x57, 0x03, 0xCF, 0x18, 0x22, 0xA8, 0x02, 0x98, 0xAD, 0x51,
+    0x01, 0xA9, 0x20, 0xB9, 0x89, 0x73, 0xA0, 0x09, 0x18, 0xA8, 0x38, 0x03, 0xB8, 0x48, 0xD0, 0x8B,
+    0x63, 0xA1, 0x8B, 0x11, 0x80, 0x99, 0x88, 0x11, 0xF1, 0x8B, 0x42, 0xFC, 0x2A, 0x57, 0x90, 0xAD,
+    0x20, 0x12, 0x0A, 0x02, 0xCA, 0x0B, 0x34, 0x88, 0x19, 0x80, 0x9D, 0x20, 0x12, 0x99, 0x01, 0xBA,
+    0x19, 0x26, 0x20, 0xA9, 0x9F, 0x21, 0x82, 0x98, 0xB2, 0x9F, 0x41, 0x82, 0xCA, 0x19, 0x90, 0x39,
+    0xB5, 0xCE, 0x78, 0x15, 0xC8, 0x8B, 0x21, 0x82, 0x38, 0xB0, 0xAD, 0x30, 0x82, 0x88, 0x01, 0xC8,
+    0x19, 0x01, 0x08, 0x30, 0x99, 0xB9, 0x75, 0xC4, 0x9B, 0x23, 0x98, 0x41, 0xB8, 0x8C, 0x20, 0x89,
+    0x32, 0xF9, 0x8D, 0x33, 0xD0, 0x1B, 0x83, 0x9A, 0x77, 0xC0, 0x0B, 0x42, 0x99, 0x30, 0xA0, 0xAD,
+    0x33, 0xA0, 0x19, 0x82, 0xBB, 0x32, 0x92, 0x0C, 0x03, 0x09, 0x83, 0xDB, 0x58, 0x83, 0xB9, 0x39,
+    0xA0, 0xAA, 0x45, 0xDA, 0x0A, 0x13, 0xCA, 0x0F, 0x12, 0x10, 0x9E, 0x00, 0x77, 0xAB, 0x28, 0x02,
+    0x1C, 0x02, 0xD8, 0x29, 0x92, 0x88, 0x21, 0xDB, 0x21, 0x01, 0x9A, 0x15, 0x9D, 0x10, 0x04, 0x0B,
+    0x91, 0xA8, 0x6A, 0x81, 0x9A, 0x48, 0xB8, 0x00, 0x18, 0x9A, 0x81, 0x03, 0xAF, 0x06, 0x9A, 0x08,
+    0x77, 0x8C, 0x08, 0x02, 0x2B, 0x81, 0xC0, 0x39, 0xB1, 0x10, 0x03, 0x0F, 0xA2, 0x18, 0x29, 0xD3,
+    0x00, 0x19, 0x19, 0xB3, 0x2B, 0x29, 0xDA, 0x44, 0xBB, 0x18, 0x04, 0xBD, 0x73, 0xA9, 0x90, 0x01,
+    0x4B, 0xF3, 0x38, 0x4A, 0xE9, 0x22, 0x88, 0x9A, 0x85, 0x09, 0x80, 0x82, 0x30, 0xAF, 0x32, 0xA0,
+    0x0B, 0x13, 0xC9, 0x81, 0x92, 0x88, 0x80, 0x39, 0x13, 0xAE, 0x7B, 0xA0, 0x92, 0x3C, 0xC5, 0x09,
+    0x13, 0xBC, 0x21, 0xC4, 0x3A, 0x92, 0x1E, 0x20, 0xC9, 0x25, 0xAC, 0x22, 0x94, 0x8D, 0x21, 0xB1,
+    0x39, 0x80, 0xBA, 0x04, 0x9A, 0x04, 0xC4, 0x1F, 0x13, 0xBA, 0x38, 0x01, 0x0C, 0x08, 0x30, 0xC0,
+    0xF1, 0x12, 0x19, 0xD1, 0x18, 0x69, 0xC0, 0x19, 0x14, 0xAF, 0x33, 0xC0, 0x1A, 0x83, 0x1B, 0x11,
+    0xD0, 0x40, 0xA9, 0xA3, 0x18, 0x40, 0xF9, 0x20, 0x93, 0x8E, 0x83, 0x08, 0x2A, 0x80, 0x80, 0x8A,
+    0x90, 0x16, 0xCA, 0x59, 0x92, 0x8B, 0x12, 0xC8, 0x29, 0x96, 0xA0, 0x2A, 0x29, 0xC7, 0x2C, 0x12,
+    0xB8, 0x29, 0x78, 0xAB, 0x40, 0x10, 0xF9, 0x22, 0xA0, 0x1A, 0xB2, 0x7B, 0x01, 0x9B, 0x31, 0xBA,
+    0x20, 0x83, 0x8E, 0x83, 0x88, 0x49, 0xAA, 0x23, 0x8E, 0x21, 0xD3, 0x0A, 0x59, 0x91, 0x8C, 0x03,
+    0xD0, 0x10, 0x91, 0x08, 0x1F, 0x33, 0xAD, 0x30, 0xB0, 0x12, 0x5A, 0xF8, 0x22, 0x89, 0x4A, 0xC8,
+    0x58, 0x88, 0x99, 0x14, 0xBB, 0x61, 0xB8, 0x29, 0x94, 0x0B, 0x83, 0x0C, 0x42, 0xDA, 0x11, 0x88,
+    0xC8, 0x05, 0x08, 0x1E, 0xA2, 0x28, 0x19, 0x29, 0xE4, 0x29, 0x49, 0xB0, 0x29, 0x01, 0xE8, 0x04,
+    0x18, 0xAB, 0xA4, 0x58, 0x08, 0xBB, 0x34, 0x0B, 0x0A, 0xA5, 0x1B, 0x22, 0xB9, 0x08, 0x13, 0x8F,
+    0xA4, 0x90, 0x29, 0x91, 0xA9, 0x3F, 0x97, 0xA1, 0x29, 0x99, 0x30, 0x02, 0xAC, 0x05, 0xB8, 0x7A,
+    0xB2, 0x10, 0x0E, 0x82, 0x00, 0x2A, 0xD1, 0x88, 0x84, 0xA9, 0x01, 0x94, 0x2D, 0xA0, 0x5A, 0x09,
+    0xD0, 0x08, 0x28, 0x17, 0x0C, 0x88, 0x80, 0x40, 0xC2, 0x99, 0x03, 0x99, 0x32, 0x9A, 0x2D, 0x31,
+    0xA8, 0x1D, 0xE2, 0x11, 0x93, 0xD9, 0x01, 0x39, 0xA2, 0x8D, 0x09, 0x58, 0xA1, 0x9E, 0x70, 0xB3,
+    0x1C, 0x02, 0xAB, 0x34, 0xC1, 0x1A, 0x81, 0x09, 0x21, 0x8C, 0x30, 0x8B, 0x11, 0xA7, 0x8F, 0x84,
+    0x80, 0x29, 0xB8, 0x49, 0x08, 0xA8, 0x91, 0x8C, 0xD3, 0x78, 0xA4, 0x9B, 0x23, 0xB9, 0x52, 0xB0,
+    0x0B, 0x12, 0x0A, 0x32, 0xDA, 0x18, 0x92, 0x0A, 0x96, 0x60, 0xBD, 0x32, 0x00, 0x8B, 0x92, 0x9A,
+    0x02, 0xD1, 0x09, 0xE8, 0x72, 0xC2, 0x19, 0x10, 0xA8, 0x15, 0xBA, 0x18, 0x92, 0x2A, 0x14, 0x9D,
+    0x20, 0xB8, 0x10, 0x85, 0x08, 0xE0, 0x1B, 0x34, 0xA8, 0x19, 0xEA, 0x21, 0xA0, 0x99, 0x60, 0x87,
+    0x8D, 0x02, 0x98, 0x68, 0xA0, 0x0A, 0x01, 0x99, 0x33, 0xE8, 0x18, 0x91, 0x0A, 0x23, 0x99, 0x5A,
+    0xD0, 0x19, 0x12, 0xA8, 0x01, 0x8C, 0x11, 0x99, 0x1B, 0x79, 0x37, 0xAF, 0x12, 0xA8, 0x79, 0xB1,
+    0x0A, 0x82, 0x9A, 0x34, 0xC8, 0x28, 0xB1, 0x0D, 0x14, 0x99, 0x21, 0xC8, 0x09, 0x00, 0x20, 0x04,
+    0xAD, 0x08, 0x80, 0x19, 0x28, 0x77, 0xDB, 0x12, 0xA9, 0x58, 0xA3, 0x1C, 0x81, 0xAB, 0x53, 0xA8,
+    0x30, 0xB1, 0x0F, 0x82, 0x09, 0x22, 0xA8, 0x90, 0xBA, 0x58, 0x04, 0x98, 0xBA, 0x3A, 0x08, 0x3A,
+    0x77, 0xEA, 0x03, 0xA9, 0x48, 0xB4, 0x3A, 0x91, 0x9C, 0x22, 0xA9, 0x52, 0xB1, 0x2B, 0xB1, 0x1D,
+    0x33, 0x8A, 0x04, 0xDB, 0x08, 0x92, 0x22, 0xF0, 0x19, 0x98, 0x68, 0x43, 0xAF, 0x84, 0x9A, 0x40,
+    0xE2, 0x40, 0x88, 0x8B, 0x83, 0x0C, 0x22, 0xC0, 0x31, 0xE8, 0x08, 0x81, 0x39, 0x01, 0xAA, 0x02,
+    0x9C, 0x84, 0xE0, 0x00, 0xA8, 0x73, 0x93, 0x1F, 0xA2, 0xAA, 0x62, 0xB9, 0x23, 0x90, 0x2C, 0xD2,
+    0x1A, 0x31, 0xAB, 0x16, 0xA9, 0x10, 0xB0, 0x19, 0x03, 0x1C, 0x13, 0xCA, 0x4B, 0xC0, 0x1A, 0xB1,
+    0x77, 0xC8, 0x20, 0x90, 0x0E, 0x95, 0x2C, 0x21, 0xD8, 0x31, 0xA9, 0x0A, 0x95, 0x1B, 0x21, 0xB8,
+    0x72, 0xA9, 0x19, 0xA2, 0x3B, 0x94, 0xBA, 0x43, 0xAD, 0x21, 0xC0, 0x70, 0xD1, 0x11, 0x81, 0x0F,
+    0x95, 0x99, 0x79, 0xD0, 0x11, 0x11, 0x9E, 0x05, 0x9A, 0x5A, 0xB1, 0x00, 0x20, 0x8C, 0x02, 0x98,
+    0x5A, 0xB0, 0x80, 0x18, 0xAA, 0x84, 0x7C, 0xB4, 0x1A, 0x31, 0xDC, 0x22, 0x98, 0x0B, 0x97, 0x09,
+    0x49, 0xC0, 0x20, 0x18, 0xCA, 0x04, 0x88, 0x2B, 0xA3, 0xAA, 0x72, 0xB8, 0x01, 0x01, 0x1D, 0x10,
+    0xB9, 0x40, 0xAA, 0x40, 0xB5, 0x1C, 0x82, 0xB1, 0x70, 0x99, 0x10, 0x81, 0x8E, 0x84, 0xB8, 0x69,
+    0x90, 0x89, 0x33, 0x9D, 0x82, 0xB0, 0x38, 0xC3, 0x90, 0x33, 0x8F, 0x81, 0xA2, 0x3A, 0x80, 0x9B,
+    0x51, 0x9C, 0x21, 0xC3, 0x3B, 0x14, 0xAA, 0x68, 0xB1, 0x9A, 0x22, 0xD8, 0x10, 0xA6, 0x0A, 0x13,
+    0xAB, 0x79, 0x98, 0x4B, 0xA2, 0x8B, 0x15, 0xB9, 0x22, 0xD1, 0x10, 0x18, 0x1B, 0x1C, 0xB1, 0x31,
+    0x3B, 0xAB, 0x02, 0xA3, 0x2E, 0xC2, 0xA2, 0x50, 0x28, 0x4B, 0x3D, 0xD1, 0xB3, 0x82, 0xC1, 0xA3,
+    0xC2, 0xA1, 0x59, 0x4B, 0x5E, 0x09, 0x2A, 0x18, 0x89, 0x08, 0xE4, 0xA1, 0xB5, 0xC4, 0x11, 0x09,
+    0x29, 0x3A, 0x1C, 0x18, 0x09, 0x5C, 0x98, 0x88, 0x02, 0xF1, 0xA3, 0x93, 0x18, 0x09, 0xA0, 0x30,
+    0xCA, 0x94, 0x7A, 0x2C, 0x1A, 0x91, 0x99, 0x94, 0x1C, 0x83, 0x11, 0xC5, 0x01, 0x0A, 0x00, 0x99,
+    0x19, 0x8B, 0x18, 0x19, 0x79, 0xA0, 0x12, 0x09, 0x88, 0x91, 0x09, 0xB0, 0x10, 0x84, 0x41, 0x18,
+    0xA1, 0x18, 0x4B, 0xCB, 0xB3, 0xAF, 0x68, 0x8A, 0x01, 0x80, 0xD3, 0x32, 0x81, 0x86, 0x88, 0x58,
+    0x0A, 0x18, 0xAA, 0x1B, 0x9E, 0x0B, 0x92, 0x89, 0x80, 0x04, 0xA1, 0x85, 0x70, 0x00, 0x0C, 0x83,
+    0x8C, 0x80, 0x19, 0x1B, 0xC9, 0x85, 0x10, 0xA5, 0x29, 0x04, 0x0A, 0x08, 0xB8, 0x0A, 0x0B, 0x38,
+    0x00, 0xC4, 0x27, 0x10, 0x69, 0x8A, 0xE0, 0x08, 0xC2, 0x1A, 0x80, 0x01, 0x19, 0x0A, 0x32, 0x8B,
+    0xB4, 0x03, 0x78, 0x81, 0x20, 0xEB, 0x08, 0x8A, 0x8A, 0x8B, 0x00, 0xC4, 0x43, 0x3E, 0x42, 0x3B,
+    0x02, 0x3B, 0x08, 0x0C, 0x08, 0xF4, 0x01, 0x28, 0x08, 0x38, 0xBB, 0x84, 0x8B, 0x9F, 0x0A, 0xA8,
+    0xC3, 0x30, 0x48, 0xC0, 0x73, 0x0B, 0xC3, 0x03, 0x8C, 0x80, 0x3A, 0x0B, 0x08, 0xC8, 0xC3, 0x84,
+    0x30, 0x3C, 0x80, 0xB7, 0x08, 0x05, 0x08, 0x31, 0x1E, 0x82, 0x80, 0x2A, 0x00, 0xC8, 0xB3, 0x84,
+    0x8B, 0x8C, 0x80, 0x9F, 0xE0, 0x01, 0x2A, 0x2A, 0x80, 0xB3, 0x08, 0x75, 0x08, 0x91, 0x28, 0xEA,
+    0x08, 0xA8, 0x3A, 0xB8, 0x80, 0xD0, 0x33, 0x8B, 0x35, 0x7B, 0x04, 0x81, 0x02, 0x02, 0x88, 0x00,
+    0x08, 0xE8, 0xB3, 0x08, 0x8D, 0x80, 0x8F, 0xD8, 0xB3, 0x2A, 0xAB, 0xB3, 0x43, 0x3B, 0x80, 0x00,
+    0x88, 0xB7, 0x80, 0x80, 0x80, 0x0F, 0x8B, 0x08, 0xB5, 0xC8, 0x03, 0x74, 0x21, 0x48, 0x1B, 0x80,
+    0x50, 0x8B, 0x1C, 0x80, 0x0A, 0x88, 0xF7, 0x91, 0xC5, 0xA4, 0xD3, 0xA4, 0xC1, 0x93, 0xD1, 0x03,
+    0x13, 0x7F, 0x8E, 0x34, 0xAF, 0x24, 0xD9, 0x58, 0xD1, 0x18, 0x93, 0x99, 0x28, 0x11, 0xBA, 0x70,
+    0x98, 0x19, 0x91, 0x0A, 0x32, 0x0D, 0x91, 0x22, 0xE8, 0x38, 0x40, 0xFA, 0x30, 0xC0, 0x9A, 0x62,
+    0xC9, 0x28, 0x80, 0x9A, 0x70, 0xD4, 0x49, 0x18, 0xA9, 0x30, 0xE4, 0x08, 0x28, 0x9A, 0x59, 0xD1,
+    0x10, 0x01, 0x99, 0x51, 0xD0, 0x18, 0x81, 0x8B, 0x42, 0xCA, 0x01, 0x98, 0x10, 0xA0, 0x1B, 0xF2,
+    0x74, 0xAC, 0x86, 0x0B, 0x20, 0x00, 0x2F, 0xC2, 0x88, 0x92, 0x08, 0x7A, 0xB8, 0x12, 0xA0, 0x01,
+    0x92, 0x1F, 0x91, 0x1A, 0x93, 0x9A, 0x13, 0x8D, 0x12, 0x8B, 0x19, 0x1E, 0xA7, 0x7A, 0xA9, 0x12,
+    0x98, 0xB1, 0x96, 0x3C, 0x88, 0x4A, 0xB8, 0x83, 0x91, 0x18, 0x81, 0x6D, 0xB8, 0x11, 0x99, 0x10,
+    0xA0, 0x48, 0x8B, 0x81, 0x19, 0x98, 0xF9, 0x47, 0x1F, 0xD5, 0x20, 0xB0, 0x11, 0x39, 0x2F, 0xB0,
+    0x11, 0xE0, 0x12, 0x0A, 0x01, 0x09, 0x10, 0x09, 0x29, 0xE0, 0x11, 0xA9, 0x84, 0x8A, 0x01, 0x1C,
+    0x91, 0x2D, 0x79, 0xF2, 0x22, 0x2F, 0xB4, 0x49, 0x99, 0x91, 0xA2, 0x39, 0xB8, 0x68, 0x8A, 0x92,
+    0x80, 0x82, 0x09, 0x85, 0x2F, 0xE2, 0x21, 0x0B, 0xA2, 0x29, 0x99, 0xA1, 0x92, 0x8B, 0x76, 0x0D,
+    0xE6, 0x60, 0xBB, 0x05, 0x2C, 0xA0, 0x91, 0x92, 0x3A, 0xA8, 0x40, 0x9A, 0x94, 0x29, 0xA0, 0x83,
+    0x5D, 0xB9, 0x85, 0x3A, 0xB9, 0x94, 0x4C, 0xB9, 0x94, 0x89, 0x25, 0x1F, 0xE4, 0x42, 0x8C, 0x94,
+    0x4B, 0x98, 0x80, 0xA1, 0x28, 0xA9, 0x22, 0x1C, 0xA2, 0x10, 0x09, 0xA4, 0x38, 0x1C, 0xC1, 0x13,
+    0x1E, 0xC1, 0x49, 0x9B, 0xB3, 0x2A, 0x07, 0x4F, 0xF1, 0x24, 0x0D, 0xA5, 0x5B, 0x99, 0x00, 0x90,
+    0x18, 0xA8, 0x32, 0x0F, 0x92, 0x18, 0x80, 0x29, 0xA0, 0x58, 0xB9, 0x04, 0x1C, 0xC2, 0x3A, 0xAA,
+    0x92, 0x4D, 0xB7, 0x7B, 0xD8, 0x05, 0x1C, 0xB3, 0x38, 0x1A, 0x99, 0xB3, 0x4A, 0xB0, 0x31, 0x8C,
+    0x01, 0xA0, 0x41, 0x8C, 0x84, 0x39, 0xC8, 0x84, 0x2C, 0xA9, 0x93, 0x0C, 0xA8, 0x7B, 0xC7, 0x7A,
+    0xC9, 0x03, 0x88, 0x10, 0xB0, 0x79, 0xA8, 0x10, 0xA8, 0x20, 0xA0, 0x39, 0xC8, 0x20, 0x09, 0x88,
+    0x95, 0x7B, 0xA0, 0x01, 0x38, 0xE0, 0x80, 0x3B, 0xD9, 0x90, 0x78, 0xB9, 0x14, 0x99, 0x49, 0xB3,
+    0x38, 0x98, 0x91, 0x28, 0xAB, 0x85, 0x08, 0xBA, 0x86, 0x1C, 0x90, 0x91, 0x20, 0x08, 0x83, 0x30,
+    0x88, 0x81, 0xBF, 0xA8, 0xDD, 0x0B, 0x58, 0xF4, 0x38, 0x80, 0x00, 0x12, 0x18, 0xA3, 0x81, 0x8F,
+    0x91, 0x81, 0x29, 0xD8, 0x11, 0x1B, 0xA9, 0x06, 0x2A, 0xA0, 0x23, 0x4A, 0xB1, 0xC2, 0x2D, 0xFA,
+    0x88, 0x8B, 0x79, 0xF2, 0x30, 0x89, 0x11, 0x10, 0x19, 0xB3, 0x20, 0x8F, 0x92, 0x80, 0x29, 0xD0,
+    0x12, 0x0B, 0x99, 0x85, 0x4A, 0xA9, 0x96, 0x28, 0x88, 0xD1, 0x10, 0x8B, 0xC9, 0x99, 0x7B, 0xC5,
+    0x49, 0x88, 0x00, 0x11, 0x19, 0xB3, 0x30, 0x8F, 0x91, 0x01, 0x1A, 0xC2, 0x00, 0x1A, 0xB9, 0x34,
+    0x0B, 0x90, 0x14, 0x19, 0x22, 0xD0, 0x0D, 0xB1, 0xFA, 0x89, 0xAB, 0x47, 0x9C, 0x03, 0x18, 0x10,
+    0x92, 0x43, 0x0C, 0xD3, 0x1A, 0x10, 0xC0, 0x21, 0x1C, 0xC0, 0x10, 0x1A, 0x08, 0x95, 0x2A, 0x10,
+    0x84, 0x88, 0x08, 0xEA, 0x08, 0xCC, 0xC9, 0x1A, 0x27, 0x0F, 0x82, 0x10, 0x00, 0x80, 0x04, 0x2B,
+    0xC8, 0x81, 0x18, 0x8A, 0xB5, 0x39, 0x9A, 0xA8, 0x30, 0x3A, 0xA4, 0x01, 0x7C, 0x82, 0x91, 0x08,
+    0x8D, 0xC2, 0xBA, 0x9D, 0xB9, 0x57, 0x9C, 0x83, 0x20, 0x28, 0xA1, 0x41, 0x1A, 0xF3, 0x18, 0x1A,
+    0xA0, 0x83, 0x1C, 0xC0, 0x81, 0x1A, 0x08, 0xA3, 0x41, 0x2B, 0x05, 0x22, 0x0A, 0xEA, 0x00, 0x9C,
+    0xCB, 0xCA, 0x3C, 0x97, 0x39, 0x90, 0x02, 0x31, 0x12, 0xB5, 0x39, 0x9E, 0x82, 0x01, 0x8B, 0xC1,
+    0x20, 0x8C, 0xB0, 0x2A, 0x39, 0x84, 0x84, 0x6B, 0x13, 0x80, 0x02, 0xBC, 0x9A, 0xB1, 0xDF, 0xBD,
+    0x29, 0x27, 0x09, 0x98, 0x81, 0x62, 0x02, 0xC0, 0x1A, 0x98, 0x82, 0x92, 0x8F, 0x01, 0x00, 0x09,
+    0xDA, 0x18, 0x20, 0x04, 0x80, 0x1B, 0x35, 0x93, 0x08, 0xBE, 0xA8, 0x11, 0xCC, 0xBE, 0x80, 0x73,
+    0xA3, 0xA9, 0x30, 0x31, 0x07, 0x9A, 0x8A, 0x03, 0x28, 0xCA, 0xAC, 0x35, 0x89, 0xA8, 0xBA, 0x50,
+    0x91, 0x18, 0x18, 0x41, 0x06, 0x88, 0x08, 0xA0, 0x98, 0xAF, 0x88, 0xAB, 0xDA, 0x9A, 0x77, 0x90,
+    0x09, 0x10, 0x30, 0x95, 0xAB, 0x00, 0x01, 0x92, 0xAF, 0x11, 0x82, 0x00, 0xCC, 0x30, 0x81, 0x09,
+    0xC8, 0x72, 0x82, 0x88, 0x88, 0x40, 0xA0, 0xBD, 0x88, 0x18, 0xF0, 0x8B, 0x10, 0x57, 0xB8, 0x09,
+    0x22, 0x22, 0xE8, 0x8A, 0x21, 0x81, 0xD9, 0x2C, 0x13, 0x90, 0xB9, 0x3B, 0x17, 0xA9, 0x9A, 0x50,
+    0x05, 0x9A, 0x08, 0x31, 0x93, 0xBF, 0x00, 0x81, 0xB8, 0x8D, 0x00, 0x41, 0x17, 0x9C, 0x21, 0x00,
+    0x83, 0xBE, 0x22, 0x08, 0x99, 0x9E, 0x24, 0x09, 0x98, 0x29, 0x24, 0xBC, 0x81, 0x49, 0x83, 0x9D,
+    0x12, 0x30, 0xB0, 0x8D, 0x83, 0x9A, 0xCC, 0x89, 0x08, 0x58, 0x47, 0x9B, 0x01, 0x22, 0x91, 0xAF,
+    0x02, 0x08, 0xC9, 0x19, 0x05, 0x18, 0xA8, 0x51, 0x91, 0x9B, 0x98, 0x23, 0xAC, 0x89, 0x43, 0x05,
+    0x8B, 0x02, 0xA1, 0xBF, 0x19, 0xC8, 0x88, 0x70, 0x97, 0x0A, 0x20, 0x02, 0xF8, 0x2A, 0x80, 0xB1,
+    0x0C, 0x42, 0x91, 0xB0, 0x70, 0x81, 0xAA, 0x0A, 0x22, 0xCB, 0x91, 0x72, 0x80, 0x09, 0x11, 0x91,
+    0xAF, 0x00, 0x80, 0x8C, 0x00, 0x65, 0xB0, 0x19, 0x31, 0xB1, 0xAE, 0x21, 0x08, 0xDA, 0x50, 0x11,
+    0xA8, 0x08, 0x05, 0xAA, 0xAB, 0x33, 0xB9, 0x2C, 0x35, 0x94, 0x0C, 0x10, 0x92, 0x9F, 0x08, 0x00,
+    0xC8, 0x18, 0x11, 0x63, 0xA3, 0x2D, 0x89, 0xB3, 0xCA, 0x28, 0x48, 0xC8, 0x61, 0x00, 0xB1, 0x1A,
+    0x92, 0x0C, 0x8D, 0x04, 0x09, 0x00, 0x44, 0x99, 0x9A, 0x38, 0xC0, 0xAA, 0x28, 0xD3, 0x4B, 0x00,
+    0xD3, 0x2A, 0x47, 0x9B, 0xA0, 0x43, 0xAB, 0x1A, 0x30, 0xD5, 0x29, 0x20, 0xB2, 0x0D, 0x02, 0x18,
+    0xAF, 0x13, 0x00, 0xA9, 0x70, 0xA1, 0xC0, 0x20, 0x91, 0x8A, 0x2A, 0xB5, 0x89, 0x28, 0xA3, 0x8F,
+    0x40, 0x86, 0x0B, 0x89, 0x85, 0xBA, 0x10, 0x60, 0xB9, 0x01, 0x23, 0xE0, 0x2A, 0x00, 0xB0, 0x1C,
+    0x12, 0x82, 0x0D, 0x15, 0x90, 0x9C, 0x21, 0xA0, 0xCA, 0x42, 0x88, 0x9A, 0x42, 0xC0, 0xBB, 0x79,
+    0x07, 0x8B, 0x89, 0x86, 0xA9, 0x09, 0x61, 0x99, 0x88, 0x32, 0xD1, 0x0A, 0x48, 0xB0, 0x9A, 0x41,
+    0x83, 0x8C, 0x31, 0x94, 0xDB, 0x18, 0x02, 0xC9, 0x19, 0x23, 0xA0, 0x1C, 0x02, 0xF8, 0x9C, 0x70,
+    0x95, 0x9A, 0x2A, 0x05, 0x9A, 0x8B, 0x15, 0x88, 0x9A, 0x53, 0x98, 0xB9, 0x30, 0x91, 0xCA, 0x4A,
+    0x05, 0x90, 0x09, 0x23, 0xBA, 0xBC, 0x41, 0x81, 0xBB, 0x78, 0x82, 0x89, 0x8A, 0xA2, 0xCA, 0xAE,
+    0x75, 0x91, 0xD1, 0x28, 0x81, 0xA1, 0x1E, 0x00, 0x01, 0x8A, 0x01, 0x31, 0x8B, 0xC8, 0x00, 0x90,
+    0x82, 0x3C, 0x41, 0x13, 0xDB, 0xA9, 0x13, 0x09, 0xAC, 0x13, 0x40, 0xE9, 0x00, 0x20, 0xC8, 0x9C,
+    0x08, 0x03, 0x77, 0x8A, 0xC8, 0x20, 0x21, 0xA2, 0x9C, 0x09, 0x15, 0x89, 0xBA, 0x08, 0x41, 0x92,
+    0x09, 0x18, 0x11, 0xB8, 0x0D, 0x00, 0x90, 0x20, 0x25, 0x83, 0x1D, 0x91, 0xC9, 0xCC, 0x21, 0x32,
+    0xC8, 0x39, 0x02, 0xB1, 0xAF, 0x80, 0x29, 0x08, 0x25, 0x22, 0xC1, 0xB8, 0x3B, 0xD8, 0xB8, 0x1C,
+    0x25, 0x02, 0x0B, 0x11, 0xA5, 0x8D, 0x1A, 0x01, 0x12, 0x88, 0x43, 0x00, 0xD9, 0x2D, 0x99, 0xB9,
+    0x78, 0x12, 0x98, 0x18, 0x03, 0xA9, 0xAF, 0x22, 0x31, 0xEC, 0x10, 0x31, 0xC0, 0x09, 0x10, 0xA1,
+    0x9C, 0x40, 0xA0, 0x0A, 0x20, 0x12, 0xB1, 0x30, 0xA2, 0xD8, 0x8F, 0x82, 0x09, 0xAE, 0x22, 0x39,
+    0xB8, 0x12, 0x98, 0xB2, 0x8A, 0x0F, 0x43, 0x4A, 0x31, 0x15, 0x08, 0xAB, 0xF9, 0x88, 0x09, 0x28,
+    0x0C, 0x13, 0x28, 0xD0, 0x08, 0x22, 0x85, 0x82, 0x15, 0x82, 0xB0, 0xB0, 0xB0, 0xCF, 0x80, 0x89,
+    0xA2, 0x70, 0xA2, 0x3A, 0x9E, 0x01, 0x98, 0x89, 0x42, 0x14, 0x80, 0x80, 0x80, 0xF0, 0xA9, 0x89,
+    0xAA, 0x0B, 0x08, 0x08, 0xD8, 0x03, 0x40, 0x04, 0x48, 0x43, 0x78, 0x80, 0x8B, 0x08, 0x80, 0xCB,
+    0x80, 0x84, 0x0B, 0x08, 0x88, 0x00, 0x88, 0x70, 0x56, 0x08, 0xD0, 0x13, 0x80, 0x80, 0x80, 0x0B,
+    0xC4, 0x8D, 0xA0, 0x08, 0x0B, 0x08, 0x0D, 0x48, 0x02, 0x3C, 0xB3, 0x58, 0xB6, 0x08, 0x2A, 0x80,
+    0xB8, 0xB4, 0x08, 0x08, 0x0E, 0x08, 0x8C, 0x80, 0x50, 0x08, 0x58, 0xC3, 0x83, 0x07, 0x3C, 0x08,
+    0x08, 0x0D, 0x08, 0x2A, 0xA8, 0x08, 0x08, 0x04, 0x08, 0x3D, 0xC0, 0x83, 0x4B, 0x3C, 0x80, 0x80,
+    0x7D, 0x89, 0xB4, 0x80, 0xB4, 0xA8, 0x83, 0x08, 0x3B, 0x4C, 0xB8, 0x03, 0x0C, 0x03, 0xD8, 0x03,
+    0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0xF0, 0x83, 0x3F, 0x80, 0x80, 0x80, 0x08, 0x3F,
+    0x80, 0x08, 0xF0, 0x83, 0x0E, 0x08, 0x84, 0x4B, 0x08, 0x3C, 0x80, 0xE0, 0x80, 0xB4, 0x03, 0x08,
+    0xE8, 0x30, 0x08, 0x80, 0x08, 0x08, 0x3F, 0x80, 0x08, 0x80, 0x08, 0xF0, 0xD3, 0x03, 0x3C, 0x0C,
+    0x48, 0x8B, 0x04, 0x88, 0xB7, 0x80, 0x80, 0x4B, 0x08, 0x08, 0x08, 0xD8, 0x03, 0xC8, 0xC4, 0xB3,
+    0xB3, 0xB4, 0xC3, 0x03, 0x08, 0xD8, 0x78, 0x2B, 0x50, 0x3C, 0x3F, 0x10, 0x2E, 0x3A, 0x0B, 0x20,
+    0x4D, 0xC8, 0xB5, 0x54, 0xF7, 0x48, 0xB1, 0x48, 0x9F, 0x24, 0x9A, 0x0A, 0x02, 0x10, 0xB8, 0x00,
+    0x01, 0x01, 0x9A, 0x01, 0x09, 0x80, 0xCA, 0x12, 0x15, 0xFA, 0x3E, 0x23, 0xD8, 0x9D, 0x25, 0xA8,
+    0x18, 0x89, 0x10, 0x82, 0x99, 0x88, 0x30, 0x89, 0x8A, 0x88, 0x73, 0xD8, 0x00, 0x88, 0x12, 0x9B,
+    0x01, 0x84, 0x8D, 0x14, 0xAA, 0x21, 0x36, 0xFD, 0x18, 0x01, 0x90, 0x08, 0x98, 0x59, 0x81, 0x99,
+    0x81, 0xB9, 0x82, 0x28, 0x29, 0x53, 0xCA, 0x8C, 0x43, 0xB0, 0x91, 0x0E, 0x10, 0x81, 0x88, 0x18,
+    0x3B, 0xC2, 0x91, 0x3C, 0x12, 0xFD, 0x11, 0x14, 0x9B, 0x0A, 0x20, 0x54, 0xE8, 0x18, 0x89, 0x38,
+    0x96, 0x98, 0x2A, 0x40, 0xC0, 0x19, 0x81, 0x20, 0x30, 0xAD, 0x80, 0x01, 0x20, 0xDC, 0x8A, 0x41,
+    0xC1, 0xA8, 0xA9, 0x73, 0x27, 0x02, 0x88, 0xA9, 0x9A, 0x90, 0x00, 0xAB, 0xAD, 0x0A, 0x70, 0x03,
+    0xB0, 0x80, 0xFB, 0x8A, 0x0A, 0x1B, 0xA0, 0xC5, 0x9D, 0x45, 0x72, 0x00, 0xB0, 0xA8, 0x8A, 0x00,
+    0x10, 0x9B, 0xE9, 0x10, 0x60, 0x33, 0x23, 0x99, 0xDD, 0xAA, 0x19, 0x21, 0x82, 0xA8, 0x8C, 0x01,
+    0x15, 0x90, 0xFC, 0xBA, 0x51, 0x51, 0x83, 0xA4, 0x8A, 0x8C, 0x80, 0x11, 0xB8, 0xD0, 0x2A, 0x5A,
+    0x23, 0x05, 0x80, 0x89, 0x89, 0xBA, 0xEB, 0x89, 0x41, 0x33, 0xA1, 0xDB, 0x99, 0x20, 0x8A, 0xAF,
+    0x87, 0x44, 0x19, 0xC8, 0xB1, 0x18, 0x1A, 0x10, 0x1A, 0xE8, 0x93, 0x50, 0x20, 0x82, 0xA8, 0xEB,
+    0x00, 0x59, 0x89, 0xD1, 0x10, 0x49, 0x81, 0xA0, 0xAC, 0xC9, 0x80, 0x7A, 0x03, 0x96, 0x10, 0x0C,
+    0xB8, 0x92, 0x10, 0x80, 0x2B, 0x0C, 0xA2, 0x17, 0x30, 0x89, 0xAA, 0xAC, 0x88, 0x42, 0x21, 0xA0,
+    0xAA, 0x82, 0x14, 0x1C, 0xBF, 0xE8, 0x08, 0x33, 0x73, 0x00, 0xC0, 0xB0, 0x2A, 0x2A, 0x00, 0xC2,
+    0xC1, 0x28, 0x7A, 0x01, 0x83, 0x98, 0xBC, 0x8A, 0x5A, 0x00, 0x95, 0x00, 0x1A, 0x88, 0x90, 0xD9,
+    0xD8, 0x8A, 0x71, 0x51, 0x91, 0xB2, 0x09, 0x0F, 0x88, 0x92, 0xA2, 0xA2, 0x5A, 0x3B, 0x93, 0x06,
+    0x89, 0xB9, 0x0B, 0x2C, 0xA2, 0x86, 0x38, 0x0A, 0xC2, 0x90, 0x8C, 0xAA, 0x4A, 0x15, 0x26, 0x29,
+    0xCA, 0xC1, 0x08, 0x19, 0x18, 0x1A, 0xC9, 0x96, 0x51, 0x39, 0x90, 0xA8, 0xBB, 0x98, 0x6A, 0x2A,
+    0xC3, 0x85, 0x28, 0x8A, 0xAA, 0xCB, 0x88, 0x17, 0x71, 0x08, 0xB0, 0x88, 0x1B, 0x88, 0x01, 0xB8,
+    0xD2, 0x40, 0x7A, 0x01, 0x82, 0x99, 0xBB, 0x0A, 0x1A, 0xB3, 0x86, 0x48, 0x19, 0xB1, 0xC8, 0xAC,
+    0x8A, 0x46, 0x70, 0x80, 0xC0, 0x90, 0x2A, 0x19, 0x08, 0xB8, 0xE3, 0x30, 0x69, 0x11, 0x81, 0xB9,
+    0xC9, 0x2A, 0x3C, 0x90, 0x93, 0x38, 0x20, 0x98, 0xCC, 0xCC, 0x08, 0x27, 0x43, 0x19, 0xCB, 0xC0,
+    0x10, 0x39, 0x19, 0xAB, 0xE0, 0x03, 0x73, 0x10, 0x88, 0xBA, 0xB9, 0x01, 0x58, 0x0A, 0xB0, 0x02,
+    0x23, 0x88, 0xAF, 0x9D, 0x40, 0x53, 0x84, 0x88, 0x8D, 0xA9, 0x82, 0x12, 0x98, 0x0C, 0x2C, 0x02,
+    0x27, 0x10, 0xAA, 0xAB, 0x1B, 0x93, 0x97, 0x09, 0x0B, 0x12, 0x84, 0xC0, 0xBC, 0x0A, 0x27, 0x43,
+    0x08, 0xF9, 0x98, 0x39, 0x28, 0x80, 0xBA, 0xC8, 0x24, 0x72, 0x80, 0xA8, 0x9B, 0x88, 0x24, 0x28,
+    0x9D, 0xB9, 0x33, 0x14, 0xA0, 0xBE, 0x89, 0x62, 0x32, 0x90, 0xF0, 0x0A, 0x29, 0x03, 0xA1, 0xFA,
+    0x88, 0x51, 0x11, 0x91, 0xC9, 0x99, 0x31, 0x51, 0xA9, 0xF9, 0x00, 0x31, 0x11, 0xBA, 0xBC, 0x80,
+    0x72, 0x03, 0x90, 0x8C, 0x1D, 0x02, 0x83, 0xCA, 0x8B, 0x40, 0x52, 0x91, 0xC8, 0x8A, 0x30, 0x43,
+    0xAA, 0xFB, 0x00, 0x41, 0x81, 0xA8, 0x8C, 0x90, 0x12, 0x49, 0x94, 0x20, 0x1E, 0xB0, 0x82, 0x88,
+    0xC9, 0x2B, 0x49, 0x06, 0x82, 0x1B, 0xA9, 0x23, 0x2B, 0xF1, 0x8A, 0x0A, 0x24, 0x22, 0x9C, 0xCB,
+    0x00, 0x1B, 0x8B, 0x77, 0x21, 0x9C, 0xA8, 0x24, 0xA0, 0xBB, 0x1A, 0x34, 0x14, 0x9C, 0x98, 0x73,
+    0x09, 0xC8, 0x19, 0x28, 0x92, 0x9B, 0x1A, 0x17, 0x89, 0xDB, 0x80, 0x70, 0x93, 0x80, 0x0E, 0x82,
+    0x31, 0xAD, 0x88, 0x20, 0x94, 0x3B, 0x9A, 0x27, 0x9A, 0xA0, 0x69, 0xB0, 0x88, 0x1A, 0x15, 0xAA,
+    0xB0, 0x51, 0xA0, 0xCA, 0x55, 0x98, 0xA9, 0x29, 0x24, 0xCB, 0x80, 0x38, 0xB2, 0x0D, 0x14, 0x19,
+    0xC0, 0x49, 0x94, 0xAB, 0x00, 0x02, 0xA8, 0x8C, 0x14, 0x9B, 0x14, 0xC9, 0x51, 0x08, 0x01, 0xCC,
+    0x30, 0x93, 0xAB, 0x01, 0x10, 0x90, 0x16, 0x9E, 0x22, 0x89, 0x08, 0x02, 0x89, 0x93, 0x8D, 0x01,
+    0xB9, 0x8D, 0x63, 0xB8, 0x3A, 0x06, 0x88, 0x8A, 0x01, 0xB9, 0x39, 0xDA, 0x24, 0xAA, 0x31, 0x85,
+    0x0D, 0x94, 0x29, 0x01, 0x89, 0x28, 0xA1, 0xB8, 0x8F, 0xB3, 0x1B, 0x19, 0x92, 0x20, 0x14, 0x5B,
+    0xB0, 0xF1, 0x28, 0x08, 0x90, 0xAA, 0x62, 0x08, 0xB0, 0x29, 0x43, 0x08, 0xB9, 0x36, 0x08, 0xFA,
+    0x49, 0xC0, 0x09, 0x00, 0x10, 0xB9, 0x22, 0x10, 0xB1, 0x0A, 0x13, 0x04, 0xBF, 0x19, 0xB1, 0x3C,
+    0xD1, 0x7C, 0x10, 0x4B, 0x20, 0x7E, 0xF1, 0x30, 0xA1, 0x1F, 0xB4, 0x08, 0x6A, 0xC1, 0x2A, 0x95,
+    0x0D, 0x42, 0xCB, 0x32, 0xB1, 0x1D, 0x94, 0x99, 0x31, 0xC8, 0x2A, 0x85, 0x9B, 0x43, 0xCB, 0x22,
+    0xA8, 0x3A, 0x94, 0x0C, 0x31, 0xD9, 0x30, 0x83, 0x9F, 0x85, 0xA9, 0x40, 0xD0, 0x20, 0x29, 0x1D,
+    0x81, 0x88, 0x08, 0x92, 0x88, 0x3A, 0xF1, 0x48, 0x80, 0x1B, 0x95, 0x2B, 0x93, 0x9A, 0x63, 0xAC,
+    0x14, 0xC9, 0x59, 0xB1, 0x29, 0x11, 0x9D, 0x84, 0x89, 0x38, 0xD0, 0x38, 0x98, 0xC0, 0x84, 0x4C,
+    0xB1, 0x10, 0x58, 0xBA, 0x85, 0x80, 0x2B, 0xC4, 0x39, 0x18, 0x9C, 0x05, 0x8A, 0x10, 0xB0, 0x29,
+    0xE1, 0x81, 0xA3, 0x1B, 0x10, 0x8D, 0x27, 0x1D, 0x92, 0xB1, 0x41, 0xAA, 0x93, 0x28, 0x1F, 0xB2,
+    0x02, 0x4D, 0xC0, 0x82, 0x39, 0x9A, 0xD2, 0x28, 0x2A, 0xC9, 0x03, 0x6D, 0xE2, 0x32, 0x09, 0x1B,
+    0xB5, 0x5B, 0x98, 0xA8, 0x04, 0x2D, 0xA3, 0x88, 0x31, 0xBB, 0x04, 0xAB, 0x3A, 0xA9, 0x8B, 0xB6,
+    0x4A, 0x07, 0x5D, 0xA1, 0x89, 0x13, 0x8F, 0x94, 0x8A, 0x40, 0xBB, 0x17, 0x0C, 0x03, 0xAA, 0x32,
+    0xAD, 0x01, 0x99, 0x39, 0xD9, 0x51, 0xC6, 0x69, 0xA9, 0x81, 0x82, 0x1F, 0xD3, 0x08, 0x21, 0x8C,
+    0x97, 0x3C, 0x91, 0xB8, 0x14, 0x0E, 0xA1, 0x08, 0x00, 0xAA, 0x57, 0x9C, 0x86, 0x8A, 0x59, 0xD9,
+    0x22, 0x0C, 0x29, 0xC2, 0x41, 0x89, 0x00, 0xB2, 0x5B, 0xC8, 0x80, 0x89, 0x19, 0x90, 0x79, 0xB6,
+    0x58, 0x89, 0x8A, 0xA5, 0x2C, 0xD3, 0x08, 0x11, 0x2B, 0x96, 0x19, 0x92, 0x0B, 0x82, 0x8D, 0xB1,
+    0x0A, 0x02, 0x9C, 0x67, 0x8C, 0x85, 0x8A, 0x30, 0xFB, 0x23, 0x0E, 0x81, 0xC2, 0x51, 0x99, 0x12,
+    0x9A, 0x28, 0xF0, 0x10, 0xAA, 0x11, 0xA0, 0x29, 0x27, 0x3F, 0xC3, 0x18, 0x18, 0x9C, 0xA6, 0x3C,
+    0x80, 0x98, 0x14, 0x1C, 0xA3, 0x88, 0x28, 0xDB, 0x95, 0x1A, 0x08, 0xB0, 0x12, 0x73, 0x0E, 0xB5,
+    0x08, 0x38, 0xDB, 0x23, 0x0E, 0xA3, 0xB2, 0x61, 0x8B, 0x03, 0x1B, 0x08, 0xD8, 0x31, 0x8D, 0x82,
+    0x88, 0x39, 0x49, 0xF6, 0x32, 0x2D, 0x98, 0xB3, 0x4C, 0xC0, 0x82, 0x38, 0x1D, 0xB3, 0x20, 0x88,
+    0x98, 0x82, 0x1E, 0xA1, 0x88, 0x01, 0xA9, 0x21, 0x7A, 0xF2, 0x95, 0x4B, 0x2B, 0xF3, 0x40, 0x9B,
+    0xB3, 0x84, 0x4D, 0xB0, 0x02, 0x28, 0x9A, 0x94, 0x1A, 0x0A, 0xF2, 0x20, 0x8A, 0x90, 0x46, 0x8E,
+    0x95, 0x09, 0x59, 0xC8, 0x21, 0x89, 0x9A, 0x97, 0x3C, 0x08, 0xB1, 0x41, 0x9A, 0x92, 0x81, 0x2E,
+    0xA2, 0x80, 0x28, 0xBB, 0x62, 0xB8, 0x6B, 0x80, 0x09, 0x83, 0xA8, 0x31, 0x98, 0x2F, 0x90, 0xD1,
+    0x31, 0x9A, 0x81, 0x01, 0x2B, 0xA6, 0x18, 0x20, 0x0E, 0xB1, 0x91, 0x5B, 0xAA, 0xA4, 0x40, 0x1B,
+    0xC4, 0x12, 0x39, 0xAA, 0xA5, 0x19, 0x88, 0x19, 0x09, 0x91, 0x09, 0x83, 0x5A, 0x2A, 0xC1, 0x83,
+    0xCB, 0x80, 0x1C, 0x9A, 0xD3, 0x1A, 0x06, 0x1A, 0x16, 0x88, 0x20, 0x98, 0x90, 0x00, 0xAB, 0x95,
+    0x1B, 0x98, 0xF2, 0x6A, 0x9A, 0x13, 0x18, 0x28, 0xA0, 0x38, 0xAE, 0xA1, 0xB9, 0x9A, 0x98, 0x71,
+    0x81, 0x16, 0x10, 0x29, 0x91, 0x1C, 0x18, 0xE9, 0x19, 0x81, 0x21, 0xB4, 0xAD, 0x85, 0x09, 0x90,
+    0x19, 0xD8, 0x78, 0xE4, 0x39, 0xA0, 0x4A, 0xC2, 0x09, 0x82, 0x19, 0x92, 0x1A, 0x03, 0x28, 0xC1,
+    0x3A, 0x08, 0x80, 0xA0, 0x9F, 0x11, 0x24, 0xCB, 0x41, 0x81, 0x11, 0xE8, 0x08, 0xBC, 0x9B, 0x73,
+    0xF8, 0x18, 0x92, 0x3A, 0x95, 0x29, 0x84, 0x18, 0xB0, 0x0A, 0xA2, 0x99, 0xC8, 0x0B, 0x53, 0x89,
+    0x19, 0x7A, 0x09, 0x38, 0xB0, 0x2B, 0x05, 0x9E, 0x02, 0x38, 0x8C, 0x07, 0xF7, 0x48, 0x1A, 0x09,
+    0x08, 0x2A, 0x98, 0x01, 0xA3, 0x2E, 0xA1, 0x92, 0x02, 0x2B, 0xC1, 0x93, 0xE2, 0x90, 0x95, 0x29,
+    0x3D, 0x0B, 0x7A, 0x1A, 0x88, 0x48, 0xA9, 0xB5, 0xB4, 0xD5, 0xA3, 0x30, 0x9A, 0x7B, 0x8C, 0x31,
+    0xAA, 0x51, 0xBA, 0x13, 0xE3, 0x28, 0xC2, 0x39, 0x18, 0x9B, 0x33, 0x8F, 0x02, 0x99, 0x30, 0xC9,
+    0x31, 0xA9, 0x38, 0xD2, 0x5A, 0x90, 0x0A, 0x96, 0x0A, 0x83, 0xD1, 0x78, 0x9A, 0x38, 0xB0, 0x6C,
+    0xB1, 0x00, 0x01, 0x8B, 0x96, 0x1A, 0x18, 0xC9, 0x31, 0x0D, 0x69, 0xD1, 0x30, 0xA8, 0x10, 0xC3,
+    0x4B, 0xB1, 0x19, 0x01, 0x1E, 0xA3, 0x29, 0x10, 0xC8, 0x14, 0x8C, 0x81, 0xB0, 0x50, 0x99, 0x21,
+    0xD1, 0x30, 0xF8, 0x19, 0x30, 0x0D, 0xA3, 0x10, 0x48, 0xC8, 0x03, 0x0B, 0x89, 0xF2, 0x20, 0x0B,
+    0x83, 0x82, 0x79, 0x99, 0x82, 0x8A, 0x0A, 0xD0, 0x20, 0x19, 0x00, 0x96, 0x20, 0x98, 0x91, 0x09,
+    0x0E, 0xA0, 0x20, 0x1A, 0x92, 0x86, 0x39, 0xA8, 0xA1, 0xA8, 0x8C, 0x92, 0x3A, 0x07, 0x2A, 0x05,
+    0x1C, 0xC2, 0x89, 0x80, 0x8C, 0x01, 0x81, 0x62, 0x90, 0x14, 0x89, 0x00, 0xFB, 0x18, 0x9D, 0xC8,
+    0x7F, 0xE2, 0x22, 0x8A, 0x10, 0xE2, 0x48, 0xAA, 0x02, 0x88, 0x6A, 0xB8, 0x13, 0x0A, 0x18, 0xD0,
+    0x21, 0x9B, 0x02, 0x98, 0x60, 0xA9, 0x04, 0x0A, 0x18, 0xC9, 0x22, 0x8D, 0x82, 0x08, 0x22, 0x8B,
+    0xA6, 0x19, 0x98, 0x0A, 0xA2, 0x19, 0x33, 0x2D, 0x94, 0x89, 0x82, 0x9D, 0xA3, 0x5B, 0x98, 0x01,
+    0xA5, 0x7B, 0xB8, 0x10, 0x90, 0x89, 0x94, 0x4A, 0x91, 0x80, 0x00, 0xB8, 0x89, 0x2A, 0xBA, 0x27,
+    0x6C, 0xA0, 0x83, 0x19, 0xAB, 0xC3, 0x89, 0x38, 0x88, 0x04, 0x13, 0x18, 0xB9, 0xBB, 0xD9, 0x8A,
+    0x01, 0x63, 0x42, 0x01, 0x93, 0x0D, 0xF9, 0x99, 0x98, 0x11, 0x12, 0x34, 0x21, 0x90, 0xC9, 0xAC,
+    0xBA, 0x89, 0x42, 0x21, 0x54, 0x81, 0x82, 0xC9, 0xBB, 0xAA, 0x80, 0x3A, 0x43, 0x72, 0x01, 0xA2,
+    0xD8, 0xA0, 0x0A, 0x38, 0x7B, 0x79, 0x19, 0x08, 0x00, 0x8A, 0xEB, 0x32, 0x74, 0xF3, 0x93, 0xDA,
+    0xC1, 0xD1, 0xF8, 0x56, 0x2E, 0xB3, 0x29, 0x18, 0x9C, 0x96, 0x3B, 0x80, 0x90, 0x84, 0x2D, 0xC2,
+    0x10, 0x09, 0x1A, 0xC3, 0x48, 0x89, 0x00, 0x91, 0x3A, 0xC9, 0x02, 0x19, 0x08, 0xA4, 0x30, 0x2A,
+    0xB0, 0xA0, 0x1F, 0x99, 0x80, 0x48, 0x1D, 0xB2, 0x3F, 0xA7, 0x7B, 0xA8, 0x10, 0x90, 0x5B, 0xC1,
+    0x20, 0x08, 0x1A, 0xD4, 0x38, 0xA9, 0x01, 0x90, 0x59, 0x90, 0x80, 0x18, 0x1C, 0xB0, 0xA2, 0x5B,
+    0xC0, 0x00, 0x7C, 0xD5, 0x31, 0x8B, 0x88, 0xC4, 0x59, 0x99, 0x02, 0x80, 0x5B, 0xC8, 0x21, 0x8A,
+    0x18, 0xC2, 0x40, 0x89, 0x00, 0xC0, 0x19, 0xC9, 0xC1, 0x10, 0x47, 0x2C, 0x81, 0x9B, 0x11, 0x8E,
+    0x83, 0x09, 0x23, 0x9A, 0x96, 0x0A, 0x08, 0xC9, 0x23, 0x0C, 0x84, 0x88, 0x21, 0x9F, 0x82, 0x9D,
+    0x10, 0x68, 0xA3, 0x10, 0xB8, 0x8A, 0xE3, 0x39, 0xA1, 0x30, 0x95, 0x2A, 0xC0, 0x09, 0x92, 0x2F,
+    0xA2, 0x20, 0x11, 0x0D, 0xB5, 0x1A, 0xAA, 0x99, 0xA3, 0x5A, 0x37, 0x1C, 0x92, 0xAB, 0x32, 0x9F,
+    0x03, 0x98, 0x52, 0xB9, 0x12, 0xAA, 0x28, 0xF0, 0x30, 0x10, 0xC8, 0x05, 0x0C, 0x00, 0xC9, 0x31,
+    0x8D, 0x81, 0x81, 0x17, 0x0C, 0x92, 0x9A, 0x60, 0x9B, 0x03, 0x99, 0x42, 0xB9, 0x20, 0xC8, 0x39,
+    0xB2, 0x4C, 0x83, 0x9A, 0x14, 0x9C, 0x02, 0xCC, 0x31, 0xCA, 0x10, 0xC1, 0x71, 0x98, 0x94, 0x98,
+    0x6B, 0xD1, 0x11, 0x28, 0x0C, 0xA5, 0x09, 0x59, 0xC9, 0x22, 0x09, 0x0A, 0xA6, 0x19, 0x39, 0xC9,
+    0x02, 0x09, 0x1A, 0xF3, 0x21, 0x8C, 0x33, 0xE8, 0x48, 0xA0, 0x1A, 0x84, 0x8B, 0x22, 0xBA, 0x40,
+    0xB2, 0x0C, 0x24, 0xBC, 0x43, 0xC0, 0x29, 0x91, 0x8B, 0x15, 0xA9, 0x28, 0xB1, 0x0C, 0x92, 0xAE,
+    0x78, 0xA4, 0x1B, 0x22, 0xBA, 0x42, 0x88, 0x9A, 0x21, 0x81, 0x8D, 0x86, 0x8A, 0x21, 0x98, 0x98,
+    0x28, 0xCA, 0x51, 0xB2, 0x3B, 0xA2, 0xB9, 0x99, 0x0B, 0xCC, 0x9C, 0x77, 0xC8, 0x28, 0x93, 0x8B,
+    0x15, 0x88, 0x0A, 0x13, 0xB9, 0x4B, 0x94, 0x8B, 0x02, 0xAA, 0x15, 0x9C, 0x12, 0xA8, 0x31, 0x88,
+    0xAC, 0x82, 0xBC, 0x09, 0xFA, 0x0B, 0x56, 0xDB, 0x32, 0x90, 0x19, 0x86, 0x08, 0x88, 0x83, 0xAA,
+    0x59, 0xC1, 0x18, 0x08, 0x98, 0x88, 0x22, 0xAD, 0x42, 0xA1, 0x19, 0x13, 0xF9, 0x3B, 0xE8, 0x0A,
+    0xA0, 0x3C, 0x97, 0x1C, 0x13, 0x9A, 0x43, 0x88, 0x91, 0x40, 0xB8, 0x8A, 0x05, 0x0B, 0xA2, 0x1A,
+    0x88, 0x9D, 0x25, 0xAB, 0x41, 0xA1, 0x2A, 0x25, 0xF9, 0x2A, 0xA0, 0x8C, 0xB1, 0x5E, 0xD2, 0x28,
+    0x01, 0x0A, 0x04, 0x29, 0x98, 0x04, 0x0A, 0x0C, 0xA4, 0x29, 0x99, 0x81, 0xA8, 0x2A, 0x80, 0xB4,
+    0x7A, 0x81, 0x8A, 0x27, 0x9B, 0x0A, 0xB1, 0xBB, 0x9C, 0x78, 0xF1, 0x20, 0x80, 0x08, 0x33, 0x08,
+    0x80, 0x85, 0x8A, 0x8A, 0xA4, 0x39, 0x9C, 0x92, 0xB0, 0x3C, 0x91, 0xB4, 0x79, 0xA2, 0x1A, 0x17,
+    0xAB, 0x09, 0xC1, 0xAB, 0xB8, 0x74, 0xAC, 0x13, 0x91, 0x49, 0x83, 0x01, 0x4A, 0x92, 0xCA, 0x49,
+    0x98, 0x81, 0x1B, 0x90, 0xBA, 0x11, 0x38, 0xAB, 0x57, 0x90, 0x5A, 0x83, 0xDB, 0x3A, 0xEA, 0x99,
+    0x2A, 0xB7, 0x3C, 0x21, 0xA9, 0x43, 0x10, 0x90, 0x42, 0x99, 0xDA, 0x22, 0x1B, 0xC1, 0x80, 0x08,
+    0xAC, 0x05, 0xA9, 0x60, 0x91, 0x88, 0x42, 0xB9, 0x9B, 0xA1, 0xBF, 0x08, 0x07, 0x0F, 0x82, 0x80,
+    0x38, 0x81, 0x10, 0x49, 0xA0, 0xB8, 0x50, 0x9A, 0x92, 0x0A, 0x28, 0xEB, 0x13, 0x1B, 0x09, 0x15,
+    0x90, 0x49, 0xC3, 0xBA, 0x88, 0xCD, 0x9A, 0x72, 0xCB, 0x03, 0x12, 0x3B, 0x86, 0x20, 0x09, 0x94,
+    0xA0, 0x1C, 0x91, 0x82, 0x1C, 0x89, 0xC0, 0x19, 0x08, 0xA0, 0x44, 0x21, 0x1A, 0x03, 0xFB, 0x0C,
+    0xBA, 0xFA, 0x68, 0xD0, 0x10, 0x10, 0x09, 0x14, 0x18, 0x90, 0x13, 0x89, 0x8C, 0x92, 0x10, 0x9B,
+    0xB0, 0xC1, 0x1D, 0x98, 0x80, 0x71, 0x20, 0x90, 0x21, 0x9D, 0xA9, 0xC9, 0xAC, 0x78, 0xE0, 0x29,
+    0x10, 0x80, 0x33, 0x30, 0x99, 0x41, 0x22, 0xAE, 0x95, 0x29, 0xAA, 0x89, 0x87, 0x8D, 0x04, 0x9A,
+    0x28, 0x09, 0x07, 0x0D, 0x80, 0xCB, 0x83, 0x8D, 0x71, 0xC4, 0x08, 0x23, 0xAC, 0x21, 0x91, 0x8F,
+    0x12, 0xA8, 0x5B, 0x82, 0x99, 0x70, 0xB8, 0x88, 0x33, 0x9E, 0x00, 0x93, 0x2C, 0x02, 0xD8, 0x39,
+    0xA8, 0x8C, 0x01, 0x37, 0x9C, 0x12, 0xA2, 0x2F, 0x82, 0xBA, 0x69, 0xA0, 0x98, 0x34, 0xAA, 0x11,
+    0x93, 0x8F, 0x82, 0xB0, 0x49, 0x91, 0x89, 0x44, 0xAA, 0x99, 0x93, 0x9F, 0x80, 0x71, 0xB3, 0x2A,
+    0x22, 0xFA, 0x20, 0x98, 0xAB, 0x05, 0x09, 0x39, 0x95, 0x19, 0x28, 0xD0, 0x09, 0x20, 0xEA, 0x20,
+    0x01, 0x09, 0x23, 0xB9, 0x0F, 0xB1, 0x9A, 0x39, 0x67, 0x9B, 0x21, 0xA3, 0x8D, 0x12, 0xD8, 0x2A,
+    0x11, 0xC8, 0x40, 0x01, 0xB8, 0x41, 0x98, 0xCA, 0x22, 0xB9, 0x9A, 0x27, 0x09, 0x88, 0x91, 0x98,
+    0x9B, 0xA1, 0x9C, 0x77, 0x0A, 0x1A, 0x85, 0x09, 0x99, 0x95, 0x0A, 0x1B, 0x84, 0x98, 0x29, 0x87,
+    0x89, 0x09, 0x82, 0x98, 0x8C, 0x02, 0x92, 0x29, 0x13, 0xC8, 0x2D, 0x94, 0xB8, 0x19, 0xA0, 0x79,
+    0xA8, 0xE1, 0x30, 0x01, 0xB8, 0x50, 0x00, 0x90, 0x29, 0x11, 0xC0, 0x1B, 0x88, 0xF0, 0x08, 0x29,
+    0x82, 0x10, 0x19, 0x80, 0x24, 0xBA, 0x9B, 0x16, 0xAB, 0x63, 0x90, 0xCB, 0x98, 0x80, 0xDD, 0x08,
+    0x10, 0x23, 0x43, 0x30, 0x13, 0x88, 0x9D, 0x99, 0xA0, 0x10, 0x38, 0x04, 0xB1, 0x0B, 0xCC, 0x8A,
+    0xAD, 0xBA, 0x80, 0x73, 0x83, 0x68, 0x15, 0x88, 0x10, 0xF9, 0xBA, 0x88, 0x01, 0xC9, 0x1A, 0x34,
+    0x80, 0x18, 0x03, 0x12, 0x24, 0x1B, 0x6A, 0x23, 0x81, 0xB9, 0x02, 0xCF, 0xD8, 0x89, 0x2A, 0xC1,
+    0x10, 0x31, 0x05, 0x11, 0x90, 0x8A, 0x75, 0xC2, 0x0E, 0x81, 0x8A, 0x80, 0x9A, 0x00, 0xA2, 0x00,
+    0x08, 0x27, 0x11, 0x90, 0x19, 0x31, 0x31, 0xD1, 0x0A, 0x24, 0xA8, 0xAC, 0x9F, 0x00, 0xBA, 0x08,
+    0x10, 0x03, 0x52, 0xC1, 0x52, 0x60, 0x92, 0x8E, 0x02, 0x9B, 0x04, 0xAC, 0x08, 0x88, 0x90, 0x8E,
+    0x00, 0x20, 0x12, 0x08, 0x54, 0x11, 0x50, 0xD3, 0x0B, 0x81, 0x59, 0xC1, 0x0C, 0x90, 0x2A, 0xC2,
+    0x8A, 0x04, 0x08, 0x92, 0x1A, 0x17, 0x81, 0x69, 0xB1, 0x2B, 0x92, 0x8A, 0xC3, 0x9E, 0x90, 0x80,
+    0xA9, 0x0B, 0x13, 0x2D, 0x13, 0x68, 0x13, 0x41, 0x92, 0x29, 0x91, 0x48, 0xB9, 0xA6, 0xAF, 0x98,
+    0x49, 0xC2, 0x0C, 0x02, 0x99, 0x04, 0x09, 0x34, 0x10, 0x81, 0x0B, 0x41, 0x2A, 0xFA, 0x19, 0xF0,
+    0x88, 0x89, 0x00, 0xBA, 0x91, 0x00, 0x67, 0xBA, 0x41, 0x08, 0x32, 0xA0, 0x20, 0x88, 0xD0, 0x8D,
+    0x03, 0xB8, 0x21, 0xBE, 0x3A, 0x11, 0x99, 0x21, 0x51, 0xA1, 0x22, 0x90, 0x72, 0xA1, 0x0A, 0xA9,
+    0x80, 0xD8, 0x9F, 0xAA, 0x67, 0xAC, 0x31, 0x99, 0x48, 0xA8, 0x29, 0x09, 0x24, 0xA9, 0x82, 0xA0,
+    0x06, 0xB9, 0x01, 0x3B, 0x22, 0xAF, 0x18, 0x18, 0x03, 0x0B, 0x98, 0x10, 0x07, 0x09, 0x1A, 0xE8,
+    0x53, 0xD9, 0x18, 0xB0, 0x31, 0xBA, 0x11, 0x06, 0xE9, 0x20, 0xAB, 0x78, 0x10, 0x29, 0xAB, 0x5D,
+    0x50, 0xF7, 0x29, 0x01, 0x5A, 0xF8, 0x11, 0x90, 0x00, 0x91, 0x19, 0x09, 0x44, 0xAE, 0x52, 0xCA,
+    0x31, 0xC1, 0x19, 0x92, 0x08, 0x12, 0x9F, 0x04, 0x98, 0x0A, 0x83, 0xA8, 0x30, 0xA8, 0x30, 0x8E,
+    0x50, 0xA1, 0xAA, 0x15, 0x99, 0x08, 0x60, 0xB0, 0x8C, 0x05, 0xAA, 0x32, 0xA1, 0x1D, 0x01, 0x88,
+    0x0A, 0x94, 0xAA, 0x14, 0x9E, 0x30, 0xCA, 0x79, 0xA4, 0xA8, 0x31, 0xB1, 0x2A, 0x49, 0xC8, 0x09,
+    0x02, 0xC0, 0x3A, 0x85, 0x8A, 0x70, 0xA2, 0x9B, 0x31, 0xD0, 0x29, 0x02, 0xAE, 0x30, 0xA1, 0x9A,
+    0x02, 0xFA, 0x88, 0x57, 0xBB, 0x12, 0x02, 0xEB, 0x23, 0x89, 0x8C, 0x23, 0xBA, 0xA2, 0x15, 0xAA,
+    0x22, 0x28, 0x3B, 0x81, 0xCF, 0x11, 0xA2, 0x98, 0x14, 0xCC, 0x59, 0x81, 0xAC, 0x00, 0x79, 0xD5,
+    0x38, 0x38, 0xD9, 0x58, 0x99, 0xD0, 0x22, 0xB9, 0x20, 0x41, 0x9B, 0x32, 0x98, 0xBB, 0x37, 0xAD,
+    0x18, 0x94, 0x1D, 0x12, 0xD0, 0x29, 0x92, 0xAB, 0x28, 0x78, 0xE2, 0x22, 0x20, 0xAD, 0x42, 0x8B,
+    0x9A, 0x96, 0x9A, 0x14, 0x80, 0x3B, 0x84, 0x9B, 0x11, 0xA2, 0x9F, 0x21, 0xB8, 0x40, 0x02, 0xBB,
+    0x40, 0xAA, 0xAA, 0xB9, 0x77, 0xD0, 0x84, 0x21, 0x9E, 0x04, 0x0B, 0x2B, 0xB5, 0x1A, 0x84, 0x90,
+    0x68, 0xA0, 0x09, 0x20, 0xBA, 0x90, 0x10, 0x89, 0x86, 0x20, 0xA9, 0xC0, 0x49, 0xCB, 0x9A, 0x77,
+    0xBB, 0x86, 0x00, 0x0D, 0x94, 0x1C, 0x29, 0xE2, 0x38, 0x92, 0x98, 0x52, 0xB9, 0x00, 0x81, 0x0D,
+    0xA2, 0x1A, 0x30, 0xC2, 0x51, 0xB8, 0xA9, 0x30, 0xCD, 0x88, 0x57, 0x9D, 0x86, 0x80, 0x2E, 0xB4,
+    0x1B, 0x38, 0xF0, 0x30, 0x91, 0x09, 0x33, 0xDB, 0x11, 0x98, 0x1C, 0xA3, 0x1C, 0x41, 0xB8, 0x52,
+    0xB8, 0xA9, 0x12, 0xAF, 0x91, 0x74, 0xAB, 0x97, 0x00, 0x1E, 0xB5, 0x2B, 0x29, 0xE1, 0x20, 0x81,
+    0x98, 0x42, 0xBA, 0x10, 0x90, 0x1E, 0xA3, 0x89, 0x40, 0xC2, 0x48, 0x88, 0xBA, 0x38, 0xCA, 0x9A,
+    0x74, 0xF3, 0x22, 0x28, 0xAD, 0x14, 0x0D, 0x89, 0xA5, 0x09, 0x03, 0x91, 0x49, 0x90, 0x9A, 0x10,
+    0xEA, 0x12, 0x19, 0x99, 0x07, 0x19, 0xA1, 0xA0, 0x0D, 0xA8, 0xB8, 0x88, 0x77, 0x9A, 0x13, 0xB2,
+    0x0D, 0x03, 0xAB, 0x6B, 0x80, 0x98, 0x42, 0xA0, 0x80, 0x30, 0xBD, 0x01, 0x28, 0xCA, 0x24, 0x00,
+    0x1D, 0x04, 0xB9, 0x2B, 0xB1, 0xDA, 0x38, 0xAA, 0x77, 0x2B, 0x29, 0xD3, 0x09, 0x08, 0xE4, 0x39,
+    0x39, 0xD1, 0x20, 0x20, 0xD8, 0x10, 0x08, 0xCA, 0x31, 0x80, 0x99, 0x24, 0x09, 0x8A, 0x94, 0xBA,
+    0x8D, 0x92, 0xC8, 0x1B, 0x77, 0x09, 0x1B, 0x96, 0xA9, 0x19, 0xA5, 0x0A, 0x6B, 0x91, 0xB1, 0x58,
+    0xA1, 0xC0, 0x48, 0x89, 0xA8, 0x22, 0x00, 0xAA, 0x32, 0x12, 0x9F, 0x90, 0x90, 0x0B, 0x88, 0xE0,
+    0x75, 0x08, 0xE8, 0x85, 0x80, 0x9C, 0x12, 0x39, 0x0F, 0x81, 0x95, 0x0A, 0x81, 0x94, 0x1B, 0x1C,
+    0x92, 0xA1, 0x4B, 0x11, 0xD2, 0x28, 0x18, 0xD0, 0x99, 0x5A, 0x98, 0xB9, 0x78, 0x97, 0xC1, 0x5B,
+    0x39, 0xC0, 0x0A, 0x28, 0xD4, 0xA1, 0x58, 0x18, 0xA8, 0x28, 0x49, 0xD8, 0xA0, 0x31, 0x08, 0xD8,
+    0x21, 0x58, 0x9A, 0x90, 0x20, 0x9B, 0xC8, 0xA3, 0x89, 0x7D, 0x85, 0xB1, 0x3B, 0x7B, 0x90, 0xA9,
+    0x19, 0xA2, 0xC6, 0x00, 0x38, 0x00, 0x89, 0x4B, 0x2A, 0xB8, 0x90, 0x11, 0xF3, 0xB4, 0x12, 0x4A,
+    0x1A, 0x8A, 0x8B, 0x00, 0xD0, 0xE8, 0x90, 0x66, 0x18, 0x9C, 0xA1, 0x05, 0x90, 0xBA, 0x28, 0x79,
+    0x09, 0x99, 0x01, 0x04, 0xC1, 0xA0, 0x10, 0x29, 0x2A, 0x1E, 0x29, 0x01, 0x92, 0x98, 0xC3, 0xD3,
+    0x99, 0x29, 0x0A, 0x9D, 0x8B, 0x75, 0x23, 0xDA, 0xC2, 0x03, 0x81, 0xAA, 0x0B, 0x7B, 0x28, 0xA8,
+    0x90, 0x05, 0x82, 0xD8, 0x88, 0x48, 0x29, 0x8C, 0x19, 0x22, 0x82, 0xD0, 0xC2, 0x82, 0x1A, 0x0E,
+    0x19, 0x89, 0xA0, 0x89, 0x67, 0x01, 0x2C, 0x2D, 0x00, 0xB2, 0xD0, 0xA0, 0x03, 0x21, 0x1C, 0x3C,
+    0x48, 0x00, 0xBA, 0xC0, 0x84, 0x92, 0x98, 0x3A, 0x79, 0x28, 0x8A, 0x98, 0xC1, 0xC2, 0xA0, 0x38,
+    0x2C, 0x8A, 0xD1, 0x73, 0x40, 0xAA, 0xE2, 0x93, 0x02, 0x8A, 0x0B, 0x7B, 0x39, 0x99, 0xB0, 0x84,
+    0x83, 0xA0, 0x9A, 0x49, 0x39, 0x09, 0x2A, 0x58, 0x18, 0xD1, 0xC2, 0x00, 0x0A, 0x1D, 0x89, 0x80,
+    0x01, 0xB8, 0xC9, 0x7D, 0x96, 0xB3, 0x29, 0x3F, 0x18, 0x90, 0xB8, 0x90, 0x94, 0x92, 0x1A, 0x3C,
+    0x11, 0xA2, 0x9A, 0x28, 0x21, 0x09, 0xB9, 0x86, 0xC3, 0x80, 0x2D, 0x10, 0xC1, 0x18, 0xEB, 0x21,
+    0x93, 0x0D, 0x9A, 0x0A, 0xDA, 0x47, 0x3A, 0xC9, 0xB6, 0x22, 0x4A, 0x9B, 0xA1, 0x40, 0x1B, 0xD8,
+    0x01, 0x49, 0x98, 0xC2, 0x11, 0x39, 0x99, 0xA1, 0x79, 0x09, 0xC2, 0x91, 0x28, 0x10, 0xB8, 0x82,
+    0x0E, 0xE3, 0x01, 0x3A, 0x9A, 0x09, 0x92, 0x1A, 0xB0, 0x74, 0x88, 0xC1, 0x21, 0x21, 0x81, 0xBA,
+    0x49, 0x88, 0xC1, 0x8A, 0x4B, 0x9A, 0x12, 0x90, 0x98, 0x92, 0x79, 0x39, 0xD8, 0x05, 0x29, 0x80,
+    0xB2, 0x21, 0x1D, 0x00, 0xA1, 0x58, 0x09, 0xA0, 0xBB, 0x9F, 0x00, 0x88, 0xBA, 0x2B, 0xB5, 0x06,
+    0x20, 0x0A, 0x80, 0x14, 0x1A, 0x9E, 0x95, 0x11, 0x81, 0x88, 0x92, 0xD0, 0x08, 0x1E, 0xA8, 0x93,
+    0x82, 0x2C, 0x98, 0x33, 0x8C, 0x90, 0x92, 0x07, 0x18, 0x08, 0x10, 0x92, 0x89, 0x94, 0xE8, 0x0F,
+    0x83, 0x1E, 0x15, 0xCB, 0x01, 0x08, 0x22, 0xD9, 0x08, 0x89, 0x42, 0x2A, 0xA4, 0x8E, 0x11, 0x9A,
+    0x80, 0x98, 0x12, 0xB1, 0x88, 0x83, 0x47, 0x91, 0x89, 0x0A, 0xA8, 0x21, 0xF3, 0x2C, 0x38, 0x89,
+    0x4F, 0x79, 0x5D, 0xF4, 0x39, 0xA1, 0x09, 0x92, 0x1A, 0x81, 0x08, 0x18, 0x19, 0xC2, 0x81, 0x80,
+    0x7B, 0x90, 0x49, 0xB6, 0x8F, 0x22, 0x90, 0x2E, 0xA3, 0x8B, 0x22, 0xD1, 0x29, 0x82, 0x8B, 0x03,
+    0x49, 0x0B, 0x7A, 0x89, 0xA8, 0x03, 0xA0, 0x0B, 0x87, 0x28, 0x1F, 0xD3, 0x19, 0x21, 0xBB, 0x05,
+    0x2A, 0x98, 0xC1, 0x16, 0x9C, 0x22, 0xAA, 0x4A, 0x92, 0xA9, 0x51, 0xD0, 0x28, 0x90, 0x9B, 0x87,
+    0x89, 0x50, 0xA1, 0x1A, 0x12, 0xDA, 0x20, 0x91, 0x0E, 0x83, 0x89, 0x20, 0xB2, 0x1A, 0x33, 0xC9,
+    0x28, 0x88, 0x2C, 0x2A, 0x03, 0x08, 0x1B, 0xF2, 0x0D, 0x95, 0xAB, 0x25, 0xEC, 0x11, 0x98, 0x0B,
+    0xD1, 0x75, 0x9A, 0x01, 0x83, 0x0F, 0xA4, 0xB0, 0x68, 0xB8, 0x81, 0x23, 0x8F, 0x83, 0xA0, 0x4B,
+    0xB2, 0x09, 0x40, 0xC8, 0x31, 0x88, 0x0B, 0x06, 0x9B, 0x20, 0xE1, 0x48, 0x90, 0x99, 0x04, 0xAB,
+    0x31, 0xE1, 0x39, 0xA1, 0x9A, 0x03, 0x9B, 0xA3, 0xCC, 0x77, 0x8B, 0x03, 0x99, 0x4D, 0xC2, 0x19,
+    0x11, 0xBA, 0x25, 0x9A, 0x18, 0xB3, 0x2E, 0x92, 0x8A, 0x32, 0xD9, 0x32, 0xB9, 0x28, 0x94, 0x1F,
+    0x83, 0x8B, 0x42, 0xE9, 0x30, 0xC8, 0x20, 0xA1, 0x1B, 0x96, 0x1B, 0x83, 0xBA, 0x33, 0xDC, 0x41,
+    0x99, 0x09, 0x70, 0xC3, 0x5B, 0xB0, 0x09, 0x22, 0xAC, 0x15, 0x8B, 0x12, 0xB8, 0x49, 0xD1, 0x39,
+    0xA1, 0x1A, 0x04, 0x0C, 0x03, 0x9B, 0x31, 0xD8, 0x21, 0xA8, 0x38, 0xB0, 0x70, 0xE8, 0x30, 0xA9,
+    0x11, 0x90, 0x28, 0xC2, 0x3A, 0xB0, 0x09, 0x21, 0xBB, 0x16, 0x8C, 0xB2, 0xA9, 0x9B, 0x19, 0xEF,
+    0x77, 0x9B, 0x04, 0x9B, 0x31, 0xBA, 0x42, 0xC9, 0x31, 0xB8, 0x20, 0xA9, 0x28, 0xC1, 0x39, 0xB3,
+    0x3A, 0xA6, 0x2A, 0xB2, 0x2B, 0x85, 0x8C, 0x14, 0x0C, 0x83, 0x8B, 0x82, 0x4B, 0xD7, 0x48, 0xA9,
+    0x82, 0x28, 0x1B, 0xC5, 0x49, 0xB8, 0x21, 0x0A, 0x08, 0x98, 0xAA, 0x86, 0x1B, 0xC0, 0x31, 0xAD,
+    0xA5, 0x65, 0x9B, 0x03, 0x0D, 0x81, 0x88, 0x11, 0xB9, 0x43, 0x9C, 0x03, 0x0D, 0x82, 0x1A, 0x81,
+    0x89, 0x32, 0xBB, 0x24, 0xAB, 0x14, 0x0A, 0x91, 0x28, 0x88, 0x88, 0x89, 0xAC, 0x03, 0x3F, 0x23,
+    0xE7, 0x7C, 0xD0, 0x22, 0x9B, 0x03, 0x8A, 0x01, 0x98, 0x30, 0xD9, 0x12, 0x8D, 0x11, 0x0B, 0x82,
+    0x9A, 0x22, 0xAC, 0x05, 0x5F, 0xE3, 0x30, 0xAA, 0x11, 0x89, 0x28, 0xB1, 0x5A, 0xC1, 0x30, 0xBA,
+    0x13, 0x8B, 0x82, 0x09, 0x28, 0xC2, 0x51, 0xBA, 0x05, 0x0A, 0xB3, 0x4A, 0xB0, 0x20, 0x89, 0x08,
+    0xC1, 0x38, 0xA8, 0x69, 0x78, 0xF8, 0x86, 0x2C, 0xC2, 0x38, 0x99, 0x10, 0xA0, 0x28, 0xB8, 0x40,
+    0xDA, 0x03, 0x1D, 0xA2, 0x39, 0xD1, 0x48, 0x9B, 0x93, 0xA8, 0x46, 0x1D, 0xB3, 0x4B, 0xC1, 0x11,
+    0xA8, 0x30, 0xA9, 0x42, 0xAC, 0x84, 0x0A, 0x02, 0x0D, 0x93, 0x3B, 0xB2, 0x48, 0xA0, 0x48, 0xD0,
+    0x11, 0xB8, 0x32, 0xAB, 0x14, 0x0D, 0xB3, 0x29, 0xA8, 0x92, 0x07, 0x4F, 0xD0, 0x12, 0x9A, 0x94,
+    0x1A, 0x81, 0x3A, 0xC0, 0x10, 0xA8, 0x10, 0xC8, 0x21, 0xAA, 0x30, 0xAD, 0x87, 0x4B, 0x98, 0x19,
+    0xA0, 0x4C, 0xB7, 0x50, 0xA9, 0x12, 0x8B, 0x82, 0x09, 0x92, 0x80, 0x18, 0x0B, 0x90, 0xB4, 0x08,
+    0xA8, 0x00, 0x69, 0x89, 0x07, 0x2A, 0xA2, 0x5B, 0xC1, 0x30, 0xCA, 0x32, 0xBB, 0x05, 0x0E, 0xA3,
+    0x6A, 0xB8, 0x83, 0x2B, 0x81, 0x18, 0xA0, 0x08, 0x00, 0xB8, 0xA2, 0x3D, 0xA1, 0x81, 0xBF, 0x31,
+    0x1B, 0xF3, 0x38, 0x9A, 0x84, 0x1F, 0xB0, 0x01, 0xA9, 0x28, 0x94, 0x27, 0x8A, 0xA6, 0x4A, 0xA1,
+    0x40, 0xA9, 0x11, 0xAA, 0x93, 0x2C, 0xA2, 0x1B, 0x9A, 0x18, 0x98, 0x15, 0x08, 0x86, 0x49, 0xA1,
+    0x58, 0x8A, 0xA2, 0x19, 0xA9, 0xA4, 0x2B, 0xBC, 0x2A, 0x41, 0x97, 0x90, 0x4E, 0x92, 0x5A, 0xA8,
+    0x39, 0xA0, 0x90, 0x0C, 0xC2, 0x31, 0xC9, 0x99, 0x1A, 0xA2, 0x68, 0xBA, 0x85, 0x0A, 0xC2, 0x89,
+    0x11, 0xC0, 0x0D, 0x10, 0x13, 0x50, 0x33, 0x2B, 0x23, 0x94, 0x5A, 0x82, 0xA9, 0xE0, 0x0A, 0xA1,
+    0x80, 0xAC, 0xA8, 0x89, 0x08, 0xA5, 0x74, 0x80, 0x30, 0x29, 0x02, 0x89, 0x80, 0xCA, 0x0A, 0xD8,
+    0x89, 0x5C, 0xA4, 0x0D, 0x15, 0x99, 0x10, 0xA9, 0x81, 0x01, 0x98, 0xA9, 0x5D, 0xAB, 0x38, 0x8F,
+    0x01, 0x8D, 0x21, 0x88, 0x99, 0xC0, 0x18, 0x83, 0x82, 0xFC, 0x20, 0x90, 0x9D, 0x28, 0x70, 0x81,
+    0x29, 0x21, 0x14, 0x91, 0xA9, 0x15, 0x82, 0xD0, 0x9C, 0x80, 0x12, 0xC9, 0x1A, 0x89, 0x8A, 0xA0,
+    0x5A, 0x47, 0x90, 0x10, 0x10, 0x30, 0xB0, 0x8B, 0x0A, 0x17, 0x9A, 0xD8, 0x41, 0x98, 0xA9, 0x28,
+    0xAA, 0x80, 0x9F, 0x38, 0x03, 0x8C, 0xC0, 0x83, 0xA0, 0xB0, 0x08, 0x3C, 0x97, 0x9F, 0x00, 0x0A,
+    0xC3, 0x0E, 0x02, 0xC8, 0x90, 0x80, 0x15, 0x99, 0x82, 0x3A, 0x36, 0x14, 0x09, 0x08, 0x05, 0x90,
+    0x90, 0x3B, 0xB1, 0xAF, 0xA2, 0x9A, 0x31, 0xC9, 0x1B, 0x22, 0x27, 0x80, 0x10, 0x04, 0x81, 0xA2,
+    0x0A, 0x42, 0x3B, 0x8B, 0xFC, 0x10, 0x94, 0x0C, 0x11, 0xC0, 0x2A, 0xAA, 0xA2, 0x33, 0xB7, 0xAF,
+    0x20, 0x82, 0x0B, 0x98, 0xA8, 0xAA, 0xF3, 0x58, 0xB0, 0x30, 0x08, 0x9F, 0x40, 0x89, 0x88, 0x99,
+    0xA2, 0x70, 0xA0, 0xC1, 0x10, 0xA4, 0x11, 0x1B, 0x96, 0x49, 0x90, 0x69, 0x30, 0x99, 0x1A, 0x9D,
+    0x34, 0xB0, 0x91, 0xD0, 0x12, 0xA0, 0x8B, 0x14, 0x82, 0x0C, 0x28, 0x78, 0x11, 0x80, 0xA9, 0x20,
+    0x17, 0xC9, 0x99, 0xB0, 0x39, 0xA0, 0xF8, 0x1C, 0xA0, 0x1D, 0x28, 0x01, 0x0B, 0x21, 0x04, 0xF8,
+    0x19, 0x11, 0x09, 0xC8, 0xAB, 0x3A, 0x04, 0xBD, 0x82, 0x40, 0xA9, 0x5A, 0x41, 0xB1, 0x7A, 0x20,
+    0x85, 0x90, 0x91, 0x01, 0x08, 0x0A, 0x2F, 0x01, 0x99, 0x8F, 0x10, 0x20, 0xF0, 0x18, 0x10, 0x12,
+    0x8A, 0x01, 0x43, 0x91, 0x08, 0x0D, 0xA3, 0x1E, 0xA8, 0x58, 0xA9, 0xF0, 0x09, 0x92, 0x10, 0xAB,
+    0x22, 0x2A, 0xF5, 0x48, 0x99, 0x04, 0x1C, 0xA0, 0x01, 0x0B, 0xA5, 0x4D, 0xC0, 0x20, 0xBA, 0x06,
+    0x2B, 0xD3, 0x59, 0x99, 0x11, 0x89, 0xA4, 0x29, 0xA0, 0x30, 0x8B, 0xB3, 0x30, 0xB8, 0xA7, 0x7B,
+    0x98, 0x30, 0xE9, 0x85, 0x2A, 0xA1, 0x39, 0xC9, 0x05, 0x1B, 0x92, 0x5B, 0xC8, 0x21, 0x09, 0x08,
+    0x6C, 0x7B, 0xE8, 0x11, 0xC0, 0x83, 0x09, 0x09, 0x20, 0x3C, 0xA8, 0x20, 0xC9, 0x14, 0x1C, 0x91,
+    0x18, 0x90, 0xB1, 0x20, 0xBA, 0x12, 0x2A, 0xF6, 0x11, 0x9A, 0x85, 0x4C, 0xB0, 0x40, 0x9A, 0x03,
+    0x1D, 0x92, 0x20, 0x8C, 0xA1, 0x59, 0xA1, 0x11, 0x8B, 0xA0, 0x71, 0x98, 0x01, 0x2C, 0xB1, 0x21,
+    0x8A, 0xA3, 0x3E, 0xF2, 0x30, 0x9C, 0x85, 0x2C, 0xB2, 0x10, 0x0A, 0xA2, 0x69, 0xAA, 0x14, 0x1C,
+    0xC2, 0x20, 0x9B, 0x04, 0x2B, 0xC0, 0x01, 0x1A, 0xA5, 0x10, 0x1A, 0xE3, 0x5A, 0xC0, 0x31, 0xB9,
+    0x33, 0x8D, 0x81, 0x19, 0x98, 0x95, 0x3A, 0xC1, 0x30, 0xB9, 0x03, 0x9A, 0xA4, 0x79, 0xA1, 0x5B,
+    0xC8, 0x48, 0x98, 0x20, 0x80, 0x0E, 0xC3, 0x59, 0xB1, 0x39, 0xB8, 0x01, 0x10, 0x9B, 0x33, 0x8D,
+    0x13, 0xC9, 0x6A, 0xD0, 0x50, 0xC8, 0x11, 0x99, 0x00, 0x00, 0x80, 0x00, 0x8A, 0x92, 0x86, 0x0C,
+    0xA4, 0x59, 0xC0, 0x41, 0xC9, 0x11, 0x8A, 0x10, 0x88, 0x38, 0xD1, 0x29, 0xC3, 0x30, 0xB9, 0x19,
+    0x05, 0x2B, 0x86, 0x9B, 0xA1, 0x6A, 0x89, 0x02, 0x8C, 0xA1, 0x11, 0xA9, 0x07, 0x2E, 0xB1, 0x31,
+    0x0B, 0xD2, 0x40, 0x8C, 0x04, 0x8B, 0x01, 0x9A, 0x20, 0xB4, 0x79, 0xB8, 0x18, 0x90, 0x31, 0xC1,
+    0x49, 0xD0, 0x48, 0xA8, 0x31, 0xC9, 0x80, 0x01, 0x19, 0xC3, 0x80, 0x84, 0x0B, 0x84, 0x8B, 0x85,
+    0x80, 0xF0, 0x21, 0x9B, 0x10, 0x80, 0x80, 0xB6, 0x2A, 0x80, 0x8A, 0x70, 0xA9, 0x86, 0x8A, 0x58,
+    0x08, 0x0B, 0x83, 0x0F, 0xA3, 0x80, 0xD3, 0x00, 0x29, 0x98, 0x01, 0x2A, 0x08, 0x08, 0x08, 0x3D,
+    0x80, 0x80, 0xE0, 0x48, 0x08, 0xB7, 0x3C, 0xC0, 0x83, 0x29, 0x08, 0x3B, 0xC0, 0x73, 0x8B, 0x80,
+    0x80, 0x00, 0x88, 0x4B, 0xC8, 0x30, 0xC0, 0x03, 0x3D, 0x80, 0x80, 0xE0, 0x83, 0x80, 0x0C, 0xC3,
+    0x40, 0x08, 0x3C, 0x08, 0x08, 0x08, 0xF0, 0x83, 0x3C, 0x00, 0x0D, 0xC3, 0x83, 0x80, 0x4C, 0xB8,
+    0xB4, 0x83, 0x4B, 0x08, 0x08, 0x3D, 0x0C, 0x48, 0x80, 0xD0, 0x03, 0xC8, 0x03, 0x08, 0xD8, 0x03,
+    0x3C, 0x80, 0x80, 0x3E, 0x8B, 0x85, 0x80, 0x3C, 0x00, 0x08, 0x08, 0x88, 0x00, 0x88, 0x3F, 0x80,
+    0xF0, 0x48, 0x08, 0xC8, 0xB3, 0x84, 0x80, 0xD0, 0x03, 0x3D, 0x80, 0x80, 0x80, 0x0E,
+};
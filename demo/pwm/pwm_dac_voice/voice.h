@@ -1,3 +1,13 @@
+#ifndef __VOICE_H__
+#define __VOICE_H__
+
 #include "fw_hal.h"
+#include "fw_audio.h"
+
+#define VOICE_FORMAT     AUDIO_Format_IMA_ADPCM
+#define VOICE_RATE       8000
+#define VOICE_SAMPLES    27451
+
+extern __CODE uint8_t voice_bulk[13726];
 
-extern __CODE uint8_t voice_bulk[];
\ No newline at end of file
+#endif
@@ -0,0 +1,59 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Demo: Quadrature encoder on PWMA
+ * Board: STC8H3K32S2/STC8H8K64U
+ * 
+ *   P10(PWMA.1) <- encoder A
+ *   P12(PWMA.2) <- encoder B
+ *   P33         <- UART1 TX
+*/
+#include "fw_hal.h"
+#include <stdio.h>
+
+#define SAMPLE_RATE  100
+
+INTERRUPT(Timer0_Routine, EXTI_VectTimer0)
+{
+    PWM_Encoder_Sample(PWM_Timer_PWMA);
+}
+
+void main(void)
+{
+    SYS_SetClock();
+    // UART1, baud 115200, baud source Timer1, 1T mode
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+
+    // Encoder outputs are usually open collector
+    GPIO_P1_SetMode(GPIO_Pin_0|GPIO_Pin_2, GPIO_Mode_InOut_QBD);
+    PWMA_PWM1_SetPort(PWMA_PWM1_AlterPort_P10_P11);
+    PWMA_PWM2_SetPort(PWMA_PWM2_AlterPort_P12P54_P13);
+    // Count on both edges of A and B, filter 0x0A: fSAMPLING=fMASTER/16, N=8
+    PWM_Encoder_Config(PWM_Timer_PWMA, PWM_EncoderMode_TI12, 0x0A, HAL_State_OFF);
+
+    // 12T mode, 100Hz is out of 16-bit range in 1T mode
+    TIM_Timer0_Config(HAL_State_OFF, TIM_TimerMode_16BitAuto, SAMPLE_RATE);
+    EXTI_Timer0_SetIntState(HAL_State_ON);
+    EXTI_Global_SetIntState(HAL_State_ON);
+    TIM_Timer0_SetRunState(HAL_State_ON);
+
+    while(1)
+    {
+        printf("position:%ld velocity:%ld counts/s\r\n",
+            PWM_Encoder_GetPosition(PWM_Timer_PWMA),
+            (int32_t)PWM_Encoder_GetVelocity(PWM_Timer_PWMA) * SAMPLE_RATE);
+        SYS_Delay(200);
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Demo: PWM input capture, tachometer and frequency meter
+ * Board: STC8H3K32S2/STC8H8K64U
+ * 
+ *   P10(PWMA.1) <- signal 1, period and duty cycle
+ *   P14(PWMA.3) <- signal 2, frequency up to 100kHz, reciprocal counting in 0.5s gate
+ *   P33         <- UART1 TX
+*/
+#include "fw_hal.h"
+#include <stdio.h>
+
+INTERRUPT(PWMA_Routine, EXTI_VectPWMA)
+{
+    PWM_Cap_PWMA_IRQHandler();
+}
+
+void main(void)
+{
+    PWM_CapResult_t result;
+    uint32_t freq;
+
+    SYS_SetClock();
+    // UART1, baud 115200, baud source Timer1, 1T mode
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+
+    GPIO_P1_SetMode(GPIO_Pin_0|GPIO_Pin_4, GPIO_Mode_Input_HIP);
+    PWMA_PWM1_SetPort(PWMA_PWM1_AlterPort_P10_P11);
+    PWMA_PWM3_SetPort(PWMA_PWM3_AlterPort_P14_P15);
+
+    // Tick = SYSCLK, the 16-bit counter is extended to 32-bit by update interrupt
+    PWM_Cap_Init(PWM_Timer_PWMA, 0);
+    // Filter 0x03: 8 samples, suppresses contact bounce of tachometer sensors
+    PWM_Cap_Config(PWM_CapChannel_1, PWM_CapMode_PeriodDuty, 0x03, PWM_CapPrescaler_1, 0);
+    // Capture every 8 edges, 100kHz input gives 12.5k interrupts/s
+    PWM_Cap_Config(PWM_CapChannel_3, PWM_CapMode_Frequency, 0x00, PWM_CapPrescaler_8, SYS_GetSysClock() / 2);
+    EXTI_Global_SetIntState(HAL_State_ON);
+
+    while(1)
+    {
+        if (PWM_Cap_Read(&result) != HAL_OK)
+        {
+            continue;
+        }
+        freq = PWM_Cap_GetFrequency(&result);
+        if (result.channel == PWM_CapChannel_1)
+        {
+            printf("CH1 period:%lu width:%lu duty:%u%% freq:%lu.%02u\r\n", 
+                result.period, result.width, (uint16_t)(result.width * 100 / result.period),
+                freq / 100, (uint16_t)(freq % 100));
+        }
+        else
+        {
+            printf("CH3 periods:%u ticks:%lu freq:%lu.%02u\r\n", 
+                result.count, result.period, freq / 100, (uint16_t)(freq % 100));
+        }
+    }
+}
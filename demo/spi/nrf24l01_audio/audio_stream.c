@@ -0,0 +1,289 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "audio_stream.h"
+
+/**************************************************************************** /
+ * TX
+*/
+
+static __XDATA uint8_t stream_tx_samples[2][STREAM_SAMPLES];
+static __XDATA uint8_t stream_tx_packet[STREAM_PAYLOAD_SIZE];
+static uint8_t stream_tx_index = 0, stream_tx_pos = 0, stream_tx_seq = 0;
+static volatile uint8_t stream_tx_ready = 0xFF;
+static AUDIO_ADPCM_State_t stream_tx_adpcm;
+
+void STREAM_TxPushSample(uint8_t sample)
+{
+    stream_tx_samples[stream_tx_index][stream_tx_pos++] = sample;
+    if (stream_tx_pos == STREAM_SAMPLES)
+    {
+        stream_tx_pos = 0;
+        stream_tx_ready = stream_tx_index;
+        stream_tx_index ^= 1;
+    }
+}
+
+uint8_t *STREAM_TxGetPacket(void)
+{
+    uint8_t i, code;
+    uint8_t __XDATA *src;
+
+    if (stream_tx_ready == 0xFF)
+    {
+        return NULL;
+    }
+    src = stream_tx_samples[stream_tx_ready];
+    stream_tx_ready = 0xFF;
+
+    stream_tx_packet[0] = stream_tx_seq++;
+#if STREAM_ADPCM
+    stream_tx_packet[1] = 0x80 | stream_tx_adpcm.index;
+    stream_tx_packet[2] = (uint16_t)stream_tx_adpcm.predictor >> 8;
+    stream_tx_packet[3] = (uint16_t)stream_tx_adpcm.predictor & 0xFF;
+    for (i = 0; i < STREAM_SAMPLES; i += 2)
+    {
+        code = AUDIO_ADPCM_Encode(&stream_tx_adpcm, AUDIO_U8ToSample(src[i]));
+        code |= AUDIO_ADPCM_Encode(&stream_tx_adpcm, AUDIO_U8ToSample(src[i + 1])) << 4;
+        stream_tx_packet[4 + (i >> 1)] = code;
+    }
+#else
+    stream_tx_packet[1] = 0x00;
+    for (i = 0; i < STREAM_SAMPLES; i++)
+    {
+        stream_tx_packet[2 + i] = src[i];
+    }
+#endif
+    return stream_tx_packet;
+}
+
+/**************************************************************************** /
+ * RX
+*/
+
+#define STREAM_SLOT(__SEQ__)    ((__SEQ__) & (STREAM_SLOTS - 1))
+
+static __XDATA uint8_t stream_slots[STREAM_SLOTS][STREAM_SAMPLES];
+static __XDATA uint8_t stream_slot_seq[STREAM_SLOTS];
+static __XDATA uint8_t stream_slot_full[STREAM_SLOTS];
+static __XDATA STREAM_Stats_t stream_stats;
+static AUDIO_ADPCM_State_t stream_rx_adpcm;
+static uint8_t __XDATA *stream_play_ptr;
+static volatile uint8_t stream_playing, stream_play_seq, stream_resync, stream_late;
+// Owned by the output interrupt
+static uint8_t stream_play_pos, stream_play_depth, stream_fade, stream_relax, stream_hold;
+
+void STREAM_RxInit(void)
+{
+    uint8_t i;
+    stream_playing = 0;
+    stream_resync = 1;
+    stream_late = 0;
+    stream_play_pos = 0;
+    stream_relax = 0;
+    for (i = 0; i < STREAM_SLOTS; i++)
+    {
+        stream_slot_full[i] = 0;
+    }
+    stream_stats.received = 0;
+    stream_stats.lost = 0;
+    stream_stats.late = 0;
+    stream_stats.overflows = 0;
+    stream_stats.underruns = 0;
+    stream_stats.depth = STREAM_DEPTH_MIN + 1;
+    // Silence for concealment before first packet
+    for (i = 0; i < STREAM_SAMPLES; i++)
+    {
+        stream_slots[0][i] = 0x80;
+    }
+    stream_play_ptr = stream_slots[0];
+}
+
+void STREAM_RxPacket(uint8_t *payload)
+{
+    uint8_t seq = payload[0], slot, i, code;
+    int8_t ahead;
+    uint8_t __XDATA *dst;
+
+    if (stream_resync)
+    {
+        // Buffer from this packet
+        stream_resync = 0;
+        stream_play_seq = seq;
+    }
+    ahead = (int8_t)(seq - stream_play_seq);
+    if (ahead < 0 || (ahead == 0 && stream_playing))
+    {
+        stream_stats.late++;
+        stream_late = 1;
+        return;
+    }
+    if (ahead > STREAM_SLOTS - 2)
+    {
+        // Sender is too far ahead, restart buffering
+        stream_playing = 0;
+        for (i = 0; i < STREAM_SLOTS; i++)
+        {
+            stream_slot_full[i] = 0;
+        }
+        stream_play_seq = seq;
+        stream_stats.overflows++;
+        ahead = 0;
+    }
+    slot = STREAM_SLOT(seq);
+    if (stream_slot_full[slot] && stream_slot_seq[slot] == seq)
+    {
+        stream_stats.late++;
+        return;
+    }
+
+    dst = stream_slots[slot];
+    if (payload[1] & 0x80)
+    {
+        stream_rx_adpcm.index = payload[1] & 0x7F;
+        stream_rx_adpcm.predictor = ((uint16_t)payload[2] << 8) | payload[3];
+        for (i = 0; i < STREAM_SAMPLES; i += 2)
+        {
+            code = payload[4 + (i >> 1)];
+            *dst++ = AUDIO_SampleToU8(AUDIO_ADPCM_Decode(&stream_rx_adpcm, code & 0x0F));
+            *dst++ = AUDIO_SampleToU8(AUDIO_ADPCM_Decode(&stream_rx_adpcm, code >> 4));
+        }
+    }
+    else
+    {
+        for (i = 0; i < STREAM_SAMPLES; i++)
+        {
+            *dst++ = payload[2 + i];
+        }
+    }
+    stream_slot_seq[slot] = seq;
+    stream_slot_full[slot] = 1;
+    stream_stats.received++;
+
+    if (!stream_playing && ahead + 1 >= stream_stats.depth)
+    {
+        stream_play_pos = 0;
+        stream_play_depth = ahead + 1;
+        stream_playing = 1;
+    }
+}
+
+static uint8_t STREAM_IsBuffered(uint8_t seq)
+{
+    uint8_t slot = STREAM_SLOT(seq);
+    return stream_slot_full[slot] && stream_slot_seq[slot] == seq;
+}
+
+/**
+ * Called at packet boundary, adjust depth and stretch or shrink the playback by one packet
+*/
+static void STREAM_Adapt(void)
+{
+    if (stream_late)
+    {
+        stream_late = 0;
+        stream_relax = 0;
+        if (stream_stats.depth < STREAM_DEPTH_MAX)
+        {
+            stream_stats.depth++;
+        }
+    }
+    else if (++stream_relax >= STREAM_DEPTH_RELAX)
+    {
+        stream_relax = 0;
+        if (stream_stats.depth > STREAM_DEPTH_MIN)
+        {
+            stream_stats.depth--;
+        }
+    }
+    if (stream_play_depth < stream_stats.depth)
+    {
+        // Replay the last packet at half volume and hold the sequence
+        stream_play_depth++;
+        stream_hold = 1;
+        stream_fade = 1;
+    }
+    else if (stream_play_depth > stream_stats.depth
+        && STREAM_IsBuffered(stream_play_seq + 1))
+    {
+        // Drop one packet
+        stream_play_depth--;
+        stream_slot_full[STREAM_SLOT(stream_play_seq)] = 0;
+        stream_play_seq++;
+    }
+}
+
+uint8_t STREAM_RxNextSample(void)
+{
+    uint8_t sample;
+
+    if (!stream_playing)
+    {
+        return 0x80;
+    }
+    if (stream_play_pos == 0)
+    {
+        stream_hold = 0;
+        STREAM_Adapt();
+        if (stream_hold)
+        {
+            // Keep stream_play_ptr
+        }
+        else if (STREAM_IsBuffered(stream_play_seq))
+        {
+            stream_play_ptr = stream_slots[STREAM_SLOT(stream_play_seq)];
+            stream_fade = 0;
+        }
+        else
+        {
+            // Repeat last packet with fading, rebuffer after 4 losses
+            stream_stats.lost++;
+            if (++stream_fade > 4)
+            {
+                stream_playing = 0;
+                stream_resync = 1;
+                stream_late = 1;
+                stream_stats.underruns++;
+                return 0x80;
+            }
+        }
+    }
+    sample = stream_play_ptr[stream_play_pos];
+    if (stream_fade)
+    {
+        sample = 0x80 + ((int8_t)(sample - 0x80) >> stream_fade);
+    }
+    if (++stream_play_pos == STREAM_SAMPLES)
+    {
+        stream_play_pos = 0;
+        if (!stream_hold)
+        {
+            stream_slot_full[STREAM_SLOT(stream_play_seq)] = 0;
+            stream_play_seq++;
+        }
+    }
+    return sample;
+}
+void STREAM_GetStats(STREAM_Stats_t *stats)
+{
+    uint8_t ea = EA;
+    EA = 0;
+    stats->received = stream_stats.received;
+    stats->lost = stream_stats.lost;
+    stats->late = stream_stats.late;
+    stats->overflows = stream_stats.overflows;
+    stats->underruns = stream_stats.underruns;
+    stats->depth = stream_stats.depth;
+    EA = ea;
+}
@@ -0,0 +1,85 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __AUDIO_STREAM_H__
+#define __AUDIO_STREAM_H__
+
+#include "fw_hal.h"
+#include "fw_audio.h"
+
+/**
+ * Audio over 32-byte radio payloads
+ * 
+ * Packet:  [0]    sequence number
+ *          [1]    bit7: ADPCM, bit6-0: ADPCM step index at packet start
+ *          [2,3]  ADPCM predictor at packet start, big endian
+ *          [4..]  56 ADPCM samples, or 30 PCM8 samples from [2]
+ * 
+ * Each ADPCM packet carries its decoder state, a lost packet doesn't
+ * break decoding of the following ones.
+ * 
+ * RX side keeps packets in a jitter buffer indexed by sequence number, the
+ * playback depth grows when packets arrive late and shrinks after a quiet
+ * period, by replaying or dropping one packet. Lost packets are concealed
+ * by repeating the last packet with fading.
+*/
+
+#define STREAM_PAYLOAD_SIZE     32
+// 0: PCM8, 1: IMA-ADPCM
+#ifndef STREAM_ADPCM
+#define STREAM_ADPCM            1
+#endif
+#if STREAM_ADPCM
+#define STREAM_SAMPLES          56
+#else
+#define STREAM_SAMPLES          30
+#endif
+// Jitter buffer slots, power of 2
+#define STREAM_SLOTS            8
+#define STREAM_DEPTH_MIN        1
+#define STREAM_DEPTH_MAX        (STREAM_SLOTS - 2)
+// Packets played without late arrival before depth is reduced by 1
+#define STREAM_DEPTH_RELAX      250
+
+typedef struct
+{
+    uint16_t received;      // Packets accepted
+    uint16_t lost;          // Packets missing at play time
+    uint16_t late;          // Packets arrived after play time, or duplicated
+    uint16_t overflows;     // Packets too far ahead, buffer resynced
+    uint16_t underruns;     // Buffer ran empty
+    uint8_t depth;          // Current target depth in packets
+} STREAM_Stats_t;
+
+/**
+ * TX: push one 8-bit sample, call it in ADC interrupt
+*/
+void STREAM_TxPushSample(uint8_t sample);
+/**
+ * TX: returns a packet ready to send, or NULL. Call it in main loop.
+*/
+uint8_t *STREAM_TxGetPacket(void);
+
+void STREAM_RxInit(void);
+/**
+ * RX: put one received payload into jitter buffer
+*/
+void STREAM_RxPacket(uint8_t *payload);
+/**
+ * RX: next 8-bit sample for output, call it in sample rate timer interrupt
+*/
+uint8_t STREAM_RxNextSample(void);
+void STREAM_GetStats(STREAM_Stats_t *stats);
+
+#endif
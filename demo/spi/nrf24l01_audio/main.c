@@ -40,26 +40,18 @@
  *    Note: 
  *    1. Use individual power supply for PAM8403
  *    2. Switch RX_ADDRESS and TX_ADDRESS in nrf24l01.c for RX and TX
+ *    3. Packets are IMA-ADPCM compressed by default, set STREAM_ADPCM to 0
+ *       in audio_stream.h for raw 8-bit samples
  */
 
 #include "nrf24l01.h"
-//#include "voice.h"
+#include "audio_stream.h"
 #include <stdio.h>
 
-#define BUFF_UNITS    8
-#define BUFF_SIZE     (BUFF_UNITS * NRF24_PLOAD_WIDTH)
-
 const NRF24_SCEN CURRENT_SCEN = NRF24_SCEN_TX;
 extern uint16_t NRF24L01_rxsn;
 extern uint8_t *NRF24L01_xbuf_data;
 
-__XDATA uint8_t MAIN_buf[2][BUFF_SIZE] = {{0}};
-uint8_t MAIN_buf_index = 0, MAIN_buf_pos = 0, 
-        MAIN_ready_index = 0xFF, 
-        MAIN_txrx_index, MAIN_txrx_pos = 0;
-
-//uint16_t voice_pos = 0, voice_size = 10665;
-
 void ADC_Init(void)
 {
     // Set ADC1(GPIO P1.1) HIP
@@ -157,102 +149,38 @@ void INT_Init()
 INTERRUPT(ADC_Routine, EXTI_VectADC)
 {
     ADC_ClearInterrupt();
-    MAIN_buf[MAIN_buf_index][MAIN_buf_pos] = ADC_RES;
-    if (MAIN_buf_pos == BUFF_SIZE - 1)
-    {
-        MAIN_buf_pos = 0;
-        MAIN_ready_index = MAIN_buf_index;
-        MAIN_buf_index = 1 - MAIN_buf_index;
-    }
-    else
-    {
-        MAIN_buf_pos++;
-    }
+    STREAM_TxPushSample(ADC_RES);
 }
 
 INTERRUPT(Timer0_Routine, EXTI_VectTimer0)
 {
-    uint8_t dc;
     if (CURRENT_SCEN == NRF24_SCEN_TX)
     {
         ADC_Start();
-        // MAIN_buf[MAIN_buf_index][MAIN_buf_pos] = voice_bulk[voice_pos++];
-        // if (MAIN_buf_pos == BUFF_SIZE - 1)
-        // {
-        //     MAIN_buf_pos = 0;
-        //     MAIN_ready_index = MAIN_buf_index;
-        //     MAIN_buf_index = 1 - MAIN_buf_index;
-        // }
-        // else
-        // {
-        //     MAIN_buf_pos++;
-        // }
-        // if (voice_pos == voice_size) voice_pos = 0;
     }
     else if (CURRENT_SCEN == NRF24_SCEN_RX)
     {
-        if (MAIN_txrx_index == 0xFF)
-        {
-            if (MAIN_ready_index != 0xFF)
-            {
-                MAIN_txrx_index = MAIN_ready_index;
-                MAIN_ready_index = 0xFF;
-                MAIN_txrx_pos = 0;
-            }
-        }
-        if (MAIN_txrx_index != 0xFF)
-        {
-            dc = MAIN_buf[MAIN_txrx_index][MAIN_txrx_pos];
-            PWMA_PWM1_SetCaptureCompareValue(dc);
-            // UART1_TxHex(dc);
-            // if (MAIN_txrx_pos % 32 == 0)
-            // {
-            //     UART1_TxString("\r\n");
-            // }
-            if (MAIN_txrx_pos == BUFF_SIZE - 1)
-            {
-                MAIN_txrx_index = 0xFF;
-                if (MAIN_ready_index != 0xFF)
-                {
-                    MAIN_txrx_index = MAIN_ready_index;
-                    MAIN_ready_index = 0xFF;
-                    MAIN_txrx_pos = 0;
-                }
-            }
-            else
-            {
-                MAIN_txrx_pos++;
-            }
-        }
+        PWMA_PWM1_SetCaptureCompareValue(STREAM_RxNextSample());
     }
 }
 
 INTERRUPT(Int2_Routine, EXTI_VectInt2)
 {
-    uint8_t pipe_num, status, i, *j;
+    uint8_t pipe_num, status;
     status = NRF24L01_HandelIrqFlag();
     pipe_num = (status >> 1) & 0x07;
     if (pipe_num != 0x07)
     {
-        i = NRF24_PLOAD_WIDTH;
-        j = NRF24L01_xbuf_data;
-        while (i--)
-        {
-            MAIN_buf[MAIN_buf_index][MAIN_buf_pos++] = *j++;
-        }
-        //UART1_TxHex(MAIN_buf_pos);
-        if (MAIN_buf_pos == 0)
-        {
-            MAIN_ready_index = MAIN_buf_index;
-            MAIN_buf_index = 1 - MAIN_buf_index;
-        }
+        // Decoding takes a while, Int2 stays in low priority to keep Timer0 output steady
+        STREAM_RxPacket(NRF24L01_xbuf_data);
     }
 }
 
 void main(void)
 {
     uint8_t *tmp;
-    uint8_t pos = 0, succ = 0, err = 0, i;
+    uint8_t succ = 0, err = 0;
+    STREAM_Stats_t stats;
 
     SYS_SetClock();
 
@@ -283,43 +211,33 @@ void main(void)
         UART1_TxString("NRF24L01 Initialized\r\n");
         while (1)
         {
-            if (MAIN_ready_index != 0xFF)
+            tmp = STREAM_TxGetPacket();
+            if (tmp == NULL)
+            {
+                continue;
+            }
+            if (NRF24L01_WriteFast(tmp) == 0)
+            {
+                NRF24L01_ResetTX();
+                err++;
+            }
+            else
+            {
+                succ++;
+            }
+            if (err >= 255 || succ >= 255)
             {
-                MAIN_txrx_index = MAIN_ready_index;
-                MAIN_ready_index = 0xFF;
-                for (pos = 0; pos < BUFF_UNITS; pos++)
-                {
-                    tmp = (uint8_t *)MAIN_buf[MAIN_txrx_index] + (pos * NRF24_PLOAD_WIDTH);
-                    // for (i = 0; i < 32; i++)
-                    // {
-                    //     UART1_TxHex(*(tmp + i));
-                    // }
-                    // UART1_TxString("\r\n");
-                    if (NRF24L01_WriteFast(tmp) == 0)
-                    {
-                        NRF24L01_ResetTX();
-                        err++;
-                    }
-                    else
-                    {
-                        succ++;
-                    }
-                    if (err >= 255 || succ >= 255)
-                    {
-                        UART1_TxHex(err);
-                        UART1_TxHex(succ);
-                        UART1_TxString("\r\n");
-                        err = 0;
-                        succ = 0;
-                    }
-                    //SYS_Delay(1);
-                }
-                
+                UART1_TxHex(err);
+                UART1_TxHex(succ);
+                UART1_TxString("\r\n");
+                err = 0;
+                succ = 0;
             }
         }
         break;
 
     case NRF24_SCEN_RX:
+        STREAM_RxInit();
         INT_Init();
         PWM_Init();
         Timer0_Init();
@@ -327,8 +245,21 @@ void main(void)
         NRF24L01_Init(NRF24_MODE_RX);
         while (1)
         {
-            UART1_TxHex(NRF24L01_rxsn >> 8);
-            UART1_TxHex(NRF24L01_rxsn & 0xFF);
+            // received, lost, late, overflows, underruns, depth
+            STREAM_GetStats(&stats);
+            UART1_TxHex(stats.received >> 8);
+            UART1_TxHex(stats.received & 0xFF);
+            UART1_TxChar(' ');
+            UART1_TxHex(stats.lost >> 8);
+            UART1_TxHex(stats.lost & 0xFF);
+            UART1_TxChar(' ');
+            UART1_TxHex(stats.late >> 8);
+            UART1_TxHex(stats.late & 0xFF);
+            UART1_TxChar(' ');
+            UART1_TxHex(stats.overflows & 0xFF);
+            UART1_TxHex(stats.underruns & 0xFF);
+            UART1_TxChar(' ');
+            UART1_TxHex(stats.depth);
             UART1_TxString("\r\n");
             SYS_Delay(1000);
         }
@@ -19,6 +19,8 @@
 uint8_t PCD8544_currentX = 0;
 uint8_t PCD8544_currentY = 0;
 static __XDATA uint8_t PCD8544_Buffer[PCD8544_WIDTH * PCD8544_HEIGHT / 8];
+/* Changed column range of each page, clean when from > to */
+static __XDATA uint8_t PCD8544_DirtyFrom[PCD8544_PAGES], PCD8544_DirtyTo[PCD8544_PAGES];
 
 void PCD8544_WriteData(uint8_t dat)
 {
@@ -54,6 +56,43 @@ static void PCD8544_Transmit(const uint8_t *pDat, uint32_t size)
     PCD8544_CS = 1;
 }
 
+static void PCD8544_MarkDirty(uint8_t page, uint8_t x)
+{
+    if (x < PCD8544_DirtyFrom[page])
+    {
+        PCD8544_DirtyFrom[page] = x;
+    }
+    if (x > PCD8544_DirtyTo[page])
+    {
+        PCD8544_DirtyTo[page] = x;
+    }
+}
+
+/**
+ * Mark the bytes that differ from dat, before the buffer is filled with it
+*/
+static void PCD8544_MarkFill(uint8_t dat)
+{
+    uint8_t page, x;
+    __XDATA uint8_t *pt = PCD8544_Buffer;
+    for (page = 0; page < PCD8544_PAGES; page++)
+    {
+        for (x = 0; x < PCD8544_WIDTH; x++)
+        {
+            if (*pt++ != dat)
+            {
+                PCD8544_MarkDirty(page, x);
+            }
+        }
+    }
+}
+
+void PCD8544_Invalidate(void)
+{
+    memset(PCD8544_DirtyFrom, 0, sizeof(PCD8544_DirtyFrom));
+    memset(PCD8544_DirtyTo, PCD8544_WIDTH - 1, sizeof(PCD8544_DirtyTo));
+}
+
 void PCD8544_Reset(void)
 {
     PCD8544_RES = 0;
@@ -74,6 +113,8 @@ void PCD8544_clear(void)
     PCD8544_WriteCommand(0x0c);
     PCD8544_WriteCommand(0x80);
     PCD8544_WriteSameData(0x00, PCD8544_WIDTH * PCD8544_HEIGHT);
+    // Display RAM no longer matches the buffer
+    PCD8544_Invalidate();
 }
 
 void PCD8544_SetBias(uint8_t val)
@@ -131,6 +172,8 @@ void PCD8544_Init(void)
     PCD8544_Reset();
     PCD8544_SetContrast(0x06, 0x20);
     PCD8544_SetDisplayNormal();
+    // Display RAM is undefined after reset
+    PCD8544_Invalidate();
 }
 
 void PCD8544_SetBackLightState(HAL_State_t state)
@@ -140,37 +183,65 @@ void PCD8544_SetBackLightState(HAL_State_t state)
 
 void PCD8544_Fill(uint8_t color)
 {
+    uint8_t dat = (color == 0x00) ? 0x00 : 0xFF;
+    PCD8544_MarkFill(dat);
     /* Set memory */
-    memset((uint8_t *)PCD8544_Buffer, (color == 0x00) ? 0x00 : 0xFF, sizeof(PCD8544_Buffer));
+#if (__CONF_MCU_TYPE == 3)
+    // Fill with CPU if the M2M engine is busy with an async transfer
+    if (DMA_M2M_Fill(PCD8544_Buffer, dat, sizeof(PCD8544_Buffer)) != HAL_OK)
+    {
+        memset((uint8_t *)PCD8544_Buffer, dat, sizeof(PCD8544_Buffer));
+    }
+#else
+    memset((uint8_t *)PCD8544_Buffer, dat, sizeof(PCD8544_Buffer));
+#endif
 }
 
 void PCD8544_UpdateScreen(void)
 {
-    uint8_t i = 0, *pt = PCD8544_Buffer;
+    uint8_t i = 0, from, *pt = PCD8544_Buffer;
     for (i = 0; i < PCD8544_PAGES; i++)
     {
+        from = PCD8544_DirtyFrom[i];
+        if (from > PCD8544_DirtyTo[i])
+        {
+            continue;
+        }
         PCD8544_WriteCommand(PCD8544_SET_YADDR | i);
-        PCD8544_WriteCommand(PCD8544_SET_XADDR);
-        PCD8544_Transmit(pt + (PCD8544_WIDTH * i), PCD8544_WIDTH);
+        PCD8544_WriteCommand(PCD8544_SET_XADDR | from);
+        PCD8544_Transmit(pt + (PCD8544_WIDTH * i) + from, PCD8544_DirtyTo[i] - from + 1);
+        PCD8544_DirtyFrom[i] = 0xFF;
+        PCD8544_DirtyTo[i] = 0;
     }
     PCD8544_WriteCommand(PCD8544_SET_YADDR);
 }
 
 void PCD8544_DrawPixel(uint8_t x, uint8_t y, uint8_t color)
 {
+    uint8_t page, dat;
+    uint16_t i;
     if (x >= PCD8544_WIDTH || y >= PCD8544_HEIGHT)
     {
         /* Error */
         return;
     }
 
+    page = y / 8;
+    i = x + page * PCD8544_WIDTH;
+    dat = PCD8544_Buffer[i];
     if (color == 0x01)
     {
-        PCD8544_Buffer[x + (y / 8) * PCD8544_WIDTH] |= 1 << (y % 8);
+        dat |= 1 << (y % 8);
     }
     else
     {
-        PCD8544_Buffer[x + (y / 8) * PCD8544_WIDTH] &= ~(1 << (y % 8));
+        dat &= ~(1 << (y % 8));
+    }
+    /* Only a change needs to be sent */
+    if (dat != PCD8544_Buffer[i])
+    {
+        PCD8544_Buffer[i] = dat;
+        PCD8544_MarkDirty(page, x);
     }
 }
 
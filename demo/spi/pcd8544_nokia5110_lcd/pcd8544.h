@@ -173,12 +173,21 @@ void PCD8544_Fill(uint8_t color);
 
 /** 
  * @brief  Update LCD display with changes
- * @note   Call this function each time when display is changed
+ * @note   Call this function each time when display is changed, only the changed column span
+ *         of each page is sent
  * @param  None
  * @retval None
  */
 void PCD8544_UpdateScreen(void);
 
+/**
+ * @brief  Mark the whole buffer as changed, the next @ref PCD8544_UpdateScreen() sends the full frame
+ * @note   Called by PCD8544_Init() and PCD8544_clear(), call again after writing to the LCD RAM directly
+ * @param  None
+ * @retval None
+ */
+void PCD8544_Invalidate(void);
+
 /**
  * @brief  Draws pixel at desired location
  * @note   @ref PCD8544_UpdateScreen() must called after that in order to show updates
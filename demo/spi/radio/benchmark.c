@@ -0,0 +1,271 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***
+ * Demo: throughput and latency of the radio backends
+ *
+ *    Pin connection is the same as main.c. Build two boards with the same RADIO_CHIP,
+ *    one with BENCH_ROLE 0 (sender) and one with BENCH_ROLE 1 (responder).
+ *
+ *    The sender runs five tests of BENCH_PACKETS 32-byte packets. One packet in flight:
+ *      no-ack   : packets/s and kbps without ACK
+ *      ack      : packets/s, lost packets, round trip from RADIO_Send() to the ACK
+ *      ack+data : the same with a 32-byte ACK payload from the responder
+ *    Pipelined, the TX queue and the TX FIFO of the chip are kept full:
+ *      stream   : packets/s and kbps without ACK
+ *      stream+ack: packets/s, kbps, lost packets and retransmits with ACK
+ *    Time is counted by Timer0 in 12T mode, the results are printed to UART1.
+ *    Set BENCH_RATE to RADIO_DataRate_2M for nRF24L01 and CI24R1.
+ *
+ * test-board: Minimum System; test-MCU: STC8H1K08,STC8H3K64S2
+ */
+
+#include "radio.h"
+#include <stdio.h>
+
+// 0:sender, 1:responder
+#define BENCH_ROLE      0
+#define BENCH_PACKETS   1000
+#define BENCH_RATE      RADIO_DataRate_1M
+
+#define BENCH_TICKS_PER_MS  (__CONF_FOSC / 12000)
+
+#if (RADIO_CHIP == RADIO_CHIP_NRF24L01)
+#define BENCH_CHIP_NAME     "nRF24L01"
+#define BENCH_POLL()
+#elif (RADIO_CHIP == RADIO_CHIP_XL2400)
+#define BENCH_CHIP_NAME     "XL2400"
+#define BENCH_POLL()        RADIO_Poll()
+#else
+#define BENCH_CHIP_NAME     "CI24R1"
+#define BENCH_POLL()        RADIO_Poll()
+#endif
+
+__CODE uint8_t ADDRESS_A[RADIO_ADDR_WIDTH] = {0x32,0x4E,0x6F,0x64,0x22};
+__CODE uint8_t ADDRESS_B[RADIO_ADDR_WIDTH] = {0x32,0x4E,0x6F,0x64,0x65};
+
+__XDATA uint8_t buf[RADIO_PLOAD_WIDTH], ack_buf[RADIO_PLOAD_WIDTH];
+static volatile uint16_t bench_overflow;
+
+#if (RADIO_BUS == RADIO_BUS_SPI)
+void SPI_Init(void)
+{
+    // 3MHz at 24MHz
+    SPI_SetClockPrescaler(SPI_ClockPreScaler_8);
+    SPI_SetClockPolarity(HAL_State_OFF);
+    SPI_SetClockPhase(SPI_ClockPhase_LeadingEdge);
+    SPI_SetDataOrder(SPI_DataOrder_MSB);
+    SPI_SetPort(SPI_AlterPort_P35_P34_P33_P32);
+    SPI_IgnoreSlaveSelect(HAL_State_ON);
+    SPI_SetMasterMode(HAL_State_ON);
+    SPI_SetEnabled(HAL_State_ON);
+}
+
+void GPIO_Init(void)
+{
+    // MISO(P33) MOSI(P34)
+    GPIO_P3_SetMode(GPIO_Pin_3|GPIO_Pin_4, GPIO_Mode_InOut_QBD);
+    // SCLK(P32) CSN(P35)
+    GPIO_P3_SetMode(GPIO_Pin_2|GPIO_Pin_5, GPIO_Mode_Output_PP);
+    // IRQ(P36)
+    GPIO_P3_SetMode(GPIO_Pin_6, GPIO_Mode_Input_HIP);
+}
+#endif
+
+#if (RADIO_CHIP == RADIO_CHIP_NRF24L01)
+INTERRUPT(Int2_Routine, EXTI_VectInt2)
+{
+    RADIO_IRQHandler();
+}
+#endif
+
+INTERRUPT(Timer0_Routine, EXTI_VectTimer0)
+{
+    bench_overflow++;
+}
+
+/**
+ * Timer0 as 32-bit counter, 12T, free running
+*/
+uint32_t Bench_Ticks(void)
+{
+    uint16_t high;
+    uint8_t th, tl;
+    do
+    {
+        high = bench_overflow;
+        th = TH0;
+        tl = TL0;
+    } while (high != bench_overflow || th != TH0);
+    return (uint32_t)high << 16 | (uint16_t)th << 8 | tl;
+}
+
+void Bench_Run(const char *name, uint8_t test, HAL_State_t ack)
+{
+    uint16_t i, sent = 0, acks = 0;
+    uint32_t start, t, elapsed, lat_min = 0xFFFFFFFF, lat_max = 0, lat_sum = 0;
+
+    RADIO_FlushRx();
+    buf[2] = test;
+    start = Bench_Ticks();
+    for (i = 0; i < BENCH_PACKETS; i++)
+    {
+        buf[0] = i & 0xFF;
+        buf[1] = i >> 8;
+        t = Bench_Ticks();
+        RADIO_Send(buf, RADIO_PLOAD_WIDTH, ack);
+        while (RADIO_GetTxStatus() == HAL_BUSY)
+        {
+            BENCH_POLL();
+        }
+        t = Bench_Ticks() - t;
+        if (RADIO_GetTxStatus() != HAL_OK)
+        {
+            continue;
+        }
+        sent++;
+        while (RADIO_Receive(ack_buf, NULL) != 0)
+        {
+            acks++;
+        }
+        lat_sum += t;
+        if (t < lat_min) lat_min = t;
+        if (t > lat_max) lat_max = t;
+    }
+    elapsed = Bench_Ticks() - start;
+
+    t = (uint32_t)sent * 1000 * BENCH_TICKS_PER_MS / elapsed;
+    printf("%s %s: %u/%u sent, %lu ms, %lu packets/s, %lu kbps",
+        BENCH_CHIP_NAME, name, sent, BENCH_PACKETS, elapsed / BENCH_TICKS_PER_MS,
+        t, t * RADIO_PLOAD_WIDTH * 8 / 1000);
+    if (ack && sent > 0)
+    {
+        printf(", acks with payload %u, round trip us min %lu avg %lu max %lu",
+            acks, lat_min * 1000 / BENCH_TICKS_PER_MS,
+            lat_sum / sent * 1000 / BENCH_TICKS_PER_MS, lat_max * 1000 / BENCH_TICKS_PER_MS);
+    }
+    printf("\r\n");
+}
+
+void Bench_Stream(const char *name, uint8_t test, HAL_State_t ack)
+{
+    uint16_t i, ok, lost, retries;
+    uint32_t start, elapsed, rate;
+
+    buf[2] = test;
+    ok = RADIO_Stats.tx_ok;
+    lost = RADIO_Stats.tx_lost;
+    retries = RADIO_Stats.tx_retries;
+    start = Bench_Ticks();
+    for (i = 0; i < BENCH_PACKETS; i++)
+    {
+        buf[0] = i & 0xFF;
+        buf[1] = i >> 8;
+        while (RADIO_Send(buf, RADIO_PLOAD_WIDTH, ack) == HAL_BUSY)
+        {
+            BENCH_POLL();
+        }
+    }
+    while (RADIO_GetTxStatus() == HAL_BUSY)
+    {
+        BENCH_POLL();
+    }
+    elapsed = Bench_Ticks() - start;
+    ok = RADIO_Stats.tx_ok - ok;
+    lost = RADIO_Stats.tx_lost - lost;
+    retries = RADIO_Stats.tx_retries - retries;
+
+    rate = (uint32_t)ok * 1000 * BENCH_TICKS_PER_MS / elapsed;
+    printf("%s %s: %u/%u sent, %lu ms, %lu packets/s, %lu kbps, lost %u, retransmits %u\r\n",
+        BENCH_CHIP_NAME, name, ok, BENCH_PACKETS, elapsed / BENCH_TICKS_PER_MS,
+        rate, rate * RADIO_PLOAD_WIDTH * 8 / 1000, lost, retries);
+}
+
+void main(void)
+{
+    uint8_t i;
+#if (BENCH_ROLE != 0)
+    uint16_t count = 0;
+#endif
+
+    SYS_SetClock();
+    // UART1, baud 115200, baud source Timer1, 1T mode, no interrupt
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+    // Timer0: 12T, 16-bit free running, overflow interrupt
+    TIM_Timer0_Set1TMode(HAL_State_OFF);
+    TIM_Timer0_SetMode(TIM_TimerMode_16BitAuto);
+    TIM_Timer0_SetInitValue(0x00, 0x00);
+    EXTI_Timer0_SetIntState(HAL_State_ON);
+    TIM_Timer0_SetRunState(HAL_State_ON);
+#if (RADIO_BUS == RADIO_BUS_SPI)
+    GPIO_Init();
+    SPI_Init();
+#endif
+
+    while (RADIO_Init() != HAL_OK)
+    {
+        UART1_TxString("Radio check failed\r\n");
+        SYS_Delay(1000);
+    }
+    RADIO_SetChannel(40);
+    RADIO_SetRf(RADIO_Power_Max, BENCH_RATE);
+    for (i = 0; i < RADIO_PLOAD_WIDTH; i++)
+    {
+        buf[i] = i;
+    }
+#if (BENCH_ROLE == 0)
+    RADIO_SetTxAddress(ADDRESS_B);
+    RADIO_SetRxAddress(ADDRESS_A);
+    RADIO_SetMode(RADIO_Mode_Standby);
+#else
+    RADIO_SetTxAddress(ADDRESS_A);
+    RADIO_SetRxAddress(ADDRESS_B);
+    RADIO_SetMode(RADIO_Mode_Rx);
+#endif
+#if (RADIO_CHIP == RADIO_CHIP_NRF24L01)
+    RADIO_SetIntState(HAL_State_ON);
+#endif
+    EXTI_Global_SetIntState(HAL_State_ON);
+
+    while (1)
+    {
+#if (BENCH_ROLE == 0)
+        Bench_Run("no-ack", 0, HAL_State_OFF);
+        Bench_Run("ack", 1, HAL_State_ON);
+        Bench_Run("ack+data", 2, HAL_State_ON);
+        Bench_Stream("stream", 3, HAL_State_OFF);
+        Bench_Stream("stream+ack", 4, HAL_State_ON);
+        SYS_Delay(2000);
+#else
+        BENCH_POLL();
+        if (RADIO_Receive(buf, NULL) != 0)
+        {
+            // Keep one ACK payload loaded in the ack+data test only
+            if (buf[2] == 2)
+            {
+                RADIO_SetAckPayload(RADIO_PIPE_RX, buf, RADIO_PLOAD_WIDTH);
+            }
+            else
+            {
+                RADIO_FlushTx();
+            }
+            if (++count == BENCH_PACKETS)
+            {
+                printf("%s received %u\r\n", BENCH_CHIP_NAME, count);
+                count = 0;
+            }
+        }
+#endif
+    }
+}
@@ -0,0 +1,203 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***
+ * Demo: 1KB messages over the link layer with selective ACK and channel hopping
+ *
+ *    Pin connection is the same as main.c. Build two boards with the same RADIO_CHIP,
+ *    one with XFER_ROLE 0 (sender) and one with XFER_ROLE 1 (receiver).
+ *
+ *    The sender sends XFER_MESSAGES messages of XFER_SIZE bytes, then prints the goodput,
+ *    the failed messages and the link counters. The receiver checks the content of each
+ *    message and prints the loss score of every channel after XFER_MESSAGES messages.
+ *    Timer0 ticks the link layer every 1ms, the results are printed to UART1.
+ *
+ * test-board: Minimum System; test-MCU: STC8H3K32S2,STC8H3K64S2
+ */
+
+#include "radio_link.h"
+#include <stdio.h>
+
+// 0:sender, 1:receiver
+#define XFER_ROLE       0
+#define XFER_MESSAGES   100
+#define XFER_SIZE       LINK_MSG_MAX
+
+#if (RADIO_CHIP == RADIO_CHIP_NRF24L01)
+#define XFER_POLL()
+#else
+#define XFER_POLL()     RADIO_Poll()
+#endif
+
+__CODE uint8_t ADDRESS_A[RADIO_ADDR_WIDTH] = {0x32,0x4E,0x6F,0x64,0x22};
+__CODE uint8_t ADDRESS_B[RADIO_ADDR_WIDTH] = {0x32,0x4E,0x6F,0x64,0x65};
+
+__XDATA uint8_t msg[XFER_SIZE];
+static volatile uint16_t ms;
+
+#if (RADIO_BUS == RADIO_BUS_SPI)
+void SPI_Init(void)
+{
+    // 3MHz at 24MHz
+    SPI_SetClockPrescaler(SPI_ClockPreScaler_8);
+    SPI_SetClockPolarity(HAL_State_OFF);
+    SPI_SetClockPhase(SPI_ClockPhase_LeadingEdge);
+    SPI_SetDataOrder(SPI_DataOrder_MSB);
+    SPI_SetPort(SPI_AlterPort_P35_P34_P33_P32);
+    SPI_IgnoreSlaveSelect(HAL_State_ON);
+    SPI_SetMasterMode(HAL_State_ON);
+    SPI_SetEnabled(HAL_State_ON);
+}
+
+void GPIO_Init(void)
+{
+    // MISO(P33) MOSI(P34)
+    GPIO_P3_SetMode(GPIO_Pin_3|GPIO_Pin_4, GPIO_Mode_InOut_QBD);
+    // SCLK(P32) CSN(P35)
+    GPIO_P3_SetMode(GPIO_Pin_2|GPIO_Pin_5, GPIO_Mode_Output_PP);
+    // IRQ(P36)
+    GPIO_P3_SetMode(GPIO_Pin_6, GPIO_Mode_Input_HIP);
+}
+#endif
+
+#if (RADIO_CHIP == RADIO_CHIP_NRF24L01)
+INTERRUPT(Int2_Routine, EXTI_VectInt2)
+{
+    RADIO_IRQHandler();
+}
+#endif
+
+INTERRUPT(Timer0_Routine, EXTI_VectTimer0)
+{
+    LINK_TickHandler();
+    ms++;
+}
+
+uint16_t Xfer_Millis(void)
+{
+    uint16_t t;
+    do
+    {
+        t = ms;
+    } while (t != ms);
+    return t;
+}
+
+#if (XFER_ROLE == 0)
+void Xfer_Send(void)
+{
+    uint16_t i, j, failed = 0, start, elapsed;
+
+    // Byte 0 carries the message index, the rest is a pattern the receiver checks
+    for (j = 1; j < XFER_SIZE; j++)
+    {
+        msg[j] = (uint8_t)j;
+    }
+    start = Xfer_Millis();
+    for (i = 0; i < XFER_MESSAGES; i++)
+    {
+        msg[0] = i & 0xFF;
+        LINK_Send(msg, XFER_SIZE);
+        while (LINK_GetTxStatus() == HAL_BUSY)
+        {
+            XFER_POLL();
+            LINK_Process();
+        }
+        if (LINK_GetTxStatus() != HAL_OK)
+        {
+            failed++;
+        }
+    }
+    elapsed = Xfer_Millis() - start;
+    printf("sent %u x %u bytes in %u ms, %lu kbps, failed %u\r\n",
+        XFER_MESSAGES - failed, XFER_SIZE, elapsed,
+        (uint32_t)(XFER_MESSAGES - failed) * XFER_SIZE * 8 / (elapsed? elapsed : 1), failed);
+    printf("frames %u repeats %u timeouts %u hops %u\r\n", LINK_Stats.tx_frames,
+        LINK_Stats.tx_repeats, LINK_Stats.tx_timeouts, LINK_Stats.hops);
+}
+#else
+void Xfer_Receive(void)
+{
+    uint16_t i, j, len, bad = 0;
+
+    for (i = 0; i < XFER_MESSAGES; i++)
+    {
+        LINK_Listen(msg, XFER_SIZE);
+        while ((len = LINK_Received()) == 0)
+        {
+            XFER_POLL();
+            LINK_Process();
+        }
+        for (j = 1; j < len; j++)
+        {
+            if (msg[j] != (uint8_t)j)
+            {
+                bad++;
+                break;
+            }
+        }
+    }
+    printf("received %u, corrupted %u, duplicates %u, loss:", XFER_MESSAGES, bad,
+        LINK_Stats.rx_duplicates);
+    for (i = 0; i < LINK_CHANNEL_NUM; i++)
+    {
+        printf(" %u", LINK_GetChannelLoss(i));
+    }
+    printf("\r\n");
+}
+#endif
+
+void main(void)
+{
+    SYS_SetClock();
+    // UART1, baud 115200, baud source Timer1, 1T mode, no interrupt
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+    // Timer0: 1000Hz, tick of the link layer
+    TIM_Timer0_Config(HAL_State_ON, TIM_TimerMode_16BitAuto, 1000);
+    EXTI_Timer0_SetIntState(HAL_State_ON);
+    TIM_Timer0_SetRunState(HAL_State_ON);
+#if (RADIO_BUS == RADIO_BUS_SPI)
+    GPIO_Init();
+    SPI_Init();
+#endif
+
+    while (RADIO_Init() != HAL_OK)
+    {
+        UART1_TxString("Radio check failed\r\n");
+        SYS_Delay(1000);
+    }
+    RADIO_SetRf(RADIO_Power_Max, RADIO_DataRate_1M);
+#if (XFER_ROLE == 0)
+    RADIO_SetTxAddress(ADDRESS_B);
+    RADIO_SetRxAddress(ADDRESS_A);
+#else
+    RADIO_SetTxAddress(ADDRESS_A);
+    RADIO_SetRxAddress(ADDRESS_B);
+#endif
+    LINK_Init();
+#if (RADIO_CHIP == RADIO_CHIP_NRF24L01)
+    RADIO_SetIntState(HAL_State_ON);
+#endif
+    EXTI_Global_SetIntState(HAL_State_ON);
+
+    while (1)
+    {
+#if (XFER_ROLE == 0)
+        Xfer_Send();
+        SYS_Delay(2000);
+#else
+        Xfer_Receive();
+#endif
+    }
+}
@@ -0,0 +1,156 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***
+ * Demo: nRF24L01 / XL2400 / CI24R1 2.4GHz RF through the radio API
+ *
+ *    Pin connection, hardware SPI (nRF24L01, XL2400):
+ *    P35(SS, Ignored) => CSN
+ *    P34(MOSI)        => MOSI, XL2400 DATA
+ *    P33(MISO)        => MISO
+ *    P32(SPCLK)       => SCK
+ *    P36(INT2)        => IRQ, nRF24L01 only
+ *    P37(IO)          => CE, nRF24L01 only
+ *
+ *    Pin connection, 3-wire (CI24R1):
+ *    P35              => CSN
+ *    P34              => DATA
+ *    P32              => SCK
+ *
+ *    Build with RADIO_CHIP=RADIO_CHIP_NRF24L01/RADIO_CHIP_XL2400/RADIO_CHIP_CI24R1, the
+ *    application code is the same for the three. The sender sends a counter every 500ms
+ *    and prints the ACK payload, the receiver prints the packets and returns the number
+ *    of packets received in the ACK payload.
+ *
+ * test-board: Minimum System; test-MCU: STC8H1K08,STC8H3K64S2
+ */
+
+#include "radio.h"
+#include <stdio.h>
+
+// 0:TX, 1:RX
+#define RADIO_DEMO_ROLE 0
+
+__CODE uint8_t ADDRESS_A[RADIO_ADDR_WIDTH] = {0x32,0x4E,0x6F,0x64,0x22};
+__CODE uint8_t ADDRESS_B[RADIO_ADDR_WIDTH] = {0x32,0x4E,0x6F,0x64,0x65};
+
+uint8_t buf[RADIO_PLOAD_WIDTH];
+
+#if (RADIO_BUS == RADIO_BUS_SPI)
+void SPI_Init(void)
+{
+    // SPI frequency, 3MHz at 24MHz, nRF24L01 runs up to 8MHz
+    SPI_SetClockPrescaler(SPI_ClockPreScaler_8);
+    // Clock is low when idle
+    SPI_SetClockPolarity(HAL_State_OFF);
+    // Data transfer is driven by lower SS pin
+    SPI_SetClockPhase(SPI_ClockPhase_LeadingEdge);
+    // MSB first
+    SPI_SetDataOrder(SPI_DataOrder_MSB);
+    // Define the output pins
+    SPI_SetPort(SPI_AlterPort_P35_P34_P33_P32);
+    // Ignore SS pin, use MSTR to swith between master/slave mode
+    SPI_IgnoreSlaveSelect(HAL_State_ON);
+    // Master mode
+    SPI_SetMasterMode(HAL_State_ON);
+    // Start SPI
+    SPI_SetEnabled(HAL_State_ON);
+}
+
+void GPIO_Init(void)
+{
+    // MISO(P33) MOSI(P34)
+    GPIO_P3_SetMode(GPIO_Pin_3|GPIO_Pin_4, GPIO_Mode_InOut_QBD);
+    // SCLK(P32) CSN(P35)
+    GPIO_P3_SetMode(GPIO_Pin_2|GPIO_Pin_5, GPIO_Mode_Output_PP);
+    // IRQ(P36)
+    GPIO_P3_SetMode(GPIO_Pin_6, GPIO_Mode_Input_HIP);
+}
+#endif
+
+#if (RADIO_CHIP == RADIO_CHIP_NRF24L01)
+INTERRUPT(Int2_Routine, EXTI_VectInt2)
+{
+    RADIO_IRQHandler();
+}
+#endif
+
+void main(void)
+{
+    uint8_t len, pipe;
+    uint16_t count = 0;
+
+    SYS_SetClock();
+    // UART1, baud 115200, baud source Timer1, 1T mode, no interrupt
+    UART1_Config8bitUart(UART1_BaudSource_Timer1, HAL_State_ON, 115200);
+#if (RADIO_BUS == RADIO_BUS_SPI)
+    GPIO_Init();
+    SPI_Init();
+#endif
+
+    while (RADIO_Init() != HAL_OK)
+    {
+        UART1_TxString("Radio check failed\r\n");
+        SYS_Delay(1000);
+    }
+    RADIO_SetChannel(40);
+    RADIO_SetRf(RADIO_Power_Max, RADIO_DataRate_1M);
+#if (RADIO_DEMO_ROLE == 0)
+    RADIO_SetTxAddress(ADDRESS_B);
+    RADIO_SetRxAddress(ADDRESS_A);
+    RADIO_SetMode(RADIO_Mode_Standby);
+#else
+    RADIO_SetTxAddress(ADDRESS_A);
+    RADIO_SetRxAddress(ADDRESS_B);
+    RADIO_SetMode(RADIO_Mode_Rx);
+    RADIO_SetAckPayload(RADIO_PIPE_RX, (uint8_t *)&count, sizeof(count));
+#endif
+#if (RADIO_CHIP == RADIO_CHIP_NRF24L01)
+    RADIO_SetIntState(HAL_State_ON);
+    EXTI_Global_SetIntState(HAL_State_ON);
+#endif
+    UART1_TxString("Radio initialized\r\n");
+
+    while (1)
+    {
+#if (RADIO_CHIP != RADIO_CHIP_NRF24L01)
+        RADIO_Poll();
+#endif
+#if (RADIO_DEMO_ROLE == 0)
+        if (RADIO_GetTxStatus() != HAL_BUSY)
+        {
+            if (count > 0)
+            {
+                printf("TX %u %s", count, RADIO_GetTxStatus() == HAL_OK? "ok" : "lost");
+                while ((len = RADIO_Receive(buf, &pipe)) != 0)
+                {
+                    printf(" ack[%u]:%u", len, *(uint16_t *)buf);
+                }
+                printf("\r\n");
+            }
+            SYS_Delay(500);
+            count++;
+            memset(buf, count, RADIO_PLOAD_WIDTH);
+            RADIO_Send(buf, RADIO_PLOAD_WIDTH, HAL_State_ON);
+        }
+#else
+        while ((len = RADIO_Receive(buf, &pipe)) != 0)
+        {
+            count++;
+            printf("RX pipe:%u len:%u %02X\r\n", pipe, len, buf[0]);
+            RADIO_SetAckPayload(RADIO_PIPE_RX, (uint8_t *)&count, sizeof(count));
+        }
+#endif
+    }
+}
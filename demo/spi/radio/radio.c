@@ -0,0 +1,503 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "radio.h"
+
+#define RADIO_RX_FIFO_MASK  (RADIO_RX_FIFO_DEPTH - 1)
+#define RADIO_TX_QUEUE_MASK (RADIO_TX_QUEUE_DEPTH - 1)
+// Levels of the TX FIFO in the chip
+#define RADIO_TX_FIFO_LEVELS 3
+
+RADIO_Stats_t RADIO_Stats;
+
+static __XDATA RADIO_Packet_t radio_rx_fifo[RADIO_RX_FIFO_DEPTH];
+static volatile uint8_t radio_rx_head, radio_rx_tail;
+// Packets left in the chip when the FIFO was full
+static volatile uint8_t radio_rx_pending;
+static volatile uint8_t radio_tx_status;
+// Packets waiting or in flight, len 0x80 flags no-ACK
+static __XDATA RADIO_Packet_t radio_tx_queue[RADIO_TX_QUEUE_DEPTH];
+// Oldest packet, packets in the queue, packets of them written to the chip
+static volatile uint8_t radio_tx_head, radio_tx_count, radio_tx_loaded;
+static RADIO_Mode_t radio_mode;
+static uint8_t radio_irq;
+// Auto retransmit count set in the chip, charged to tx_retries at MAX_RT
+static uint8_t radio_retry_count;
+
+#define RADIO_LOCK()    do { if (radio_irq) { RADIO_IRQ_DISABLE(); } } while(0)
+#define RADIO_UNLOCK()  do { if (radio_irq) { RADIO_IRQ_ENABLE(); } } while(0)
+
+/**************************************************************************** /
+ * Bus
+*/
+
+#if (RADIO_BUS == RADIO_BUS_3WIRE)
+
+#define RADIO_Bus_Tx(__VALUE__) SOFTSPI_Tx(__VALUE__)
+#define RADIO_Bus_Rx()          SOFTSPI_Rx()
+#define RADIO_Bus_DataIn()      SOFTSPI_DataIn()
+#define RADIO_Bus_DataOut()     SOFTSPI_DataOut()
+
+static void RADIO_Bus_Init(void)
+{
+    PIN_SET(RADIO_CSN_PIN);
+    PIN_SetMode(RADIO_CSN_PIN, GPIO_Mode_Output_PP);
+    SOFTSPI_Init();
+}
+
+#else
+
+#define RADIO_Bus_Tx(__VALUE__) SPI_TxRx(__VALUE__)
+#define RADIO_Bus_Rx()          SPI_TxRx(RADIO_CMD_NOP)
+#define RADIO_Bus_DataIn()
+#define RADIO_Bus_DataOut()
+
+static void RADIO_Bus_Init(void)
+{
+    PIN_SET(RADIO_CSN_PIN);
+}
+
+#endif
+
+void RADIO_Command(uint8_t cmd)
+{
+    PIN_CLR(RADIO_CSN_PIN);
+    RADIO_Bus_Tx(cmd);
+    PIN_SET(RADIO_CSN_PIN);
+}
+
+void RADIO_Write(uint8_t cmd, const uint8_t *buf, uint8_t len)
+{
+    PIN_CLR(RADIO_CSN_PIN);
+    RADIO_Bus_Tx(cmd);
+    while (len--)
+    {
+        RADIO_Bus_Tx(*buf++);
+    }
+    PIN_SET(RADIO_CSN_PIN);
+}
+
+void RADIO_Read(uint8_t cmd, uint8_t *buf, uint8_t len)
+{
+    PIN_CLR(RADIO_CSN_PIN);
+    RADIO_Bus_Tx(cmd);
+    RADIO_Bus_DataIn();
+    while (len--)
+    {
+        *buf++ = RADIO_Bus_Rx();
+    }
+    RADIO_Bus_DataOut();
+    PIN_SET(RADIO_CSN_PIN);
+}
+
+void RADIO_WriteReg(uint8_t reg, uint8_t value)
+{
+    RADIO_Write(RADIO_CMD_W_REGISTER | reg, &value, 1);
+}
+
+uint8_t RADIO_ReadReg(uint8_t reg)
+{
+    uint8_t value;
+    RADIO_Read(RADIO_CMD_R_REGISTER | reg, &value, 1);
+    return value;
+}
+
+/**************************************************************************** /
+ * Radio
+*/
+
+HAL_StatusTypeDef RADIO_Init(void)
+{
+    uint8_t i, buf[RADIO_ADDR_WIDTH];
+    const uint8_t *ptr = (const uint8_t *)RADIO_TEST_ADDR;
+
+    RADIO_Bus_Init();
+    RADIO_Chip_Reset();
+    RADIO_Write(RADIO_CMD_W_REGISTER | RADIO_REG_TX_ADDR, ptr, RADIO_ADDR_WIDTH);
+    RADIO_Read(RADIO_CMD_R_REGISTER | RADIO_REG_TX_ADDR, buf, RADIO_ADDR_WIDTH);
+    for (i = 0; i < RADIO_ADDR_WIDTH; i++)
+    {
+        if (buf[i] != ptr[i]) return HAL_ERROR;
+    }
+
+    RADIO_Chip_Init();
+    // Pipe 0 for ACKs of TX, pipe 1 for RX, both with auto-ACK and dynamic payload length
+    RADIO_WriteReg(RADIO_REG_EN_AA, 0x03);
+    RADIO_WriteReg(RADIO_REG_EN_RXADDR, 0x03);
+    RADIO_WriteReg(RADIO_REG_DYNPD, 0x03);
+    RADIO_SetRetries(RADIO_RETRY_DELAY, RADIO_RETRY_COUNT);
+    RADIO_Chip_SetRf(RADIO_Power_Max, RADIO_DataRate_1M);
+    RADIO_Command(RADIO_CMD_FLUSH_TX);
+    RADIO_Command(RADIO_CMD_FLUSH_RX);
+    RADIO_WriteReg(RADIO_REG_STATUS, RADIO_FLAG_IRQ_MASK);
+
+    memset(&RADIO_Stats, 0, sizeof(RADIO_Stats));
+    radio_rx_head = 0;
+    radio_rx_tail = 0;
+    radio_rx_pending = 0;
+    radio_tx_status = HAL_OK;
+    radio_tx_head = 0;
+    radio_tx_count = 0;
+    radio_tx_loaded = 0;
+    radio_mode = RADIO_Mode_PowerDown;
+    RADIO_SetMode(RADIO_Mode_Standby);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef RADIO_SetChannel(uint8_t channel)
+{
+    HAL_StatusTypeDef status;
+    RADIO_LOCK();
+    status = RADIO_Chip_SetChannel(channel);
+    RADIO_UNLOCK();
+    return status;
+}
+
+HAL_StatusTypeDef RADIO_SetRf(RADIO_Power_t power, RADIO_DataRate_t rate)
+{
+    HAL_StatusTypeDef status;
+    RADIO_LOCK();
+    status = RADIO_Chip_SetRf(power, rate);
+    RADIO_UNLOCK();
+    return status;
+}
+
+void RADIO_SetRetries(uint8_t delay, uint8_t count)
+{
+    RADIO_LOCK();
+    RADIO_WriteReg(RADIO_REG_SETUP_RETR, (delay << 4) | (count & 0x0F));
+    radio_retry_count = count & 0x0F;
+    RADIO_UNLOCK();
+}
+
+void RADIO_SetTxAddress(const uint8_t *address)
+{
+    RADIO_LOCK();
+    RADIO_Write(RADIO_CMD_W_REGISTER | RADIO_REG_TX_ADDR, address, RADIO_ADDR_WIDTH);
+    RADIO_Write(RADIO_CMD_W_REGISTER | RADIO_REG_RX_ADDR_P0, address, RADIO_ADDR_WIDTH);
+    RADIO_UNLOCK();
+}
+
+void RADIO_SetRxAddress(const uint8_t *address)
+{
+    RADIO_LOCK();
+    RADIO_Write(RADIO_CMD_W_REGISTER | RADIO_REG_RX_ADDR_P1, address, RADIO_ADDR_WIDTH);
+    RADIO_UNLOCK();
+}
+
+/**
+ * Write queued packets to the chip until its TX FIFO is full
+*/
+static void RADIO_TxLoad(void)
+{
+    __XDATA RADIO_Packet_t *packet;
+    while (radio_tx_loaded < radio_tx_count && radio_tx_loaded < RADIO_TX_FIFO_LEVELS)
+    {
+        packet = &radio_tx_queue[(radio_tx_head + radio_tx_loaded) & RADIO_TX_QUEUE_MASK];
+        RADIO_Write((packet->pipe)? RADIO_CMD_W_TX_PAYLOAD_NOACK : RADIO_CMD_W_TX_PAYLOAD,
+            packet->dat, packet->len);
+        radio_tx_loaded++;
+    }
+}
+
+/**
+ * Drop the queue and the TX FIFO of the chip, queued packets count as lost
+*/
+static void RADIO_TxAbort(void)
+{
+    RADIO_Command(RADIO_CMD_FLUSH_TX);
+    if (radio_tx_count > 0)
+    {
+        RADIO_Stats.tx_lost += radio_tx_count;
+        radio_tx_head = (radio_tx_head + radio_tx_count) & RADIO_TX_QUEUE_MASK;
+        radio_tx_count = 0;
+        radio_tx_status = HAL_ERROR;
+    }
+    radio_tx_loaded = 0;
+}
+
+/**
+ * TX_DS and MAX_RT. TX_DS is one flag for any number of packets, the finished ones
+ * are counted from the FIFO status: all if it is empty, otherwise one. Two packets
+ * finished between two calls are counted when the FIFO runs empty, or at MAX_RT:
+ * the failed packet stays in the FIFO, so a FIFO that isn't full holds at most
+ * two of the loaded packets. MAX_RT with two loaded packets after such an
+ * undercount, at the tail of a burst, is still charged to the sent one.
+*/
+static void RADIO_TxDone(uint8_t status)
+{
+    uint8_t done;
+    if (status & RADIO_FLAG_TX_DS)
+    {
+        done = (RADIO_ReadReg(RADIO_REG_FIFO_STATUS) & RADIO_FIFO_TX_EMPTY)? radio_tx_loaded : 1;
+        RADIO_Stats.tx_retries += RADIO_ReadReg(RADIO_REG_OBSERVE_TX) & 0x0F;
+        if (done > radio_tx_loaded)
+        {
+            done = radio_tx_loaded;
+        }
+        RADIO_Stats.tx_ok += done;
+        radio_tx_head = (radio_tx_head + done) & RADIO_TX_QUEUE_MASK;
+        radio_tx_count -= done;
+        radio_tx_loaded -= done;
+        radio_tx_status = HAL_OK;
+    }
+    if ((status & RADIO_FLAG_MAX_RT) && radio_tx_count > 0)
+    {
+        // Settle packets sent before the failed one but not counted yet
+        done = (status & RADIO_FLAG_TX_FULL)? RADIO_TX_FIFO_LEVELS : RADIO_TX_FIFO_LEVELS - 1;
+        if (radio_tx_loaded > done)
+        {
+            done = radio_tx_loaded - done;
+            RADIO_Stats.tx_ok += done;
+            radio_tx_head = (radio_tx_head + done) & RADIO_TX_QUEUE_MASK;
+            radio_tx_count -= done;
+        }
+        // Drop the packet at the head, send the ones after it again
+        RADIO_Command(RADIO_CMD_FLUSH_TX);
+        RADIO_Stats.tx_retries += radio_retry_count;
+        RADIO_Stats.tx_lost++;
+        radio_tx_head = (radio_tx_head + 1) & RADIO_TX_QUEUE_MASK;
+        radio_tx_count--;
+        radio_tx_loaded = 0;
+        radio_tx_status = HAL_ERROR;
+    }
+    if (radio_tx_count > 0)
+    {
+        RADIO_TxLoad();
+    }
+    else
+    {
+        RADIO_Chip_SetCE(HAL_State_OFF);
+        if (radio_mode == RADIO_Mode_Rx)
+        {
+            RADIO_Chip_PowerUp(HAL_State_ON);
+            RADIO_Chip_SetCE(HAL_State_ON);
+        }
+    }
+}
+
+void RADIO_SetMode(RADIO_Mode_t mode)
+{
+    RADIO_LOCK();
+    RADIO_Chip_SetCE(HAL_State_OFF);
+    if (mode == RADIO_Mode_PowerDown)
+    {
+        RADIO_Chip_PowerDown();
+    }
+    else
+    {
+        RADIO_Chip_PowerUp((mode == RADIO_Mode_Rx)? HAL_State_ON : HAL_State_OFF);
+        if (radio_mode == RADIO_Mode_PowerDown)
+        {
+            // Crystal start up, 1.5ms
+            SYS_Delay(2);
+        }
+        if (mode == RADIO_Mode_Rx)
+        {
+            RADIO_Chip_SetCE(HAL_State_ON);
+        }
+    }
+    // Queued packets are dropped, ACK payloads too when leaving RX
+    if (radio_tx_count > 0 || (radio_mode == RADIO_Mode_Rx && mode != RADIO_Mode_Rx))
+    {
+        RADIO_TxAbort();
+    }
+    radio_mode = mode;
+    RADIO_UNLOCK();
+}
+
+RADIO_Mode_t RADIO_GetMode(void)
+{
+    return radio_mode;
+}
+
+HAL_StatusTypeDef RADIO_Send(const uint8_t *buf, uint8_t len, HAL_State_t ack)
+{
+    __XDATA RADIO_Packet_t *packet;
+
+    if (len == 0 || len > RADIO_PLOAD_WIDTH || radio_mode == RADIO_Mode_PowerDown)
+    {
+        return HAL_ERROR;
+    }
+    // RADIO_TxDone() moves head and count, the free slot is read with both stable
+    RADIO_LOCK();
+    if (radio_tx_count == RADIO_TX_QUEUE_DEPTH)
+    {
+        RADIO_UNLOCK();
+        return HAL_BUSY;
+    }
+    packet = &radio_tx_queue[(radio_tx_head + radio_tx_count) & RADIO_TX_QUEUE_MASK];
+    packet->len = len;
+    packet->pipe = !ack;
+    memcpy(packet->dat, buf, len);
+    radio_tx_count++;
+    if (radio_tx_loaded == 0)
+    {
+        if (radio_mode == RADIO_Mode_Rx)
+        {
+            RADIO_Chip_SetCE(HAL_State_OFF);
+            RADIO_Chip_PowerUp(HAL_State_OFF);
+        }
+        RADIO_TxLoad();
+        RADIO_Chip_SetCE(HAL_State_ON);
+    }
+    else
+    {
+        RADIO_TxLoad();
+    }
+    RADIO_UNLOCK();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef RADIO_GetTxStatus(void)
+{
+    return (radio_tx_count > 0)? HAL_BUSY : (HAL_StatusTypeDef)radio_tx_status;
+}
+
+uint8_t RADIO_GetTxFree(void)
+{
+    return RADIO_TX_QUEUE_DEPTH - radio_tx_count;
+}
+
+HAL_StatusTypeDef RADIO_SetAckPayload(uint8_t pipe, const uint8_t *buf, uint8_t len)
+{
+    if (pipe > 5 || len == 0 || len > RADIO_PLOAD_WIDTH)
+    {
+        return HAL_ERROR;
+    }
+    RADIO_LOCK();
+    RADIO_Write(RADIO_CMD_W_ACK_PAYLOAD | pipe, buf, len);
+    RADIO_UNLOCK();
+    return HAL_OK;
+}
+
+uint8_t RADIO_Available(void)
+{
+    return (radio_rx_head - radio_rx_tail) & RADIO_RX_FIFO_MASK;
+}
+
+/**
+ * Move packets from the chip to the RX FIFO until either is empty/full
+*/
+static void RADIO_ReadRxFifo(void)
+{
+    uint8_t len, head;
+    __XDATA RADIO_Packet_t *packet;
+
+    while (!(RADIO_ReadReg(RADIO_REG_FIFO_STATUS) & RADIO_FIFO_RX_EMPTY))
+    {
+        head = (radio_rx_head + 1) & RADIO_RX_FIFO_MASK;
+        if (head == radio_rx_tail)
+        {
+            // Leave them in the chip, read after RADIO_Receive()
+            radio_rx_pending = 1;
+            return;
+        }
+        RADIO_Read(RADIO_CMD_R_RX_PL_WID, &len, 1);
+        if (len == 0 || len > RADIO_PLOAD_WIDTH)
+        {
+            RADIO_Command(RADIO_CMD_FLUSH_RX);
+            RADIO_Stats.rx_error++;
+            return;
+        }
+        packet = &radio_rx_fifo[radio_rx_head];
+        packet->len = len;
+        packet->pipe = (RADIO_ReadReg(RADIO_REG_STATUS) >> 1) & 0x07;
+        RADIO_Read(RADIO_CMD_R_RX_PAYLOAD, packet->dat, len);
+        radio_rx_head = head;
+        RADIO_Stats.rx++;
+    }
+}
+
+uint8_t RADIO_Receive(uint8_t *buf, uint8_t *pipe)
+{
+    uint8_t len;
+    __XDATA RADIO_Packet_t *packet;
+
+    if (radio_rx_head == radio_rx_tail)
+    {
+        return 0;
+    }
+    packet = &radio_rx_fifo[radio_rx_tail];
+    len = packet->len;
+    memcpy(buf, packet->dat, len);
+    if (pipe != NULL)
+    {
+        *pipe = packet->pipe;
+    }
+    radio_rx_tail = (radio_rx_tail + 1) & RADIO_RX_FIFO_MASK;
+    if (radio_rx_pending)
+    {
+        RADIO_LOCK();
+        radio_rx_pending = 0;
+        RADIO_ReadRxFifo();
+        RADIO_UNLOCK();
+    }
+    return len;
+}
+
+void RADIO_FlushRx(void)
+{
+    RADIO_LOCK();
+    RADIO_Command(RADIO_CMD_FLUSH_RX);
+    radio_rx_tail = radio_rx_head;
+    radio_rx_pending = 0;
+    RADIO_UNLOCK();
+}
+
+void RADIO_FlushTx(void)
+{
+    RADIO_LOCK();
+    RADIO_TxAbort();
+    RADIO_UNLOCK();
+}
+
+void RADIO_SetIntState(HAL_State_t state)
+{
+    RADIO_IRQ_DISABLE();
+    radio_irq = state;
+    if (state)
+    {
+        // The pin interrupt is edge triggered, clear what is pending
+        RADIO_IRQHandler();
+        RADIO_IRQ_ENABLE();
+    }
+}
+
+void RADIO_IRQHandler(void)
+{
+    uint8_t status;
+
+    while ((status = RADIO_ReadReg(RADIO_REG_STATUS)) & RADIO_FLAG_IRQ_MASK)
+    {
+        // Clear first, events after this assert the IRQ pin again
+        RADIO_WriteReg(RADIO_REG_STATUS, status & RADIO_FLAG_IRQ_MASK);
+        if ((status & RADIO_FLAG_RX_DR) && !radio_rx_pending)
+        {
+            RADIO_ReadRxFifo();
+        }
+        // In RX mode TX_DS also flags a sent ACK payload
+        if ((status & (RADIO_FLAG_TX_DS | RADIO_FLAG_MAX_RT)) && radio_tx_loaded > 0)
+        {
+            RADIO_TxDone(status);
+        }
+    }
+}
+
+void RADIO_Poll(void)
+{
+    RADIO_LOCK();
+    RADIO_IRQHandler();
+    RADIO_UNLOCK();
+}
@@ -0,0 +1,307 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __FW_RADIO_H__
+#define __FW_RADIO_H__
+
+#include "fw_hal.h"
+#include "string.h"
+
+/**
+ * 2.4GHz radio with one API for nRF24L01, XL2400 and CI24R1
+ *
+ * The three chips share the nRF24L01 command set, status flags and FIFO model, they differ
+ * in the bus, the CE line, channel/power registers and some init. radio.c holds the bus and
+ * the common logic, radio_<chip>.c the chip specific part, the chip is selected at build
+ * time by RADIO_CHIP, the other backends compile to nothing.
+ *
+ * - Pipe 0 receives ACKs for the TX address, pipe 1 listens on the RX address
+ * - Dynamic payload length 1 - 32 bytes, auto-ACK, ACK with payload and no-ACK packets
+ * - Received packets, including ACK payloads, are moved by RADIO_IRQHandler() to a software
+ *   FIFO, when it is full they stay in the 3-level hardware FIFO and the chip stops acking
+ * - RADIO_Send() puts packets in a TX queue and returns at once, the handler keeps the
+ *   3-level TX FIFO of the chip filled from it, CE stays high until the queue is empty.
+ *   A packet lost after the last retransmit is dropped and the ones after it are sent
+ *
+ * nRF24L01 signals events on its IRQ pin: route the pin interrupt to RADIO_IRQHandler()
+ * and enable it with RADIO_SetIntState(). XL2400 and CI24R1 have no IRQ line in 3/4-pin
+ * mode, call RADIO_Poll() from the main loop instead.
+ * For hardware SPI, set SPI to master mode, MSB first, CPOL 0, CPHA 0 and ignore SS
+ * before RADIO_Init().
+*/
+
+#define RADIO_CHIP_NRF24L01         0
+#define RADIO_CHIP_XL2400           1
+#define RADIO_CHIP_CI24R1           2
+
+#ifndef RADIO_CHIP
+#define RADIO_CHIP                  RADIO_CHIP_NRF24L01
+#endif
+
+#define RADIO_BUS_SPI               0   // Hardware SPI: CSN, SCK, MOSI, MISO
+#define RADIO_BUS_3WIRE             1   // GPIO: CSN, SCK and bidirectional DATA
+
+#ifndef RADIO_BUS
+#if (RADIO_CHIP == RADIO_CHIP_CI24R1)
+#define RADIO_BUS                   RADIO_BUS_3WIRE
+#else
+#define RADIO_BUS                   RADIO_BUS_SPI
+#endif
+#endif
+
+#ifndef RADIO_CSN_PIN
+#define RADIO_CSN_PIN               GPIO_PIN(3, 5)
+#endif
+/**
+ * nRF24L01 only, XL2400 and CI24R1 switch CE by register and command
+*/
+#ifndef RADIO_CE_PIN
+#define RADIO_CE_PIN                GPIO_PIN(3, 7)
+#endif
+/**
+ * RADIO_BUS_3WIRE runs on fw_softspi, SCK and DATA are SOFTSPI_SCK_PIN and
+ * SOFTSPI_MOSI_PIN, P3.2 and P3.4 by default
+*/
+
+/**
+ * Mask the interrupt that calls RADIO_IRQHandler() while the API uses the bus from main
+ * context, default INT2 on P3.6. Empty for chips without IRQ line.
+*/
+#ifndef RADIO_IRQ_ENABLE
+#if (RADIO_CHIP == RADIO_CHIP_NRF24L01)
+#define RADIO_IRQ_ENABLE()          EXTI_Int2_SetIntState(HAL_State_ON)
+#define RADIO_IRQ_DISABLE()         EXTI_Int2_SetIntState(HAL_State_OFF)
+#else
+#define RADIO_IRQ_ENABLE()
+#define RADIO_IRQ_DISABLE()
+#endif
+#endif
+
+/**
+ * Slots of received packets in XDATA, 34 bytes each, power of 2, holds depth - 1 packets
+*/
+#ifndef RADIO_RX_FIFO_DEPTH
+#define RADIO_RX_FIFO_DEPTH         4
+#endif
+/**
+ * Packets waiting to be sent, in XDATA, 34 bytes each, power of 2. 1 for one packet
+ * at a time.
+*/
+#ifndef RADIO_TX_QUEUE_DEPTH
+#define RADIO_TX_QUEUE_DEPTH        4
+#endif
+/**
+ * Auto retransmit, delay in 250us steps [0, 15] and count [0, 15]. An ACK with 32 bytes
+ * payload needs 500us at 1Mbps and 1500us at 250Kbps.
+*/
+#ifndef RADIO_RETRY_DELAY
+#define RADIO_RETRY_DELAY           3
+#endif
+#ifndef RADIO_RETRY_COUNT
+#define RADIO_RETRY_COUNT           3
+#endif
+
+#define RADIO_ADDR_WIDTH            5
+#define RADIO_PLOAD_WIDTH           32
+#define RADIO_PIPE_TX               0
+#define RADIO_PIPE_RX               1
+#define RADIO_TEST_ADDR             "RADIO"
+
+/****************** Commands, common to the three chips ********************/
+#define RADIO_CMD_R_REGISTER        0x00 // [000A AAAA] Register read
+#define RADIO_CMD_W_REGISTER        0x20 // [001A AAAA] Register write
+#define RADIO_CMD_R_RX_PAYLOAD      0x61 // Read RX payload
+#define RADIO_CMD_W_TX_PAYLOAD      0xA0 // Write TX payload
+#define RADIO_CMD_FLUSH_TX          0xE1 // Flush TX FIFO
+#define RADIO_CMD_FLUSH_RX          0xE2 // Flush RX FIFO
+#define RADIO_CMD_R_RX_PL_WID       0x60 // Read RX payload width of the top packet
+#define RADIO_CMD_W_ACK_PAYLOAD     0xA8 // [1010 1PPP] Write ACK payload of pipe PPP
+#define RADIO_CMD_W_TX_PAYLOAD_NOACK 0xB0 // Write TX payload, no ACK requested
+#define RADIO_CMD_NOP               0xFF // No operation
+
+/****************** Registers, common to the three chips ********************/
+#define RADIO_REG_CONFIG            0x00
+#define RADIO_REG_EN_AA             0x01
+#define RADIO_REG_EN_RXADDR         0x02
+#define RADIO_REG_SETUP_AW          0x03
+#define RADIO_REG_SETUP_RETR        0x04
+#define RADIO_REG_RF_CH             0x05
+#define RADIO_REG_RF_SETUP          0x06
+#define RADIO_REG_STATUS            0x07
+#define RADIO_REG_OBSERVE_TX        0x08
+#define RADIO_REG_RX_ADDR_P0        0x0A
+#define RADIO_REG_RX_ADDR_P1        0x0B
+#define RADIO_REG_TX_ADDR           0x10
+#define RADIO_REG_FIFO_STATUS       0x17
+#define RADIO_REG_DYNPD             0x1C
+#define RADIO_REG_FEATURE           0x1D
+
+#define RADIO_FLAG_RX_DR            0x40 // Data ready
+#define RADIO_FLAG_TX_DS            0x20 // Data sent (and acked)
+#define RADIO_FLAG_MAX_RT           0x10 // Max retransmits reached
+#define RADIO_FLAG_IRQ_MASK         0x70
+#define RADIO_FLAG_TX_FULL          0x01
+#define RADIO_FIFO_RX_EMPTY         0x01 // FIFO_STATUS bit 0
+#define RADIO_FIFO_TX_EMPTY         0x10 // FIFO_STATUS bit 4
+
+#define RADIO_FEATURE_EN_DYN_ACK    0x01
+#define RADIO_FEATURE_EN_ACK_PAY    0x02
+#define RADIO_FEATURE_EN_DPL        0x04
+
+typedef enum
+{
+    RADIO_Power_Min     = 0x00,   // nRF24L01 -18dBm, XL2400 -18dBm, CI24R1 -9dBm
+    RADIO_Power_Low     = 0x01,   // nRF24L01 -12dBm, XL2400 -12dBm, CI24R1 -4dBm
+    RADIO_Power_High    = 0x02,   // nRF24L01  -6dBm, XL2400  -6dBm, CI24R1  3dBm
+    RADIO_Power_Max     = 0x03,   // nRF24L01   0dBm, XL2400   0dBm, CI24R1 11dBm
+} RADIO_Power_t;
+
+typedef enum
+{
+    RADIO_DataRate_250K = 0x00,
+    RADIO_DataRate_1M   = 0x01,
+    RADIO_DataRate_2M   = 0x02,   // Not supported by XL2400
+} RADIO_DataRate_t;
+
+typedef enum
+{
+    RADIO_Mode_PowerDown = 0x00,
+    RADIO_Mode_Standby   = 0x01,  // Powered up, TX ready
+    RADIO_Mode_Rx        = 0x02,  // Listening, returns to RX after each TX
+} RADIO_Mode_t;
+
+typedef struct
+{
+    uint8_t len;
+    uint8_t pipe;
+    uint8_t dat[RADIO_PLOAD_WIDTH];
+} RADIO_Packet_t;
+
+typedef struct
+{
+    uint16_t tx_ok;         // Packets acked, or sent if no ACK was requested
+    uint16_t tx_lost;       // Packets dropped after the last retransmit, or by flush/mode change
+    uint16_t tx_retries;    // Retransmits, ARC_CNT of the last packet of each TX_DS
+    uint16_t rx;            // Packets moved to the RX FIFO, ACK payloads included
+    uint16_t rx_error;      // Packets with bad length, RX FIFO of the chip flushed
+} RADIO_Stats_t;
+
+extern RADIO_Stats_t RADIO_Stats;
+
+/**
+ * Check the bus by writing and reading back the TX address, then set up pipe 0/1,
+ * dynamic payload length and ACK payload, 1Mbps at max power, and enter standby.
+ * Returns HAL_ERROR if the chip doesn't answer.
+*/
+HAL_StatusTypeDef RADIO_Init(void);
+/**
+ * nRF24L01, CI24R1: [0, 125], 2400 + channel MHz; XL2400: [0, 80]
+*/
+HAL_StatusTypeDef RADIO_SetChannel(uint8_t channel);
+/**
+ * HAL_ERROR if the data rate is not supported by the chip
+*/
+HAL_StatusTypeDef RADIO_SetRf(RADIO_Power_t power, RADIO_DataRate_t rate);
+void RADIO_SetRetries(uint8_t delay, uint8_t count);
+/**
+ * Address of the peer, also set to pipe 0 to receive its ACKs
+*/
+void RADIO_SetTxAddress(const uint8_t *address);
+/**
+ * Own address, pipe 1
+*/
+void RADIO_SetRxAddress(const uint8_t *address);
+void RADIO_SetMode(RADIO_Mode_t mode);
+RADIO_Mode_t RADIO_GetMode(void);
+/**
+ * Queue one packet, len [1, 32], and start sending. ack: request auto-ACK and retransmit.
+ * Returns HAL_BUSY if the TX queue is full, HAL_ERROR on bad length or in power down mode.
+*/
+HAL_StatusTypeDef RADIO_Send(const uint8_t *buf, uint8_t len, HAL_State_t ack);
+/**
+ * HAL_BUSY: queue not empty, HAL_OK: last packet acked or sent,
+ * HAL_ERROR: last packet lost after the last retransmit
+*/
+HAL_StatusTypeDef RADIO_GetTxStatus(void);
+/**
+ * Free slots of the TX queue
+*/
+uint8_t RADIO_GetTxFree(void);
+/**
+ * Load a payload for the ACK of the next packet received on the pipe, the chip keeps
+ * up to 3. On the sender the payload arrives in the RX FIFO on pipe 0.
+ * ACK payloads share the TX FIFO, RADIO_Send() in RX mode sends the loaded ones first,
+ * they are flushed when leaving RX mode.
+*/
+HAL_StatusTypeDef RADIO_SetAckPayload(uint8_t pipe, const uint8_t *buf, uint8_t len);
+/**
+ * Number of packets in the RX FIFO
+*/
+uint8_t RADIO_Available(void);
+/**
+ * Copy the oldest packet to buf (32 bytes), returns its length, 0 if the FIFO is empty.
+ * pipe can be NULL.
+*/
+uint8_t RADIO_Receive(uint8_t *buf, uint8_t *pipe);
+void RADIO_FlushRx(void);
+/**
+ * Drop the TX queue and the TX FIFO of the chip, ACK payloads included
+*/
+void RADIO_FlushTx(void);
+/**
+ * Enable calling RADIO_IRQHandler() from the pin interrupt, pending events are
+ * handled before the interrupt is enabled
+*/
+void RADIO_SetIntState(HAL_State_t state);
+/**
+ * Read the status, move received packets to the RX FIFO and finish TX.
+ * Call from the IRQ pin interrupt, e.g.
+ *   INTERRUPT(Int2_Routine, EXTI_VectInt2) { RADIO_IRQHandler(); }
+*/
+void RADIO_IRQHandler(void);
+/**
+ * RADIO_IRQHandler() from main context, for chips without IRQ line
+*/
+void RADIO_Poll(void);
+
+/**************************************************************************** /
+ * Bus, in radio.c
+*/
+void RADIO_Command(uint8_t cmd);
+void RADIO_Write(uint8_t cmd, const uint8_t *buf, uint8_t len);
+void RADIO_Read(uint8_t cmd, uint8_t *buf, uint8_t len);
+void RADIO_WriteReg(uint8_t reg, uint8_t value);
+uint8_t RADIO_ReadReg(uint8_t reg);
+
+/**************************************************************************** /
+ * Backend, in radio_<chip>.c
+*/
+/**
+ * CE low and the bus interface ready, before the bus check
+*/
+void RADIO_Chip_Reset(void);
+/**
+ * Chip specific registers after the bus check, including SETUP_AW and FEATURE
+*/
+void RADIO_Chip_Init(void);
+void RADIO_Chip_SetCE(HAL_State_t state);
+/**
+ * Power up, PRIM_RX set or cleared, CE is low
+*/
+void RADIO_Chip_PowerUp(HAL_State_t rx);
+void RADIO_Chip_PowerDown(void);
+HAL_StatusTypeDef RADIO_Chip_SetChannel(uint8_t channel);
+HAL_StatusTypeDef RADIO_Chip_SetRf(RADIO_Power_t power, RADIO_DataRate_t rate);
+
+#endif
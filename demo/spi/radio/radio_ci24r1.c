@@ -0,0 +1,74 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "radio.h"
+
+#if (RADIO_CHIP == RADIO_CHIP_CI24R1)
+
+#define CI24R1_CMD_CE_ON        0x70 // CE high
+#define CI24R1_CMD_CE_OFF       0x71 // CE low
+#define CI24R1_CMD_SELSPI       0x74 // DATA pin as SPI
+#define CI24R1_CONFIG_PWR_DOWN  0x0C // CRC 2 bytes
+#define CI24R1_CONFIG_PWR_UP    0x0E
+#define CI24R1_CONFIG_PRIM_RX   0x01
+
+// RF_SETUP bit 5: 250Kbps, bit 3: 2Mbps
+static __CODE uint8_t ci24r1_rates[3] = {0x20, 0x00, 0x08};
+// RF_SETUP[2:0], -9dBm, -4dBm, 3dBm, 11dBm
+static __CODE uint8_t ci24r1_powers[4] = {0x00, 0x01, 0x03, 0x07};
+
+void RADIO_Chip_Reset(void)
+{
+    RADIO_Command(CI24R1_CMD_CE_OFF);
+    RADIO_Command(CI24R1_CMD_SELSPI);
+}
+
+void RADIO_Chip_Init(void)
+{
+    // Address width 5 bytes
+    RADIO_WriteReg(RADIO_REG_SETUP_AW, 0x03);
+    RADIO_WriteReg(RADIO_REG_FEATURE,
+        RADIO_FEATURE_EN_DPL | RADIO_FEATURE_EN_ACK_PAY | RADIO_FEATURE_EN_DYN_ACK);
+    RADIO_WriteReg(RADIO_REG_CONFIG, CI24R1_CONFIG_PWR_DOWN);
+}
+
+void RADIO_Chip_SetCE(HAL_State_t state)
+{
+    RADIO_Command(state? CI24R1_CMD_CE_ON : CI24R1_CMD_CE_OFF);
+}
+
+void RADIO_Chip_PowerUp(HAL_State_t rx)
+{
+    RADIO_WriteReg(RADIO_REG_CONFIG, CI24R1_CONFIG_PWR_UP | (rx? CI24R1_CONFIG_PRIM_RX : 0x00));
+}
+
+void RADIO_Chip_PowerDown(void)
+{
+    RADIO_WriteReg(RADIO_REG_CONFIG, CI24R1_CONFIG_PWR_DOWN);
+}
+
+HAL_StatusTypeDef RADIO_Chip_SetChannel(uint8_t channel)
+{
+    if (channel > 125) return HAL_ERROR;
+    RADIO_WriteReg(RADIO_REG_RF_CH, channel);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef RADIO_Chip_SetRf(RADIO_Power_t power, RADIO_DataRate_t rate)
+{
+    RADIO_WriteReg(RADIO_REG_RF_SETUP, ci24r1_rates[rate] | ci24r1_powers[power]);
+    return HAL_OK;
+}
+
+#endif
@@ -0,0 +1,581 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "radio_link.h"
+
+#define LINK_SACK_SIZE          12
+#define LINK_BITMAP_SIZE        8
+#define LINK_CHANNEL_NONE       0xFF
+// Bursts on each channel when the sender scans the hop set, they span the receiver's
+// dwell on both of its channels
+#define LINK_SCAN_BURSTS        (2 * LINK_DWELL_TIMEOUT / (LINK_ACK_TIMEOUT + LINK_WINDOW * LINK_FRAME_TIME / 1000) + 1)
+
+#define LINK_TX_IDLE            0x00
+#define LINK_TX_BURST           0x01    // Fragments being queued
+#define LINK_TX_WAIT            0x02    // Waiting for SACK
+#define LINK_TX_HOLD            0x03    // Waiting for the receiver to retune
+
+#define LINK_BIT_GET(__MAP__, __N__)    ((__MAP__)[(__N__) >> 3] & (0x01 << ((__N__) & 0x07)))
+#define LINK_BIT_SET(__MAP__, __N__)    ((__MAP__)[(__N__) >> 3] |= (0x01 << ((__N__) & 0x07)))
+
+typedef struct
+{
+    // Sender
+    const uint8_t *tx_buf;
+    uint16_t tx_len;
+    uint16_t tx_timer;
+    uint8_t tx_state;
+    uint8_t tx_status;
+    uint8_t tx_msg;
+    uint8_t tx_last;                    // Sequence number of the last fragment
+    uint8_t tx_seq;                     // Next fragment to check in the burst
+    uint8_t tx_left;                    // Fragments of the burst not queued
+    uint8_t tx_burst;                   // Tag << 5 | (fragments - 1)
+    uint8_t tx_retries;
+    uint16_t tx_scan;                   // Bursts sent while scanning the hop set
+    uint8_t tx_fallback;                // LINK_FRAME_FALLBACK after a timeout hop
+    uint8_t tx_acked[LINK_BITMAP_SIZE];
+    uint8_t tx_sent[LINK_BITMAP_SIZE];
+    // Receiver
+    uint8_t *rx_buf;
+    uint16_t rx_size;
+    uint16_t rx_len;
+    uint16_t rx_timer;                  // SACK of a burst whose last fragment is lost
+    uint8_t rx_listen;                  // Buffer given and message not complete
+    uint8_t rx_started;
+    uint8_t rx_done;                    // Message complete since LINK_Listen()
+    uint8_t rx_complete;                // rx_msg is complete, rx_have is full
+    uint8_t rx_sacked;
+    uint8_t rx_msg;
+    uint8_t rx_last;
+    uint8_t rx_burst;
+    uint8_t rx_count;                   // Fragments received of the burst, 0: no burst
+    uint8_t rx_lost;                    // Dwell timeouts since a SACK without the next burst, 0: off
+    uint8_t rx_have[LINK_BITMAP_SIZE];
+    // Hopping, channel indexes
+    uint16_t dwell_timer;
+    uint8_t ch;                         // Channel of the sender
+    uint8_t alt;                        // The other candidate while a SACK may be lost
+    uint8_t tuned;
+    uint8_t hop;
+    uint8_t lfsr;
+    uint8_t loss[LINK_CHANNEL_NUM];
+    uint8_t ticks;
+    uint8_t frame[RADIO_PLOAD_WIDTH];
+} LINK_State_t;
+
+LINK_Stats_t LINK_Stats;
+
+static __XDATA LINK_State_t link;
+static volatile uint8_t link_ticks;
+
+/**************************************************************************** /
+ * Channels
+*/
+
+static void LINK_Tune(uint8_t index)
+{
+    if (index != link.tuned)
+    {
+        link.tuned = index;
+        RADIO_SetChannel(LINK_CHANNEL_FIRST + index * LINK_CHANNEL_STEP);
+        RADIO_SetMode(RADIO_Mode_Rx);
+    }
+    link.dwell_timer = LINK_DWELL_TIMEOUT;
+}
+
+/**
+ * Moving average of the loss ratio, sample [0, 255]. Weighted 1/2 so one bad burst
+ * is enough to skip the channel
+*/
+static void LINK_Score(uint8_t index, uint8_t sample)
+{
+    int16_t diff = (int16_t)sample - link.loss[index];
+    link.loss[index] = (uint8_t)(link.loss[index] + diff / 2);
+}
+
+/**
+ * Channel with the lowest loss score other than the current one
+*/
+static uint8_t LINK_BestChannel(void)
+{
+    uint8_t i, index = (link.ch + 1) % LINK_CHANNEL_NUM;
+    for (i = 0; i < LINK_CHANNEL_NUM; i++)
+    {
+        if (i != link.ch && link.loss[i] < link.loss[index])
+        {
+            index = i;
+        }
+    }
+    return index;
+}
+
+static uint8_t LINK_NextChannel(void)
+{
+    uint8_t i, index = link.ch;
+    for (i = 0; i < LINK_CHANNEL_NUM; i++)
+    {
+        // Galois LFSR, x^8 + x^6 + x^5 + x^4 + 1
+        link.lfsr = (link.lfsr >> 1) ^ ((link.lfsr & 0x01)? 0xB8 : 0x00);
+        index = link.lfsr % LINK_CHANNEL_NUM;
+        if (link.loss[index] > LINK_CHANNEL_BAD)
+        {
+            // Skipped, decays so the channel is tried again
+            link.loss[index] -= (link.loss[index] >> 5) + 1;
+        }
+        else if (index != link.ch)
+        {
+            break;
+        }
+    }
+    return index;
+}
+
+/**************************************************************************** /
+ * Sender
+*/
+
+static void LINK_StartBurst(void)
+{
+    uint8_t seq, count = 0;
+    link.tx_seq = 0xFF;
+    for (seq = 0; seq <= link.tx_last && count < LINK_WINDOW; seq++)
+    {
+        if (!LINK_BIT_GET(link.tx_acked, seq))
+        {
+            if (count++ == 0)
+            {
+                link.tx_seq = seq;
+            }
+        }
+    }
+    if (count == 0)
+    {
+        link.tx_state = LINK_TX_IDLE;
+        link.tx_status = HAL_OK;
+        return;
+    }
+    link.tx_left = count;
+    link.tx_burst = (((link.tx_burst >> 5) + 1) << 5) | (count - 1);
+    link.tx_state = LINK_TX_BURST;
+}
+
+static void LINK_SendFragments(void)
+{
+    uint8_t len;
+    uint16_t offset;
+    while (link.tx_left > 0 && RADIO_GetTxFree() > 0)
+    {
+        while (LINK_BIT_GET(link.tx_acked, link.tx_seq))
+        {
+            link.tx_seq++;
+        }
+        offset = (uint16_t)link.tx_seq * LINK_FRAG_SIZE;
+        len = (link.tx_seq == link.tx_last)? (uint8_t)(link.tx_len - offset) : LINK_FRAG_SIZE;
+        link.frame[0] = LINK_FRAME_DATA | link.tx_fallback | (link.tx_left - 1);
+        link.frame[1] = link.tx_msg;
+        link.frame[2] = link.tx_seq;
+        link.frame[3] = link.tx_last;
+        link.frame[4] = link.tx_burst;
+        memcpy(link.frame + LINK_HEADER_SIZE, link.tx_buf + offset, len);
+        if (RADIO_Send(link.frame, LINK_HEADER_SIZE + len, HAL_State_OFF) != HAL_OK)
+        {
+            break;
+        }
+        if (LINK_BIT_GET(link.tx_sent, link.tx_seq))
+        {
+            LINK_Stats.tx_repeats++;
+        }
+        LINK_BIT_SET(link.tx_sent, link.tx_seq);
+        LINK_Stats.tx_frames++;
+        link.tx_seq++;
+        link.tx_left--;
+    }
+    if (link.tx_left == 0)
+    {
+        link.tx_state = LINK_TX_WAIT;
+        link.tx_timer = LINK_ACK_TIMEOUT;
+    }
+}
+
+static void LINK_HandleSack(void)
+{
+    uint8_t i;
+    if (link.tx_state != LINK_TX_WAIT
+        || link.frame[1] != link.tx_msg
+        || link.frame[2] != link.tx_burst
+        || link.frame[3] >= LINK_CHANNEL_NUM)
+    {
+        return;
+    }
+    for (i = 0; i < LINK_BITMAP_SIZE; i++)
+    {
+        link.tx_acked[i] |= link.frame[4 + i];
+    }
+    link.tx_retries = 0;
+    link.tx_scan = 0;
+    link.tx_fallback = 0;
+    link.alt = link.ch;
+    link.ch = link.frame[3];
+    link.hop = link.ch;
+    LINK_StartBurst();
+    if (link.tx_state == LINK_TX_BURST)
+    {
+        link.tx_state = LINK_TX_HOLD;
+        link.tx_timer = LINK_HOP_DELAY + 1;
+    }
+}
+
+/**************************************************************************** /
+ * Receiver
+*/
+
+static void LINK_SendSack(void)
+{
+    uint8_t len = (link.rx_burst & 0x1F) + 1;
+    if (link.rx_count < len)
+    {
+        LINK_Score(link.ch, (uint8_t)((uint16_t)(len - link.rx_count) * 255 / len));
+    }
+    else
+    {
+        LINK_Score(link.ch, 0);
+    }
+    link.alt = link.ch;
+    link.ch = LINK_NextChannel();
+    link.frame[0] = LINK_FRAME_SACK;
+    link.frame[1] = link.rx_msg;
+    link.frame[2] = link.rx_burst;
+    link.frame[3] = link.ch;
+    memcpy(link.frame + 4, link.rx_have, LINK_BITMAP_SIZE);
+    RADIO_Send(link.frame, LINK_SACK_SIZE, HAL_State_OFF);
+    link.hop = link.ch;
+    link.rx_count = 0;
+    link.rx_timer = 0;
+    link.rx_sacked = 1;
+    link.rx_lost = 1;
+}
+
+static void LINK_Store(uint8_t seq, uint8_t len)
+{
+    uint8_t i;
+    uint16_t offset = (uint16_t)seq * LINK_FRAG_SIZE;
+    if (LINK_BIT_GET(link.rx_have, seq))
+    {
+        LINK_Stats.rx_duplicates++;
+        return;
+    }
+    if (seq == link.rx_last)
+    {
+        if (offset + len > link.rx_size)
+        {
+            return;
+        }
+        link.rx_len = offset + len;
+    }
+    else if (len != LINK_FRAG_SIZE)
+    {
+        return;
+    }
+    memcpy(link.rx_buf + offset, link.frame + LINK_HEADER_SIZE, len);
+    LINK_BIT_SET(link.rx_have, seq);
+    for (i = 0; i <= link.rx_last; i++)
+    {
+        if (!LINK_BIT_GET(link.rx_have, i))
+        {
+            return;
+        }
+    }
+    link.rx_done = 1;
+    link.rx_complete = 1;
+    link.rx_listen = 0;
+}
+
+static void LINK_HandleData(uint8_t len)
+{
+    uint8_t msg = link.frame[1], seq = link.frame[2], last = link.frame[3], burst = link.frame[4];
+    uint8_t lost;
+
+    if (seq > last || last >= LINK_BITMAP_SIZE * 8)
+    {
+        return;
+    }
+    if (link.rx_complete && msg == link.rx_msg)
+    {
+        // The sender missed the last SACK, ack the complete message again
+    }
+    else if (!link.rx_listen)
+    {
+        return;
+    }
+    else
+    {
+        if (!link.rx_started || msg != link.rx_msg)
+        {
+            if ((uint16_t)last * LINK_FRAG_SIZE >= link.rx_size)
+            {
+                return;
+            }
+            link.rx_started = 1;
+            link.rx_complete = 0;
+            link.rx_msg = msg;
+            link.rx_last = last;
+            memset(link.rx_have, 0, LINK_BITMAP_SIZE);
+        }
+        else if (last != link.rx_last)
+        {
+            return;
+        }
+        LINK_Store(seq, len - LINK_HEADER_SIZE);
+    }
+    LINK_Stats.rx_frames++;
+    link.dwell_timer = LINK_DWELL_TIMEOUT;
+    if (link.tuned == link.ch && link.rx_count == 0)
+    {
+        // A burst on the channel of the last SACK, the sender follows
+        link.rx_lost = 0;
+    }
+
+    if (link.tuned != link.ch)
+    {
+        // Heard on the old channel: the sender fell back from the new channel, or it
+        // missed the SACK on the old one
+        link.alt = link.ch;
+        link.ch = link.tuned;
+        LINK_Score((link.frame[0] & LINK_FRAME_FALLBACK)? link.alt : link.ch, 255);
+    }
+    else if (link.rx_count == 0 && link.rx_sacked)
+    {
+        // Bursts sent since the last SACK and not heard at all
+        lost = ((burst >> 5) - (link.rx_burst >> 5) - 1) & 0x07;
+        while (lost-- > 0)
+        {
+            LINK_Score(link.ch, 255);
+        }
+    }
+    if (link.rx_count == 0 || burst != link.rx_burst)
+    {
+        link.rx_burst = burst;
+        link.rx_count = 0;
+    }
+    link.rx_count++;
+    if ((link.frame[0] & LINK_FRAME_LEFT) == 0)
+    {
+        LINK_SendSack();
+    }
+    else
+    {
+        link.rx_timer = (uint16_t)(link.frame[0] & LINK_FRAME_LEFT) * LINK_FRAME_TIME / 1000 + 2;
+    }
+}
+
+/**************************************************************************** /
+ * API
+*/
+
+void LINK_Init(void)
+{
+    memset(&link, 0, sizeof(link));
+    memset(&LINK_Stats, 0, sizeof(LINK_Stats));
+    link.tx_status = HAL_OK;
+    link.hop = LINK_CHANNEL_NONE;
+    link.lfsr = 0xE1;
+    link.ticks = link_ticks;
+    link.tuned = LINK_CHANNEL_NONE;
+    LINK_Tune(0);
+}
+
+HAL_StatusTypeDef LINK_Send(const uint8_t *buf, uint16_t len)
+{
+    if (link.tx_state != LINK_TX_IDLE)
+    {
+        return HAL_BUSY;
+    }
+    if (len == 0 || len > LINK_MSG_MAX)
+    {
+        return HAL_ERROR;
+    }
+    link.tx_buf = buf;
+    link.tx_len = len;
+    link.tx_msg++;
+    link.tx_last = (uint8_t)((len - 1) / LINK_FRAG_SIZE);
+    link.tx_retries = 0;
+    link.tx_scan = 0;
+    memset(link.tx_acked, 0, LINK_BITMAP_SIZE);
+    memset(link.tx_sent, 0, LINK_BITMAP_SIZE);
+    link.tx_status = HAL_BUSY;
+    // Back to the channel of the receiver if dwelling on the other one
+    if (link.tuned != link.ch)
+    {
+        link.hop = link.ch;
+    }
+    LINK_StartBurst();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef LINK_GetTxStatus(void)
+{
+    return (HAL_StatusTypeDef)link.tx_status;
+}
+
+void LINK_Listen(uint8_t *buf, uint16_t size)
+{
+    link.rx_buf = buf;
+    link.rx_size = size;
+    link.rx_len = 0;
+    link.rx_started = 0;
+    link.rx_done = 0;
+    link.rx_listen = 1;
+}
+
+uint16_t LINK_Received(void)
+{
+    return link.rx_done? link.rx_len : 0;
+}
+
+uint8_t LINK_GetChannelLoss(uint8_t index)
+{
+    return link.loss[index];
+}
+
+/**
+ * Count down a timer, returns 1 when it expires
+*/
+static uint8_t LINK_Timer(uint16_t *timer, uint8_t elapsed)
+{
+    if (*timer == 0)
+    {
+        return 0;
+    }
+    if (*timer > elapsed)
+    {
+        *timer -= elapsed;
+        return 0;
+    }
+    *timer = 0;
+    return 1;
+}
+
+void LINK_Process(void)
+{
+    uint8_t len, elapsed = link_ticks - link.ticks;
+    link.ticks += elapsed;
+
+    while ((len = RADIO_Receive(link.frame, NULL)) > 0)
+    {
+        if ((link.frame[0] & 0xC0) == LINK_FRAME_DATA && len > LINK_HEADER_SIZE)
+        {
+            LINK_HandleData(len);
+        }
+        else if (link.frame[0] == LINK_FRAME_SACK && len == LINK_SACK_SIZE)
+        {
+            LINK_HandleSack();
+        }
+    }
+
+    if (LINK_Timer(&link.rx_timer, elapsed) && link.rx_count > 0)
+    {
+        LINK_SendSack();
+    }
+    if (link.hop != LINK_CHANNEL_NONE && RADIO_GetTxStatus() != HAL_BUSY)
+    {
+        LINK_Tune(link.hop);
+        link.hop = LINK_CHANNEL_NONE;
+        LINK_Stats.hops++;
+        // The next burst follows the SACK in LINK_HOP_DELAY, if the sender missed
+        // the SACK it repeats on the old channel
+        link.dwell_timer = LINK_ACK_TIMEOUT / 2;
+    }
+
+    switch (link.tx_state)
+    {
+    case LINK_TX_IDLE:
+        if (LINK_Timer(&link.dwell_timer, elapsed))
+        {
+            if (link.rx_lost > 0 && ++link.rx_lost > LINK_RETRY_MAX / 2)
+            {
+                // Both channels may be bad, wait on the best one for the scanning sender.
+                // After the last SACK of a message the sender may just be idle
+                if (!link.rx_complete)
+                {
+                    LINK_Score(link.ch, 255);
+                }
+                link.alt = link.ch;
+                link.ch = LINK_BestChannel();
+                link.rx_lost = 0;
+            }
+            LINK_Tune((link.tuned == link.ch)? link.alt : link.ch);
+        }
+        break;
+    case LINK_TX_HOLD:
+        if (LINK_Timer(&link.tx_timer, elapsed))
+        {
+            link.tx_state = LINK_TX_BURST;
+        }
+        break;
+    case LINK_TX_BURST:
+        if (link.hop == LINK_CHANNEL_NONE)
+        {
+            LINK_SendFragments();
+        }
+        break;
+    case LINK_TX_WAIT:
+        if (RADIO_GetTxStatus() == HAL_BUSY)
+        {
+            link.tx_timer = LINK_ACK_TIMEOUT;
+        }
+        else if (LINK_Timer(&link.tx_timer, elapsed))
+        {
+            LINK_Stats.tx_timeouts++;
+            if (link.tx_retries < LINK_RETRY_MAX)
+            {
+                if (++link.tx_retries % 3 == 0)
+                {
+                    // The channel may be jammed, try the previous one
+                    len = link.ch;
+                    link.ch = link.alt;
+                    link.alt = len;
+                    link.hop = link.ch;
+                    link.tx_fallback = LINK_FRAME_FALLBACK;
+                }
+            }
+            else if (link.tx_scan == (uint16_t)LINK_CHANNEL_NUM * LINK_SCAN_BURSTS * LINK_SCAN_MAX)
+            {
+                link.tx_state = LINK_TX_IDLE;
+                link.tx_status = HAL_TIMEOUT;
+                break;
+            }
+            else if (link.tx_scan++ % LINK_SCAN_BURSTS == 0)
+            {
+                // Lost on both channels, e.g. a SACK naming a good channel never gets
+                // through the bad one: go through the hop set, the receiver answers on
+                // the channel it dwells on
+                link.alt = link.ch;
+                link.ch = (link.ch + 1) % LINK_CHANNEL_NUM;
+                link.hop = link.ch;
+                link.tx_fallback = 0;
+            }
+            LINK_StartBurst();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void LINK_TickHandler(void)
+{
+    link_ticks++;
+}
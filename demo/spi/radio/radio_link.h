@@ -0,0 +1,174 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef __FW_RADIO_LINK_H__
+#define __FW_RADIO_LINK_H__
+
+#include "radio.h"
+
+/**
+ * Link layer over the radio API: messages up to LINK_MSG_MAX bytes, selective
+ * repeat and channel hopping
+ *
+ * - A message is cut into fragments of LINK_FRAG_SIZE bytes, each sent as one no-ACK
+ *   packet with message id, sequence number and last sequence number. The chip's auto-ACK
+ *   and retransmit are not used.
+ * - The sender sends a burst of up to LINK_WINDOW unacked fragments back to back, the
+ *   receiver answers the burst with one SACK holding the bitmap of all fragments it has.
+ *   The next burst starts from the lowest unacked fragment and carries only missing ones.
+ * - Each SACK also names the channel of the next burst, both sides hop after it. The
+ *   receiver draws channels from LINK_CHANNEL_NUM channels with an LFSR, keeps a loss
+ *   score of each channel from the bursts it receives and skips channels scoring above
+ *   LINK_CHANNEL_BAD. A skipped channel's score decays, so it is tried again later.
+ * - If a SACK is lost the two sides are one hop apart: the sender repeats the burst on
+ *   the old channel after LINK_ACK_TIMEOUT, the receiver switches between the old and
+ *   the new channel every LINK_DWELL_TIMEOUT until it hears from the sender.
+ * - If both channels are bad, e.g. SACKs naming a good channel don't get through the
+ *   bad one, the sender goes through the hop set after LINK_RETRY_MAX bursts, staying
+ *   on each channel for a full switch cycle of the receiver. A receiver that doesn't
+ *   hear the next burst after a SACK for LINK_RETRY_MAX / 2 dwells moves to the
+ *   channel with the lowest loss score and waits there.
+ *
+ * One side sends at a time. The receiver gives its buffer with LINK_Listen(), fragments
+ * are copied straight into it, the sender's buffer must stay valid until the message
+ * ends. Call LINK_TickHandler() every 1ms from a timer interrupt and LINK_Process() from
+ * the main loop, after RADIO_Poll() for chips without IRQ line.
+*/
+
+#define LINK_HEADER_SIZE            5
+#define LINK_FRAG_SIZE              (RADIO_PLOAD_WIDTH - LINK_HEADER_SIZE)
+
+/**
+ * Largest message, the SACK bitmap covers 64 fragments
+*/
+#ifndef LINK_MSG_MAX
+#define LINK_MSG_MAX                1024
+#endif
+/**
+ * Fragments in flight per burst, [1, 32]
+*/
+#ifndef LINK_WINDOW
+#define LINK_WINDOW                 12
+#endif
+/**
+ * Hop set, channel = LINK_CHANNEL_FIRST + index * LINK_CHANNEL_STEP. The default 2 - 77
+ * fits the 0 - 80 range of XL2400.
+*/
+#ifndef LINK_CHANNEL_NUM
+#define LINK_CHANNEL_NUM            16
+#endif
+#ifndef LINK_CHANNEL_FIRST
+#define LINK_CHANNEL_FIRST          2
+#endif
+#ifndef LINK_CHANNEL_STEP
+#define LINK_CHANNEL_STEP           5
+#endif
+/**
+ * Loss score [0, 255] above which a channel is skipped, 255 to hop over all channels
+*/
+#ifndef LINK_CHANNEL_BAD
+#define LINK_CHANNEL_BAD            64
+#endif
+/**
+ * Air time of one fragment in us including the gap, 500 at 1Mbps, 1500 at 250Kbps.
+ * The receiver answers a burst whose last fragment is lost after the time of the
+ * fragments left plus 2ms.
+*/
+#ifndef LINK_FRAME_TIME
+#define LINK_FRAME_TIME             500
+#endif
+/**
+ * Timeouts in ms: SACK wait after the last fragment of a burst is sent, and receiver
+ * dwell on a channel before switching
+*/
+#ifndef LINK_ACK_TIMEOUT
+#define LINK_ACK_TIMEOUT            8
+#endif
+#ifndef LINK_DWELL_TIMEOUT
+#define LINK_DWELL_TIMEOUT          20
+#endif
+/**
+ * Sender wait in ms after a hop, for the receiver to retune
+*/
+#ifndef LINK_HOP_DELAY
+#define LINK_HOP_DELAY              1
+#endif
+/**
+ * Bursts without SACK in a row before the sender scans the hop set, and scans of the
+ * hop set before the message is given up
+*/
+#ifndef LINK_RETRY_MAX
+#define LINK_RETRY_MAX              30
+#endif
+#ifndef LINK_SCAN_MAX
+#define LINK_SCAN_MAX               4
+#endif
+
+#define LINK_FRAME_DATA             0x80 // [10FL LLLL]
+#define LINK_FRAME_FALLBACK         0x20 // F: sent on the previous channel after timeouts
+#define LINK_FRAME_LEFT             0x1F // L: fragments left in the burst
+#define LINK_FRAME_SACK             0x40
+
+typedef struct
+{
+    uint16_t tx_frames;     // Fragments sent
+    uint16_t tx_repeats;    // Fragments sent again
+    uint16_t tx_timeouts;   // Bursts without SACK
+    uint16_t rx_frames;     // Fragments received
+    uint16_t rx_duplicates; // Fragments received again
+    uint16_t hops;          // Channel changes after SACK
+} LINK_Stats_t;
+
+extern LINK_Stats_t LINK_Stats;
+
+/**
+ * Set the first channel of the hop set, clear the loss scores and enter RX mode.
+ * Both sides start on the same channel, call after RADIO_Init() and the addresses.
+*/
+void LINK_Init(void);
+/**
+ * Start sending a message, len [1, LINK_MSG_MAX]. Returns HAL_BUSY while the previous
+ * message is in progress, HAL_ERROR on bad length.
+*/
+HAL_StatusTypeDef LINK_Send(const uint8_t *buf, uint16_t len);
+/**
+ * HAL_BUSY: in progress, HAL_OK: all fragments acked, HAL_TIMEOUT: given up after
+ * LINK_RETRY_MAX bursts and LINK_SCAN_MAX scans of the hop set without SACK, about
+ * 3s with the defaults
+*/
+HAL_StatusTypeDef LINK_GetTxStatus(void);
+/**
+ * Receive the next message into buf. Messages longer than size are not acked.
+*/
+void LINK_Listen(uint8_t *buf, uint16_t size);
+/**
+ * Length of the message received into the LINK_Listen() buffer, 0 while not complete.
+ * Further messages are not acked until LINK_Listen() is called again.
+*/
+uint16_t LINK_Received(void);
+/**
+ * Loss score of a channel of the hop set, as seen by this side as receiver
+*/
+uint8_t LINK_GetChannelLoss(uint8_t index);
+/**
+ * Read received packets, run the timers, send fragments and SACKs, hop
+*/
+void LINK_Process(void);
+/**
+ * 1ms tick, call from a timer interrupt
+*/
+void LINK_TickHandler(void);
+
+#endif
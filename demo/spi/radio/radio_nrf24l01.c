@@ -0,0 +1,79 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "radio.h"
+
+#if (RADIO_CHIP == RADIO_CHIP_NRF24L01)
+
+#define NRF24_CMD_ACTIVATE      0x50 // Unlock FEATURE and DYNPD on nRF24L01 (non plus)
+#define NRF24_CONFIG_PWR_DOWN   0x0C // CRC 2 bytes, all interrupts on IRQ pin
+#define NRF24_CONFIG_PWR_UP     0x0E
+#define NRF24_CONFIG_PRIM_RX    0x01
+#define NRF24_FEATURE           (RADIO_FEATURE_EN_DPL | RADIO_FEATURE_EN_ACK_PAY | RADIO_FEATURE_EN_DYN_ACK)
+
+// RF_DR_LOW(bit 5), RF_DR_HIGH(bit 3)
+static __CODE uint8_t nrf24_rates[3] = {0x20, 0x00, 0x08};
+
+void RADIO_Chip_Reset(void)
+{
+    PIN_CLR(RADIO_CE_PIN);
+    PIN_SetMode(RADIO_CE_PIN, GPIO_Mode_Output_PP);
+}
+
+void RADIO_Chip_Init(void)
+{
+    uint8_t value = 0x73;
+
+    // Address width 5 bytes
+    RADIO_WriteReg(RADIO_REG_SETUP_AW, 0x03);
+    RADIO_WriteReg(RADIO_REG_FEATURE, NRF24_FEATURE);
+    if (RADIO_ReadReg(RADIO_REG_FEATURE) != NRF24_FEATURE)
+    {
+        // ACTIVATE toggles, only send it when the features are locked
+        RADIO_Write(NRF24_CMD_ACTIVATE, &value, 1);
+        RADIO_WriteReg(RADIO_REG_FEATURE, NRF24_FEATURE);
+    }
+    RADIO_WriteReg(RADIO_REG_CONFIG, NRF24_CONFIG_PWR_DOWN);
+}
+
+void RADIO_Chip_SetCE(HAL_State_t state)
+{
+    PIN_WRITE(RADIO_CE_PIN, state);
+}
+
+void RADIO_Chip_PowerUp(HAL_State_t rx)
+{
+    RADIO_WriteReg(RADIO_REG_CONFIG, NRF24_CONFIG_PWR_UP | (rx? NRF24_CONFIG_PRIM_RX : 0x00));
+}
+
+void RADIO_Chip_PowerDown(void)
+{
+    RADIO_WriteReg(RADIO_REG_CONFIG, NRF24_CONFIG_PWR_DOWN);
+}
+
+HAL_StatusTypeDef RADIO_Chip_SetChannel(uint8_t channel)
+{
+    if (channel > 125) return HAL_ERROR;
+    RADIO_WriteReg(RADIO_REG_RF_CH, channel);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef RADIO_Chip_SetRf(RADIO_Power_t power, RADIO_DataRate_t rate)
+{
+    // RF_PWR[2:1], 00:-18dBm -> 11:0dBm, bit 0 LNA gain
+    RADIO_WriteReg(RADIO_REG_RF_SETUP, nrf24_rates[rate] | (power << 1) | 0x01);
+    return HAL_OK;
+}
+
+#endif
@@ -0,0 +1,147 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "radio.h"
+
+#if (RADIO_CHIP == RADIO_CHIP_XL2400)
+
+#define XL2400_REG_RSSI         0x09 // Data output and RSSI, 14 bits
+#define XL2400_REG_ANALOG_CFG0  0x12 // Analog config 0, 128 bits
+#define XL2400_REG_ANALOG_CFG3  0x15 // Analog config 3, 128 bits
+#define XL2400_REG_RX_PW_PX     0x11 // RX payload width of pipe 0 ~ 5, 48 bits
+#define XL2400_CFG_PRIM_RX      0x01 // CFG_TOP byte 0
+#define XL2400_CFG_CE           0x40 // CFG_TOP byte 1, software CE
+
+// RF_SETUP, 250Kbps, 1Mbps
+static __CODE uint8_t xl2400_rates[2] = {0x22, 0x02};
+// RF_CH byte 2, -18dBm, -12dBm, -6dBm, 0dBm
+static __CODE uint8_t xl2400_powers[4] = {0x02, 0x04, 0x08, 0x10};
+// CFG_TOP, 20 bits, written as a whole
+static uint8_t xl2400_cfg[3];
+
+static void XL2400_WriteCfg(uint8_t cfg0, uint8_t cfg2)
+{
+    xl2400_cfg[0] = cfg0;
+    xl2400_cfg[1] = 0x82;
+    xl2400_cfg[2] = cfg2;
+    RADIO_Write(RADIO_CMD_W_REGISTER | RADIO_REG_CONFIG, xl2400_cfg, 3);
+}
+
+static HAL_StatusTypeDef XL2400_RxCalibrate(void)
+{
+    uint8_t i, j, buf[2];
+    for (i = 0; i < 10; i++)
+    {
+        SYS_Delay(2);
+        RADIO_Read(RADIO_CMD_R_REGISTER | XL2400_REG_ANALOG_CFG3, buf, 2);
+        buf[1] |= 0x90;
+        buf[1] &= ~0x20;
+        RADIO_Write(RADIO_CMD_W_REGISTER | XL2400_REG_ANALOG_CFG3, buf, 2);
+        buf[1] |= 0x40;
+        RADIO_Write(RADIO_CMD_W_REGISTER | XL2400_REG_ANALOG_CFG3, buf, 2);
+        SYS_Delay(1);
+        RADIO_Read(RADIO_CMD_R_REGISTER | RADIO_REG_FIFO_STATUS, buf, 2);
+
+        if (buf[1] & 0x20)
+        {
+            j = buf[1] << 3;
+            RADIO_Read(RADIO_CMD_R_REGISTER | XL2400_REG_ANALOG_CFG3, buf, 2);
+            buf[1] &= 0x8F;
+            buf[1] |= 0x20;
+            buf[0] &= 0x07;
+            buf[0] |= j;
+            RADIO_Write(RADIO_CMD_W_REGISTER | XL2400_REG_ANALOG_CFG3, buf, 2);
+            return HAL_OK;
+        }
+    }
+    return HAL_ERROR;
+}
+
+void RADIO_Chip_Reset(void)
+{
+    // Software CE, wake up RF
+    XL2400_WriteCfg(0x7E, 0x0B);
+}
+
+void RADIO_Chip_Init(void)
+{
+    __XDATA uint8_t buf[13];
+
+    // Analog config
+    RADIO_Read(RADIO_CMD_R_REGISTER | XL2400_REG_ANALOG_CFG0, buf, 13);
+    buf[4] &= ~0x04;
+    buf[12] |= 0x40;
+    RADIO_Write(RADIO_CMD_W_REGISTER | XL2400_REG_ANALOG_CFG0, buf, 13);
+    XL2400_WriteCfg(0x7E, 0x0B);
+    // Address width 5 bytes
+    RADIO_WriteReg(RADIO_REG_SETUP_AW, 0xAF);
+    // Widths of pipe 0 and 1, used when dynamic length is off
+    buf[0] = RADIO_PLOAD_WIDTH;
+    buf[1] = RADIO_PLOAD_WIDTH;
+    RADIO_Write(RADIO_CMD_W_REGISTER | XL2400_REG_RX_PW_PX, buf, 2);
+    // bit4=1 FEC off, bit3=1 FEATURE on, dynamic length, ACK payload, no-ACK TX
+    RADIO_WriteReg(RADIO_REG_FEATURE,
+        0x18 | RADIO_FEATURE_EN_DPL | RADIO_FEATURE_EN_ACK_PAY | RADIO_FEATURE_EN_DYN_ACK);
+    // Enable RSSI
+    buf[0] = 0x10;
+    buf[1] = 0x00;
+    RADIO_Write(RADIO_CMD_W_REGISTER | XL2400_REG_RSSI, buf, 2);
+}
+
+void RADIO_Chip_SetCE(HAL_State_t state)
+{
+    xl2400_cfg[1] = state? (xl2400_cfg[1] | XL2400_CFG_CE) : (xl2400_cfg[1] & ~XL2400_CFG_CE);
+    RADIO_Write(RADIO_CMD_W_REGISTER | RADIO_REG_CONFIG, xl2400_cfg, 2);
+}
+
+void RADIO_Chip_PowerUp(HAL_State_t rx)
+{
+    XL2400_WriteCfg(0x7E | (rx? XL2400_CFG_PRIM_RX : 0x00), 0x0B);
+}
+
+void RADIO_Chip_PowerDown(void)
+{
+    XL2400_WriteCfg(0x7C, 0x03);
+}
+
+HAL_StatusTypeDef RADIO_Chip_SetChannel(uint8_t channel)
+{
+    uint8_t buf[2];
+    if (channel > 80) return HAL_ERROR;
+    // AFC reset, AFC on
+    RADIO_WriteReg(XL2400_REG_ANALOG_CFG0, 0x06);
+    RADIO_WriteReg(XL2400_REG_ANALOG_CFG0, 0x0E);
+    // Frequency(MHz) 2400:0x960 -> 2480:0x9B0
+    buf[0] = 0x60 + channel;
+    buf[1] = 0x09;
+    RADIO_Write(RADIO_CMD_W_REGISTER | RADIO_REG_RF_CH, buf, 2);
+    // AFC locked
+    buf[1] |= 0x20;
+    RADIO_Write(RADIO_CMD_W_REGISTER | RADIO_REG_RF_CH, buf, 2);
+    // Calibrate once per channel instead of on every RX/TX switch
+    return XL2400_RxCalibrate();
+}
+
+HAL_StatusTypeDef RADIO_Chip_SetRf(RADIO_Power_t power, RADIO_DataRate_t rate)
+{
+    uint8_t buf[3];
+    if (rate == RADIO_DataRate_2M) return HAL_ERROR;
+    RADIO_WriteReg(RADIO_REG_RF_SETUP, xl2400_rates[rate]);
+    RADIO_Read(RADIO_CMD_R_REGISTER | RADIO_REG_RF_CH, buf, 3);
+    buf[2] = xl2400_powers[power];
+    RADIO_Write(RADIO_CMD_W_REGISTER | RADIO_REG_RF_CH, buf, 3);
+    return HAL_OK;
+}
+
+#endif
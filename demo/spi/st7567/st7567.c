@@ -23,6 +23,8 @@ __BIT ST7567_colorInverted = RESET;
 uint8_t ST7567_currentX = 0;
 uint8_t ST7567_currentY = 0;
 static __XDATA uint8_t ST7567_Buffer_all[ST7567_WIDTH * ST7567_PAGES];
+/* Changed column range of each page, clean when from > to */
+static __XDATA uint8_t ST7567_DirtyFrom[ST7567_PAGES], ST7567_DirtyTo[ST7567_PAGES];
 
 void ST7567_WriteData(uint8_t dat)
 {
@@ -58,6 +60,43 @@ static void ST7567_Transmit(const uint8_t *pDat, uint32_t size)
     ST7567_CS = 1;
 }
 
+static void ST7567_MarkDirty(uint8_t page, uint8_t x)
+{
+    if (x < ST7567_DirtyFrom[page])
+    {
+        ST7567_DirtyFrom[page] = x;
+    }
+    if (x > ST7567_DirtyTo[page])
+    {
+        ST7567_DirtyTo[page] = x;
+    }
+}
+
+/**
+ * Mark the bytes that differ from dat, before the buffer is filled with it
+*/
+static void ST7567_MarkFill(uint8_t dat)
+{
+    uint8_t page, x;
+    __XDATA uint8_t *pt = ST7567_Buffer_all;
+    for (page = 0; page < ST7567_PAGES; page++)
+    {
+        for (x = 0; x < ST7567_WIDTH; x++)
+        {
+            if (*pt++ != dat)
+            {
+                ST7567_MarkDirty(page, x);
+            }
+        }
+    }
+}
+
+void ST7567_Invalidate(void)
+{
+    memset(ST7567_DirtyFrom, 0, sizeof(ST7567_DirtyFrom));
+    memset(ST7567_DirtyTo, ST7567_WIDTH - 1, sizeof(ST7567_DirtyTo));
+}
+
 void ST7567_Reset(void)
 {
     ST7567_RES = 0;
@@ -95,6 +134,8 @@ void ST7567_Init(void)
         |ST7567_POWER_CONTROL_VF);
     ST7567_WriteCommand(ST7567_DISPLAY_ON);
     ST7567_WriteCommand(ST7567_ALL_PIXEL_NORMAL);
+    // Display RAM is undefined after reset
+    ST7567_Invalidate();
 }
 
 void ST7567_SetPowerSaveMode(HAL_State_t state)
@@ -131,13 +172,20 @@ void ST7567_SetContrast(uint8_t val)
 
 void ST7567_UpdateScreen(void)
 {
-    uint8_t i = 0, *pt = ST7567_Buffer_all;
+    uint8_t i = 0, from, *pt = ST7567_Buffer_all;
     for (i = 0; i < ST7567_PAGES; i++)
     {
+        from = ST7567_DirtyFrom[i];
+        if (from > ST7567_DirtyTo[i])
+        {
+            continue;
+        }
         ST7567_WriteCommand(ST7567_SET_PAGE_ADDRESS|(i & ST7567_SET_PAGE_ADDRESS_MASK));
-        ST7567_WriteCommand(ST7567_SET_COLUMN_ADDRESS_MSB|(0 >> 4));
-        ST7567_WriteCommand(ST7567_SET_COLUMN_ADDRESS_LSB|(0 & 0x0F));
-        ST7567_Transmit(pt + (ST7567_WIDTH * i), ST7567_WIDTH);
+        ST7567_WriteCommand(ST7567_SET_COLUMN_ADDRESS_MSB|(from >> 4));
+        ST7567_WriteCommand(ST7567_SET_COLUMN_ADDRESS_LSB|(from & 0x0F));
+        ST7567_Transmit(pt + (ST7567_WIDTH * i) + from, ST7567_DirtyTo[i] - from + 1);
+        ST7567_DirtyFrom[i] = 0xFF;
+        ST7567_DirtyTo[i] = 0;
     }
 }
 
@@ -157,26 +205,46 @@ void ST7567_ToggleInvert(void)
 
 void ST7567_Fill(uint8_t color)
 {
+    uint8_t dat = (color == ST7567_COLOR_BACK) ? 0x00 : 0xFF;
+    ST7567_MarkFill(dat);
     /* Set memory */
-    memset((uint8_t *)ST7567_Buffer_all, (color == ST7567_COLOR_BACK) ? 0x00 : 0xFF, sizeof(ST7567_Buffer_all));
+#if (__CONF_MCU_TYPE == 3)
+    // Fill with CPU if the M2M engine is busy with an async transfer
+    if (DMA_M2M_Fill(ST7567_Buffer_all, dat, sizeof(ST7567_Buffer_all)) != HAL_OK)
+    {
+        memset((uint8_t *)ST7567_Buffer_all, dat, sizeof(ST7567_Buffer_all));
+    }
+#else
+    memset((uint8_t *)ST7567_Buffer_all, dat, sizeof(ST7567_Buffer_all));
+#endif
 }
 
 void ST7567_DrawPixel(uint8_t x, uint8_t y, uint8_t color)
 {
-    uint8_t page, column;
+    uint8_t page, dat;
+    uint16_t i;
     if (x >= ST7567_WIDTH || y >= ST7567_HEIGHT)
     {
         /* Error */
         return;
     }
 
+    page = y / 8;
+    i = x + page * ST7567_WIDTH;
+    dat = ST7567_Buffer_all[i];
     if (color == ST7567_COLOR_FRONT)
     {
-        ST7567_Buffer_all[x + (y / 8) * ST7567_WIDTH] |= 1 << (y % 8);
+        dat |= 1 << (y % 8);
     }
     else
     {
-        ST7567_Buffer_all[x + (y / 8) * ST7567_WIDTH] &= ~(1 << (y % 8));
+        dat &= ~(1 << (y % 8));
+    }
+    /* Only a change needs to be sent */
+    if (dat != ST7567_Buffer_all[i])
+    {
+        ST7567_Buffer_all[i] = dat;
+        ST7567_MarkDirty(page, x);
     }
 }
 
@@ -209,12 +209,21 @@ void ST7567_SetContrast(uint8_t val);
 
 /** 
  * @brief  Update LCD display with buffer changes
- * @note   Call this function each time when display is changed
+ * @note   Call this function each time when display is changed, only the changed column span
+ *         of each page is sent
  * @param  None
  * @retval None
  */
 void ST7567_UpdateScreen(void);
 
+/**
+ * @brief  Mark the whole buffer as changed, the next @ref ST7567_UpdateScreen() sends the full frame
+ * @note   Called by ST7567_Init(), call again after writing to the LCD RAM directly
+ * @param  None
+ * @retval None
+ */
+void ST7567_Invalidate(void);
+
 /**
  * @brief  Toggles pixels invertion inside internal RAM
  * @note   @ref ST7567_UpdateScreen() must be called after that in order to see updated LCD screen
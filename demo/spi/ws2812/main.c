@@ -0,0 +1,93 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***
+ * Demo: WS2812 LED strip, 150 LEDs rainbow at 60 fps
+ * Board: STC8H8K64U, 24MHz
+ *
+ *              P34   -> DIN
+ *              GND   -> GND
+ *              5V    -> VCC
+ *
+ * SPI clock 24MHz / 8 = 3MHz with 4-bit encoding, the frame is sent by DMA_SPI
+ * in 4.8ms, effects are calculated while the previous frame is latching.
+ */
+
+#include "fw_hal.h"
+#include "ws2812.h"
+
+INTERRUPT(DMA_SPI_Routine, EXTI_VectDMA_SPI)
+{
+    DMA_Channel_Dispatch(DMA_Channel_SPI);
+}
+
+void SPI_Init(void)
+{
+    SPI_SetClockPrescaler(SPI_ClockPreScaler_8);
+    SPI_SetClockPolarity(HAL_State_OFF);
+    SPI_SetClockPhase(SPI_ClockPhase_LeadingEdge);
+    SPI_SetDataOrder(SPI_DataOrder_MSB);
+    SPI_SetPort(SPI_AlterPort_P35_P34_P33_P32);
+    SPI_IgnoreSlaveSelect(HAL_State_ON);
+    SPI_SetMasterMode(HAL_State_ON);
+    SPI_SetEnabled(HAL_State_ON);
+}
+
+/**
+ * Hue 0 - 191 to RGB, three 64-step ramps
+*/
+void Wheel(uint16_t index, uint8_t hue)
+{
+    uint8_t level = (hue & 0x3F) << 2;
+    switch (hue >> 6)
+    {
+    case 0:
+        WS2812_SetPixel(index, 255 - level, level, 0);
+        break;
+    case 1:
+        WS2812_SetPixel(index, 0, 255 - level, level);
+        break;
+    default:
+        WS2812_SetPixel(index, level, 0, 255 - level);
+        break;
+    }
+}
+
+void main(void)
+{
+    uint16_t i;
+    uint8_t offset = 0, hue;
+
+    SYS_SetClock();
+    // MOSI(P34)
+    GPIO_P3_SetMode(GPIO_Pin_4, GPIO_Mode_Output_PP);
+    SPI_Init();
+    WS2812_Init(WS2812_Encoding_4Bit);
+    WS2812_SetBrightness(64, HAL_State_ON);
+    EXTI_Global_SetIntState(HAL_State_ON);
+
+    while(1)
+    {
+        while (WS2812_IsBusy());
+        hue = offset;
+        for (i = 0; i < WS2812_NUM_LEDS; i++)
+        {
+            Wheel(i, hue);
+            hue = (hue >= 190)? hue - 190 : hue + 2;
+        }
+        offset = (offset == 191)? 0 : offset + 1;
+        WS2812_Show();
+        SYS_Delay(16);
+    }
+}
@@ -0,0 +1,266 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ws2812.h"
+
+#define WS2812_CHUNK_BYTES  (WS2812_CHUNK_SIZE * 4)
+
+/**
+ * Gamma 2.6
+*/
+static __CODE uint8_t ws2812_gamma[256] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,
+      3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   5,   6,   6,   6,   6,   7,
+      7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  10,  11,  11,  11,  12,  12,
+     13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,  20,
+     20,  21,  21,  22,  22,  23,  24,  24,  25,  25,  26,  27,  27,  28,  29,  29,
+     30,  31,  31,  32,  33,  34,  34,  35,  36,  37,  38,  38,  39,  40,  41,  42,
+     42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,
+     58,  59,  60,  61,  62,  63,  64,  65,  66,  68,  69,  70,  71,  72,  73,  75,
+     76,  77,  78,  80,  81,  82,  84,  85,  86,  88,  89,  90,  92,  93,  94,  96,
+     97,  99, 100, 102, 103, 105, 106, 108, 109, 111, 112, 114, 115, 117, 119, 120,
+    122, 124, 125, 127, 129, 130, 132, 134, 136, 137, 139, 141, 143, 145, 146, 148,
+    150, 152, 154, 156, 158, 160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180,
+    182, 184, 186, 188, 191, 193, 195, 197, 199, 202, 204, 206, 209, 211, 213, 215,
+    218, 220, 223, 225, 227, 230, 232, 235, 237, 240, 242, 245, 247, 250, 252, 255,
+};
+
+/**
+ * 4-bit encoding, one SPI byte per 2 LED bits
+*/
+static __CODE uint8_t ws2812_enc4[4] = {0x88, 0x8C, 0xC8, 0xCC};
+/**
+ * 3-bit encoding, 3 SPI bytes per LED byte, 100100100100100100100100 with
+ * LED bits 7:5, 4:3, 2:0 placed in the middle of each group
+*/
+static __CODE uint8_t ws2812_enc3h[8] = {0x92, 0x93, 0x9A, 0x9B, 0xD2, 0xD3, 0xDA, 0xDB};
+static __CODE uint8_t ws2812_enc3m[4] = {0x49, 0x4D, 0x69, 0x6D};
+static __CODE uint8_t ws2812_enc3l[8] = {0x24, 0x26, 0x34, 0x36, 0xA4, 0xA6, 0xB4, 0xB6};
+
+__XDATA uint8_t WS2812_Buffer[WS2812_BUFFER_SIZE];
+
+static __XDATA uint8_t ws2812_level[256];
+static WS2812_Encoding_t ws2812_encoding;
+
+/**
+ * Encode n pixel bytes from src to dst, returns the end of dst
+*/
+static uint8_t __XDATA *WS2812_EncodeBytes(uint8_t __XDATA *dst, uint8_t __XDATA *src, uint8_t n)
+{
+    uint8_t v;
+    if (ws2812_encoding == WS2812_Encoding_4Bit)
+    {
+        while (n--)
+        {
+            v = ws2812_level[*src++];
+            *dst++ = ws2812_enc4[v >> 6];
+            *dst++ = ws2812_enc4[(v >> 4) & 0x03];
+            *dst++ = ws2812_enc4[(v >> 2) & 0x03];
+            *dst++ = ws2812_enc4[v & 0x03];
+        }
+    }
+    else
+    {
+        while (n--)
+        {
+            v = ws2812_level[*src++];
+            *dst++ = ws2812_enc3h[v >> 5];
+            *dst++ = ws2812_enc3m[(v >> 3) & 0x03];
+            *dst++ = ws2812_enc3l[v & 0x07];
+        }
+    }
+    return dst;
+}
+
+#if (__CONF_MCU_TYPE == 3)
+
+static __XDATA uint8_t ws2812_chunk[2][WS2812_CHUNK_BYTES];
+static uint8_t ws2812_length[2], ws2812_index, ws2812_latch;
+static uint8_t __XDATA *ws2812_src;
+static uint16_t ws2812_left;
+static volatile uint8_t ws2812_busy;
+
+/**
+ * Encode the next chunk of pixels, or the next part of the latch,
+ * returns SPI bytes in dst, 0 when the frame is done
+*/
+static uint8_t WS2812_EncodeChunk(uint8_t __XDATA *dst)
+{
+    uint8_t n, i;
+    if (ws2812_left != 0)
+    {
+        n = (ws2812_left > WS2812_CHUNK_SIZE)? WS2812_CHUNK_SIZE : ws2812_left;
+        ws2812_left -= n;
+        WS2812_EncodeBytes(dst, ws2812_src, n);
+        ws2812_src += n;
+        return n * ws2812_encoding;
+    }
+    n = (ws2812_latch > WS2812_CHUNK_BYTES)? WS2812_CHUNK_BYTES : ws2812_latch;
+    ws2812_latch -= n;
+    for (i = 0; i < n; i++)
+    {
+        dst[i] = 0x00;
+    }
+    return n;
+}
+
+static void WS2812_StartChunk(void)
+{
+    uint8_t __XDATA *buf = ws2812_chunk[ws2812_index];
+    // Keep EAXFR state of the interrupted code
+    uint8_t p_sw2 = P_SW2;
+    P_SW2 |= 0x80;
+    DMA_SPI_TXAH = (uint16_t)buf >> 8;
+    DMA_SPI_TXAL = (uint16_t)buf & 0xFF;
+    DMA_SPI_AMT = ws2812_length[ws2812_index] - 1;
+    DMA_Channel_Start(DMA_Channel_SPI, 0x40);
+    P_SW2 = p_sw2;
+}
+
+void WS2812_DMA_Handler(void)
+{
+    ws2812_index ^= 1;
+    if (ws2812_length[ws2812_index] == 0)
+    {
+        ws2812_busy = 0;
+        return;
+    }
+    WS2812_StartChunk();
+    ws2812_length[ws2812_index ^ 1] = WS2812_EncodeChunk(ws2812_chunk[ws2812_index ^ 1]);
+}
+
+#else
+
+static __XDATA uint8_t ws2812_tx[4];
+
+#endif
+
+HAL_StatusTypeDef WS2812_Init(WS2812_Encoding_t encoding)
+{
+    uint16_t i;
+#if (__CONF_MCU_TYPE != 3)
+    // Gaps between polled SPI bytes stretch the high parts of 3-bit encoding
+    if (encoding == WS2812_Encoding_3Bit)
+    {
+        return HAL_ERROR;
+    }
+#endif
+    ws2812_encoding = encoding;
+    for (i = 0; i < WS2812_BUFFER_SIZE; i++)
+    {
+        WS2812_Buffer[i] = 0;
+    }
+    WS2812_SetBrightness(255, HAL_State_ON);
+#if (__CONF_MCU_TYPE == 3)
+    ws2812_busy = 0;
+    DMA_SPI_SetTxEnabled(HAL_State_ON);
+    DMA_SPI_SetRxEnabled(HAL_State_OFF);
+    DMA_SPI_SetAutoSlaveSelect(HAL_State_OFF);
+    DMA_SPI_ClearFifo();
+    return DMA_Channel_Acquire(DMA_Channel_SPI, DMA_BusPriority_High, WS2812_DMA_Handler);
+#else
+    return HAL_OK;
+#endif
+}
+
+void WS2812_SetBrightness(uint8_t brightness, HAL_State_t gamma)
+{
+    uint8_t i = 0;
+    do
+    {
+        ws2812_level[i] = ((uint16_t)(gamma? ws2812_gamma[i] : i) * ((uint16_t)brightness + 1)) >> 8;
+    } while (++i != 0);
+}
+
+void WS2812_SetPixel(uint16_t index, uint8_t r, uint8_t g, uint8_t b)
+{
+    uint8_t __XDATA *p;
+    if (index >= WS2812_NUM_LEDS)
+    {
+        return;
+    }
+    p = WS2812_Buffer + index * WS2812_BYTES_PER_LED;
+    *p++ = g;
+    *p++ = r;
+    *p = b;
+}
+
+#if (WS2812_BYTES_PER_LED == 4)
+void WS2812_SetPixelRGBW(uint16_t index, uint8_t r, uint8_t g, uint8_t b, uint8_t w)
+{
+    WS2812_SetPixel(index, r, g, b);
+    if (index < WS2812_NUM_LEDS)
+    {
+        WS2812_Buffer[index * 4 + 3] = w;
+    }
+}
+#endif
+
+void WS2812_Fill(uint8_t r, uint8_t g, uint8_t b)
+{
+    uint16_t i;
+    for (i = 0; i < WS2812_NUM_LEDS; i++)
+    {
+        WS2812_SetPixel(i, r, g, b);
+    }
+}
+
+HAL_StatusTypeDef WS2812_Show(void)
+{
+#if (__CONF_MCU_TYPE == 3)
+    if (ws2812_busy)
+    {
+        return HAL_BUSY;
+    }
+    ws2812_busy = 1;
+    ws2812_src = WS2812_Buffer;
+    ws2812_left = WS2812_BUFFER_SIZE;
+    ws2812_latch = WS2812_LATCH_SIZE;
+    ws2812_index = 0;
+    ws2812_length[0] = WS2812_EncodeChunk(ws2812_chunk[0]);
+    ws2812_length[1] = WS2812_EncodeChunk(ws2812_chunk[1]);
+    WS2812_StartChunk();
+    return HAL_OK;
+#else
+    // One pixel byte is encoded between SPI bytes, gaps keep the line low
+    uint8_t __XDATA *p;
+    uint8_t __XDATA *end;
+    uint8_t __XDATA *src = WS2812_Buffer;
+    uint16_t i;
+    for (i = 0; i < WS2812_BUFFER_SIZE; i++)
+    {
+        end = WS2812_EncodeBytes(ws2812_tx, src++, 1);
+        for (p = ws2812_tx; p != end; p++)
+        {
+            SPI_TxRx(*p);
+        }
+    }
+    for (i = 0; i < WS2812_LATCH_SIZE; i++)
+    {
+        SPI_TxRx(0x00);
+    }
+    return HAL_OK;
+#endif
+}
+
+uint8_t WS2812_IsBusy(void)
+{
+#if (__CONF_MCU_TYPE == 3)
+    return ws2812_busy;
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,106 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __FW_WS2812__
+#define __FW_WS2812__
+
+#include "fw_hal.h"
+
+/**
+ * WS2812/SK6812 addressable LEDs driven by the MOSI pin of SPI
+ *
+ * Each LED bit is sent as 3 or 4 SPI bits, the high part of the bit is 1 or 2 SPI bits
+ *   3 bits: 0 = 100, 1 = 110, SPI clock 2.4MHz (2.1 - 2.8MHz)
+ *   4 bits: 0 = 1000, 1 = 1100, SPI clock 3.2MHz (2.8 - 3.6MHz), e.g. 24MHz / 8
+ * In 4-bit mode every SPI byte ends with a low bit, so gaps between bytes only stretch
+ * the low part. In 3-bit mode LED bits cross SPI byte boundaries: the first byte of
+ * each LED byte ends with LED bit 5, the second with the leading high of LED bit 2, so a
+ * gap stretches a high part and corrupts the color. 3-bit mode needs the gapless DMA path.
+ *
+ * On STC8H, the frame is encoded in chunks into two small buffers and streamed by DMA_SPI,
+ * the next chunk is encoded in the DMA interrupt while the previous one is sending.
+ * Chunks end on LED byte boundaries. 150 LEDs take 4.8ms at 3MHz. On other MCUs the frame
+ * is sent by polling SPI, with gaps between bytes, and only 4-bit mode is supported.
+ *
+ * Set SPI to master mode, MSB first, and ignore SS before WS2812_Init().
+*/
+
+#ifndef WS2812_NUM_LEDS
+#define WS2812_NUM_LEDS         150
+#endif
+/**
+ * 3 for WS2812 GRB, 4 for SK6812 GRBW
+*/
+#ifndef WS2812_BYTES_PER_LED
+#define WS2812_BYTES_PER_LED    3
+#endif
+/**
+ * Pixel bytes encoded per DMA transfer, 4 x 32 = 128 SPI bytes, at most 63
+*/
+#ifndef WS2812_CHUNK_SIZE
+#define WS2812_CHUNK_SIZE       32
+#endif
+/**
+ * Zero bytes sent after the pixels as reset/latch, 128 bytes = 341us at 3MHz,
+ * newer WS2812B parts need more than 280us
+*/
+#ifndef WS2812_LATCH_SIZE
+#define WS2812_LATCH_SIZE       128
+#endif
+
+#define WS2812_BUFFER_SIZE      (WS2812_NUM_LEDS * WS2812_BYTES_PER_LED)
+
+typedef enum
+{
+    WS2812_Encoding_3Bit    = 0x03,
+    WS2812_Encoding_4Bit    = 0x04,
+} WS2812_Encoding_t;
+
+/**
+ * Pixels in LED order, GRB or GRBW, raw values before gamma and brightness
+*/
+extern __XDATA uint8_t WS2812_Buffer[WS2812_BUFFER_SIZE];
+
+/**
+ * Clear the buffer, set brightness to 255 with gamma correction,
+ * and take the DMA_SPI channel on STC8H.
+ * Returns HAL_ERROR for WS2812_Encoding_3Bit on MCUs without DMA_SPI.
+*/
+HAL_StatusTypeDef WS2812_Init(WS2812_Encoding_t encoding);
+/**
+ * Build the output level table: level = gamma(value) * (brightness + 1) / 256,
+ * applied when the frame is encoded, the buffer is not changed
+*/
+void WS2812_SetBrightness(uint8_t brightness, HAL_State_t gamma);
+void WS2812_SetPixel(uint16_t index, uint8_t r, uint8_t g, uint8_t b);
+#if (WS2812_BYTES_PER_LED == 4)
+void WS2812_SetPixelRGBW(uint16_t index, uint8_t r, uint8_t g, uint8_t b, uint8_t w);
+#endif
+void WS2812_Fill(uint8_t r, uint8_t g, uint8_t b);
+/**
+ * Send the buffer. On STC8H it returns when the first chunk is started,
+ * HAL_BUSY if the previous frame is still sending.
+ * The buffer is read while sending, change it after WS2812_IsBusy() returns 0.
+*/
+HAL_StatusTypeDef WS2812_Show(void);
+uint8_t WS2812_IsBusy(void);
+#if (__CONF_MCU_TYPE == 3)
+/**
+ * Registered to DMA_Channel_Dispatch() by WS2812_Init(), route the interrupt with
+ *   INTERRUPT(DMA_SPI_Routine, EXTI_VectDMA_SPI) { DMA_Channel_Dispatch(DMA_Channel_SPI); }
+*/
+void WS2812_DMA_Handler(void);
+#endif
+
+#endif
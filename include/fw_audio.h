@@ -0,0 +1,59 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ___FW_AUDIO_H___
+#define ___FW_AUDIO_H___
+
+#include "fw_conf.h"
+#include "fw_types.h"
+
+/**
+ * Audio sample codecs
+ *
+ * - IMA-ADPCM, 4 bits per sample, two samples per byte, low nibble first
+ * - G.711 u-law, 8 bits per sample, 14-bit dynamic range
+ *
+ * Samples are signed 16-bit, use AUDIO_SampleToU8() to get 8-bit PWM duty
+*/
+
+typedef enum
+{
+    AUDIO_Format_PCM8       = 0x00,     // 8-bit unsigned
+    AUDIO_Format_ULaw       = 0x01,
+    AUDIO_Format_IMA_ADPCM  = 0x02,
+} AUDIO_Format_t;
+
+typedef struct
+{
+    int16_t predictor;
+    int8_t index;
+} AUDIO_ADPCM_State_t;
+
+#define AUDIO_SampleToU8(__SAMPLE__)        ((uint8_t)(((uint16_t)(__SAMPLE__) >> 8) ^ 0x80))
+#define AUDIO_U8ToSample(__U8__)            ((int16_t)(((uint16_t)(__U8__) ^ 0x80) << 8))
+
+void AUDIO_ADPCM_Init(AUDIO_ADPCM_State_t *state);
+/**
+ * Encode one sample, returns 4-bit code
+*/
+uint8_t AUDIO_ADPCM_Encode(AUDIO_ADPCM_State_t *state, int16_t sample);
+/**
+ * Decode one 4-bit code
+*/
+int16_t AUDIO_ADPCM_Decode(AUDIO_ADPCM_State_t *state, uint8_t code);
+
+uint8_t AUDIO_ULaw_Encode(int16_t sample);
+int16_t AUDIO_ULaw_Decode(uint8_t ulaw);
+
+#endif
@@ -0,0 +1,83 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef ___FW_CRC_H___
+#define ___FW_CRC_H___
+
+#include "fw_conf.h"
+#include "fw_types.h"
+
+/**
+ * CRC, software only, STC8 has no CRC unit
+ *
+ *   CRC8          CRC-8/MAXIM, poly 0x31 reflected, init 0x00, 1-Wire ROM and scratchpad
+ *   CRC16_CCITT   CRC-16/CCITT-FALSE, poly 0x1021, init 0xFFFF, MSB first
+ *   CRC16_Modbus  CRC-16/MODBUS, poly 0x8005 reflected, init 0xFFFF, low byte sent first
+ *   CRC32         CRC-32 (Ethernet, zlib), poly 0x04C11DB7 reflected, init and xorout 0xFFFFFFFF
+ *
+ * Each algorithm is built in one of three ways, set by CRC8_IMPL, CRC16_CCITT_IMPL,
+ * CRC16_MODBUS_IMPL and CRC32_IMPL:
+ *   CRC_IMPL_BITWISE   no table, 8 shift/xor steps per byte (CCITT uses a
+ *                      shift-xor formula over the whole byte)
+ *   CRC_IMPL_NIBBLE    16-entry __CODE table, 2 lookups per byte
+ *   CRC_IMPL_TABLE     256-entry __CODE table, 1 lookup per byte, table takes
+ *                      256 x 1/2/4 bytes
+ * The cycles per byte of the configured variants are printed by demo/crc/crc_benchmark.c
+ *
+ * Update() takes the running value and can be called on each chunk of a stream:
+ *   crc = CRC16_CCITT_INIT;
+ *   crc = CRC16_CCITT_Update(crc, header, 4);
+ *   crc = CRC16_CCITT_Update(crc, payload, len);
+ * CRC32 needs CRC32_Final() at the end, the others are complete after Update()
+*/
+
+#define CRC_IMPL_BITWISE            0
+#define CRC_IMPL_NIBBLE             1
+#define CRC_IMPL_TABLE              2
+
+#ifndef CRC8_IMPL
+#define CRC8_IMPL                   CRC_IMPL_TABLE
+#endif
+
+#ifndef CRC16_CCITT_IMPL
+#define CRC16_CCITT_IMPL            CRC_IMPL_NIBBLE
+#endif
+
+#ifndef CRC16_MODBUS_IMPL
+#define CRC16_MODBUS_IMPL           CRC_IMPL_NIBBLE
+#endif
+
+#ifndef CRC32_IMPL
+#define CRC32_IMPL                  CRC_IMPL_NIBBLE
+#endif
+
+#define CRC8_INIT                   0x00
+#define CRC16_CCITT_INIT            0xFFFF
+#define CRC16_MODBUS_INIT           0xFFFF
+#define CRC32_INIT                  0xFFFFFFFFUL
+
+#define CRC32_Final(__CRC__)        ((__CRC__) ^ 0xFFFFFFFFUL)
+
+#define CRC8_Calc(__BUF__, __LEN__)         CRC8_Update(CRC8_INIT, (__BUF__), (__LEN__))
+#define CRC16_CCITT_Calc(__BUF__, __LEN__)  CRC16_CCITT_Update(CRC16_CCITT_INIT, (__BUF__), (__LEN__))
+#define CRC16_Modbus_Calc(__BUF__, __LEN__) CRC16_Modbus_Update(CRC16_MODBUS_INIT, (__BUF__), (__LEN__))
+#define CRC32_Calc(__BUF__, __LEN__)        CRC32_Final(CRC32_Update(CRC32_INIT, (__BUF__), (__LEN__)))
+
+uint8_t CRC8_Update(uint8_t crc, const uint8_t *buf, uint16_t len);
+uint16_t CRC16_CCITT_Update(uint16_t crc, const uint8_t *buf, uint16_t len);
+uint16_t CRC16_Modbus_Update(uint16_t crc, const uint8_t *buf, uint16_t len);
+uint32_t CRC32_Update(uint32_t crc, const uint8_t *buf, uint16_t len);
+
+#endif
@@ -26,6 +26,68 @@ typedef enum
     DMA_BusPriority_Highest = 0x03,
 } DMA_BusPriority_t;
 
+/**************************************************************************** /
+ * DMA channel manager
+*/
+
+typedef enum
+{
+    DMA_Channel_M2M     = 0x00,
+    DMA_Channel_ADC     = 0x01,
+    DMA_Channel_SPI     = 0x02,
+    DMA_Channel_UR1T    = 0x03,
+    DMA_Channel_UR1R    = 0x04,
+    DMA_Channel_UR2T    = 0x05,
+    DMA_Channel_UR2R    = 0x06,
+    DMA_Channel_UR3T    = 0x07,
+    DMA_Channel_UR3R    = 0x08,
+    DMA_Channel_UR4T    = 0x09,
+    DMA_Channel_UR4R    = 0x0A,
+    DMA_Channel_LCM     = 0x0B,
+    DMA_Channel_Count   = 0x0C,
+} DMA_Channel_t;
+
+typedef void (*DMA_Callback_t)(void);
+
+typedef struct
+{
+    uint32_t bytes;         // Bytes transferred, from AMT of completed transfers, not counted for ADC
+    uint32_t busyTicks;     // DMA_Channel_Tick() calls while channel is busy
+    uint16_t completions;   // Completion interrupts
+} DMA_ChannelStats_t;
+
+/**
+ * Take ownership of a channel, set bus priority and interrupt priority to the same level,
+ * enable the channel interrupt if handler is not NULL.
+ * Each of Low, High, Highest can be held by one channel only so arbitration between
+ * running channels is fixed, Lowest is shared.
+ * Returns HAL_BUSY if channel is owned, HAL_ERROR if priority is taken.
+*/
+HAL_StatusTypeDef DMA_Channel_Acquire(DMA_Channel_t channel, DMA_BusPriority_t priority, DMA_Callback_t handler);
+void DMA_Channel_Release(DMA_Channel_t channel);
+/**
+ * Enable the channel and set trigger bits in its CR register, e.g. 0x40 for M2M start,
+ * mark channel busy until its completion is dispatched
+*/
+void DMA_Channel_Start(DMA_Channel_t channel, uint8_t trigger);
+/**
+ * Clear the interrupt flag, update the counters and the busy state of a finished transfer,
+ * call this instead of DMA_Channel_Dispatch() when the completion is polled
+*/
+void DMA_Channel_Complete(DMA_Channel_t channel) __REENTRANT;
+/**
+ * Call this in DMA interrupt routines, it does DMA_Channel_Complete() and calls the
+ * registered handler, e.g.
+ *   INTERRUPT(DMA_ADC_Routine, EXTI_VectDMA_ADC) { DMA_Channel_Dispatch(DMA_Channel_ADC); }
+*/
+void DMA_Channel_Dispatch(DMA_Channel_t channel) __REENTRANT;
+/**
+ * Call this in a periodic timer interrupt to measure busy time
+*/
+void DMA_Channel_Tick(void);
+void DMA_Channel_GetStats(DMA_Channel_t channel, DMA_ChannelStats_t *stats);
+void DMA_Channel_ResetStats(DMA_Channel_t channel);
+
 /**************************************************************************** /
  * DMA M2M
 */
@@ -53,6 +115,36 @@ typedef enum
                                                         SFRX_OFF(); \
                                                     } while(0)
 
+typedef void (*DMA_M2M_Callback_t)(void);
+
+/**
+ * Copy len bytes from src to dst, wait until finished.
+ * Both buffers should be in xdata and must not overlap, transfers longer than
+ * 256 bytes are split into 256-byte blocks.
+*/
+HAL_StatusTypeDef DMA_M2M_Copy(uint8_t __XDATA *dst, uint8_t __XDATA *src, uint16_t len);
+/**
+ * Fill len bytes of dst with val, wait until finished.
+ * The first byte is written by CPU, then the filled part is copied forward
+ * in doubling blocks.
+*/
+HAL_StatusTypeDef DMA_M2M_Fill(uint8_t __XDATA *dst, uint8_t val, uint16_t len);
+/**
+ * Start copying and return immediately, callback(can be NULL) is called from
+ * DMA_M2M_IRQHandler() when all blocks are done.
+ * Returns HAL_BUSY if previous transfer is not finished.
+ * A transfer acquires DMA_Channel_M2M with the lowest priority and releases it when done,
+ * unless the channel is acquired with DMA_M2M_IRQHandler as handler beforehand.
+*/
+HAL_StatusTypeDef DMA_M2M_CopyAsync(uint8_t __XDATA *dst, uint8_t __XDATA *src, uint16_t len, DMA_M2M_Callback_t callback);
+HAL_StatusTypeDef DMA_M2M_FillAsync(uint8_t __XDATA *dst, uint8_t val, uint16_t len, DMA_M2M_Callback_t callback);
+uint8_t DMA_M2M_IsBusy(void);
+/**
+ * Handler of DMA_Channel_M2M, route the interrupt with
+ *   INTERRUPT(DMA_M2M_Routine, EXTI_VectDMA_M2M) { DMA_Channel_Dispatch(DMA_Channel_M2M); }
+*/
+void DMA_M2M_IRQHandler(void);
+
 /**************************************************************************** /
  * DMA ADC
 */
@@ -104,6 +196,66 @@ typedef enum
  * DMA SPI
 */
 
+#define DMA_SPI_SetTxEnabled(__STATE__)             SFRX_ASSIGN(DMA_SPI_CFG, 6, __STATE__)
+#define DMA_SPI_SetRxEnabled(__STATE__)             SFRX_ASSIGN(DMA_SPI_CFG, 5, __STATE__)
+#define DMA_SPI_SetBusPriority(__PRI__)             SFRX_ASSIGN2BIT(DMA_SPI_CFG, 0, __PRI__)
+#define DMA_SPI_SetEnabled(__STATE__)               SFRX_ASSIGN(DMA_SPI_CR, 7, __STATE__)
+#define DMA_SPI_TriggerMaster()                     SFRX_SET(DMA_SPI_CR, 6)
+#define DMA_SPI_TriggerSlave()                      SFRX_SET(DMA_SPI_CR, 5)
+#define DMA_SPI_ClearFifo()                         SFRX_SET(DMA_SPI_CR, 0)
+#define DMA_SPI_ClearInterrupt()                    SFRX_RESET(DMA_SPI_STA, 0)
+/**
+ * Drive the SS pin selected by DMA_SPI_SetSlaveSelectPin() low during transfer
+*/
+#define DMA_SPI_SetAutoSlaveSelect(__STATE__)       SFRX_ASSIGN(DMA_SPI_CFG2, 2, __STATE__)
+/**
+ * 00:P1.2/P5.4, 01:P2.2, 10:P7.4, 11:P3.5
+*/
+#define DMA_SPI_SetSlaveSelectPin(__PIN__)          SFRX_ASSIGN2BIT(DMA_SPI_CFG2, 0, __PIN__)
+/**
+ * Transfer size = __LEN__ + 1
+*/
+#define DMA_SPI_SetTxLength(__LEN__)                do{SFRX_ON(); DMA_SPI_AMT = (__LEN__); SFRX_OFF();}while(0)
+#define DMA_SPI_SetSrcAddr(__16BIT_ADDR__)          do{   \
+                                                        SFRX_ON(); \
+                                                        (DMA_SPI_TXAH = ((__16BIT_ADDR__) >> 8)); \
+                                                        (DMA_SPI_TXAL = ((__16BIT_ADDR__) & 0xFF)); \
+                                                        SFRX_OFF(); \
+                                                    } while(0)
+#define DMA_SPI_SetDstAddr(__16BIT_ADDR__)          do{   \
+                                                        SFRX_ON(); \
+                                                        (DMA_SPI_RXAH = ((__16BIT_ADDR__) >> 8)); \
+                                                        (DMA_SPI_RXAL = ((__16BIT_ADDR__) & 0xFF)); \
+                                                        SFRX_OFF(); \
+                                                    } while(0)
+
 
+/**************************************************************************** /
+ * DMA LCM
+*/
+
+#define DMA_LCM_SetBusPriority(__PRI__)             SFRX_ASSIGN2BIT(DMA_LCM_CFG, 0, __PRI__)
+#define DMA_LCM_SetEnabled(__STATE__)               SFRX_ASSIGN(DMA_LCM_CR, 7, __STATE__)
+#define DMA_LCM_TriggerWriteCmd()                   SFRX_SET(DMA_LCM_CR, 6)
+#define DMA_LCM_TriggerWriteData()                  SFRX_SET(DMA_LCM_CR, 5)
+#define DMA_LCM_TriggerReadCmd()                    SFRX_SET(DMA_LCM_CR, 4)
+#define DMA_LCM_TriggerReadData()                   SFRX_SET(DMA_LCM_CR, 3)
+#define DMA_LCM_ClearInterrupt()                    SFRX_RESET(DMA_LCM_STA, 0)
+/**
+ * Transfer size = __LEN__ + 1
+*/
+#define DMA_LCM_SetTxLength(__LEN__)                do{SFRX_ON(); DMA_LCM_AMT = (__LEN__); SFRX_OFF();}while(0)
+#define DMA_LCM_SetSrcAddr(__16BIT_ADDR__)          do{   \
+                                                        SFRX_ON(); \
+                                                        (DMA_LCM_TXAH = ((__16BIT_ADDR__) >> 8)); \
+                                                        (DMA_LCM_TXAL = ((__16BIT_ADDR__) & 0xFF)); \
+                                                        SFRX_OFF(); \
+                                                    } while(0)
+#define DMA_LCM_SetDstAddr(__16BIT_ADDR__)          do{   \
+                                                        SFRX_ON(); \
+                                                        (DMA_LCM_RXAH = ((__16BIT_ADDR__) >> 8)); \
+                                                        (DMA_LCM_RXAL = ((__16BIT_ADDR__) & 0xFF)); \
+                                                        SFRX_OFF(); \
+                                                    } while(0)
 
 #endif
@@ -253,4 +253,74 @@ typedef enum
             SFRX(PxIM1 + (__PORT__)) = SFRX(PxIM1 + (__PORT__)) & ~(__PINS__) | (((__PORT_INT_MODE__) & 0x02)? (__PINS__) : 0x00);  \
         SFRX_OFF(); } while(0)
 
+#if (__CONF_MCU_TYPE == 3  )
+/**************************************************************************** /
+ * Pin change dispatcher
+ *
+ * Per-pin interrupts of P0 - P7 are decoded lowest pin first and turned into
+ * events in a ring buffer, so buttons and switches need no polling.
+ *   - Each edge is stamped with the tick counter, increased by EXTI_Pin_TickHandler()
+ *   - A pin with debounce > 0 has its interrupt turned off on the first edge, the
+ *     tick handler samples it after debounce ticks and reports a change of the
+ *     stable level with the timestamp of that first edge
+ *   - A pin with debounce = 0 reports every edge from the port interrupt
+ * Interrupt mode is switched between falling and rising to follow the level, both
+ * directions are tracked whatever edge is reported. Events are read in main
+ * loop without turning interrupts off. Route the interrupts with
+ *   EXTI_PIN_ROUTINE(3)
+ *   INTERRUPT(Timer0_Routine, EXTI_VectTimer0) { EXTI_Pin_TickHandler(); }
+*/
+
+#define EXTI_PIN_QUEUE_SIZE     16
+
+typedef enum
+{
+    EXTI_PinEdge_Fall   = 0x01,
+    EXTI_PinEdge_Rise   = 0x02,
+    EXTI_PinEdge_Both   = 0x03,
+} EXTI_PinEdge_t;
+
+typedef struct
+{
+    uint8_t pin;            // port << 3 | bit
+    uint8_t edge;           // EXTI_PinEdge_Fall or EXTI_PinEdge_Rise
+    uint16_t timestamp;     // Ticks at the first edge
+} EXTI_PinEvent_t;
+
+#define EXTI_PinEvent_GetPort(__EVENT__)    ((__EVENT__)->pin >> 3)
+#define EXTI_PinEvent_GetMask(__EVENT__)    (0x01 << ((__EVENT__)->pin & 0x07))
+
+/**
+ * Interrupt service routine of one port, e.g. EXTI_PIN_ROUTINE(3) for P3
+*/
+#define EXTI_PIN_ROUTINE(__PORT__)  INTERRUPT(EXTI_Pin_P##__PORT__##_Routine, EXTI_VectP##__PORT__) \
+                                    { EXTI_Pin_IRQHandler(__PORT__); }
+
+/**
+ * Turn off all pin interrupts and clear the event queue
+*/
+void EXTI_Pin_Init(void);
+/**
+ * Start watching pins(mask) of port, pins should be in input or quasi-bidirectional mode.
+ * edge: edges to report, debounce: stable ticks required, 0 to report each edge
+*/
+void EXTI_Pin_Config(uint8_t port, uint8_t pins, EXTI_PinEdge_t edge, uint8_t debounce);
+void EXTI_Pin_Disable(uint8_t port, uint8_t pins);
+/**
+ * Take one event from the queue, returns HAL_ERROR if it is empty
+*/
+HAL_StatusTypeDef EXTI_Pin_Read(EXTI_PinEvent_t *event);
+/**
+ * Events dropped because the queue was full
+*/
+uint16_t EXTI_Pin_GetOverruns(void);
+uint16_t EXTI_Pin_GetTicks(void);
+/**
+ * Debounced levels of the watched pins of port
+*/
+uint8_t EXTI_Pin_GetState(uint8_t port);
+void EXTI_Pin_IRQHandler(uint8_t port);
+void EXTI_Pin_TickHandler(void);
+#endif
+
 #endif
@@ -149,4 +149,62 @@ typedef enum
                         } while(0)
 
 
+/**************************************************************************** /
+ * Pin descriptors
+ *
+ * A pin is a constant pair of port and bit, a group is a port and a mask of pins on it
+ *   #define LED_PIN         GPIO_PIN(3, 2)
+ *   #define SEG_PINS        GPIO_PINS(2, 0x0F)
+ *   #define LED_PINS        GPIO_PINS(PIN_PORT(LED_PIN), PIN_MASK(LED_PIN) | PIN_MASK(LED2_PIN))
+ * The preprocessor turns the operations into sbit and port accesses, a pin compiles to
+ * SETB/CLR/CPL/MOV C, a group to a single ORL/ANL/XRL on the port, or one
+ * read-modify-write for PINS_WRITE. Drivers take the descriptors as macros so
+ * a different pinout only changes the defines.
+*/
+#define GPIO_PIN(__PORT__, __BIT__)             __PORT__, __BIT__
+#define GPIO_PINS(__PORT__, __MASK__)           __PORT__, __MASK__
+
+#define PIN_PORT(__PIN__)                       GPIO_PIN_PORT_(__PIN__)
+#define PIN_MASK(__PIN__)                       GPIO_PIN_MASK_(__PIN__)
+#define PIN_SET(__PIN__)                        GPIO_PIN_WRITE_(__PIN__, 1)
+#define PIN_CLR(__PIN__)                        GPIO_PIN_WRITE_(__PIN__, 0)
+#define PIN_WRITE(__PIN__, __STATE__)           GPIO_PIN_WRITE_(__PIN__, (__STATE__)? 1 : 0)
+#define PIN_TOGGLE(__PIN__)                     GPIO_PIN_TOGGLE_(__PIN__)
+#define PIN_READ(__PIN__)                       GPIO_PIN_READ_(__PIN__)
+#define PIN_SetMode(__PIN__, __MODE__)          GPIO_PIN_SETMODE_(__PIN__, __MODE__)
+#define PIN_SetPullUp(__PIN__, __STATE__)       GPIO_PIN_SETPULLUP_(__PIN__, __STATE__)
+
+#define PINS_MASK(__PINS__)                     GPIO_PINS_MASK_(__PINS__)
+#define PINS_SET(__PINS__)                      GPIO_PINS_SET_(__PINS__)
+#define PINS_CLR(__PINS__)                      GPIO_PINS_CLR_(__PINS__)
+#define PINS_TOGGLE(__PINS__)                   GPIO_PINS_TOGGLE_(__PINS__)
+/**
+ * Masked port value, pins keep their positions
+*/
+#define PINS_READ(__PINS__)                     GPIO_PINS_READ_(__PINS__)
+/**
+ * Set pins of the group to the bits of value in one read-modify-write,
+ * value is in pin positions
+*/
+#define PINS_WRITE(__PINS__, __VALUE__)         GPIO_PINS_WRITE_(__PINS__, __VALUE__)
+#define PINS_SetMode(__PINS__, __MODE__)        GPIO_PINS_SETMODE_(__PINS__, __MODE__)
+#define PINS_SetPullUp(__PINS__, __STATE__)     GPIO_PINS_SETPULLUP_(__PINS__, __STATE__)
+
+// Descriptor arguments are expanded into port and bit/mask before they reach these
+#define GPIO_PIN_PORT_(__PORT__, __BIT__)               __PORT__
+#define GPIO_PIN_MASK_(__PORT__, __BIT__)               (0x01 << (__BIT__))
+#define GPIO_PIN_WRITE_(__PORT__, __BIT__, __STATE__)   (P##__PORT__##__BIT__ = (__STATE__))
+#define GPIO_PIN_TOGGLE_(__PORT__, __BIT__)             (P##__PORT__##__BIT__ = !P##__PORT__##__BIT__)
+#define GPIO_PIN_READ_(__PORT__, __BIT__)               (P##__PORT__##__BIT__)
+#define GPIO_PIN_SETMODE_(__PORT__, __BIT__, __MODE__)     GPIO_P##__PORT__##_SetMode(0x01 << (__BIT__), __MODE__)
+#define GPIO_PIN_SETPULLUP_(__PORT__, __BIT__, __STATE__)   GPIO_SetPullUp(GPIO_Port_##__PORT__, 0x01 << (__BIT__), __STATE__)
+#define GPIO_PINS_MASK_(__PORT__, __MASK__)             (__MASK__)
+#define GPIO_PINS_SET_(__PORT__, __MASK__)              (P##__PORT__ |= (__MASK__))
+#define GPIO_PINS_CLR_(__PORT__, __MASK__)              (P##__PORT__ &= ~(__MASK__))
+#define GPIO_PINS_TOGGLE_(__PORT__, __MASK__)           (P##__PORT__ ^= (__MASK__))
+#define GPIO_PINS_READ_(__PORT__, __MASK__)             (P##__PORT__ & (__MASK__))
+#define GPIO_PINS_WRITE_(__PORT__, __MASK__, __VALUE__) (P##__PORT__ = P##__PORT__ & ~(__MASK__) | ((__VALUE__) & (__MASK__)))
+#define GPIO_PINS_SETMODE_(__PORT__, __MASK__, __MODE__)    GPIO_P##__PORT__##_SetMode(__MASK__, __MODE__)
+#define GPIO_PINS_SETPULLUP_(__PORT__, __MASK__, __STATE__) GPIO_SetPullUp(GPIO_Port_##__PORT__, __MASK__, __STATE__)
+
 #endif
@@ -29,6 +29,9 @@
 #include "fw_iap.h"
 #include "fw_util.h"
 #include "fw_wdt.h"
+#include "fw_onewire.h"
+#include "fw_crc.h"
+#include "fw_softspi.h"
 
 #if (__CONF_MCU_TYPE == 2  )
 #include "fw_pca.h"
@@ -37,6 +40,7 @@
 #include "fw_pwm.h"
 #include "fw_rtc.h"
 #include "fw_dma.h"
+#include "fw_lcm.h"
 #include "fw_usb.h"
 #endif
 
@@ -64,9 +64,15 @@ typedef enum
                 SFRX_OFF();                                                             \
             } while(0)
 
+#if defined (__HOST_SIM)
+#define I2C_MasterCmdFinished()             SIM_I2C_Poll()
+#else
+#define I2C_MasterCmdFinished()             (I2CMSST & 0x40)
+#endif
+
 #define I2C_SendMasterCmd(__CMD__) {                                 \
                 (I2CMSCR) =  (I2CMSCR) & ~(0x0F) | ((__CMD__) & 0x0F);  \
-                while (!(I2CMSST & 0x40));                              \
+                while (!I2C_MasterCmdFinished());                       \
                 I2CMSST &= ~0x40;                                       \
             }
 
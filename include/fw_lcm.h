@@ -0,0 +1,119 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ___FW_LCM_H___
+#define ___FW_LCM_H___
+
+#include "fw_conf.h"
+#include "fw_types.h"
+
+/**
+ * LCM, parallel interface for LCD/TFT panels, STC8H8K64U, STC8H4K64TL
+*/
+
+typedef enum
+{
+    LCM_Mode_I8080      = 0x00,
+    LCM_Mode_M6800      = 0x01,
+} LCM_Mode_t;
+
+typedef enum
+{
+    LCM_DataWidth_8Bit  = 0x00,
+    LCM_DataWidth_16Bit = 0x01,
+} LCM_DataWidth_t;
+
+typedef enum
+{
+    //                           8-bit, 16-bit: D15-D8 D7-D0
+    LCM_AlterDataPort_P2_P0     = 0x00,
+    LCM_AlterDataPort_P6_P2     = 0x01,
+    LCM_AlterDataPort_P2_P7     = 0x02,
+    LCM_AlterDataPort_P6_P7     = 0x03,
+} LCM_AlterDataPort_t;
+
+typedef enum
+{
+    //                           RS  RD(E) WR(RW)
+    LCM_AlterCtrlPort_P45_P44_P42   = 0x00,
+    LCM_AlterCtrlPort_P45_P37_P36   = 0x01,
+    LCM_AlterCtrlPort_P40_P44_P42   = 0x02,
+    LCM_AlterCtrlPort_P40_P37_P36   = 0x03,
+} LCM_AlterCtrlPort_t;
+
+typedef enum
+{
+    LCM_Cmd_WriteCmd    = 0x04,
+    LCM_Cmd_WriteData   = 0x05,
+    LCM_Cmd_ReadStatus  = 0x06,
+    LCM_Cmd_ReadData    = 0x07,
+} LCM_Cmd_t;
+
+#define LCM_SetMode(__MODE__)                   SFRX_ASSIGN(LCMIFCFG, 0, (__MODE__))
+#define LCM_SetDataWidth(__WIDTH__)             SFRX_ASSIGN(LCMIFCFG, 1, (__WIDTH__))
+#define LCM_SetDataPort(__ALTER_PORT__)         SFRX_ASSIGN2BIT(LCMIFCFG, 2, (__ALTER_PORT__))
+#define LCM_SetCtrlPort(__ALTER_PORT__)         SFRX_ASSIGN2BIT(LCMIFCFG2, 5, (__ALTER_PORT__))
+/**
+ * Setup time: 0 - 7 (+1) clocks, hold time: 0 - 3 (+1) clocks
+*/
+#define LCM_SetSetupTime(__CLOCKS__)            SFRX_ASSIGN3BIT(LCMIFCFG2, 2, (__CLOCKS__))
+#define LCM_SetHoldTime(__CLOCKS__)             SFRX_ASSIGN2BIT(LCMIFCFG2, 0, (__CLOCKS__))
+#define LCM_SetEnabled(__STATE__)               SFRX_ASSIGN(LCMIFCR, 7, (__STATE__))
+
+/**
+ * Call SFRX_ON(); before calling following macros
+*/
+#if defined (__HOST_SIM)
+#define LCM_OpFinished()                        SIM_LCM_Poll()
+#else
+#define LCM_OpFinished()                        (LCMIFSTA & 0x01)
+#endif
+#define LCM_ClearInterrupt()                    (LCMIFSTA = 0x00)
+#define LCM_SendCmd(__CMD__)                    (LCMIFCR = 0x80 | (__CMD__))
+
+void LCM_Config(
+    LCM_Mode_t mode,
+    LCM_DataWidth_t width,
+    LCM_AlterDataPort_t dataPort,
+    LCM_AlterCtrlPort_t ctrlPort,
+    uint8_t setupTime,
+    uint8_t holdTime);
+
+void LCM_WriteCmd(uint16_t cmd);
+void LCM_WriteData(uint16_t dat);
+uint16_t LCM_ReadData(void);
+
+typedef void (*LCM_Callback_t)(void);
+
+/**
+ * Write data from xdata buffer through DMA, wait until finished.
+ * Length is in bytes, transfers longer than 256 bytes are split into blocks.
+*/
+HAL_StatusTypeDef LCM_WriteDataDMA(uint8_t __XDATA *buf, uint16_t len);
+/**
+ * Start DMA write and return immediately, callback(can be NULL) is called from
+ * LCM_DMA_IRQHandler() when all blocks are done.
+ * Returns HAL_BUSY if previous transfer is not finished.
+ * A transfer acquires DMA_Channel_LCM with the lowest priority and releases it when done,
+ * unless the channel is acquired with LCM_DMA_IRQHandler as handler beforehand.
+*/
+HAL_StatusTypeDef LCM_WriteDataDMAAsync(uint8_t __XDATA *buf, uint16_t len, LCM_Callback_t callback);
+uint8_t LCM_DMA_IsBusy(void);
+/**
+ * Handler of DMA_Channel_LCM, route the interrupt with
+ *   INTERRUPT(DMA_LCM_Routine, EXTI_VectDMA_LCM) { DMA_Channel_Dispatch(DMA_Channel_LCM); }
+*/
+void LCM_DMA_IRQHandler(void);
+
+#endif
@@ -20,7 +20,7 @@
 
 #define MEM_ReadCODE(__ADDR__)      (*(unsigned char volatile __CODE *)(__ADDR__))
 // Set SFRX_ON() before using this macro
-#define MEM_ReadXDATA(__ADDR__)     (*(unsigned char volatile __XDATA *)(__ADDR__))
+#define MEM_ReadXDATA(__ADDR__)     SFRX(__ADDR__)
 
 typedef enum
 {
@@ -0,0 +1,125 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef ___FW_ONEWIRE_H___
+#define ___FW_ONEWIRE_H___
+
+#include "fw_conf.h"
+#include "fw_types.h"
+#include "fw_gpio.h"
+
+/**
+ * 1-Wire master, time slots generated by Timer0 interrupt
+ *
+ * Timer0 runs in 1T mode and is reloaded in each interrupt for the length of the
+ * next interval, so timing is counted in SYSCLK cycles. Each interrupt ends one
+ * slot and starts the next one:
+ *   write 0        DQ is pulled low and left low, released by the next interrupt
+ *   write 1/read   DQ is pulled low for 2us and released, the line is sampled at
+ *                  12us, the only part busy waiting on the timer counter
+ *   reset          480us low, presence sampled at 70us after release, 410us end
+ * The CPU is free for about 80% of a slot. A slot is 70us, a little longer if
+ * the interrupt is delayed, set Timer0 to the highest interrupt priority.
+ *
+ * Operations run in background and start with reset unless noted, poll
+ * OW_IsBusy() or OW_GetStatus() for the result. Buffers must stay valid until
+ * the operation ends. DQ is open-drain with the internal pull-up(STC8A needs an
+ * external one), route the interrupt with
+ *   INTERRUPT(Timer0_Routine, EXTI_VectTimer0) { OW_IRQHandler(); }
+ *
+ * UART transport, selected by OW_UART_Init() instead of OW_Init()
+ *
+ * UART2 runs half-duplex: TxD2 is open-drain and tied to RxD2 and DQ, each slot is
+ * one byte and its echo is the sample. A reset is 0xF0 at 9600 baud, the presence
+ * pulse changes the echo. At 115200 baud write 0 is 0x00, write 1 and read are
+ * 0xFF, a device pulling DQ low changes the echo. Timer2 is the baud generator and
+ * is switched between the two rates, it can't be shared with UART1/3/4. Route with
+ *   INTERRUPT(UART2_Routine, EXTI_VectUART2) { OW_UART_IRQHandler(); }
+ * On STC8H with DMA enabled, write and read phases run in batches of up to 8 bytes,
+ * 64 slot bytes sent by UR2T and echoed into the same buffer by UR2R, one interrupt
+ * per batch. ROM search and single bits stay one byte per interrupt. Route with
+ *   INTERRUPT(DMA_UR2R_Routine, EXTI_VectDMA_UR2R) { DMA_Channel_Dispatch(DMA_Channel_UR2R); }
+*/
+
+#ifndef OW_DQ_PIN
+#define OW_DQ_PIN                   GPIO_PIN(3, 5)
+#endif
+
+#ifndef OW_UART_TX_PIN
+#define OW_UART_TX_PIN              GPIO_PIN(1, 1)
+#endif
+
+// Command and ROM bytes written in one operation
+#define OW_TX_BUFFER_SIZE           16
+
+/* ROM commands */
+#define OW_CMD_SEARCHROM            0xF0
+#define OW_CMD_READROM              0x33
+#define OW_CMD_MATCHROM             0x55
+#define OW_CMD_SKIPROM              0xCC
+#define OW_CMD_ALARMSEARCH          0xEC
+
+void OW_Init(void);
+/**
+ * Reset only, status is HAL_ERROR if no presence pulse
+*/
+HAL_StatusTypeDef OW_Reset(void);
+/**
+ * Write bytes without reset
+*/
+HAL_StatusTypeDef OW_Write(const uint8_t *tx, uint8_t len);
+/**
+ * Read bytes without reset
+*/
+HAL_StatusTypeDef OW_Read(uint8_t *rx, uint8_t len);
+/**
+ * Single slot without reset, bit is 0 or 1
+*/
+HAL_StatusTypeDef OW_WriteBit(uint8_t bit);
+HAL_StatusTypeDef OW_ReadBit(uint8_t *bit);
+/**
+ * Reset, MATCH ROM with rom, or SKIP ROM if rom is NULL, write tx and read rx_len bytes
+ * into rx. Returns HAL_BUSY if an operation is running, HAL_ERROR if tx is too long
+*/
+HAL_StatusTypeDef OW_Transfer(const uint8_t *rom, const uint8_t *tx, uint8_t tx_len, uint8_t *rx, uint8_t rx_len);
+/**
+ * Restart ROM search from the first device
+*/
+void OW_Search_Reset(void);
+/**
+ * Find next device with cmd OW_CMD_SEARCHROM or OW_CMD_ALARMSEARCH, the 8-byte ROM is
+ * written to rom. Returns HAL_ERROR if the last device has been found, the status is
+ * HAL_ERROR if no device answers. CRC of the ROM is not checked
+*/
+HAL_StatusTypeDef OW_Search(uint8_t cmd, uint8_t *rom);
+uint8_t OW_IsBusy(void);
+/**
+ * Result of the last operation, HAL_BUSY while running
+*/
+HAL_StatusTypeDef OW_GetStatus(void);
+/**
+ * Wait for the running operation and return its result
+*/
+HAL_StatusTypeDef OW_Wait(void);
+void OW_IRQHandler(void);
+
+/**
+ * Use UART2 as transport, dma is for STC8H only and ignored on other types.
+ * Returns HAL_BUSY if an operation is running, HAL_ERROR if DMA channels are taken
+*/
+HAL_StatusTypeDef OW_UART_Init(HAL_State_t dma);
+void OW_UART_IRQHandler(void);
+
+#endif
@@ -146,4 +146,77 @@ typedef enum
 */
 #define PCA_SetPort(__ALTER_PORT__)         (P_SW1 = P_SW1 & ~(0x03 << 4) | ((__ALTER_PORT__) << 4))
 
+/**************************************************************************** /
+ * Compare timers, capture and pulse output
+ *
+ * The PCA counter runs free and is extended to 32 bits by the CF overflow
+ * interrupt. Each of PCA0 - PCA2 works as one of
+ *   Timer      callback after an interval, once or periodically
+ *   Capture    edge timestamps in 32-bit ticks, put into a ring buffer
+ *   Pulse      high-speed output toggles CCPn on compare match, high/low times
+ *              are added to the previous match value so ISR latency gives no jitter
+ * Intervals are 32-bit, longer than 0xFFFF ticks are matched in several parts.
+ * The ISR must finish before the next match, keep intervals above ~100 SYSCLK.
+*/
+
+#define PCA_CAP_BUFFER_SIZE     16
+
+typedef enum
+{
+    PCA_Channel_0 = 0x00,
+    PCA_Channel_1 = 0x01,
+    PCA_Channel_2 = 0x02,
+} PCA_Channel_t;
+
+typedef void (*PCA_Callback_t)(void);
+
+typedef struct
+{
+    uint8_t channel;
+    uint32_t timestamp;
+} PCA_CapEvent_t;
+
+/**
+ * Start the counter from 0 with overflow interrupt, route the interrupt with
+ *   INTERRUPT(PCA_Routine, EXTI_VectPCA) { PCA_IRQHandler(); }
+*/
+void PCA_Timebase_Init(PCA_ClockSource_t source);
+/**
+ * Tick frequency in Hz, 0 for Timer0 and external clock sources
+*/
+uint32_t PCA_GetClock(void);
+uint32_t PCA_GetTicks(void);
+/**
+ * Call callback(can be NULL) from PCA interrupt after interval ticks, and then every
+ * interval ticks if periodic is ON
+*/
+HAL_StatusTypeDef PCA_Timer_Start(PCA_Channel_t channel, uint32_t interval, HAL_State_t periodic, PCA_Callback_t callback);
+/**
+ * mode: PCA_WorkMode_CAP_16bitRising, PCA_WorkMode_CAP_16bitFalling or PCA_WorkMode_CAP_16bitEdge
+*/
+HAL_StatusTypeDef PCA_Capture_Start(PCA_Channel_t channel, PCA_WorkMode_t mode);
+/**
+ * Take one event from ring buffer, returns HAL_ERROR if it is empty
+*/
+HAL_StatusTypeDef PCA_Capture_Read(PCA_CapEvent_t *event);
+/**
+ * Events dropped because ring buffer was full
+*/
+uint16_t PCA_Capture_GetOverruns(void);
+/**
+ * CCPn should be low when started, the first rising edge comes after low ticks.
+ * count: number of high pulses, 0 for endless, the channel stops after the last falling edge
+*/
+HAL_StatusTypeDef PCA_Pulse_Start(PCA_Channel_t channel, uint32_t high, uint32_t low, uint16_t count);
+/**
+ * Change high and low times, each edge takes the latest values
+*/
+void PCA_Pulse_SetWidth(PCA_Channel_t channel, uint32_t high, uint32_t low);
+/**
+ * Returns 1 while timer or pulse train is running
+*/
+uint8_t PCA_Channel_IsBusy(PCA_Channel_t channel);
+void PCA_Channel_Stop(PCA_Channel_t channel);
+void PCA_IRQHandler(void);
+
 #endif
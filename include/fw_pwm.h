@@ -50,6 +50,12 @@ typedef enum
     PWM_EdgeAlignment_CenterBoth    = 0x11,
 } PWM_EdgeAlignment_t;
 
+typedef enum
+{
+    PWM_Timer_PWMA  = 0x00,
+    PWM_Timer_PWMB  = 0x01,
+} PWM_Timer_t;
+
 typedef enum
 {
     PWM_CounterDirection_Up     = 0x00,
@@ -524,4 +530,196 @@ typedef enum
                     }while(0)
 
 
+/**************************************************************************** /
+ * PWM input capture
+ *
+ * PWMA and PWMB run as free 16-bit counters extended to 32 bits by the update
+ * interrupt, each capture is stamped with the extended count. Results are put
+ * into a ring buffer by the interrupt handlers and read in main loop.
+ *
+ * Channels PWM_CapChannel_1 - 4 are PWMA.1 - PWMA.4, PWM_CapChannel_5 - 8 are
+ * PWMB.1 - PWMB.4. Route the pins with PWMA_PWMx_SetPort()/PWMB_PWMx_SetPort()
+ * and set them to input mode.
+*/
+
+#define PWM_CAP_BUFFER_SIZE     16      // Results in ring buffer, power of 2
+
+typedef enum
+{
+    PWM_CapChannel_1 = 0x00,
+    PWM_CapChannel_2 = 0x01,
+    PWM_CapChannel_3 = 0x02,
+    PWM_CapChannel_4 = 0x03,
+    PWM_CapChannel_5 = 0x04,
+    PWM_CapChannel_6 = 0x05,
+    PWM_CapChannel_7 = 0x06,
+    PWM_CapChannel_8 = 0x07,
+} PWM_CapChannel_t;
+
+typedef enum
+{
+    PWM_CapMode_Off         = 0x00,
+    /**
+     * One result per capture, rising edge to rising edge
+    */
+    PWM_CapMode_Period      = 0x01,
+    /**
+     * Period and high pulse width. The next channel (PWM_CapChannel_2 for
+     * PWM_CapChannel_1) captures the falling edge of the same pin, so only
+     * PWM_CapChannel_1, 3, 5, 7 can be used and the next channel is occupied
+    */
+    PWM_CapMode_PeriodDuty  = 0x02,
+    /**
+     * Reciprocal counting, one result per gate time: the ticks between the first
+     * and the last rising edge in gate time, and the number of periods between
+     * them. Resolution is one tick regardless of input frequency.
+    */
+    PWM_CapMode_Frequency   = 0x03,
+} PWM_CapMode_t;
+
+/**
+ * Capture on every 1, 2, 4 or 8 edges, reduces interrupt rate of high
+ * frequency inputs in Period and Frequency modes
+*/
+typedef enum
+{
+    PWM_CapPrescaler_1 = 0x00,
+    PWM_CapPrescaler_2 = 0x01,
+    PWM_CapPrescaler_4 = 0x02,
+    PWM_CapPrescaler_8 = 0x03,
+} PWM_CapPrescaler_t;
+
+typedef struct
+{
+    uint8_t channel;
+    uint32_t period;    // Ticks of `count` periods
+    uint32_t width;     // Ticks of high pulse, PeriodDuty mode only
+    uint16_t count;     // Number of periods measured
+} PWM_CapResult_t;
+
+/**
+ * Stop the counter, set tick = SYSCLK / (prescaler + 1), and restart it as a
+ * free running up counter with update interrupt
+*/
+void PWM_Cap_Init(PWM_Timer_t timer, uint16_t prescaler);
+/**
+ * filter: 0x00 - 0x0F, input filter of ICxF
+ * gate: gate time in ticks, Frequency mode only
+*/
+HAL_StatusTypeDef PWM_Cap_Config(
+    PWM_CapChannel_t channel, 
+    PWM_CapMode_t mode, 
+    uint8_t filter, 
+    PWM_CapPrescaler_t prescaler, 
+    uint32_t gate);
+/**
+ * Take one result from ring buffer, returns HAL_ERROR if it is empty
+*/
+HAL_StatusTypeDef PWM_Cap_Read(PWM_CapResult_t *result);
+/**
+ * Results dropped because ring buffer was full
+*/
+uint16_t PWM_Cap_GetOverruns(void);
+/**
+ * Frequency of result in 0.01 Hz
+*/
+uint32_t PWM_Cap_GetFrequency(PWM_CapResult_t *result);
+/**
+ * Call them in PWMA and PWMB interrupts, the two interrupts should have the
+ * same priority
+*/
+void PWM_Cap_PWMA_IRQHandler(void);
+void PWM_Cap_PWMB_IRQHandler(void);
+
+
+/**************************************************************************** /
+ * Quadrature encoder
+ *
+ * The counter of PWMA or PWMB is clocked by the encoder on PWMx.1 and PWMx.2
+ * (PWM5, PWM6 for PWMB), so the timer can't be used for output or capture at
+ * the same time. Counting runs in hardware, PWM_Encoder_Sample() extends it to
+ * 32 bits and calculates velocity.
+*/
+
+/**
+ * Slave mode of SMCR
+*/
+typedef enum
+{
+    PWM_EncoderMode_TI2     = 0x01, // SMS=001, count on TI2FP2 edges, x2
+    PWM_EncoderMode_TI1     = 0x02, // SMS=010, count on TI1FP1 edges, x2
+    PWM_EncoderMode_TI12    = 0x03, // Count on both TI1 and TI2 edges, x4
+} PWM_EncoderMode_t;
+
+/**
+ * filter: 0x00 - 0x0F, input filter of ICxF on both inputs
+ * invert: reverse counting direction
+*/
+void PWM_Encoder_Config(PWM_Timer_t timer, PWM_EncoderMode_t mode, uint8_t filter, HAL_State_t invert);
+/**
+ * Call it at fixed rate, e.g. in a timer interrupt. The counter should move
+ * less than 32768 counts between two calls.
+*/
+void PWM_Encoder_Sample(PWM_Timer_t timer);
+int32_t PWM_Encoder_GetPosition(PWM_Timer_t timer);
+void PWM_Encoder_SetPosition(PWM_Timer_t timer, int32_t position);
+/**
+ * Counts in the last sample period
+*/
+int16_t PWM_Encoder_GetVelocity(PWM_Timer_t timer);
+
+
+/**************************************************************************** /
+ * Three-phase complementary PWM
+ *
+ * PWMA.1 - PWMA.3 P/N pairs in center-aligned mode with dead-time, for
+ * BLDC/PMSM inverters. The update interrupt, once per PWM period, advances
+ * a phase accumulator and sets the duty cycles of the 3 phases from a
+ * __CODE quarter-wave table, 120 degrees apart.
+ *
+ * PWMA.4 is not output, its OC4REF drives TRGO to start the ADC near the
+ * counter peak, when all low-side switches are on.
+*/
+
+typedef enum
+{
+    PWM_3PhaseWave_Sine     = 0x00,
+    /**
+     * Space vector equivalent, sine with min-max injection. The fundamental is
+     * 2/sqrt(3) of the sine wave at the same amplitude.
+    */
+    PWM_3PhaseWave_SVPWM    = 0x01,
+} PWM_3PhaseWave_t;
+
+/**
+ * frequency: PWM frequency in Hz, counter period = SYSCLK / 2 / frequency
+ * deadtime: dead-time in SYSCLK ticks, up to 1008
+ * Outputs stay off until PWM_3Phase_Start()
+*/
+void PWM_3Phase_Init(uint16_t frequency, uint16_t deadtime, PWM_3PhaseWave_t wave);
+/**
+ * Break input PWMA_BRK turns off all outputs in hardware, they stay off
+ * until PWM_3Phase_Start() is called
+*/
+void PWM_3Phase_SetBreak(HAL_State_t state, HAL_State_t activeHigh);
+/**
+ * Trigger ADC lead ticks before counter peak, enables ADC PWM trigger
+*/
+void PWM_3Phase_SetAdcTrigger(HAL_State_t state, uint16_t lead);
+/**
+ * frequency: output frequency in 0.1 Hz
+ * amplitude: 0 - 0xFFFF, modulation index 0 - 1
+*/
+void PWM_3Phase_SetOutput(uint16_t frequency, uint16_t amplitude);
+void PWM_3Phase_Start(void);
+void PWM_3Phase_Stop(void);
+/**
+ * Returns HAL_State_ON if outputs were turned off by break input
+*/
+HAL_State_t PWM_3Phase_IsBroken(void);
+/**
+ * Call it in PWMA interrupt
+*/
+void PWM_3Phase_IRQHandler(void);
+
 #endif
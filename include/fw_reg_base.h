@@ -34,6 +34,33 @@
     #define INTERRUPT_USING(name, vector, regnum) void name (void)
     #define NOP() 
 
+#elif defined (__HOST_SIM)
+    #include <stdbool.h>
+    #include "fw_sim.h"
+    #define __BIT   bool
+    #define __DATA
+    #define __IDATA
+    #define __PDATA
+    #define __XDATA
+    #define __CODE
+    #define __REENTRANT
+    /**
+     * SFRs and sbits are plain variables, defined once in fw_sim.c, xdata SFRs
+     * are mapped into SIM_XDATA[]
+    */
+    #if defined (__HOST_SIM_DEFINE)
+        #define SBIT(name, addr, bit)  volatile bool           name
+        #define SFR(name, addr)        volatile unsigned char  name
+    #else
+        #define SBIT(name, addr, bit)  extern volatile bool           name
+        #define SFR(name, addr)        extern volatile unsigned char  name
+    #endif
+    #define SFRX(addr)              (SIM_XDATA[(uint16_t)(addr)])
+    #define SFR16X(addr)            (*(uint16_t volatile *)(SIM_XDATA + (uint16_t)(addr)))
+    #define INTERRUPT(name, vector) void name (void)
+    #define INTERRUPT_USING(name, vector, regnum) void name (void)
+    #define NOP()
+
 #elif defined (SDCC) || defined (__SDCC)
     #define __BIT   __bit
     #define __DATA  __data
@@ -0,0 +1,88 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ___FW_SIM_H___
+#define ___FW_SIM_H___
+
+#include "fw_types.h"
+
+/**
+ * Host side peripheral simulation, build with gcc and -D__HOST_SIM
+ *
+ * - SFRs and sbits are plain variables, xdata SFRs are mapped into SIM_XDATA[]
+ * - Peripheral models run when a driver polls the finish flag: SPI_RxTxFinished(),
+ *   UART1_TxFinished(), UART2_TxFinished(), I2C_MasterCmdFinished(), ADC_SamplingFinished(),
+ *   LCM_OpFinished()
+ * - GPIO ports are not modelled, read and write P0 - P7 directly in host code
+ * - Interrupt service routines are plain functions, register them with
+ *   SIM_SetIntHandler() to have them called by the models
+*/
+
+#define SIM_I2C_MAX_DEVICES     4
+
+extern volatile uint8_t SIM_XDATA[0x10000];
+
+/**
+ * Simulated I2C slave, all callbacks are optional
+*/
+typedef struct
+{
+    void    (*Start)(uint8_t rw);       // Addressed after START, rw: 0:write, 1:read
+    uint8_t (*Write)(uint8_t dat);      // Byte from master, return 0:ACK, 1:NACK
+    uint8_t (*Read)(void);              // Byte to master
+    void    (*Stop)(void);
+} SIM_I2C_Device_t;
+
+void SIM_Reset(void);
+/**
+ * Print every bus transaction to stderr
+*/
+void SIM_SetTrace(HAL_State_t state);
+void SIM_SetIntHandler(uint8_t vector, void (*handler)(void));
+void SIM_RaiseInterrupt(uint8_t vector);
+
+/**
+ * SPI master, xfer() receives MOSI byte and returns MISO byte
+*/
+void SIM_SPI_SetDevice(uint8_t (*xfer)(uint8_t dat));
+uint8_t SIM_SPI_Poll(void);
+
+void SIM_UART_SetTxHandler(void (*handler)(uint8_t uart, uint8_t dat));
+void SIM_UART1_Receive(uint8_t dat);
+uint8_t SIM_UART1_Poll(void);
+uint8_t SIM_UART2_Poll(void);
+
+/**
+ * I2C master, addr is the 8-bit write address, e.g. 0x78 for SSD1306
+*/
+HAL_StatusTypeDef SIM_I2C_AttachDevice(uint8_t addr, SIM_I2C_Device_t *dev);
+uint8_t SIM_I2C_Poll(void);
+
+/**
+ * 12-bit conversion result of each channel
+*/
+void SIM_ADC_SetValue(uint8_t channel, uint16_t value);
+uint8_t SIM_ADC_Poll(void);
+
+/**
+ * LCM parallel interface, only traces commands and data
+*/
+uint8_t SIM_LCM_Poll(void);
+
+/**
+ * Raise overflow flag of Timer0 - Timer4, and call ISR if interrupt is enabled
+*/
+void SIM_TIM_Overflow(uint8_t timer);
+
+#endif
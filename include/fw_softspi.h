@@ -0,0 +1,77 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ___FW_SOFTSPI_H___
+#define ___FW_SOFTSPI_H___
+
+#include "fw_conf.h"
+#include "fw_types.h"
+#include "fw_gpio.h"
+
+/**
+ * Bit-banged SPI master on GPIO, CPOL 0, CPHA 0
+ *
+ * For parts where the hardware SPI pins are taken, and for 3-wire chips(CI24R1,
+ * XL2400) sharing one pin for MOSI and MISO. Pins are fixed at compile time, with
+ * SDCC each byte is a fully unrolled RLC/RRC A and MOV bit,C sequence. By the
+ * instruction timing table, not measured, that is about 5 clocks per bit to write
+ * and 4 to read, 4.8 MHz and 6 MHz SCK at 24 MHz SYSCLK. Other compilers use
+ * unrolled C.
+ *
+ * 3-wire mode is selected by leaving SOFTSPI_MISO_PIN undefined, MOSI is then
+ * the bidirectional data pin: call SOFTSPI_DataIn() before reading and
+ * SOFTSPI_DataOut() after. Chip select is left to the caller.
+*/
+
+#ifndef SOFTSPI_SCK_PIN
+#define SOFTSPI_SCK_PIN             GPIO_PIN(3, 2)
+#endif
+
+#ifndef SOFTSPI_MOSI_PIN
+#define SOFTSPI_MOSI_PIN            GPIO_PIN(3, 4)
+#endif
+
+/**
+ * Define SOFTSPI_MISO_PIN for 4-wire mode, e.g. GPIO_PIN(3, 3)
+*/
+
+// 0:MSB first, 1:LSB first
+#ifndef SOFTSPI_LSB_FIRST
+#define SOFTSPI_LSB_FIRST           0
+#endif
+
+#if defined (SOFTSPI_MISO_PIN)
+#define SOFTSPI_DataIn()
+#define SOFTSPI_DataOut()
+#else
+#define SOFTSPI_DataIn()            PIN_SetMode(SOFTSPI_MOSI_PIN, GPIO_Mode_Input_HIP)
+#define SOFTSPI_DataOut()           PIN_SetMode(SOFTSPI_MOSI_PIN, GPIO_Mode_Output_PP)
+#endif
+
+/**
+ * SCK low, SCK and MOSI push-pull output, MISO high-impedance input
+*/
+void SOFTSPI_Init(void);
+void SOFTSPI_Tx(uint8_t dat);
+uint8_t SOFTSPI_Rx(void);
+#if defined (SOFTSPI_MISO_PIN)
+/**
+ * Full duplex transfer, 4-wire mode only
+*/
+uint8_t SOFTSPI_TxRx(uint8_t dat);
+#endif
+void SOFTSPI_Write(const uint8_t *buf, uint8_t len);
+void SOFTSPI_Read(uint8_t *buf, uint8_t len);
+
+#endif
@@ -60,7 +60,11 @@ typedef enum
     SPI_DataOrder_LSB       = 0x01, // Low bits first
 } SPI_DataOrder_t;
 
+#if defined (__HOST_SIM)
+#define SPI_RxTxFinished()                  SIM_SPI_Poll()
+#else
 #define SPI_RxTxFinished()                  (SPSTAT & 0x80)
+#endif
 #define SPI_ClearInterrupt()                SFR_SET(SPSTAT, 7)
 #define SPI_ClearWriteConflictInterrupt()   SFR_SET(SPSTAT, 6)
 #define SPI_ClearInterrupts()               (SPSTAT |= 0xC0)
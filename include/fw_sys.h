@@ -39,12 +39,22 @@ typedef enum
  *  11 Internal 32KHz  |
 */
 
+#if (__CONF_MCU_TYPE == 1  )
+// STC8A8K64D4 has no VRTRIM, __VRTRIM__ is ignored
+#define SYS_SetFOSC(__IRCBAND__, __VRTRIM__, __IRTRIM__, __LIRTRIM__)  do {      \
+                                     IRCBAND = ((__IRCBAND__) & 0x03);           \
+                                     (void)(__VRTRIM__);                         \
+                                     IRTRIM = (__IRTRIM__);                      \
+                                     LIRTRIM = ((__LIRTRIM__) & 0x03);           \
+                                 } while(0)
+#else
 #define SYS_SetFOSC(__IRCBAND__, __VRTRIM__, __IRTRIM__, __LIRTRIM__)  do {      \
                                      IRCBAND = ((__IRCBAND__) & 0x03);           \
                                      VRTRIM = (__VRTRIM__);                      \
                                      IRTRIM = (__IRTRIM__);                      \
                                      LIRTRIM = ((__LIRTRIM__) & 0x03);           \
                                  } while(0)
+#endif
 
 /**
  * Enable high speed internal oscillator
@@ -15,6 +15,9 @@
 #ifndef ___FW_TYPES_H___
 #define ___FW_TYPES_H___
 
+#if defined (__HOST_SIM)
+#include <stdint.h>
+#else
 typedef unsigned char uint8_t;
 typedef unsigned short uint16_t;
 typedef unsigned long uint32_t;
@@ -24,6 +27,13 @@ typedef signed char int8_t;
 typedef short int16_t;
 typedef long int32_t;
 typedef int32_t int64_t[2];
+// Data pointers are 16-bit addresses, the memory type byte of generic pointers is dropped
+typedef uint16_t uintptr_t;
+#endif
+
+#ifndef NULL
+#define NULL ((void *)0)
+#endif
 
 
 #define B00000000   0x00
@@ -51,6 +51,11 @@ typedef enum
 #define UART1_SetRxState(__STATE__)         SBIT_ASSIGN(REN, __STATE__)
 #define UART1_ClearTxInterrupt()            SBIT_RESET(TI)
 #define UART1_ClearRxInterrupt()            SBIT_RESET(RI)
+#if defined (__HOST_SIM)
+#define UART1_TxFinished()                  SIM_UART1_Poll()
+#else
+#define UART1_TxFinished()                  (TI)
+#endif
 #define UART1_WriteBuffer(__DATA__)         (SBUF = (__DATA__))
 #define UART1_SetFrameErrDetect(__STATE__)  SFR_ASSIGN(PCON, 6, __STATE__)
 #define UART1_SetBaudSource(__BAUD_SRC__)   SFR_ASSIGN(AUXR, 0, __BAUD_SRC__)
@@ -104,7 +109,11 @@ void UART1_TxString(uint8_t *str);
 #define UART2_ClearTxInterrupt()            SFR_RESET(S2CON, 1)
 #define UART2_ClearRxInterrupt()            SFR_RESET(S2CON, 0)
 #define UART2_WriteBuffer(__DATA__)         (S2BUF = (__DATA__))
+#if defined (__HOST_SIM)
+#define UART2_TxFinished()                  SIM_UART2_Poll()
+#else
 #define UART2_TxFinished()                  (S2CON & (0x01 << 1))
+#endif
 #define UART2_Set8bitUART()                 SFR_RESET(S2CON, 7)
 #define UART2_Set9bitUART()                 SFR_SET(S2CON, 7)
 /**
@@ -0,0 +1,147 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fw_audio.h"
+
+static __CODE int8_t AUDIO_ADPCM_IndexTable[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static __CODE uint16_t AUDIO_ADPCM_StepTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+void AUDIO_ADPCM_Init(AUDIO_ADPCM_State_t *state)
+{
+    state->predictor = 0;
+    state->index = 0;
+}
+
+/**
+ * Apply code to predictor and step index
+*/
+static void AUDIO_ADPCM_Update(AUDIO_ADPCM_State_t *state, uint8_t code)
+{
+    uint16_t step = AUDIO_ADPCM_StepTable[state->index];
+    uint16_t diff = step >> 3;
+    int32_t predictor = state->predictor;
+
+    if (code & 0x04) diff += step;
+    if (code & 0x02) diff += step >> 1;
+    if (code & 0x01) diff += step >> 2;
+    if (code & 0x08)
+    {
+        predictor -= diff;
+        if (predictor < -32768) predictor = -32768;
+    }
+    else
+    {
+        predictor += diff;
+        if (predictor > 32767) predictor = 32767;
+    }
+    state->predictor = (int16_t)predictor;
+
+    state->index += AUDIO_ADPCM_IndexTable[code];
+    if (state->index < 0)
+    {
+        state->index = 0;
+    }
+    else if (state->index > 88)
+    {
+        state->index = 88;
+    }
+}
+
+uint8_t AUDIO_ADPCM_Encode(AUDIO_ADPCM_State_t *state, int16_t sample)
+{
+    uint16_t step = AUDIO_ADPCM_StepTable[state->index];
+    int32_t delta = (int32_t)sample - state->predictor;
+    uint16_t diff;
+    uint8_t code = 0;
+
+    if (delta < 0)
+    {
+        code = 0x08;
+        delta = -delta;
+    }
+    diff = (delta > 0xFFFF)? 0xFFFF : (uint16_t)delta;
+    if (diff >= step)
+    {
+        code |= 0x04;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step)
+    {
+        code |= 0x02;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step)
+    {
+        code |= 0x01;
+    }
+    AUDIO_ADPCM_Update(state, code);
+    return code;
+}
+
+int16_t AUDIO_ADPCM_Decode(AUDIO_ADPCM_State_t *state, uint8_t code)
+{
+    AUDIO_ADPCM_Update(state, code & 0x0F);
+    return state->predictor;
+}
+
+uint8_t AUDIO_ULaw_Encode(int16_t sample)
+{
+    uint16_t magnitude;
+    uint8_t sign = 0, exponent = 7;
+
+    if (sample < 0)
+    {
+        sign = 0x80;
+        magnitude = (sample == -32768)? 32767 : -sample;
+    }
+    else
+    {
+        magnitude = sample;
+    }
+    if (magnitude > 32635)
+    {
+        magnitude = 32635;
+    }
+    magnitude += 0x84;
+    while (exponent > 0 && !(magnitude & (0x4000 >> (7 - exponent))))
+    {
+        exponent--;
+    }
+    return ~(sign | (exponent << 4) | ((magnitude >> (exponent + 3)) & 0x0F));
+}
+
+int16_t AUDIO_ULaw_Decode(uint8_t ulaw)
+{
+    int16_t magnitude;
+    ulaw = ~ulaw;
+    magnitude = ((((uint16_t)ulaw & 0x0F) << 3) + 0x84) << ((ulaw >> 4) & 0x07);
+    magnitude -= 0x84;
+    return (ulaw & 0x80)? -magnitude : magnitude;
+}
@@ -0,0 +1,369 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fw_dma.h"
+
+#if (__CONF_MCU_TYPE == 3)
+
+#if defined (__HOST_SIM)
+#include <string.h>
+#include "fw_exti.h"
+#endif
+
+/**************************************************************************** /
+ * DMA channel manager
+*/
+
+#define DMA_CHANNEL_MASK(__CH__)    ((uint16_t)0x01 << (__CH__))
+#define DMA_CHANNEL_CFG(__CH__)     SFRX(dma_channel_base[__CH__])
+#define DMA_CHANNEL_CR(__CH__)      SFRX(dma_channel_base[__CH__] + 1)
+#define DMA_CHANNEL_STA(__CH__)     SFRX(dma_channel_base[__CH__] + 2)
+#define DMA_CHANNEL_AMT(__CH__)     SFRX(dma_channel_base[__CH__] + 3)
+
+static __CODE uint16_t dma_channel_base[DMA_Channel_Count] = {
+    0xfa00, 0xfa10, 0xfa20, 0xfa30, 0xfa38, 0xfa40, 0xfa48, 0xfa50, 0xfa58, 0xfa60, 0xfa68, 0xfa70
+};
+static uint16_t dma_channel_owned, dma_channel_busy;
+static __XDATA uint8_t dma_channel_priority[DMA_Channel_Count];
+static __XDATA DMA_Callback_t dma_channel_handler[DMA_Channel_Count];
+static __XDATA DMA_ChannelStats_t dma_channel_stats[DMA_Channel_Count];
+
+HAL_StatusTypeDef DMA_Channel_Acquire(DMA_Channel_t channel, DMA_BusPriority_t priority, DMA_Callback_t handler)
+{
+    uint8_t i, ea = EA;
+    if (channel >= DMA_Channel_Count)
+    {
+        return HAL_ERROR;
+    }
+    // Check and claim in one go, channels are also taken from interrupt routines
+    EA = 0;
+    if (dma_channel_owned & DMA_CHANNEL_MASK(channel))
+    {
+        EA = ea;
+        return HAL_BUSY;
+    }
+    if (priority != DMA_BusPriority_Lowest)
+    {
+        for (i = 0; i < DMA_Channel_Count; i++)
+        {
+            if ((dma_channel_owned & DMA_CHANNEL_MASK(i)) && dma_channel_priority[i] == priority)
+            {
+                EA = ea;
+                return HAL_ERROR;
+            }
+        }
+    }
+    dma_channel_owned |= DMA_CHANNEL_MASK(channel);
+    dma_channel_priority[channel] = priority;
+    EA = ea;
+    dma_channel_handler[channel] = handler;
+    DMA_Channel_ResetStats(channel);
+    SFRX_ON();
+    // Keep bits 6:4, interrupt priority = bus priority
+    DMA_CHANNEL_CFG(channel) = DMA_CHANNEL_CFG(channel) & 0x70
+        | ((handler != NULL)? 0x80 : 0x00) | ((priority & 0x03) << 2) | (priority & 0x03);
+    DMA_CHANNEL_STA(channel) = 0x00;
+    SFRX_OFF();
+    return HAL_OK;
+}
+
+void DMA_Channel_Release(DMA_Channel_t channel)
+{
+    uint8_t ea = EA;
+    if (channel >= DMA_Channel_Count)
+    {
+        return;
+    }
+    SFRX_ON();
+    DMA_CHANNEL_CFG(channel) &= ~0x80;
+    DMA_CHANNEL_CR(channel) = 0x00;
+    DMA_CHANNEL_STA(channel) = 0x00;
+    SFRX_OFF();
+    EA = 0;
+    dma_channel_owned &= ~DMA_CHANNEL_MASK(channel);
+    dma_channel_busy &= ~DMA_CHANNEL_MASK(channel);
+    EA = ea;
+    dma_channel_handler[channel] = NULL;
+}
+
+void DMA_Channel_Start(DMA_Channel_t channel, uint8_t trigger)
+{
+    // Keep EAXFR state of the caller
+    uint8_t p_sw2 = P_SW2, ea = EA;
+    EA = 0;
+    dma_channel_busy |= DMA_CHANNEL_MASK(channel);
+    EA = ea;
+    P_SW2 |= 0x80;
+    DMA_CHANNEL_CR(channel) |= 0x80 | trigger;
+    P_SW2 = p_sw2;
+}
+
+void DMA_Channel_Complete(DMA_Channel_t channel) __REENTRANT
+{
+    // Keep EAXFR state of the interrupted code
+    uint8_t p_sw2 = P_SW2, ea = EA;
+    P_SW2 |= 0x80;
+    DMA_CHANNEL_STA(channel) = 0x00;
+    if (channel != DMA_Channel_ADC)
+    {
+        dma_channel_stats[channel].bytes += (uint16_t)DMA_CHANNEL_AMT(channel) + 1;
+    }
+    P_SW2 = p_sw2;
+    dma_channel_stats[channel].completions++;
+    // Shared with dispatches of higher priority vectors
+    EA = 0;
+    dma_channel_busy &= ~DMA_CHANNEL_MASK(channel);
+    EA = ea;
+}
+
+void DMA_Channel_Dispatch(DMA_Channel_t channel) __REENTRANT
+{
+    DMA_Channel_Complete(channel);
+    if (dma_channel_handler[channel] != NULL)
+    {
+        dma_channel_handler[channel]();
+    }
+}
+
+void DMA_Channel_Tick(void)
+{
+    static uint8_t i;
+    if (dma_channel_busy == 0)
+    {
+        return;
+    }
+    for (i = 0; i < DMA_Channel_Count; i++)
+    {
+        if (dma_channel_busy & DMA_CHANNEL_MASK(i))
+        {
+            dma_channel_stats[i].busyTicks++;
+        }
+    }
+}
+
+void DMA_Channel_GetStats(DMA_Channel_t channel, DMA_ChannelStats_t *stats)
+{
+    uint8_t ea = EA;
+    EA = 0;
+    stats->bytes = dma_channel_stats[channel].bytes;
+    stats->busyTicks = dma_channel_stats[channel].busyTicks;
+    stats->completions = dma_channel_stats[channel].completions;
+    EA = ea;
+}
+
+void DMA_Channel_ResetStats(DMA_Channel_t channel)
+{
+    uint8_t ea = EA;
+    EA = 0;
+    dma_channel_stats[channel].bytes = 0;
+    dma_channel_stats[channel].busyTicks = 0;
+    dma_channel_stats[channel].completions = 0;
+    EA = ea;
+}
+
+/**************************************************************************** /
+ * DMA M2M
+*/
+
+/**
+ * Transfer state, no local variables in the functions shared with interrupt routine
+*/
+static uint8_t __XDATA *dma_m2m_src;
+static uint8_t __XDATA *dma_m2m_dst;
+static uint16_t dma_m2m_remain, dma_m2m_filled, dma_m2m_block;
+static uint8_t dma_m2m_fill;
+static volatile uint8_t dma_m2m_busy;
+// Channel taken by the transfer, released when it is done
+static uint8_t dma_m2m_acquired;
+static DMA_M2M_Callback_t dma_m2m_callback;
+
+/**
+ * Start next block, SFRX should be ON
+*/
+static void DMA_M2M_StartBlock(void)
+{
+    dma_m2m_block = (dma_m2m_remain > 256)? 256 : dma_m2m_remain;
+    if (dma_m2m_fill && dma_m2m_block > dma_m2m_filled)
+    {
+        dma_m2m_block = dma_m2m_filled;
+    }
+    DMA_M2M_AMT = dma_m2m_block - 1;
+#if defined (__HOST_SIM)
+    DMA_Channel_Start(DMA_Channel_M2M, 0x40);
+    memcpy(dma_m2m_dst, dma_m2m_src, dma_m2m_block);
+    DMA_M2M_STA |= 0x01;
+    if (DMA_M2M_CFG & 0x80)
+    {
+        SIM_RaiseInterrupt(EXTI_VectDMA_M2M);
+    }
+#else
+    DMA_M2M_TXAH = (uint16_t)dma_m2m_src >> 8;
+    DMA_M2M_TXAL = (uint16_t)dma_m2m_src & 0xFF;
+    DMA_M2M_RXAH = (uint16_t)dma_m2m_dst >> 8;
+    DMA_M2M_RXAL = (uint16_t)dma_m2m_dst & 0xFF;
+    DMA_Channel_Start(DMA_Channel_M2M, 0x40);
+#endif
+}
+
+/**
+ * Give back the channel if the transfer took it, then accept the next transfer
+*/
+static void DMA_M2M_Done(void)
+{
+    if (dma_m2m_acquired)
+    {
+        DMA_Channel_Release(DMA_Channel_M2M);
+    }
+    dma_m2m_busy = 0;
+}
+
+/**
+ * Move to next block, return 0 if all blocks are done
+*/
+static uint8_t DMA_M2M_NextBlock(void)
+{
+    dma_m2m_dst += dma_m2m_block;
+    dma_m2m_remain -= dma_m2m_block;
+    if (dma_m2m_fill)
+    {
+        dma_m2m_filled += dma_m2m_block;
+    }
+    else
+    {
+        dma_m2m_src += dma_m2m_block;
+    }
+    return dma_m2m_remain != 0;
+}
+
+static HAL_StatusTypeDef DMA_M2M_Transfer(HAL_State_t async, DMA_M2M_Callback_t callback)
+{
+    if (dma_m2m_remain == 0)
+    {
+        dma_m2m_busy = 0;
+        if (async && callback != NULL)
+        {
+            callback();
+        }
+        return HAL_OK;
+    }
+    dma_m2m_callback = callback;
+    // Owned already if the application set its own priority
+    dma_m2m_acquired = DMA_Channel_Acquire(DMA_Channel_M2M, DMA_BusPriority_Lowest, DMA_M2M_IRQHandler) == HAL_OK;
+    SFRX_ON();
+    // Address increment, keep interrupt priority and bus priority
+    DMA_M2M_CFG = DMA_M2M_CFG & 0x0F | (async? 0x80 : 0x00);
+    DMA_M2M_STA = 0x00;
+    DMA_M2M_StartBlock();
+    if (!async)
+    {
+        while (1)
+        {
+            while (!(DMA_M2M_STA & 0x01));
+            DMA_Channel_Complete(DMA_Channel_M2M);
+            if (!DMA_M2M_NextBlock())
+            {
+                break;
+            }
+            DMA_M2M_StartBlock();
+        }
+        DMA_M2M_Done();
+    }
+    SFRX_OFF();
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef DMA_M2M_Prepare(uint8_t __XDATA *dst, uint8_t __XDATA *src, uint8_t val, uint16_t len, uint8_t fill)
+{
+    if (dma_m2m_busy)
+    {
+        return HAL_BUSY;
+    }
+    dma_m2m_busy = 1;
+    dma_m2m_dst = dst;
+    dma_m2m_src = src;
+    dma_m2m_remain = len;
+    dma_m2m_fill = fill;
+    if (fill && len != 0)
+    {
+        *dst = val;
+        dma_m2m_dst++;
+        dma_m2m_remain--;
+        dma_m2m_filled = 1;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef DMA_M2M_Copy(uint8_t __XDATA *dst, uint8_t __XDATA *src, uint16_t len)
+{
+    if (DMA_M2M_Prepare(dst, src, 0, len, 0) != HAL_OK)
+    {
+        return HAL_BUSY;
+    }
+    return DMA_M2M_Transfer(HAL_State_OFF, NULL);
+}
+
+HAL_StatusTypeDef DMA_M2M_Fill(uint8_t __XDATA *dst, uint8_t val, uint16_t len)
+{
+    if (DMA_M2M_Prepare(dst, dst, val, len, 1) != HAL_OK)
+    {
+        return HAL_BUSY;
+    }
+    return DMA_M2M_Transfer(HAL_State_OFF, NULL);
+}
+
+HAL_StatusTypeDef DMA_M2M_CopyAsync(uint8_t __XDATA *dst, uint8_t __XDATA *src, uint16_t len, DMA_M2M_Callback_t callback)
+{
+    if (DMA_M2M_Prepare(dst, src, 0, len, 0) != HAL_OK)
+    {
+        return HAL_BUSY;
+    }
+    return DMA_M2M_Transfer(HAL_State_ON, callback);
+}
+
+HAL_StatusTypeDef DMA_M2M_FillAsync(uint8_t __XDATA *dst, uint8_t val, uint16_t len, DMA_M2M_Callback_t callback)
+{
+    if (DMA_M2M_Prepare(dst, dst, val, len, 1) != HAL_OK)
+    {
+        return HAL_BUSY;
+    }
+    return DMA_M2M_Transfer(HAL_State_ON, callback);
+}
+
+uint8_t DMA_M2M_IsBusy(void)
+{
+    return dma_m2m_busy;
+}
+
+void DMA_M2M_IRQHandler(void)
+{
+    // Keep EAXFR state of the interrupted code
+    uint8_t p_sw2 = P_SW2;
+    P_SW2 |= 0x80;
+    if (DMA_M2M_NextBlock())
+    {
+        DMA_M2M_StartBlock();
+        P_SW2 = p_sw2;
+    }
+    else
+    {
+        P_SW2 = p_sw2;
+        DMA_M2M_Done();
+        if (dma_m2m_callback != NULL)
+        {
+            dma_m2m_callback();
+        }
+    }
+}
+
+#endif
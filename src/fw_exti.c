@@ -0,0 +1,295 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "fw_exti.h"
+
+#if (__CONF_MCU_TYPE == 3)
+
+// Lowest set bit of a nibble, decodes the pending flags lowest pin first
+static __CODE uint8_t exti_pin_lsb[16] = {0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0};
+
+static __XDATA EXTI_PinEvent_t exti_pin_queue[EXTI_PIN_QUEUE_SIZE];
+static volatile uint8_t exti_pin_head, exti_pin_tail;
+static uint16_t exti_pin_overruns;
+static volatile uint16_t exti_pin_ticks;
+
+// Per port: debounced levels, pins waiting in debounce
+static __XDATA uint8_t exti_pin_state[8];
+static __XDATA uint8_t exti_pin_pending[8];
+static volatile uint8_t exti_pin_pending_ports;
+// Per pin, indexed by port << 3 | bit
+static __XDATA uint8_t exti_pin_edge[64];
+static __XDATA uint8_t exti_pin_debounce[64];
+static __XDATA uint8_t exti_pin_count[64];
+static __XDATA uint16_t exti_pin_time[64];
+
+// Used in interrupt only
+static uint8_t exti_pin_psw2, exti_pin_flags, exti_pin_mask, exti_pin_idx;
+static uint8_t exti_tick_psw2, exti_tick_ports, exti_tick_pins, exti_tick_mask, exti_tick_idx;
+
+// A macro, both interrupts use it and they may nest
+#define EXTI_PIN_LOWEST(__MASK__)   (((__MASK__) & 0x0F)? exti_pin_lsb[(__MASK__) & 0x0F] : 4 + exti_pin_lsb[(__MASK__) >> 4])
+
+static uint8_t EXTI_Pin_ReadPort(uint8_t port)
+{
+    switch (port)
+    {
+    case 0:
+        return P0;
+    case 1:
+        return P1;
+    case 2:
+        return P2;
+    case 3:
+        return P3;
+    case 4:
+        return P4;
+    case 5:
+        return P5;
+    case 6:
+        return P6;
+    default:
+        return P7;
+    }
+}
+
+/**
+ * Called from both interrupts. Not reentrant, its arguments and locals are static,
+ * so call it with EA off
+*/
+static void EXTI_Pin_Push(uint8_t idx, uint8_t edge, uint16_t timestamp)
+{
+    uint8_t head;
+    if (!(exti_pin_edge[idx] & edge))
+    {
+        return;
+    }
+    head = exti_pin_head;
+    if (((head + 1) & (EXTI_PIN_QUEUE_SIZE - 1)) == exti_pin_tail)
+    {
+        exti_pin_overruns++;
+    }
+    else
+    {
+        exti_pin_queue[head].pin = idx;
+        exti_pin_queue[head].edge = edge;
+        exti_pin_queue[head].timestamp = timestamp;
+        exti_pin_head = (head + 1) & (EXTI_PIN_QUEUE_SIZE - 1);
+    }
+}
+
+/**
+ * Arm the edge leaving the debounced level, falling for high and rising for low.
+ * P_SW2 bit 7 must be set
+*/
+static void EXTI_Pin_Arm(uint8_t port, uint8_t pins)
+{
+    SFRX(PxIM0 + port) = SFRX(PxIM0 + port) & ~pins | (~exti_pin_state[port] & pins);
+    SFRX(PxIM1 + port) &= ~pins;
+    SFRX(PxINTF + port) &= ~pins;
+    SFRX(PxINTE + port) |= pins;
+}
+
+void EXTI_Pin_Init(void)
+{
+    uint8_t i;
+    SFRX_ON();
+    for (i = 0; i < 8; i++)
+    {
+        SFRX(PxINTE + i) = 0x00;
+        SFRX(PxINTF + i) = 0x00;
+        exti_pin_state[i] = 0x00;
+        exti_pin_pending[i] = 0x00;
+    }
+    SFRX_OFF();
+    for (i = 0; i < 64; i++)
+    {
+        exti_pin_edge[i] = 0x00;
+    }
+    exti_pin_pending_ports = 0;
+    exti_pin_head = 0;
+    exti_pin_tail = 0;
+    exti_pin_overruns = 0;
+}
+
+void EXTI_Pin_Config(uint8_t port, uint8_t pins, EXTI_PinEdge_t edge, uint8_t debounce)
+{
+    uint8_t i, ea = EA;
+    EA = 0;
+    SFRX_ON();
+    SFRX(PxINTE + port) &= ~pins;
+    exti_pin_pending[port] &= ~pins;
+    for (i = 0; i < 8; i++)
+    {
+        if (pins & (0x01 << i))
+        {
+            exti_pin_edge[port << 3 | i] = edge;
+            exti_pin_debounce[port << 3 | i] = debounce;
+        }
+    }
+    exti_pin_state[port] = exti_pin_state[port] & ~pins | (EXTI_Pin_ReadPort(port) & pins);
+    EXTI_Pin_Arm(port, pins);
+    SFRX_OFF();
+    EA = ea;
+}
+
+void EXTI_Pin_Disable(uint8_t port, uint8_t pins)
+{
+    uint8_t ea = EA;
+    EA = 0;
+    SFRX_ON();
+    SFRX(PxINTE + port) &= ~pins;
+    SFRX(PxINTF + port) &= ~pins;
+    SFRX_OFF();
+    exti_pin_pending[port] &= ~pins;
+    EA = ea;
+}
+
+HAL_StatusTypeDef EXTI_Pin_Read(EXTI_PinEvent_t *event)
+{
+    uint8_t tail = exti_pin_tail;
+    if (tail == exti_pin_head)
+    {
+        return HAL_ERROR;
+    }
+    event->pin = exti_pin_queue[tail].pin;
+    event->edge = exti_pin_queue[tail].edge;
+    event->timestamp = exti_pin_queue[tail].timestamp;
+    exti_pin_tail = (tail + 1) & (EXTI_PIN_QUEUE_SIZE - 1);
+    return HAL_OK;
+}
+
+uint16_t EXTI_Pin_GetOverruns(void)
+{
+    uint16_t overruns;
+    uint8_t ea = EA;
+    EA = 0;
+    overruns = exti_pin_overruns;
+    EA = ea;
+    return overruns;
+}
+
+uint16_t EXTI_Pin_GetTicks(void)
+{
+    uint16_t ticks;
+    uint8_t ea = EA;
+    EA = 0;
+    ticks = exti_pin_ticks;
+    EA = ea;
+    return ticks;
+}
+
+uint8_t EXTI_Pin_GetState(uint8_t port)
+{
+    return exti_pin_state[port];
+}
+
+void EXTI_Pin_IRQHandler(uint8_t port)
+{
+    uint8_t ea;
+    exti_pin_psw2 = P_SW2;
+    P_SW2 |= 0x80;
+    exti_pin_flags = SFRX(PxINTF + port) & SFRX(PxINTE + port);
+    SFRX(PxINTF + port) &= ~exti_pin_flags;
+    while (exti_pin_flags)
+    {
+        exti_pin_idx = EXTI_PIN_LOWEST(exti_pin_flags);
+        exti_pin_mask = 0x01 << exti_pin_idx;
+        exti_pin_flags &= ~exti_pin_mask;
+        exti_pin_idx |= port << 3;
+        if (exti_pin_debounce[exti_pin_idx] != 0)
+        {
+            // Mute the pin until the tick handler has seen it stable
+            SFRX(PxINTE + port) &= ~exti_pin_mask;
+            exti_pin_time[exti_pin_idx] = exti_pin_ticks;
+            exti_pin_count[exti_pin_idx] = exti_pin_debounce[exti_pin_idx];
+            exti_pin_pending[port] |= exti_pin_mask;
+            exti_pin_pending_ports |= 0x01 << port;
+        }
+        else
+        {
+            // The armed edge has come, follow the level and arm the opposite one
+            exti_pin_state[port] ^= exti_pin_mask;
+            SFRX(PxIM0 + port) ^= exti_pin_mask;
+            // The tick interrupt may call it too
+            ea = EA;
+            EA = 0;
+            EXTI_Pin_Push(exti_pin_idx,
+                (exti_pin_state[port] & exti_pin_mask)? EXTI_PinEdge_Rise : EXTI_PinEdge_Fall,
+                exti_pin_ticks);
+            EA = ea;
+        }
+    }
+    P_SW2 = exti_pin_psw2;
+}
+
+void EXTI_Pin_TickHandler(void)
+{
+    uint8_t ea;
+    exti_pin_ticks++;
+    if (exti_pin_pending_ports == 0)
+    {
+        return;
+    }
+    exti_tick_psw2 = P_SW2;
+    P_SW2 |= 0x80;
+    exti_tick_ports = exti_pin_pending_ports;
+    while (exti_tick_ports)
+    {
+        exti_tick_idx = EXTI_PIN_LOWEST(exti_tick_ports) << 3;
+        exti_tick_ports &= ~(0x01 << (exti_tick_idx >> 3));
+        exti_tick_pins = exti_pin_pending[exti_tick_idx >> 3];
+        while (exti_tick_pins)
+        {
+            exti_tick_idx = exti_tick_idx & 0xF8 | EXTI_PIN_LOWEST(exti_tick_pins);
+            exti_tick_mask = 0x01 << (exti_tick_idx & 0x07);
+            exti_tick_pins &= ~exti_tick_mask;
+            if (--exti_pin_count[exti_tick_idx] != 0)
+            {
+                continue;
+            }
+            // Port interrupt of a higher priority may change the other pins of the same port
+            ea = EA;
+            EA = 0;
+            if ((EXTI_Pin_ReadPort(exti_tick_idx >> 3) ^ exti_pin_state[exti_tick_idx >> 3]) & exti_tick_mask)
+            {
+                exti_pin_state[exti_tick_idx >> 3] ^= exti_tick_mask;
+                EXTI_Pin_Push(exti_tick_idx,
+                    (exti_pin_state[exti_tick_idx >> 3] & exti_tick_mask)? EXTI_PinEdge_Rise : EXTI_PinEdge_Fall,
+                    exti_pin_time[exti_tick_idx]);
+            }
+            EXTI_Pin_Arm(exti_tick_idx >> 3, exti_tick_mask);
+            if ((EXTI_Pin_ReadPort(exti_tick_idx >> 3) ^ exti_pin_state[exti_tick_idx >> 3]) & exti_tick_mask)
+            {
+                // Edge between sampling and arming is not latched, start over
+                SFRX(PxINTE + (exti_tick_idx >> 3)) &= ~exti_tick_mask;
+                exti_pin_time[exti_tick_idx] = exti_pin_ticks;
+                exti_pin_count[exti_tick_idx] = exti_pin_debounce[exti_tick_idx];
+            }
+            else
+            {
+                exti_pin_pending[exti_tick_idx >> 3] &= ~exti_tick_mask;
+                if (exti_pin_pending[exti_tick_idx >> 3] == 0)
+                {
+                    exti_pin_pending_ports &= ~(0x01 << (exti_tick_idx >> 3));
+                }
+            }
+            EA = ea;
+        }
+    }
+    P_SW2 = exti_tick_psw2;
+}
+
+#endif
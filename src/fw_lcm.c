@@ -0,0 +1,212 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fw_lcm.h"
+#include "fw_dma.h"
+
+#if (__CONF_MCU_TYPE == 3)
+
+#if defined (__HOST_SIM)
+#include "fw_exti.h"
+#endif
+
+static uint8_t __XDATA *lcm_dma_buf;
+static uint16_t lcm_dma_remain, lcm_dma_block;
+static volatile uint8_t lcm_dma_busy;
+// Channel taken by the transfer, released when it is done
+static uint8_t lcm_dma_acquired;
+static LCM_Callback_t lcm_dma_callback;
+
+void LCM_Config(
+    LCM_Mode_t mode,
+    LCM_DataWidth_t width,
+    LCM_AlterDataPort_t dataPort,
+    LCM_AlterCtrlPort_t ctrlPort,
+    uint8_t setupTime,
+    uint8_t holdTime)
+{
+    SFRX_ON();
+    LCMIFCFG = LCMIFCFG & 0xF0 | ((dataPort & 0x03) << 2) | ((width & 0x01) << 1) | (mode & 0x01);
+    LCMIFCFG2 = ((ctrlPort & 0x03) << 5) | ((setupTime & 0x07) << 2) | (holdTime & 0x03);
+    LCMIFSTA = 0x00;
+    LCMIFCR = 0x80;
+    SFRX_OFF();
+}
+
+static void LCM_Send(LCM_Cmd_t cmd, uint16_t dat)
+{
+    SFRX_ON();
+    LCMIDDATH = dat >> 8;
+    LCMIDDATL = dat & 0xFF;
+    LCM_SendCmd(cmd);
+    while (!LCM_OpFinished());
+    LCM_ClearInterrupt();
+    SFRX_OFF();
+}
+
+void LCM_WriteCmd(uint16_t cmd)
+{
+    LCM_Send(LCM_Cmd_WriteCmd, cmd);
+}
+
+void LCM_WriteData(uint16_t dat)
+{
+    LCM_Send(LCM_Cmd_WriteData, dat);
+}
+
+uint16_t LCM_ReadData(void)
+{
+    uint16_t dat;
+    SFRX_ON();
+    LCM_SendCmd(LCM_Cmd_ReadData);
+    while (!LCM_OpFinished());
+    LCM_ClearInterrupt();
+    dat = (LCMIDDATH << 8) | LCMIDDATL;
+    SFRX_OFF();
+    return dat;
+}
+
+/**
+ * Start next block, SFRX should be ON
+*/
+static void LCM_DMA_StartBlock(void)
+{
+    lcm_dma_block = (lcm_dma_remain > 256)? 256 : lcm_dma_remain;
+    DMA_LCM_AMT = lcm_dma_block - 1;
+#if defined (__HOST_SIM)
+    DMA_Channel_Start(DMA_Channel_LCM, 0x20);
+    {
+        uint16_t i;
+        for (i = 0; i < lcm_dma_block; i++)
+        {
+            LCMIDDATL = lcm_dma_buf[i];
+            LCM_SendCmd(LCM_Cmd_WriteData);
+            while (!LCM_OpFinished());
+            LCM_ClearInterrupt();
+        }
+    }
+    DMA_LCM_STA |= 0x01;
+    if (DMA_LCM_CFG & 0x80)
+    {
+        SIM_RaiseInterrupt(EXTI_VectDMA_LCM);
+    }
+#else
+    DMA_LCM_TXAH = (uint16_t)lcm_dma_buf >> 8;
+    DMA_LCM_TXAL = (uint16_t)lcm_dma_buf & 0xFF;
+    DMA_Channel_Start(DMA_Channel_LCM, 0x20);
+#endif
+}
+
+/**
+ * Give back the channel if the transfer took it, then accept the next transfer
+*/
+static void LCM_DMA_Done(void)
+{
+    if (lcm_dma_acquired)
+    {
+        DMA_Channel_Release(DMA_Channel_LCM);
+    }
+    lcm_dma_busy = 0;
+}
+
+/**
+ * Move to next block, return 0 if all blocks are done
+*/
+static uint8_t LCM_DMA_NextBlock(void)
+{
+    lcm_dma_buf += lcm_dma_block;
+    lcm_dma_remain -= lcm_dma_block;
+    return lcm_dma_remain != 0;
+}
+
+static HAL_StatusTypeDef LCM_DMA_Transfer(uint8_t __XDATA *buf, uint16_t len, HAL_State_t async, LCM_Callback_t callback)
+{
+    if (lcm_dma_busy)
+    {
+        return HAL_BUSY;
+    }
+    if (len == 0)
+    {
+        if (async && callback != NULL)
+        {
+            callback();
+        }
+        return HAL_OK;
+    }
+    lcm_dma_busy = 1;
+    lcm_dma_buf = buf;
+    lcm_dma_remain = len;
+    lcm_dma_callback = callback;
+    // Owned already if the application set its own priority
+    lcm_dma_acquired = DMA_Channel_Acquire(DMA_Channel_LCM, DMA_BusPriority_Lowest, LCM_DMA_IRQHandler) == HAL_OK;
+    SFRX_ON();
+    // Keep interrupt priority and bus priority
+    DMA_LCM_CFG = DMA_LCM_CFG & 0x0F | (async? 0x80 : 0x00);
+    DMA_LCM_STA = 0x00;
+    LCM_DMA_StartBlock();
+    if (!async)
+    {
+        while (1)
+        {
+            while (!(DMA_LCM_STA & 0x01));
+            DMA_Channel_Complete(DMA_Channel_LCM);
+            if (!LCM_DMA_NextBlock())
+            {
+                break;
+            }
+            LCM_DMA_StartBlock();
+        }
+        LCM_DMA_Done();
+    }
+    SFRX_OFF();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef LCM_WriteDataDMA(uint8_t __XDATA *buf, uint16_t len)
+{
+    return LCM_DMA_Transfer(buf, len, HAL_State_OFF, NULL);
+}
+
+HAL_StatusTypeDef LCM_WriteDataDMAAsync(uint8_t __XDATA *buf, uint16_t len, LCM_Callback_t callback)
+{
+    return LCM_DMA_Transfer(buf, len, HAL_State_ON, callback);
+}
+
+uint8_t LCM_DMA_IsBusy(void)
+{
+    return lcm_dma_busy;
+}
+
+void LCM_DMA_IRQHandler(void)
+{
+    // Keep EAXFR state of the interrupted code
+    uint8_t p_sw2 = P_SW2;
+    P_SW2 |= 0x80;
+    if (LCM_DMA_NextBlock())
+    {
+        LCM_DMA_StartBlock();
+        P_SW2 = p_sw2;
+    }
+    else
+    {
+        P_SW2 = p_sw2;
+        LCM_DMA_Done();
+        if (lcm_dma_callback != NULL)
+        {
+            lcm_dma_callback();
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,701 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "fw_onewire.h"
+#include "fw_tim.h"
+#include "fw_uart.h"
+#include "fw_sys.h"
+#include "fw_exti.h"
+#include "fw_dma.h"
+
+#define OW_SYSCLK_KHZ       (__CONF_FOSC / ((__CONF_CLKDIV == 0)? 1 : __CONF_CLKDIV) / 1000)
+#define OW_TICKS(__US__)    ((uint16_t)(OW_SYSCLK_KHZ * (__US__) / 1000))
+
+#define OW_TICKS_RESET_LOW      OW_TICKS(480)
+#define OW_TICKS_RESET_SAMPLE   OW_TICKS(70)
+#define OW_TICKS_RESET_END      OW_TICKS(410)
+#define OW_TICKS_SLOT           OW_TICKS(70)
+// Slot timing from reload: recovery, low pulse of write 1/read, sampling point
+#define OW_TICKS_RECOVERY       OW_TICKS(1)
+#define OW_TICKS_LOW            OW_TICKS(3)
+#define OW_TICKS_SAMPLE         OW_TICKS(13)
+#define OW_TICKS_START          OW_TICKS(10)
+
+#define OW_SLOT_0               0x00
+#define OW_SLOT_1               0x01    // Write 1 or read
+#define OW_SLOT_RESET           0x02
+#define OW_SLOT_END             0x03
+
+#define OW_PHASE_START          0x00
+#define OW_PHASE_RESET          0x01
+#define OW_PHASE_TX             0x02
+#define OW_PHASE_RX             0x03
+#define OW_PHASE_SEARCH         0x04
+
+#define OW_TIMER_RESET_LOW      0x00
+#define OW_TIMER_RESET_SAMPLE   0x01
+#define OW_TIMER_SLOT           0x02
+
+#define OW_FLAG_RESET           0x01
+#define OW_FLAG_SEARCH          0x02
+#define OW_FLAG_BIT             0x04    // Single slot write or read
+
+#define OW_TRANSPORT_TIMER      0x00
+#define OW_TRANSPORT_UART       0x01
+#define OW_TRANSPORT_DMA        0x02    // UART with batches by DMA
+
+#define OW_UART_BAUD_SLOT       115200
+#define OW_UART_BAUD_RESET      9600
+#define OW_UART_RESET_BYTE      0xF0
+#define OW_UART_DMA_BYTES       8
+
+static __XDATA uint8_t ow_txbuf[OW_TX_BUFFER_SIZE];
+static uint8_t ow_tx_len, ow_rx_len;
+static uint8_t *ow_rx;
+static uint8_t ow_flags;
+static volatile uint8_t ow_busy;
+static volatile HAL_StatusTypeDef ow_status;
+
+static __XDATA uint8_t ow_search_rom[8];
+static uint8_t ow_last_discrepancy, ow_last_device;
+
+// Used in interrupt only
+static uint8_t ow_phase, ow_timer, ow_sample, ow_slot;
+static uint8_t ow_pos, ow_byte, ow_mask;
+static uint8_t ow_id, ow_id_bit, ow_step, ow_last_zero;
+static uint16_t ow_load;
+
+static uint8_t ow_transport;
+static uint16_t ow_baud_slot, ow_baud_reset;
+#if (__CONF_MCU_TYPE == 3)
+// Slot bytes of one batch, sent and overwritten by the echo
+static __XDATA uint8_t ow_slots[OW_UART_DMA_BYTES * 8];
+static uint8_t ow_chunk;
+#endif
+
+static void OW_UART_Next(void);
+
+static void OW_TimerLoad(uint16_t ticks)
+{
+    ow_load = 0 - ticks;
+    TIM_Timer0_SetRunState(HAL_State_OFF);
+    TIM_Timer0_SetInitValue(ow_load >> 8, ow_load & 0xFF);
+    TIM_Timer0_SetRunState(HAL_State_ON);
+}
+
+#if defined (__HOST_SIM)
+// Timer counter doesn't run in simulation
+#define OW_WAIT(__TICKS__)
+#else
+static uint16_t OW_GetCounter(void)
+{
+    uint8_t th;
+    uint16_t counter;
+    do
+    {
+        th = TH0;
+        counter = (uint16_t)th << 8 | TL0;
+    } while (th != TH0);
+    return counter;
+}
+
+#define OW_WAIT(__TICKS__)      while ((uint16_t)(OW_GetCounter() - ow_load) < (__TICKS__))
+#endif
+
+static uint8_t OW_End(void)
+{
+    if (ow_flags & OW_FLAG_SEARCH)
+    {
+        for (ow_pos = 0; ow_pos < 8; ow_pos++)
+        {
+            ow_rx[ow_pos] = ow_search_rom[ow_pos];
+        }
+        ow_last_discrepancy = ow_last_zero;
+        ow_last_device = (ow_last_zero == 0);
+    }
+    return OW_SLOT_END;
+}
+
+static uint8_t OW_BeginRx(void)
+{
+    if (ow_flags & OW_FLAG_SEARCH)
+    {
+        ow_phase = OW_PHASE_SEARCH;
+        ow_id = 1;
+        ow_step = 0;
+        ow_last_zero = 0;
+        return OW_SLOT_1;
+    }
+    if (ow_rx_len == 0)
+    {
+        return OW_End();
+    }
+    ow_phase = OW_PHASE_RX;
+    ow_pos = 0;
+    ow_byte = 0;
+    ow_mask = 0x01;
+    return OW_SLOT_1;
+}
+
+static uint8_t OW_TxBit(void)
+{
+    if (ow_mask == 0)
+    {
+        if (ow_pos == ow_tx_len)
+        {
+            return OW_BeginRx();
+        }
+        ow_byte = ow_txbuf[ow_pos++];
+        ow_mask = 0x01;
+    }
+    ow_slot = (ow_byte & ow_mask)? OW_SLOT_1 : OW_SLOT_0;
+    ow_mask = (ow_flags & OW_FLAG_BIT)? 0 : ow_mask << 1;
+    return ow_slot;
+}
+
+static uint8_t OW_BeginTx(void)
+{
+    ow_phase = OW_PHASE_TX;
+    ow_pos = 0;
+    ow_mask = 0;
+    return OW_TxBit();
+}
+
+/**
+ * Maxim search algorithm, 3 slots per ROM bit: read bit, read complement, write direction
+*/
+static uint8_t OW_SearchBit(uint8_t sample)
+{
+    if (ow_step == 0)
+    {
+        ow_id_bit = sample;
+        ow_step = 1;
+        return OW_SLOT_1;
+    }
+    if (ow_step == 1)
+    {
+        if (ow_id_bit && sample)
+        {
+            ow_status = HAL_ERROR;
+            return OW_SLOT_END;
+        }
+        ow_mask = 0x01 << ((ow_id - 1) & 0x07);
+        if (ow_id_bit == sample)
+        {
+            // Discrepancy, take the other branch at the last one
+            if (ow_id < ow_last_discrepancy)
+            {
+                ow_id_bit = ow_search_rom[(ow_id - 1) >> 3] & ow_mask;
+            }
+            else
+            {
+                ow_id_bit = (ow_id == ow_last_discrepancy);
+            }
+            if (!ow_id_bit)
+            {
+                ow_last_zero = ow_id;
+            }
+        }
+        if (ow_id_bit)
+        {
+            ow_search_rom[(ow_id - 1) >> 3] |= ow_mask;
+        }
+        else
+        {
+            ow_search_rom[(ow_id - 1) >> 3] &= ~ow_mask;
+        }
+        ow_step = 2;
+        return ow_id_bit? OW_SLOT_1 : OW_SLOT_0;
+    }
+    if (++ow_id > 64)
+    {
+        return OW_End();
+    }
+    ow_step = 0;
+    return OW_SLOT_1;
+}
+
+/**
+ * Take the sample of the slot just ended, return the next slot
+*/
+static uint8_t OW_NextSlot(uint8_t sample)
+{
+    switch (ow_phase)
+    {
+    case OW_PHASE_START:
+        if (ow_flags & OW_FLAG_RESET)
+        {
+            ow_phase = OW_PHASE_RESET;
+            return OW_SLOT_RESET;
+        }
+        return OW_BeginTx();
+    case OW_PHASE_RESET:
+        if (sample)
+        {
+            ow_status = HAL_ERROR;
+            return OW_SLOT_END;
+        }
+        return OW_BeginTx();
+    case OW_PHASE_TX:
+        return OW_TxBit();
+    case OW_PHASE_RX:
+        if (sample)
+        {
+            ow_byte |= ow_mask;
+        }
+        ow_mask <<= 1;
+        if (ow_mask == 0 || (ow_flags & OW_FLAG_BIT))
+        {
+            ow_rx[ow_pos++] = ow_byte;
+            if (ow_pos == ow_rx_len)
+            {
+                return OW_End();
+            }
+            ow_byte = 0;
+            ow_mask = 0x01;
+        }
+        return OW_SLOT_1;
+    case OW_PHASE_SEARCH:
+        return OW_SearchBit(sample);
+    default:
+        return OW_SLOT_END;
+    }
+}
+
+static void OW_Finish(void)
+{
+    if (ow_status == HAL_BUSY)
+    {
+        ow_status = HAL_OK;
+    }
+    ow_busy = 0;
+}
+
+static HAL_StatusTypeDef OW_Start(uint8_t flags, uint8_t *rx, uint8_t rx_len)
+{
+    ow_flags = flags;
+    ow_rx = rx;
+    ow_rx_len = rx_len;
+    ow_phase = OW_PHASE_START;
+    ow_status = HAL_BUSY;
+    ow_busy = 1;
+    if (ow_transport == OW_TRANSPORT_TIMER)
+    {
+        ow_timer = OW_TIMER_SLOT;
+        OW_TimerLoad(OW_TICKS_START);
+    }
+    else
+    {
+        // Nothing is in flight, the first byte is sent from here
+        OW_UART_Next();
+    }
+    return HAL_OK;
+}
+
+void OW_Init(void)
+{
+    PIN_SET(OW_DQ_PIN);
+    PIN_SetMode(OW_DQ_PIN, GPIO_Mode_InOut_OD);
+#if (__CONF_MCU_TYPE == 2) || (__CONF_MCU_TYPE == 3)
+    PIN_SetPullUp(OW_DQ_PIN, HAL_State_ON);
+#endif
+    TIM_Timer0_SetRunState(HAL_State_OFF);
+    TIM_Timer0_Set1TMode(HAL_State_ON);
+    TIM_Timer0_SetFuncTimer;
+    TIM_Timer0_SetMode(TIM_TimerMode_16Bit);
+    EXTI_Timer0_SetIntPriority(EXTI_IntPriority_Highest);
+    EXTI_Timer0_SetIntState(HAL_State_ON);
+    ow_transport = OW_TRANSPORT_TIMER;
+    ow_busy = 0;
+    ow_status = HAL_OK;
+    OW_Search_Reset();
+}
+
+HAL_StatusTypeDef OW_Reset(void)
+{
+    if (ow_busy)
+    {
+        return HAL_BUSY;
+    }
+    ow_tx_len = 0;
+    return OW_Start(OW_FLAG_RESET, NULL, 0);
+}
+
+HAL_StatusTypeDef OW_Write(const uint8_t *tx, uint8_t len)
+{
+    if (ow_busy)
+    {
+        return HAL_BUSY;
+    }
+    if (len > OW_TX_BUFFER_SIZE)
+    {
+        return HAL_ERROR;
+    }
+    for (ow_tx_len = 0; ow_tx_len < len; ow_tx_len++)
+    {
+        ow_txbuf[ow_tx_len] = tx[ow_tx_len];
+    }
+    return OW_Start(0, NULL, 0);
+}
+
+HAL_StatusTypeDef OW_Read(uint8_t *rx, uint8_t len)
+{
+    if (ow_busy)
+    {
+        return HAL_BUSY;
+    }
+    ow_tx_len = 0;
+    return OW_Start(0, rx, len);
+}
+
+HAL_StatusTypeDef OW_WriteBit(uint8_t bit)
+{
+    if (ow_busy)
+    {
+        return HAL_BUSY;
+    }
+    ow_txbuf[0] = bit;
+    ow_tx_len = 1;
+    return OW_Start(OW_FLAG_BIT, NULL, 0);
+}
+
+HAL_StatusTypeDef OW_ReadBit(uint8_t *bit)
+{
+    if (ow_busy)
+    {
+        return HAL_BUSY;
+    }
+    ow_tx_len = 0;
+    return OW_Start(OW_FLAG_BIT, bit, 1);
+}
+
+HAL_StatusTypeDef OW_Transfer(const uint8_t *rom, const uint8_t *tx, uint8_t tx_len, uint8_t *rx, uint8_t rx_len)
+{
+    uint8_t i;
+    if (ow_busy)
+    {
+        return HAL_BUSY;
+    }
+    if (tx_len > OW_TX_BUFFER_SIZE - ((rom == NULL)? 1 : 9))
+    {
+        return HAL_ERROR;
+    }
+    ow_tx_len = 0;
+    if (rom == NULL)
+    {
+        ow_txbuf[ow_tx_len++] = OW_CMD_SKIPROM;
+    }
+    else
+    {
+        ow_txbuf[ow_tx_len++] = OW_CMD_MATCHROM;
+        for (i = 0; i < 8; i++)
+        {
+            ow_txbuf[ow_tx_len++] = rom[i];
+        }
+    }
+    for (i = 0; i < tx_len; i++)
+    {
+        ow_txbuf[ow_tx_len++] = tx[i];
+    }
+    return OW_Start(OW_FLAG_RESET, rx, rx_len);
+}
+
+void OW_Search_Reset(void)
+{
+    ow_last_discrepancy = 0;
+    ow_last_device = 0;
+}
+
+HAL_StatusTypeDef OW_Search(uint8_t cmd, uint8_t *rom)
+{
+    if (ow_busy)
+    {
+        return HAL_BUSY;
+    }
+    if (ow_last_device)
+    {
+        return HAL_ERROR;
+    }
+    ow_txbuf[0] = cmd;
+    ow_tx_len = 1;
+    return OW_Start(OW_FLAG_RESET | OW_FLAG_SEARCH, rom, 8);
+}
+
+uint8_t OW_IsBusy(void)
+{
+    return ow_busy;
+}
+
+HAL_StatusTypeDef OW_GetStatus(void)
+{
+    return ow_status;
+}
+
+HAL_StatusTypeDef OW_Wait(void)
+{
+    while (ow_busy);
+    return ow_status;
+}
+
+void OW_IRQHandler(void)
+{
+    switch (ow_timer)
+    {
+    case OW_TIMER_RESET_LOW:
+        PIN_SET(OW_DQ_PIN);
+        OW_TimerLoad(OW_TICKS_RESET_SAMPLE);
+        ow_timer = OW_TIMER_RESET_SAMPLE;
+        break;
+    case OW_TIMER_RESET_SAMPLE:
+        ow_sample = PIN_READ(OW_DQ_PIN);
+        OW_TimerLoad(OW_TICKS_RESET_END);
+        ow_timer = OW_TIMER_SLOT;
+        break;
+    default:
+        // End of slot, releases DQ after write 0
+        PIN_SET(OW_DQ_PIN);
+        ow_slot = OW_NextSlot(ow_sample);
+        switch (ow_slot)
+        {
+        case OW_SLOT_RESET:
+            PIN_CLR(OW_DQ_PIN);
+            OW_TimerLoad(OW_TICKS_RESET_LOW);
+            ow_timer = OW_TIMER_RESET_LOW;
+            break;
+        case OW_SLOT_0:
+            OW_TimerLoad(OW_TICKS_SLOT);
+            OW_WAIT(OW_TICKS_RECOVERY);
+            PIN_CLR(OW_DQ_PIN);
+            break;
+        case OW_SLOT_1:
+            OW_TimerLoad(OW_TICKS_SLOT);
+            OW_WAIT(OW_TICKS_RECOVERY);
+            // Nothing may stretch the low pulse or delay the sampling
+            EA = 0;
+            PIN_CLR(OW_DQ_PIN);
+            OW_WAIT(OW_TICKS_LOW);
+            PIN_SET(OW_DQ_PIN);
+            OW_WAIT(OW_TICKS_SAMPLE);
+            ow_sample = PIN_READ(OW_DQ_PIN);
+            EA = 1;
+            break;
+        default:
+            TIM_Timer0_SetRunState(HAL_State_OFF);
+            OW_Finish();
+            break;
+        }
+        break;
+    }
+}
+
+/**************************************************************************** /
+ * UART transport
+*/
+
+static void OW_UART_SetBaud(uint16_t init)
+{
+    TIM_Timer2_SetRunState(HAL_State_OFF);
+    TIM_Timer2_SetInitValue(init >> 8, init & 0xFF);
+    TIM_Timer2_SetRunState(HAL_State_ON);
+}
+
+static void OW_UART_Send(uint8_t slot)
+{
+    ow_slot = slot;
+    switch (slot)
+    {
+    case OW_SLOT_RESET:
+        OW_UART_SetBaud(ow_baud_reset);
+        UART2_WriteBuffer(OW_UART_RESET_BYTE);
+        break;
+    case OW_SLOT_0:
+        UART2_WriteBuffer(0x00);
+        break;
+    case OW_SLOT_1:
+        UART2_WriteBuffer(0xFF);
+        break;
+    default:
+        OW_Finish();
+        break;
+    }
+}
+
+#if (__CONF_MCU_TYPE == 3)
+/**
+ * Decode the batch just echoed and start the next one, called at the end of reset
+ * and from UR2R completion. ow_pos counts bytes of the phase
+*/
+static void OW_UART_Batch(void)
+{
+    uint8_t i, j, p_sw2;
+    if (ow_phase == OW_PHASE_RX)
+    {
+        for (i = 0, j = 0; i < ow_chunk; i++)
+        {
+            ow_byte = 0;
+            for (ow_mask = 0x01; ow_mask; ow_mask <<= 1)
+            {
+                if (ow_slots[j++] == 0xFF)
+                {
+                    ow_byte |= ow_mask;
+                }
+            }
+            ow_rx[ow_pos++] = ow_byte;
+        }
+    }
+    else if (ow_pos == ow_tx_len)
+    {
+        ow_phase = OW_PHASE_RX;
+        ow_pos = 0;
+    }
+    if (ow_phase == OW_PHASE_RX)
+    {
+        if (ow_pos == ow_rx_len)
+        {
+            EXTI_UART2_SetIntState(HAL_State_ON);
+            OW_Finish();
+            return;
+        }
+        ow_chunk = ow_rx_len - ow_pos;
+    }
+    else
+    {
+        ow_chunk = ow_tx_len - ow_pos;
+    }
+    if (ow_chunk > OW_UART_DMA_BYTES)
+    {
+        ow_chunk = OW_UART_DMA_BYTES;
+    }
+    for (i = 0, j = 0; i < ow_chunk; i++)
+    {
+        ow_byte = (ow_phase == OW_PHASE_RX)? 0xFF : ow_txbuf[ow_pos++];
+        for (ow_mask = 0x01; ow_mask; ow_mask <<= 1)
+        {
+            ow_slots[j++] = (ow_byte & ow_mask)? 0xFF : 0x00;
+        }
+    }
+    // RI and TI belong to DMA during the batch
+    EXTI_UART2_SetIntState(HAL_State_OFF);
+    p_sw2 = P_SW2;
+    P_SW2 |= 0x80;
+    DMA_UR2R_AMT = j - 1;
+    DMA_UR2R_RXAH = (uint16_t)(uintptr_t)ow_slots >> 8;
+    DMA_UR2R_RXAL = (uint16_t)(uintptr_t)ow_slots & 0xFF;
+    DMA_UR2T_AMT = j - 1;
+    DMA_UR2T_TXAH = (uint16_t)(uintptr_t)ow_slots >> 8;
+    DMA_UR2T_TXAL = (uint16_t)(uintptr_t)ow_slots & 0xFF;
+    // Receiver first with FIFO cleared, then transmitter
+    DMA_Channel_Start(DMA_Channel_UR2R, 0x21);
+    DMA_Channel_Start(DMA_Channel_UR2T, 0x40);
+    P_SW2 = p_sw2;
+}
+#endif
+
+static void OW_UART_Next(void)
+{
+#if (__CONF_MCU_TYPE == 3)
+    if (ow_transport == OW_TRANSPORT_DMA && !(ow_flags & (OW_FLAG_SEARCH | OW_FLAG_BIT)))
+    {
+        // Batches start after the reset has been answered, or without reset
+        if ((ow_phase == OW_PHASE_START && !(ow_flags & OW_FLAG_RESET))
+            || (ow_phase == OW_PHASE_RESET && !ow_sample))
+        {
+            ow_phase = OW_PHASE_TX;
+            ow_pos = 0;
+            OW_UART_Batch();
+            return;
+        }
+    }
+#endif
+    OW_UART_Send(OW_NextSlot(ow_sample));
+}
+
+HAL_StatusTypeDef OW_UART_Init(HAL_State_t dma)
+{
+    uint32_t sysclk;
+    if (ow_busy)
+    {
+        return HAL_BUSY;
+    }
+#if (__CONF_MCU_TYPE == 3)
+    if (ow_transport == OW_TRANSPORT_DMA)
+    {
+        DMA_Channel_Release(DMA_Channel_UR2T);
+        DMA_Channel_Release(DMA_Channel_UR2R);
+    }
+    if (dma)
+    {
+        if (DMA_Channel_Acquire(DMA_Channel_UR2T, DMA_BusPriority_Lowest, NULL) != HAL_OK)
+        {
+            return HAL_ERROR;
+        }
+        if (DMA_Channel_Acquire(DMA_Channel_UR2R, DMA_BusPriority_Lowest, OW_UART_Batch) != HAL_OK)
+        {
+            DMA_Channel_Release(DMA_Channel_UR2T);
+            return HAL_ERROR;
+        }
+    }
+#endif
+    PIN_SET(OW_UART_TX_PIN);
+    PIN_SetMode(OW_UART_TX_PIN, GPIO_Mode_InOut_OD);
+#if (__CONF_MCU_TYPE == 2) || (__CONF_MCU_TYPE == 3)
+    PIN_SetPullUp(OW_UART_TX_PIN, HAL_State_ON);
+#endif
+    sysclk = SYS_GetSysClock();
+    ow_baud_slot = UART_Timer_InitValueCalculate(sysclk, HAL_State_ON, OW_UART_BAUD_SLOT);
+    ow_baud_reset = UART_Timer_InitValueCalculate(sysclk, HAL_State_ON, OW_UART_BAUD_RESET);
+    UART2_Set8bitUART();
+    UART2_SetRxState(HAL_State_ON);
+    UART2_ClearTxInterrupt();
+    UART2_ClearRxInterrupt();
+    TIM_Timer2_Set1TMode(HAL_State_ON);
+    OW_UART_SetBaud(ow_baud_slot);
+    EXTI_UART2_SetIntState(HAL_State_ON);
+#if (__CONF_MCU_TYPE == 3)
+    ow_transport = dma? OW_TRANSPORT_DMA : OW_TRANSPORT_UART;
+#else
+    (void)dma;
+    ow_transport = OW_TRANSPORT_UART;
+#endif
+    ow_status = HAL_OK;
+    OW_Search_Reset();
+    return HAL_OK;
+}
+
+void OW_UART_IRQHandler(void)
+{
+    uint8_t rx;
+    if (S2CON & (0x01 << 1))
+    {
+        UART2_ClearTxInterrupt();
+    }
+    if (!(S2CON & 0x01))
+    {
+        return;
+    }
+    UART2_ClearRxInterrupt();
+    rx = S2BUF;
+    if (ow_slot == OW_SLOT_RESET)
+    {
+        OW_UART_SetBaud(ow_baud_slot);
+        // Presence pulse overlaps the low bits of 0xF0
+        ow_sample = (rx == OW_UART_RESET_BYTE);
+    }
+    else
+    {
+        ow_sample = (rx == 0xFF);
+    }
+    OW_UART_Next();
+}
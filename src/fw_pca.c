@@ -0,0 +1,366 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fw_pca.h"
+#include "fw_sys.h"
+
+#if (__CONF_MCU_TYPE == 2)
+
+#define PCA_MODE_OFF        0x00
+#define PCA_MODE_TIMER      0x01
+#define PCA_MODE_CAPTURE    0x02
+#define PCA_MODE_PULSE      0x03
+
+// SYSCLK divider by PCA_ClockSource_t, 0 for Timer0 overflow and ECI
+static __CODE uint8_t pca_clock_div[8] = {12, 2, 0, 0, 1, 4, 6, 8};
+
+static __XDATA PCA_CapEvent_t pca_cap_buf[PCA_CAP_BUFFER_SIZE];
+static volatile uint8_t pca_cap_head, pca_cap_tail;
+static uint16_t pca_cap_overruns;
+static uint16_t pca_overflows;
+static uint8_t pca_source;
+
+static __XDATA uint8_t pca_mode[3];
+static __XDATA uint8_t pca_level[3];
+static __XDATA uint8_t pca_periodic[3];
+// Last programmed match value, and ticks from it to the event
+static __XDATA uint16_t pca_match[3];
+static __XDATA uint32_t pca_left[3];
+// Pulse high and low times, timer interval is kept in pca_high
+static __XDATA uint32_t pca_high[3];
+static __XDATA uint32_t pca_low[3];
+static __XDATA uint16_t pca_count[3];
+static __XDATA PCA_Callback_t pca_callback[3];
+
+// Used in interrupt only
+static uint8_t pca_flags;
+
+static void PCA_SetMode(uint8_t channel, uint8_t mode)
+{
+    switch (channel)
+    {
+    case 0:
+        PCA_PCA0_SetWorkMode(mode);
+        break;
+    case 1:
+        PCA_PCA1_SetWorkMode(mode);
+        break;
+    default:
+        PCA_PCA2_SetWorkMode(mode);
+        break;
+    }
+}
+
+/**
+ * Writing CCAPnL clears ECOM and writing CCAPnH sets it, so a half written
+ * value never matches
+*/
+static void PCA_SetMatch(uint8_t channel, uint16_t value)
+{
+    switch (channel)
+    {
+    case 0:
+        CCAP0L = value & 0xFF;
+        CCAP0H = value >> 8;
+        break;
+    case 1:
+        CCAP1L = value & 0xFF;
+        CCAP1H = value >> 8;
+        break;
+    default:
+        CCAP2L = value & 0xFF;
+        CCAP2H = value >> 8;
+        break;
+    }
+}
+
+static uint16_t PCA_GetCapture(uint8_t channel)
+{
+    switch (channel)
+    {
+    case 0:
+        return ((uint16_t)CCAP0H << 8) | CCAP0L;
+    case 1:
+        return ((uint16_t)CCAP1H << 8) | CCAP1L;
+    default:
+        return ((uint16_t)CCAP2H << 8) | CCAP2L;
+    }
+}
+
+static uint16_t PCA_GetCounter(void)
+{
+    uint8_t high, low;
+    do
+    {
+        high = CH;
+        low = CL;
+    } while (high != CH);
+    return ((uint16_t)high << 8) | low;
+}
+
+/**
+ * Program the next match, interval is counted from the previous match.
+ * Intervals longer than 0xFFFF are split, a pulse channel toggles on the last part only.
+ * No part after the first is shorter than 0x8000, the ISR must reprogram the match
+ * before the counter passes it.
+*/
+static void PCA_Schedule(uint8_t channel, uint32_t interval)
+{
+    uint16_t part = interval;
+    if (interval > 0xFFFF)
+    {
+        part = (interval - 0x10000 < 0x8000)? 0x8000 : 0xFFFF;
+    }
+    pca_left[channel] = interval - part;
+    pca_match[channel] += part;
+    PCA_SetMode(channel, (pca_mode[channel] == PCA_MODE_PULSE && pca_left[channel] == 0)?
+        PCA_WorkMode_CAP_16bitPulseOut | 0x01 : PCA_WorkMode_CAP_16bitTimer | 0x01);
+    PCA_SetMatch(channel, pca_match[channel]);
+}
+
+void PCA_Timebase_Init(PCA_ClockSource_t source)
+{
+    uint8_t i;
+    pca_source = source;
+    PCA_SetCounterState(HAL_State_OFF);
+    PCA_SetStopCounterInIdle(HAL_State_OFF);
+    PCA_SetClockSource(source);
+    for (i = 0; i < 3; i++)
+    {
+        PCA_Channel_Stop(i);
+    }
+    CL = 0;
+    CH = 0;
+    // Clear CF and CCFn
+    CCON = 0x00;
+    pca_overflows = 0;
+    pca_cap_head = 0;
+    pca_cap_tail = 0;
+    pca_cap_overruns = 0;
+    PCA_EnableCounterOverflowInterrupt(HAL_State_ON);
+    PCA_SetCounterState(HAL_State_ON);
+}
+
+uint32_t PCA_GetClock(void)
+{
+    uint8_t div = pca_clock_div[pca_source & 0x07];
+    return (div == 0)? 0 : SYS_GetSysClock() / div;
+}
+
+uint32_t PCA_GetTicks(void)
+{
+    uint16_t high, value;
+    uint8_t ea = EA;
+    EA = 0;
+    value = PCA_GetCounter();
+    high = pca_overflows;
+    // Counter overflowed but the interrupt is not handled yet
+    if ((CCON & 0x80) && value < 0x8000)
+    {
+        high++;
+    }
+    EA = ea;
+    return ((uint32_t)high << 16) | value;
+}
+
+HAL_StatusTypeDef PCA_Timer_Start(PCA_Channel_t channel, uint32_t interval, HAL_State_t periodic, PCA_Callback_t callback)
+{
+    uint8_t ea = EA;
+    if (channel > PCA_Channel_2 || interval == 0)
+    {
+        return HAL_ERROR;
+    }
+    EA = 0;
+    pca_mode[channel] = PCA_MODE_TIMER;
+    pca_high[channel] = interval;
+    pca_periodic[channel] = periodic;
+    pca_callback[channel] = callback;
+    pca_match[channel] = PCA_GetCounter();
+    PCA_Schedule(channel, interval);
+    EA = ea;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef PCA_Capture_Start(PCA_Channel_t channel, PCA_WorkMode_t mode)
+{
+    uint8_t ea = EA;
+    if (channel > PCA_Channel_2 
+        || (mode != PCA_WorkMode_CAP_16bitRising 
+            && mode != PCA_WorkMode_CAP_16bitFalling 
+            && mode != PCA_WorkMode_CAP_16bitEdge))
+    {
+        return HAL_ERROR;
+    }
+    EA = 0;
+    pca_mode[channel] = PCA_MODE_CAPTURE;
+    PCA_SetMode(channel, mode | 0x01);
+    EA = ea;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef PCA_Capture_Read(PCA_CapEvent_t *event)
+{
+    uint8_t tail = pca_cap_tail;
+    if (tail == pca_cap_head)
+    {
+        return HAL_ERROR;
+    }
+    event->channel = pca_cap_buf[tail].channel;
+    event->timestamp = pca_cap_buf[tail].timestamp;
+    pca_cap_tail = (tail + 1) & (PCA_CAP_BUFFER_SIZE - 1);
+    return HAL_OK;
+}
+
+uint16_t PCA_Capture_GetOverruns(void)
+{
+    uint16_t overruns;
+    uint8_t ea = EA;
+    EA = 0;
+    overruns = pca_cap_overruns;
+    EA = ea;
+    return overruns;
+}
+
+HAL_StatusTypeDef PCA_Pulse_Start(PCA_Channel_t channel, uint32_t high, uint32_t low, uint16_t count)
+{
+    uint8_t ea = EA;
+    if (channel > PCA_Channel_2 || high == 0 || low == 0)
+    {
+        return HAL_ERROR;
+    }
+    EA = 0;
+    pca_mode[channel] = PCA_MODE_PULSE;
+    pca_level[channel] = 0;
+    pca_high[channel] = high;
+    pca_low[channel] = low;
+    pca_count[channel] = count;
+    pca_match[channel] = PCA_GetCounter();
+    PCA_Schedule(channel, low);
+    EA = ea;
+    return HAL_OK;
+}
+
+void PCA_Pulse_SetWidth(PCA_Channel_t channel, uint32_t high, uint32_t low)
+{
+    uint8_t ea = EA;
+    if (channel > PCA_Channel_2 || high == 0 || low == 0)
+    {
+        return;
+    }
+    EA = 0;
+    pca_high[channel] = high;
+    pca_low[channel] = low;
+    EA = ea;
+}
+
+uint8_t PCA_Channel_IsBusy(PCA_Channel_t channel)
+{
+    return pca_mode[channel] == PCA_MODE_TIMER || pca_mode[channel] == PCA_MODE_PULSE;
+}
+
+void PCA_Channel_Stop(PCA_Channel_t channel)
+{
+    uint8_t ea = EA;
+    EA = 0;
+    pca_mode[channel] = PCA_MODE_OFF;
+    PCA_SetMode(channel, PCA_WorkMode_None);
+    EA = ea;
+}
+
+static void PCA_Capture_Push(uint8_t channel)
+{
+    uint16_t value = PCA_GetCapture(channel), high;
+    uint8_t head = pca_cap_head, next = (pca_cap_head + 1) & (PCA_CAP_BUFFER_SIZE - 1);
+    if (next == pca_cap_tail)
+    {
+        pca_cap_overruns++;
+        return;
+    }
+    // Counter overflowed before this capture but CF is not handled yet
+    high = ((pca_flags & 0x80) && value < 0x8000)? pca_overflows + 1 : pca_overflows;
+    pca_cap_buf[head].channel = channel;
+    pca_cap_buf[head].timestamp = ((uint32_t)high << 16) | value;
+    pca_cap_head = next;
+}
+
+void PCA_IRQHandler(void)
+{
+    uint8_t i;
+    pca_flags = CCON;
+    // Clear handled CF and CCFn, keep CR
+    CCON &= ~(pca_flags & 0x87);
+    for (i = 0; i < 3; i++)
+    {
+        if (!(pca_flags & (0x01 << i)))
+        {
+            continue;
+        }
+        switch (pca_mode[i])
+        {
+        case PCA_MODE_CAPTURE:
+            PCA_Capture_Push(i);
+            break;
+        case PCA_MODE_TIMER:
+            if (pca_left[i] != 0)
+            {
+                PCA_Schedule(i, pca_left[i]);
+                break;
+            }
+            if (pca_periodic[i])
+            {
+                PCA_Schedule(i, pca_high[i]);
+            }
+            else
+            {
+                pca_mode[i] = PCA_MODE_OFF;
+                PCA_SetMode(i, PCA_WorkMode_None);
+            }
+            // Called last so a one-shot timer can be restarted in callback
+            if (pca_callback[i] != NULL)
+            {
+                pca_callback[i]();
+            }
+            break;
+        case PCA_MODE_PULSE:
+            if (pca_left[i] != 0)
+            {
+                PCA_Schedule(i, pca_left[i]);
+                break;
+            }
+            pca_level[i] ^= 0x01;
+            if (pca_level[i])
+            {
+                PCA_Schedule(i, pca_high[i]);
+            }
+            else if (pca_count[i] != 0 && --pca_count[i] == 0)
+            {
+                pca_mode[i] = PCA_MODE_OFF;
+                PCA_SetMode(i, PCA_WorkMode_None);
+            }
+            else
+            {
+                PCA_Schedule(i, pca_low[i]);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    if (pca_flags & 0x80)
+    {
+        pca_overflows++;
+    }
+}
+
+#endif
@@ -0,0 +1,676 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fw_pwm.h"
+#include "fw_sys.h"
+#include "fw_adc.h"
+
+#if (__CONF_MCU_TYPE == 3)
+
+// Registers of PWMA and PWMB by PWM_Timer_t
+#define PWM_TIMER_REG(__TIMER__, __OFFSET__)    SFRX(((__TIMER__)? 0xfee0 : 0xfec0) + (__OFFSET__))
+#define PWM_TIMER_CR1(__TIMER__)                PWM_TIMER_REG(__TIMER__, 0x00)
+#define PWM_TIMER_SMCR(__TIMER__)               PWM_TIMER_REG(__TIMER__, 0x02)
+#define PWM_TIMER_IER(__TIMER__)                PWM_TIMER_REG(__TIMER__, 0x04)
+#define PWM_TIMER_SR1(__TIMER__)                PWM_TIMER_REG(__TIMER__, 0x05)
+#define PWM_TIMER_SR2(__TIMER__)                PWM_TIMER_REG(__TIMER__, 0x06)
+#define PWM_TIMER_EGR(__TIMER__)                PWM_TIMER_REG(__TIMER__, 0x07)
+#define PWM_TIMER_CCMR1(__TIMER__)              PWM_TIMER_REG(__TIMER__, 0x08)
+#define PWM_TIMER_CCMR2(__TIMER__)              PWM_TIMER_REG(__TIMER__, 0x09)
+#define PWM_TIMER_CCER1(__TIMER__)              PWM_TIMER_REG(__TIMER__, 0x0C)
+#define PWM_TIMER_CNTRH(__TIMER__)              PWM_TIMER_REG(__TIMER__, 0x0E)
+#define PWM_TIMER_CNTRL(__TIMER__)              PWM_TIMER_REG(__TIMER__, 0x0F)
+#define PWM_TIMER_PSCRH(__TIMER__)              PWM_TIMER_REG(__TIMER__, 0x10)
+#define PWM_TIMER_PSCRL(__TIMER__)              PWM_TIMER_REG(__TIMER__, 0x11)
+#define PWM_TIMER_ARRH(__TIMER__)               PWM_TIMER_REG(__TIMER__, 0x12)
+#define PWM_TIMER_ARRL(__TIMER__)               PWM_TIMER_REG(__TIMER__, 0x13)
+
+/**************************************************************************** /
+ * PWM input capture
+*/
+
+// Registers of capture channel by PWM_CapChannel_t
+#define PWM_CAP_CCMR(__CH__)                    PWM_TIMER_REG((__CH__) >> 2, 0x08 + ((__CH__) & 0x03))
+#define PWM_CAP_CCER(__CH__)                    PWM_TIMER_REG((__CH__) >> 2, 0x0C + (((__CH__) >> 1) & 0x01))
+#define PWM_CAP_CCRH(__CH__)                    PWM_TIMER_REG((__CH__) >> 2, 0x15 + (((__CH__) & 0x03) << 1))
+#define PWM_CAP_CCRL(__CH__)                    PWM_TIMER_REG((__CH__) >> 2, 0x16 + (((__CH__) & 0x03) << 1))
+// CCxE and CCxP of channel in CCER
+#define PWM_CAP_CCER_SHIFT(__CH__)              (((__CH__) & 0x01) << 2)
+
+// Internal mode of the channel capturing falling edge for PeriodDuty mode
+#define PWM_CAP_MODE_FALLING                    0x04
+
+static __XDATA PWM_CapResult_t pwm_cap_buf[PWM_CAP_BUFFER_SIZE];
+static volatile uint8_t pwm_cap_head, pwm_cap_tail;
+static uint16_t pwm_cap_overruns;
+static uint16_t pwm_cap_overflows[2];
+static __XDATA uint32_t pwm_cap_clock[2];
+
+static __XDATA uint8_t pwm_cap_mode[8];
+static __XDATA uint8_t pwm_cap_edges[8];
+static __XDATA uint8_t pwm_cap_started[8];
+static __XDATA uint16_t pwm_cap_count[8];
+static __XDATA uint32_t pwm_cap_last[8];
+static __XDATA uint32_t pwm_cap_start[8];
+static __XDATA uint32_t pwm_cap_gate[8];
+
+// Used in interrupt only, PWMA and PWMB interrupts must not nest
+static uint32_t pwm_cap_stamp;
+static uint8_t pwm_cap_timer, pwm_cap_flags;
+
+void PWM_Cap_Init(PWM_Timer_t timer, uint16_t prescaler)
+{
+    pwm_cap_clock[timer] = SYS_GetSysClock() / ((uint32_t)prescaler + 1);
+    pwm_cap_overflows[timer] = 0;
+    SFRX_ON();
+    // Stop counter, up counting, edge aligned, update event on overflow only
+    PWM_TIMER_CR1(timer) = 0x04;
+    PWM_TIMER_PSCRH(timer) = prescaler >> 8;
+    PWM_TIMER_PSCRL(timer) = prescaler & 0xFF;
+    PWM_TIMER_ARRH(timer) = 0xFF;
+    PWM_TIMER_ARRL(timer) = 0xFF;
+    // Load prescaler
+    PWM_TIMER_EGR(timer) = 0x01;
+    PWM_TIMER_SR1(timer) = 0x00;
+    PWM_TIMER_SR2(timer) = 0x00;
+    PWM_TIMER_IER(timer) |= 0x01;
+    PWM_TIMER_CR1(timer) |= 0x01;
+    SFRX_OFF();
+}
+
+static void PWM_Cap_SetChannel(uint8_t channel, uint8_t ccmr, uint8_t falling)
+{
+    uint8_t shift = PWM_CAP_CCER_SHIFT(channel);
+    // CCxS is writable only when the channel is off
+    PWM_CAP_CCER(channel) &= ~(0x03 << shift);
+    PWM_TIMER_IER(channel >> 2) &= ~(0x02 << (channel & 0x03));
+    PWM_CAP_CCMR(channel) = ccmr;
+    if (ccmr)
+    {
+        PWM_CAP_CCER(channel) |= ((falling? 0x02 : 0x00) | 0x01) << shift;
+        PWM_TIMER_SR2(channel >> 2) &= ~(0x02 << (channel & 0x03));
+        PWM_TIMER_IER(channel >> 2) |= 0x02 << (channel & 0x03);
+    }
+}
+
+HAL_StatusTypeDef PWM_Cap_Config(
+    PWM_CapChannel_t channel, 
+    PWM_CapMode_t mode, 
+    uint8_t filter, 
+    PWM_CapPrescaler_t prescaler, 
+    uint32_t gate)
+{
+    if (channel > PWM_CapChannel_8
+        || (mode == PWM_CapMode_PeriodDuty && (channel & 0x01)))
+    {
+        return HAL_ERROR;
+    }
+    if (pwm_cap_mode[channel] == PWM_CAP_MODE_FALLING)
+    {
+        // Occupied by PeriodDuty mode of previous channel
+        return HAL_BUSY;
+    }
+    if (mode == PWM_CapMode_PeriodDuty)
+    {
+        // Both edges are needed, no prescaler
+        prescaler = PWM_CapPrescaler_1;
+    }
+    pwm_cap_started[channel] = 0;
+    pwm_cap_mode[channel] = mode;
+    pwm_cap_edges[channel] = 0x01 << prescaler;
+    pwm_cap_gate[channel] = (mode == PWM_CapMode_Frequency)? gate : 0;
+
+    SFRX_ON();
+    if (pwm_cap_mode[channel] == PWM_CapMode_Off)
+    {
+        PWM_Cap_SetChannel(channel, 0x00, 0);
+    }
+    else
+    {
+        // CCxS = 01, input from own pin
+        PWM_Cap_SetChannel(channel, ((filter & 0x0F) << 4) | (prescaler << 2) | 0x01, 0);
+    }
+    if (mode == PWM_CapMode_PeriodDuty)
+    {
+        // CCxS = 10, input from the pin of previous channel, falling edge
+        pwm_cap_mode[channel + 1] = PWM_CAP_MODE_FALLING;
+        pwm_cap_started[channel + 1] = 0;
+        PWM_Cap_SetChannel(channel + 1, ((filter & 0x0F) << 4) | 0x02, 1);
+    }
+    else if (!(channel & 0x01) && pwm_cap_mode[channel + 1] == PWM_CAP_MODE_FALLING)
+    {
+        // Release the channel occupied by previous PeriodDuty mode
+        pwm_cap_mode[channel + 1] = PWM_CapMode_Off;
+        PWM_Cap_SetChannel(channel + 1, 0x00, 0);
+    }
+    SFRX_OFF();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef PWM_Cap_Read(PWM_CapResult_t *result)
+{
+    uint8_t tail = pwm_cap_tail;
+    if (tail == pwm_cap_head)
+    {
+        return HAL_ERROR;
+    }
+    result->channel = pwm_cap_buf[tail].channel;
+    result->period = pwm_cap_buf[tail].period;
+    result->width = pwm_cap_buf[tail].width;
+    result->count = pwm_cap_buf[tail].count;
+    pwm_cap_tail = (tail + 1) & (PWM_CAP_BUFFER_SIZE - 1);
+    return HAL_OK;
+}
+
+uint16_t PWM_Cap_GetOverruns(void)
+{
+    uint16_t overruns;
+    uint8_t ea = EA;
+    EA = 0;
+    overruns = pwm_cap_overruns;
+    EA = ea;
+    return overruns;
+}
+
+uint32_t PWM_Cap_GetFrequency(PWM_CapResult_t *result)
+{
+    uint32_t num, clock, period, rem;
+    if (result->period == 0)
+    {
+        return 0;
+    }
+    num = (uint32_t)result->count * 100;
+    clock = pwm_cap_clock[result->channel >> 2];
+    period = result->period;
+    // num * clock / period without 64-bit intermediate
+    rem = clock % period;
+    while (rem > 0xFFFFFFFF / num)
+    {
+        rem >>= 1;
+        period >>= 1;
+    }
+    return num * (clock / result->period) + num * rem / period;
+}
+
+static void PWM_Cap_Push(uint8_t channel, uint32_t period, uint32_t width, uint16_t count)
+{
+    uint8_t head = pwm_cap_head, next = (pwm_cap_head + 1) & (PWM_CAP_BUFFER_SIZE - 1);
+    if (next == pwm_cap_tail)
+    {
+        pwm_cap_overruns++;
+        return;
+    }
+    pwm_cap_buf[head].channel = channel;
+    pwm_cap_buf[head].period = period;
+    pwm_cap_buf[head].width = width;
+    pwm_cap_buf[head].count = count;
+    pwm_cap_head = next;
+}
+
+/**
+ * Read capture of channel, extend it to 32 bits in pwm_cap_stamp
+*/
+static void PWM_Cap_Stamp(uint8_t channel)
+{
+    uint16_t value;
+    value = PWM_CAP_CCRH(channel) << 8;
+    value |= PWM_CAP_CCRL(channel);
+    // Counter overflowed before this capture but the update is not handled yet
+    pwm_cap_stamp = ((pwm_cap_flags & 0x01) && value < 0x8000)? 
+        pwm_cap_overflows[pwm_cap_timer] + 1 : pwm_cap_overflows[pwm_cap_timer];
+    pwm_cap_stamp = (pwm_cap_stamp << 16) | value;
+
+    if (PWM_TIMER_SR2(pwm_cap_timer) & (0x02 << (channel & 0x03)))
+    {
+        // Edges were missed, restart measurement
+        PWM_TIMER_SR2(pwm_cap_timer) &= ~(0x02 << (channel & 0x03));
+        pwm_cap_started[channel] = 0;
+        if (pwm_cap_mode[channel] == PWM_CAP_MODE_FALLING)
+        {
+            pwm_cap_started[channel - 1] = 0;
+        }
+    }
+}
+
+static void PWM_Cap_Process(uint8_t channel)
+{
+    if (pwm_cap_mode[channel] == PWM_CAP_MODE_FALLING)
+    {
+        // Falling edge stamp is kept in pwm_cap_last of this channel
+        pwm_cap_last[channel] = pwm_cap_stamp;
+        pwm_cap_started[channel] = pwm_cap_started[channel - 1];
+        return;
+    }
+    if (!pwm_cap_started[channel])
+    {
+        pwm_cap_started[channel] = 1;
+        pwm_cap_start[channel] = pwm_cap_stamp;
+        pwm_cap_last[channel] = pwm_cap_stamp;
+        pwm_cap_count[channel] = 0;
+        return;
+    }
+    pwm_cap_count[channel] += pwm_cap_edges[channel];
+    switch (pwm_cap_mode[channel])
+    {
+    case PWM_CapMode_Period:
+        PWM_Cap_Push(channel, pwm_cap_stamp - pwm_cap_last[channel], 0, pwm_cap_count[channel]);
+        pwm_cap_count[channel] = 0;
+        break;
+    case PWM_CapMode_PeriodDuty:
+        if (pwm_cap_started[channel + 1])
+        {
+            PWM_Cap_Push(channel, pwm_cap_stamp - pwm_cap_last[channel], 
+                pwm_cap_last[channel + 1] - pwm_cap_last[channel], 1);
+            pwm_cap_started[channel + 1] = 0;
+        }
+        pwm_cap_count[channel] = 0;
+        break;
+    case PWM_CapMode_Frequency:
+        if (pwm_cap_stamp - pwm_cap_start[channel] >= pwm_cap_gate[channel] 
+            || pwm_cap_count[channel] > 0xFFFF - 8)
+        {
+            PWM_Cap_Push(channel, pwm_cap_stamp - pwm_cap_start[channel], 0, pwm_cap_count[channel]);
+            pwm_cap_start[channel] = pwm_cap_stamp;
+            pwm_cap_count[channel] = 0;
+        }
+        break;
+    default:
+        break;
+    }
+    pwm_cap_last[channel] = pwm_cap_stamp;
+}
+
+static void PWM_Cap_IRQHandler(void)
+{
+    uint8_t i, channel;
+    uint32_t first, second;
+    pwm_cap_flags = PWM_TIMER_SR1(pwm_cap_timer);
+    // Flags are cleared by writing 0, writing 1 has no effect so new flags are kept
+    PWM_TIMER_SR1(pwm_cap_timer) &= ~(pwm_cap_flags & 0x1F);
+    for (i = 0; i < 4; i++)
+    {
+        if (!(pwm_cap_flags & (0x02 << i)))
+        {
+            continue;
+        }
+        channel = (pwm_cap_timer << 2) + i;
+        PWM_Cap_Stamp(channel);
+        if (pwm_cap_mode[channel] == PWM_CapMode_PeriodDuty 
+            && (pwm_cap_flags & (0x04 << i)))
+        {
+            // Both edges of the pair are pending, process them in time order
+            first = pwm_cap_stamp;
+            PWM_Cap_Stamp(channel + 1);
+            second = pwm_cap_stamp;
+            if ((int32_t)(second - first) < 0)
+            {
+                PWM_Cap_Process(channel + 1);
+                pwm_cap_stamp = first;
+                PWM_Cap_Process(channel);
+            }
+            else
+            {
+                pwm_cap_stamp = first;
+                PWM_Cap_Process(channel);
+                pwm_cap_stamp = second;
+                PWM_Cap_Process(channel + 1);
+            }
+            i++;
+            continue;
+        }
+        PWM_Cap_Process(channel);
+    }
+    if (pwm_cap_flags & 0x01)
+    {
+        pwm_cap_overflows[pwm_cap_timer]++;
+    }
+}
+
+void PWM_Cap_PWMA_IRQHandler(void)
+{
+    // Keep EAXFR state of the interrupted code
+    uint8_t p_sw2 = P_SW2;
+    P_SW2 |= 0x80;
+    pwm_cap_timer = PWM_Timer_PWMA;
+    PWM_Cap_IRQHandler();
+    P_SW2 = p_sw2;
+}
+
+void PWM_Cap_PWMB_IRQHandler(void)
+{
+    uint8_t p_sw2 = P_SW2;
+    P_SW2 |= 0x80;
+    pwm_cap_timer = PWM_Timer_PWMB;
+    PWM_Cap_IRQHandler();
+    P_SW2 = p_sw2;
+}
+
+/**************************************************************************** /
+ * Quadrature encoder
+*/
+
+static uint16_t pwm_encoder_last[2];
+static int32_t pwm_encoder_position[2], pwm_encoder_sampled[2];
+static int16_t pwm_encoder_velocity[2];
+
+void PWM_Encoder_Config(PWM_Timer_t timer, PWM_EncoderMode_t mode, uint8_t filter, HAL_State_t invert)
+{
+    SFRX_ON();
+    PWM_TIMER_CR1(timer) = 0x00;
+    PWM_TIMER_IER(timer) = 0x00;
+    PWM_TIMER_CCER1(timer) = 0x00;
+    // CC1S = 01, CC2S = 01: IC1 on TI1FP1, IC2 on TI2FP2
+    PWM_TIMER_CCMR1(timer) = ((filter & 0x0F) << 4) | 0x01;
+    PWM_TIMER_CCMR2(timer) = ((filter & 0x0F) << 4) | 0x01;
+    // CC1P inverts TI1, which reverses the direction
+    PWM_TIMER_CCER1(timer) = invert? 0x13 : 0x11;
+    PWM_TIMER_SMCR(timer) = mode & 0x07;
+    PWM_TIMER_PSCRH(timer) = 0x00;
+    PWM_TIMER_PSCRL(timer) = 0x00;
+    PWM_TIMER_ARRH(timer) = 0xFF;
+    PWM_TIMER_ARRL(timer) = 0xFF;
+    PWM_TIMER_CNTRH(timer) = 0x00;
+    PWM_TIMER_CNTRL(timer) = 0x00;
+    PWM_TIMER_CR1(timer) = 0x01;
+    SFRX_OFF();
+    pwm_encoder_last[timer] = 0;
+    pwm_encoder_position[timer] = 0;
+    pwm_encoder_sampled[timer] = 0;
+    pwm_encoder_velocity[timer] = 0;
+}
+
+/**
+ * Add counter movement since last call to position, the counter must not
+ * move more than 32767 counts in between
+*/
+static void PWM_Encoder_Delta(uint8_t timer)
+{
+    uint16_t count;
+    uint8_t p_sw2 = P_SW2;
+    P_SW2 |= 0x80;
+    // Reading high byte first latches low byte
+    count = PWM_TIMER_CNTRH(timer) << 8;
+    count |= PWM_TIMER_CNTRL(timer);
+    P_SW2 = p_sw2;
+    pwm_encoder_position[timer] += (int16_t)(count - pwm_encoder_last[timer]);
+    pwm_encoder_last[timer] = count;
+}
+
+void PWM_Encoder_Sample(PWM_Timer_t timer)
+{
+    uint8_t ea = EA;
+    EA = 0;
+    PWM_Encoder_Delta(timer);
+    pwm_encoder_velocity[timer] = (int16_t)(pwm_encoder_position[timer] - pwm_encoder_sampled[timer]);
+    pwm_encoder_sampled[timer] = pwm_encoder_position[timer];
+    EA = ea;
+}
+
+int32_t PWM_Encoder_GetPosition(PWM_Timer_t timer)
+{
+    int32_t position;
+    uint8_t ea = EA;
+    EA = 0;
+    PWM_Encoder_Delta(timer);
+    position = pwm_encoder_position[timer];
+    EA = ea;
+    return position;
+}
+
+void PWM_Encoder_SetPosition(PWM_Timer_t timer, int32_t position)
+{
+    uint8_t ea = EA;
+    EA = 0;
+    PWM_Encoder_Delta(timer);
+    pwm_encoder_sampled[timer] += position - pwm_encoder_position[timer];
+    pwm_encoder_position[timer] = position;
+    EA = ea;
+}
+
+int16_t PWM_Encoder_GetVelocity(PWM_Timer_t timer)
+{
+    int16_t velocity;
+    uint8_t ea = EA;
+    EA = 0;
+    velocity = pwm_encoder_velocity[timer];
+    EA = ea;
+    return velocity;
+}
+
+/**************************************************************************** /
+ * Three-phase complementary PWM
+*/
+
+// Quarter wave, 0 - 90 degrees in 64 steps
+static __CODE int16_t pwm_3phase_sine[65] = {
+    0, 804, 1608, 2410, 3212, 4011, 4808, 5602,
+    6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+    18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+    27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+    32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767,
+};
+// sin(a) - (max + min) / 2 of the 3 phases, scaled by 2/sqrt(3)
+static __CODE int16_t pwm_3phase_svpwm[65] = {
+    0, 1393, 2785, 4175, 5563, 6947, 8328, 9703,
+    11072, 12435, 13790, 15137, 16475, 17803, 19120, 20426,
+    21719, 22999, 24266, 25517, 26754, 27974, 28641, 29023,
+    29388, 29735, 30064, 30374, 30667, 30941, 31196, 31433,
+    31650, 31849, 32028, 32189, 32329, 32451, 32552, 32634,
+    32697, 32740, 32763, 32766, 32749, 32713, 32657, 32582,
+    32487, 32372, 32238, 32084, 31911, 31719, 31507, 31277,
+    31028, 30760, 30474, 30169, 29846, 29505, 29147, 28771,
+    28377,
+};
+
+static int16_t __CODE *pwm_3phase_table;
+static uint16_t pwm_3phase_period, pwm_3phase_half;
+static int16_t pwm_3phase_gain;
+static uint32_t pwm_3phase_phase, pwm_3phase_step;
+// Phase step of 0.1 Hz in 16.16 fixed point
+static uint32_t pwm_3phase_scale;
+static uint16_t pwm_3phase_scale_frac;
+
+/**
+ * Dead-time generator: DTG[7:5] = 0xx: DTG[7:0] x tCK
+ *                                 10x: (64 + DTG[5:0]) x 2tCK
+ *                                 110: (32 + DTG[4:0]) x 8tCK
+ *                                 111: (32 + DTG[4:0]) x 16tCK
+*/
+static uint8_t PWM_3Phase_DeadTime(uint16_t ticks)
+{
+    if (ticks < 128)
+    {
+        return ticks;
+    }
+    else if (ticks < 255)
+    {
+        return 0x80 | ((ticks + 1) / 2 - 64);
+    }
+    else if (ticks < 505)
+    {
+        return 0xC0 | ((ticks + 7) / 8 - 32);
+    }
+    else if (ticks < 1009)
+    {
+        return 0xE0 | ((ticks + 15) / 16 - 32);
+    }
+    return 0xFF;
+}
+
+void PWM_3Phase_Init(uint16_t frequency, uint16_t deadtime, PWM_3PhaseWave_t wave)
+{
+    uint32_t div = (uint32_t)frequency * 10, rem;
+
+    pwm_3phase_table = (wave == PWM_3PhaseWave_SVPWM)? pwm_3phase_svpwm : pwm_3phase_sine;
+    pwm_3phase_period = SYS_GetSysClock() / 2 / frequency;
+    pwm_3phase_half = pwm_3phase_period / 2;
+    // 2^32 / (frequency * 10), fraction part in two 8-bit steps to avoid overflow
+    pwm_3phase_scale = 0xFFFFFFFF / div;
+    rem = (0xFFFFFFFF % div) << 8;
+    pwm_3phase_scale_frac = (rem / div) << 8;
+    rem = (rem % div) << 8;
+    pwm_3phase_scale_frac |= rem / div;
+    pwm_3phase_phase = 0;
+    pwm_3phase_step = 0;
+    pwm_3phase_gain = 0;
+
+    SFRX_ON();
+    PWMA_CR1 = 0x00;
+    // Outputs off, forced to idle level (low) when MOE = 0
+    PWMA_BKR = 0x0C;
+    PWMA_OISR = 0x00;
+    PWMA_CCER1 = 0x00;
+    PWMA_CCER2 &= 0xF0;
+    // PWM mode 1 with preload
+    PWMA_CCMR1 = 0x68;
+    PWMA_CCMR2 = 0x68;
+    PWMA_CCMR3 = 0x68;
+    // CCxE and CCxNE of PWMA.1 - PWMA.3
+    PWMA_CCER1 = 0x55;
+    PWMA_CCER2 |= 0x05;
+    PWMA_DTR = PWM_3Phase_DeadTime(deadtime);
+    PWMA_PSCRH = 0x00;
+    PWMA_PSCRL = 0x00;
+    PWMA_ARRH = pwm_3phase_period >> 8;
+    PWMA_ARRL = pwm_3phase_period & 0xFF;
+    PWMA_CCR1H = pwm_3phase_half >> 8;
+    PWMA_CCR1L = pwm_3phase_half & 0xFF;
+    PWMA_CCR2H = pwm_3phase_half >> 8;
+    PWMA_CCR2L = pwm_3phase_half & 0xFF;
+    PWMA_CCR3H = pwm_3phase_half >> 8;
+    PWMA_CCR3L = pwm_3phase_half & 0xFF;
+    // Center-aligned mode updates on both overflow and underflow, take one of them
+    PWMA_RCR = 0x01;
+    // Auto-reload preload, center-aligned mode 1
+    PWMA_CR1 = 0xA0;
+    PWMA_EGR = 0x01;
+    PWMA_SR1 = 0x00;
+    PWMA_ENO |= PWM_Pin_1|PWM_Pin_1N|PWM_Pin_2|PWM_Pin_2N|PWM_Pin_3|PWM_Pin_3N;
+    PWMA_IER |= 0x01;
+    PWMA_CR1 |= 0x01;
+    SFRX_OFF();
+}
+
+void PWM_3Phase_SetBreak(HAL_State_t state, HAL_State_t activeHigh)
+{
+    SFRX_ON();
+    PWMA_BKR = PWMA_BKR & ~0x30 | (activeHigh? 0x20 : 0x00) | (state? 0x10 : 0x00);
+    SFRX_OFF();
+}
+
+void PWM_3Phase_SetAdcTrigger(HAL_State_t state, uint16_t lead)
+{
+    uint16_t ccr = (lead < pwm_3phase_period)? pwm_3phase_period - lead : 0;
+    SFRX_ON();
+    if (state)
+    {
+        // PWM mode 2, OC4REF rises when counting up to CCR4
+        PWMA_CCMR4 = 0x78;
+        PWMA_CCR4H = ccr >> 8;
+        PWMA_CCR4L = ccr & 0xFF;
+        // TRGO = OC4REF
+        PWMA_CR2 = PWMA_CR2 & ~0x70 | 0x70;
+    }
+    else
+    {
+        PWMA_CR2 &= ~0x70;
+    }
+    SFRX_OFF();
+    ADC_SetPWMTriggerState(state);
+}
+
+void PWM_3Phase_SetOutput(uint16_t frequency, uint16_t amplitude)
+{
+    uint32_t step = (uint32_t)frequency * pwm_3phase_scale
+        + (((uint32_t)frequency * pwm_3phase_scale_frac) >> 16);
+    int16_t gain = ((uint32_t)amplitude * pwm_3phase_half) >> 16;
+    uint8_t ea = EA;
+    EA = 0;
+    pwm_3phase_step = step;
+    pwm_3phase_gain = gain;
+    EA = ea;
+}
+
+void PWM_3Phase_Start(void)
+{
+    SFRX_ON();
+    PWMA_SR1 &= ~0x80;
+    PWMA_BKR |= 0x80;
+    SFRX_OFF();
+}
+
+void PWM_3Phase_Stop(void)
+{
+    SFRX_ON();
+    PWMA_BKR &= ~0x80;
+    SFRX_OFF();
+}
+
+HAL_State_t PWM_3Phase_IsBroken(void)
+{
+    HAL_State_t broken;
+    SFRX_ON();
+    broken = (PWMA_SR1 & 0x80)? HAL_State_ON : HAL_State_OFF;
+    SFRX_OFF();
+    return broken;
+}
+
+static int16_t PWM_3Phase_Lookup(uint8_t index)
+{
+    uint8_t i = index & 0x3F;
+    int16_t value;
+    if (index & 0x40)
+    {
+        i = 64 - i;
+    }
+    value = pwm_3phase_table[i];
+    return (index & 0x80)? -value : value;
+}
+
+static uint16_t PWM_3Phase_Duty(uint16_t phase)
+{
+    int16_t v0, v1;
+    v0 = PWM_3Phase_Lookup(phase >> 8);
+    v1 = PWM_3Phase_Lookup((uint8_t)((phase >> 8) + 1));
+    // Linear interpolation on 4 bits, fits in 16-bit multiplication
+    v0 += ((v1 - v0) * (int16_t)((phase >> 4) & 0x0F)) >> 4;
+    return pwm_3phase_half + (int16_t)(((int32_t)v0 * pwm_3phase_gain) >> 15);
+}
+
+void PWM_3Phase_IRQHandler(void)
+{
+    uint16_t phase, duty;
+    uint8_t p_sw2 = P_SW2;
+    P_SW2 |= 0x80;
+    PWMA_SR1 &= ~0x01;
+    pwm_3phase_phase += pwm_3phase_step;
+    phase = pwm_3phase_phase >> 16;
+    // Written to preload registers, take effect on next update
+    duty = PWM_3Phase_Duty(phase);
+    PWMA_CCR1H = duty >> 8;
+    PWMA_CCR1L = duty & 0xFF;
+    duty = PWM_3Phase_Duty(phase - 0x5555);
+    PWMA_CCR2H = duty >> 8;
+    PWMA_CCR2L = duty & 0xFF;
+    duty = PWM_3Phase_Duty(phase + 0x5555);
+    PWMA_CCR3H = duty >> 8;
+    PWMA_CCR3L = duty & 0xFF;
+    P_SW2 = p_sw2;
+}
+
+#endif
@@ -0,0 +1,379 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Define the SFR and sbit variables in this file only
+#define __HOST_SIM_DEFINE
+#include "fw_hal.h"
+
+#if defined (__HOST_SIM)
+
+#include <stdio.h>
+#include <string.h>
+
+volatile uint8_t SIM_XDATA[0x10000];
+
+static uint8_t sim_trace;
+static void (*sim_int_handlers[64])(void);
+static uint8_t (*sim_spi_xfer)(uint8_t dat);
+static void (*sim_uart_tx)(uint8_t uart, uint8_t dat);
+static uint16_t sim_adc_values[16];
+
+static uint8_t sim_i2c_addrs[SIM_I2C_MAX_DEVICES];
+static SIM_I2C_Device_t *sim_i2c_devices[SIM_I2C_MAX_DEVICES];
+static SIM_I2C_Device_t *sim_i2c_active;
+static uint8_t sim_i2c_busy, sim_i2c_addressing, sim_i2c_nack;
+
+void SIM_Reset(void)
+{
+    memset((void *)SIM_XDATA, 0, sizeof(SIM_XDATA));
+    memset(sim_int_handlers, 0, sizeof(sim_int_handlers));
+    memset(sim_adc_values, 0, sizeof(sim_adc_values));
+    memset(sim_i2c_devices, 0, sizeof(sim_i2c_devices));
+    sim_spi_xfer = NULL;
+    sim_uart_tx = NULL;
+    sim_i2c_active = NULL;
+    sim_i2c_busy = 0;
+    sim_i2c_addressing = 0;
+    sim_i2c_nack = 0;
+}
+
+void SIM_SetTrace(HAL_State_t state)
+{
+    sim_trace = state;
+}
+
+void SIM_SetIntHandler(uint8_t vector, void (*handler)(void))
+{
+    sim_int_handlers[vector & 0x3F] = handler;
+}
+
+void SIM_RaiseInterrupt(uint8_t vector)
+{
+    if (sim_int_handlers[vector & 0x3F] != NULL)
+    {
+        sim_int_handlers[vector & 0x3F]();
+    }
+}
+
+/**************************************************************************** /
+ * SPI
+*/
+
+void SIM_SPI_SetDevice(uint8_t (*xfer)(uint8_t dat))
+{
+    sim_spi_xfer = xfer;
+}
+
+uint8_t SIM_SPI_Poll(void)
+{
+    uint8_t tx = SPDAT, rx = 0xFF;
+    if (sim_spi_xfer != NULL)
+    {
+        rx = sim_spi_xfer(tx);
+    }
+    if (sim_trace)
+    {
+        fprintf(stderr, "SPI  : %02X > %02X\n", tx, rx);
+    }
+    SPDAT = rx;
+    SPSTAT |= 0x80;
+    return 0x80;
+}
+
+/**************************************************************************** /
+ * UART
+*/
+
+void SIM_UART_SetTxHandler(void (*handler)(uint8_t uart, uint8_t dat))
+{
+    sim_uart_tx = handler;
+}
+
+static void SIM_UART_Transmit(uint8_t uart, uint8_t dat)
+{
+    if (sim_trace)
+    {
+        fprintf(stderr, "UART%d: %02X\n", uart, dat);
+    }
+    if (sim_uart_tx != NULL)
+    {
+        sim_uart_tx(uart, dat);
+    }
+}
+
+void SIM_UART1_Receive(uint8_t dat)
+{
+    SBUF = dat;
+    RI = 1;
+    if (EA && ES)
+    {
+        SIM_RaiseInterrupt(EXTI_VectUART1);
+    }
+}
+
+uint8_t SIM_UART1_Poll(void)
+{
+    SIM_UART_Transmit(1, SBUF);
+    TI = 1;
+    return 1;
+}
+
+uint8_t SIM_UART2_Poll(void)
+{
+    SIM_UART_Transmit(2, S2BUF);
+    S2CON |= 0x02;
+    return 0x02;
+}
+
+/**************************************************************************** /
+ * I2C master
+*/
+
+HAL_StatusTypeDef SIM_I2C_AttachDevice(uint8_t addr, SIM_I2C_Device_t *dev)
+{
+    uint8_t i;
+    for (i = 0; i < SIM_I2C_MAX_DEVICES; i++)
+    {
+        if (sim_i2c_devices[i] == NULL || sim_i2c_addrs[i] == (addr & 0xFE))
+        {
+            sim_i2c_addrs[i] = addr & 0xFE;
+            sim_i2c_devices[i] = dev;
+            return HAL_OK;
+        }
+    }
+    return HAL_ERROR;
+}
+
+static void SIM_I2C_Send(void)
+{
+    uint8_t i, dat = I2CTXD;
+    if (sim_i2c_addressing)
+    {
+        sim_i2c_addressing = 0;
+        sim_i2c_active = NULL;
+        for (i = 0; i < SIM_I2C_MAX_DEVICES; i++)
+        {
+            if (sim_i2c_devices[i] != NULL && sim_i2c_addrs[i] == (dat & 0xFE))
+            {
+                sim_i2c_active = sim_i2c_devices[i];
+            }
+        }
+        sim_i2c_nack = (sim_i2c_active == NULL);
+        if (sim_i2c_active != NULL && sim_i2c_active->Start != NULL)
+        {
+            sim_i2c_active->Start(dat & 0x01);
+        }
+    }
+    else if (sim_i2c_active != NULL)
+    {
+        sim_i2c_nack = (sim_i2c_active->Write != NULL)? sim_i2c_active->Write(dat) : 0;
+    }
+    else
+    {
+        sim_i2c_nack = 1;
+    }
+    if (sim_trace)
+    {
+        fprintf(stderr, " %02X", dat);
+    }
+}
+
+static void SIM_I2C_RxAck(void)
+{
+    I2CMSST = I2CMSST & ~0x02 | (sim_i2c_nack? 0x02 : 0x00);
+    if (sim_trace)
+    {
+        fprintf(stderr, sim_i2c_nack? " N" : " A");
+    }
+}
+
+static void SIM_I2C_Recv(void)
+{
+    I2CRXD = (sim_i2c_active != NULL && sim_i2c_active->Read != NULL)? sim_i2c_active->Read() : 0xFF;
+    if (sim_trace)
+    {
+        fprintf(stderr, " <%02X", I2CRXD);
+    }
+}
+
+static void SIM_I2C_TxAck(uint8_t nack)
+{
+    if (sim_trace)
+    {
+        fprintf(stderr, nack? " N" : " A");
+    }
+}
+
+uint8_t SIM_I2C_Poll(void)
+{
+    switch (I2CMSCR & 0x0F)
+    {
+    case I2C_MasterCmd_StartSendRxAck:
+    case I2C_MasterCmd_Start:
+        sim_i2c_addressing = 1;
+        if (sim_trace)
+        {
+            fprintf(stderr, sim_i2c_busy? " Sr" : "I2C  : S");
+        }
+        sim_i2c_busy = 1;
+        if ((I2CMSCR & 0x0F) == I2C_MasterCmd_Start)
+        {
+            break;
+        }
+        SIM_I2C_Send();
+        SIM_I2C_RxAck();
+        break;
+    case I2C_MasterCmd_Send:
+        SIM_I2C_Send();
+        break;
+    case I2C_MasterCmd_SendRxAck:
+        SIM_I2C_Send();
+        SIM_I2C_RxAck();
+        break;
+    case I2C_MasterCmd_RxAck:
+        SIM_I2C_RxAck();
+        break;
+    case I2C_MasterCmd_Recv:
+        SIM_I2C_Recv();
+        break;
+    case I2C_MasterCmd_TxAck:
+        SIM_I2C_TxAck(I2CMSST & 0x01);
+        break;
+    case I2C_MasterCmd_RecvTxAck0:
+        SIM_I2C_Recv();
+        SIM_I2C_TxAck(0);
+        break;
+    case I2C_MasterCmd_RecvNAck:
+        SIM_I2C_Recv();
+        SIM_I2C_TxAck(1);
+        break;
+    case I2C_MasterCmd_Stop:
+        if (sim_i2c_active != NULL && sim_i2c_active->Stop != NULL)
+        {
+            sim_i2c_active->Stop();
+        }
+        sim_i2c_active = NULL;
+        sim_i2c_busy = 0;
+        if (sim_trace)
+        {
+            fprintf(stderr, " P\n");
+        }
+        break;
+    default:
+        break;
+    }
+    I2CMSCR &= ~0x0F;
+    I2CMSST |= 0x40;
+    return 0x40;
+}
+
+/**************************************************************************** /
+ * ADC
+*/
+
+void SIM_ADC_SetValue(uint8_t channel, uint16_t value)
+{
+    sim_adc_values[channel & 0x0F] = value & 0x0FFF;
+}
+
+uint8_t SIM_ADC_Poll(void)
+{
+    uint16_t value = sim_adc_values[ADC_CONTR & 0x0F];
+    if (ADCCFG & (0x01 << 5))
+    {
+        ADC_RES = value >> 8;
+        ADC_RESL = value & 0xFF;
+    }
+    else
+    {
+        ADC_RES = value >> 4;
+        ADC_RESL = (value << 4) & 0xF0;
+    }
+    if (sim_trace)
+    {
+        fprintf(stderr, "ADC  : CH%d %03X\n", ADC_CONTR & 0x0F, value);
+    }
+    ADC_CONTR = ADC_CONTR & ~(0x01 << 6) | (0x01 << 5);
+    return 0x20;
+}
+
+/**************************************************************************** /
+ * LCM
+*/
+
+#if (__CONF_MCU_TYPE == 3)
+uint8_t SIM_LCM_Poll(void)
+{
+    if (sim_trace)
+    {
+        switch (LCMIFCR & 0x07)
+        {
+        case LCM_Cmd_WriteCmd:
+            fprintf(stderr, "LCM  : C %02X%02X\n", LCMIDDATH, LCMIDDATL);
+            break;
+        case LCM_Cmd_WriteData:
+            fprintf(stderr, "LCM  : D %02X%02X\n", LCMIDDATH, LCMIDDATL);
+            break;
+        default:
+            fprintf(stderr, "LCM  : R\n");
+            break;
+        }
+    }
+    LCMIFSTA |= 0x01;
+    return 0x01;
+}
+#endif
+
+/**************************************************************************** /
+ * Timer
+*/
+
+void SIM_TIM_Overflow(uint8_t timer)
+{
+    switch (timer)
+    {
+    case 0:
+        TF0 = 1;
+        if (EA && ET0)
+        {
+            TF0 = 0;
+            SIM_RaiseInterrupt(EXTI_VectTimer0);
+        }
+        break;
+    case 1:
+        TF1 = 1;
+        if (EA && ET1)
+        {
+            TF1 = 0;
+            SIM_RaiseInterrupt(EXTI_VectTimer1);
+        }
+        break;
+    case 2:
+        AUXINTIF |= 0x01;
+        if (EA && (IE2 & (0x01 << 2))) SIM_RaiseInterrupt(EXTI_VectTimer2);
+        break;
+    case 3:
+        AUXINTIF |= 0x02;
+        if (EA && (IE2 & (0x01 << 5))) SIM_RaiseInterrupt(EXTI_VectTimer3);
+        break;
+    case 4:
+        AUXINTIF |= 0x04;
+        if (EA && (IE2 & (0x01 << 6))) SIM_RaiseInterrupt(EXTI_VectTimer4);
+        break;
+    default:
+        break;
+    }
+}
+
+#endif
@@ -0,0 +1,270 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "fw_softspi.h"
+
+#if defined (SOFTSPI_MISO_PIN)
+#define SOFTSPI_IN_PIN          SOFTSPI_MISO_PIN
+#else
+#define SOFTSPI_IN_PIN          SOFTSPI_MOSI_PIN
+#endif
+
+#if defined (SDCC) || defined (__SDCC)
+
+/**
+ * Bit symbols of the pins for inline assembly, e.g. GPIO_PIN(3, 2) -> _P32.
+ * The byte is shifted through carry, the leading bit is shifted out before the
+ * first clock and the sampled bit is shifted in after each clock.
+*/
+#define SOFTSPI_ASM_BIT_(__PORT__, __BIT__)     _P##__PORT__##__BIT__
+#define SOFTSPI_ASM_BIT(__PIN__)                SOFTSPI_ASM_BIT_(__PIN__)
+#define SOFTSPI_ASM_SCK                         SOFTSPI_ASM_BIT(SOFTSPI_SCK_PIN)
+#define SOFTSPI_ASM_MOSI                        SOFTSPI_ASM_BIT(SOFTSPI_MOSI_PIN)
+#define SOFTSPI_ASM_MISO                        SOFTSPI_ASM_BIT(SOFTSPI_IN_PIN)
+#if (SOFTSPI_LSB_FIRST == 1)
+#define SOFTSPI_ASM_SHIFT                       rrc
+#else
+#define SOFTSPI_ASM_SHIFT                       rlc
+#endif
+
+void SOFTSPI_Tx(uint8_t dat) __naked
+{
+    dat; // In DPL
+    __asm
+        mov     a, dpl
+        SOFTSPI_ASM_SHIFT a
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        clr     SOFTSPI_ASM_SCK
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        clr     SOFTSPI_ASM_SCK
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        clr     SOFTSPI_ASM_SCK
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        clr     SOFTSPI_ASM_SCK
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        clr     SOFTSPI_ASM_SCK
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        clr     SOFTSPI_ASM_SCK
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        clr     SOFTSPI_ASM_SCK
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        nop
+        clr     SOFTSPI_ASM_SCK
+        ret
+    __endasm;
+}
+
+uint8_t SOFTSPI_Rx(void) __naked
+{
+    __asm
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        mov     dpl, a
+        ret
+    __endasm;
+}
+
+#if defined (SOFTSPI_MISO_PIN)
+uint8_t SOFTSPI_TxRx(uint8_t dat) __naked
+{
+    dat; // In DPL
+    __asm
+        mov     a, dpl
+        SOFTSPI_ASM_SHIFT a
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        mov     SOFTSPI_ASM_MOSI, c
+        setb    SOFTSPI_ASM_SCK
+        mov     c, SOFTSPI_ASM_MISO
+        clr     SOFTSPI_ASM_SCK
+        SOFTSPI_ASM_SHIFT a
+        mov     dpl, a
+        ret
+    __endasm;
+}
+#endif
+
+#else
+
+#if (SOFTSPI_LSB_FIRST == 1)
+#define SOFTSPI_BIT(__N__)      (0x01 << (__N__))
+#else
+#define SOFTSPI_BIT(__N__)      (0x80 >> (__N__))
+#endif
+
+#define SOFTSPI_TX_BIT(__MASK__)    do {                \
+        PIN_WRITE(SOFTSPI_MOSI_PIN, dat & (__MASK__));  \
+        PIN_SET(SOFTSPI_SCK_PIN);                       \
+        PIN_CLR(SOFTSPI_SCK_PIN);                       \
+    } while(0)
+
+#define SOFTSPI_RX_BIT(__MASK__)    do {                \
+        PIN_SET(SOFTSPI_SCK_PIN);                       \
+        if (PIN_READ(SOFTSPI_IN_PIN)) rx |= (__MASK__); \
+        PIN_CLR(SOFTSPI_SCK_PIN);                       \
+    } while(0)
+
+#define SOFTSPI_TXRX_BIT(__MASK__)  do {                \
+        PIN_WRITE(SOFTSPI_MOSI_PIN, dat & (__MASK__));  \
+        SOFTSPI_RX_BIT(__MASK__);                       \
+    } while(0)
+
+void SOFTSPI_Tx(uint8_t dat)
+{
+    SOFTSPI_TX_BIT(SOFTSPI_BIT(0));
+    SOFTSPI_TX_BIT(SOFTSPI_BIT(1));
+    SOFTSPI_TX_BIT(SOFTSPI_BIT(2));
+    SOFTSPI_TX_BIT(SOFTSPI_BIT(3));
+    SOFTSPI_TX_BIT(SOFTSPI_BIT(4));
+    SOFTSPI_TX_BIT(SOFTSPI_BIT(5));
+    SOFTSPI_TX_BIT(SOFTSPI_BIT(6));
+    SOFTSPI_TX_BIT(SOFTSPI_BIT(7));
+}
+
+uint8_t SOFTSPI_Rx(void)
+{
+    uint8_t rx = 0;
+    SOFTSPI_RX_BIT(SOFTSPI_BIT(0));
+    SOFTSPI_RX_BIT(SOFTSPI_BIT(1));
+    SOFTSPI_RX_BIT(SOFTSPI_BIT(2));
+    SOFTSPI_RX_BIT(SOFTSPI_BIT(3));
+    SOFTSPI_RX_BIT(SOFTSPI_BIT(4));
+    SOFTSPI_RX_BIT(SOFTSPI_BIT(5));
+    SOFTSPI_RX_BIT(SOFTSPI_BIT(6));
+    SOFTSPI_RX_BIT(SOFTSPI_BIT(7));
+    return rx;
+}
+
+#if defined (SOFTSPI_MISO_PIN)
+uint8_t SOFTSPI_TxRx(uint8_t dat)
+{
+    uint8_t rx = 0;
+    SOFTSPI_TXRX_BIT(SOFTSPI_BIT(0));
+    SOFTSPI_TXRX_BIT(SOFTSPI_BIT(1));
+    SOFTSPI_TXRX_BIT(SOFTSPI_BIT(2));
+    SOFTSPI_TXRX_BIT(SOFTSPI_BIT(3));
+    SOFTSPI_TXRX_BIT(SOFTSPI_BIT(4));
+    SOFTSPI_TXRX_BIT(SOFTSPI_BIT(5));
+    SOFTSPI_TXRX_BIT(SOFTSPI_BIT(6));
+    SOFTSPI_TXRX_BIT(SOFTSPI_BIT(7));
+    return rx;
+}
+#endif
+
+#endif
+
+void SOFTSPI_Init(void)
+{
+    PIN_CLR(SOFTSPI_SCK_PIN);
+    PIN_SetMode(SOFTSPI_SCK_PIN, GPIO_Mode_Output_PP);
+    PIN_SetMode(SOFTSPI_MOSI_PIN, GPIO_Mode_Output_PP);
+#if defined (SOFTSPI_MISO_PIN)
+    PIN_SetMode(SOFTSPI_MISO_PIN, GPIO_Mode_Input_HIP);
+#endif
+}
+
+void SOFTSPI_Write(const uint8_t *buf, uint8_t len)
+{
+    while (len--)
+    {
+        SOFTSPI_Tx(*buf++);
+    }
+}
+
+void SOFTSPI_Read(uint8_t *buf, uint8_t len)
+{
+    while (len--)
+    {
+        *buf++ = SOFTSPI_Rx();
+    }
+}
@@ -21,6 +21,8 @@
 */
 #if defined (__SDCC_SYNTAX_FIX)
     #define __CLK_REF 10000
+#elif defined (__HOST_SIM)
+    #define __CLK_REF 10000
 #elif defined (SDCC) || defined (__SDCC)
     #define __CLK_REF 9000
 #elif defined __CX51__
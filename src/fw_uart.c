@@ -76,7 +76,7 @@ void UART1_Config9bitUart(UART1_BaudSource_t baudSource, HAL_State_t _1TMode, ui
 void UART1_TxChar(char dat)
 {
     UART1_WriteBuffer(dat);
-    while(!TI);
+    while(!UART1_TxFinished());
     UART1_ClearTxInterrupt();
 }
 
@@ -93,7 +93,7 @@ void UART1_TxString(uint8_t *str)
 
 int putchar(int dat) {
     UART1_WriteBuffer(dat);
-    while(!TI);
+    while(!UART1_TxFinished());
     UART1_ClearTxInterrupt();
     return dat;
 }
@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+# Copyright 2021 IOsetting <iosetting(at)outlook.com>
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Encode audio into __CODE tables for playback with fw_audio codecs.
+
+Input is a mono or stereo WAV file (8/16-bit), a raw 8-bit unsigned file, or
+a C source with an uint8_t array of 8-bit unsigned samples. Output is a .c/.h
+pair, the .h defines <NAME>_FORMAT, <NAME>_RATE and <NAME>_SAMPLES.
+
+  IMA-ADPCM  4 bits/sample, low nibble first, same algorithm as src/fw_audio.c
+  u-law      8 bits/sample, G.711
+  pcm8       8 bits/sample, unsigned
+
+Usage:
+  python3 tools/audio_encode.py voice.wav -f adpcm -r 8000 -n voice -o demo/pwm/pwm_dac_voice/voice
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import wave
+
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+    12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+]
+FORMATS = {'pcm8': 'AUDIO_Format_PCM8', 'ulaw': 'AUDIO_Format_ULaw', 'adpcm': 'AUDIO_Format_IMA_ADPCM'}
+
+
+def read_input(path, rate):
+    """
+    Returns (samples as signed 16-bit, sample rate)
+    """
+    if path.endswith('.wav'):
+        with wave.open(path) as w:
+            width, channels, rate = w.getsampwidth(), w.getnchannels(), w.getframerate()
+            frames = w.readframes(w.getnframes())
+        if width == 1:
+            data = [(b - 128) << 8 for b in frames]
+        elif width == 2:
+            data = list(struct.unpack('<%dh' % (len(frames) // 2), frames))
+        else:
+            sys.exit('only 8-bit and 16-bit WAV are supported')
+        return [sum(data[i:i + channels]) // channels for i in range(0, len(data), channels)], rate
+    if path.endswith('.c'):
+        with open(path) as f:
+            text = f.read()
+        data = [int(n) for n in re.findall(r'\d+', text[text.index('{'):])]
+    else:
+        with open(path, 'rb') as f:
+            data = list(f.read())
+    if rate is None:
+        sys.exit('--input-rate is required for raw and C array input')
+    return [(b - 128) << 8 for b in data], rate
+
+
+def resample(samples, src_rate, dst_rate):
+    if src_rate == dst_rate:
+        return samples
+    out, n = [], int(len(samples) * dst_rate / src_rate)
+    for i in range(n):
+        pos = i * src_rate / dst_rate
+        j = int(pos)
+        k = min(j + 1, len(samples) - 1)
+        out.append(int(samples[j] + (samples[k] - samples[j]) * (pos - j)))
+    return out
+
+
+def adpcm_encode(samples):
+    predictor, index, codes = 0, 0, []
+    for sample in samples:
+        step = STEP_TABLE[index]
+        delta = sample - predictor
+        code = 0
+        if delta < 0:
+            code, delta = 0x08, -delta
+        diff = min(delta, 0xFFFF)
+        if diff >= step:
+            code |= 0x04
+            diff -= step
+        if diff >= step >> 1:
+            code |= 0x02
+            diff -= step >> 1
+        if diff >= step >> 2:
+            code |= 0x01
+        # Same update as decoder
+        diff = step >> 3
+        if code & 0x04:
+            diff += step
+        if code & 0x02:
+            diff += step >> 1
+        if code & 0x01:
+            diff += step >> 2
+        predictor = max(predictor - diff, -32768) if code & 0x08 else min(predictor + diff, 32767)
+        index = min(max(index + INDEX_TABLE[code], 0), 88)
+        codes.append(code)
+    if len(codes) % 2:
+        codes.append(0)
+    return bytes(codes[i] | (codes[i + 1] << 4) for i in range(0, len(codes), 2))
+
+
+def ulaw_encode(samples):
+    out = []
+    for sample in samples:
+        sign = 0x80 if sample < 0 else 0
+        magnitude = min(min(-sample, 32767) if sign else sample, 32635) + 0x84
+        exponent = 7
+        while exponent > 0 and not magnitude & (0x4000 >> (7 - exponent)):
+            exponent -= 1
+        out.append(~(sign | (exponent << 4) | ((magnitude >> (exponent + 3)) & 0x0F)) & 0xFF)
+    return bytes(out)
+
+
+def pcm8_encode(samples):
+    return bytes(((s >> 8) + 128) & 0xFF for s in samples)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    parser.add_argument('input')
+    parser.add_argument('-f', '--format', choices=FORMATS.keys(), default='adpcm')
+    parser.add_argument('-r', '--rate', type=int, help='output sample rate, default: same as input')
+    parser.add_argument('--input-rate', type=int, help='sample rate of raw and C array input')
+    parser.add_argument('-n', '--name', default='voice', help='C identifier prefix')
+    parser.add_argument('-o', '--output', required=True, help='output path without extension')
+    args = parser.parse_args()
+
+    samples, rate = read_input(args.input, args.input_rate)
+    if args.rate:
+        samples, rate = resample(samples, rate, args.rate), args.rate
+    data = {'adpcm': adpcm_encode, 'ulaw': ulaw_encode, 'pcm8': pcm8_encode}[args.format](samples)
+
+    name, upper = args.name, args.name.upper()
+    header = os.path.basename(args.output) + '.h'
+    with open(args.output + '.h', 'w') as f:
+        f.write('#ifndef __%s_H__\n#define __%s_H__\n\n' % (upper, upper))
+        f.write('#include "fw_hal.h"\n#include "fw_audio.h"\n\n')
+        f.write('#define %s_FORMAT     %s\n' % (upper, FORMATS[args.format]))
+        f.write('#define %s_RATE       %d\n' % (upper, rate))
+        f.write('#define %s_SAMPLES    %d\n\n' % (upper, len(samples)))
+        f.write('extern __CODE uint8_t %s_bulk[%d];\n\n#endif\n' % (name, len(data)))
+    with open(args.output + '.c', 'w') as f:
+        f.write('#include "%s"\n\n' % header)
+        f.write('// %d samples, %d Hz, %s, generated by tools/audio_encode.py\n' % (len(samples), rate, args.format))
+        f.write('__CODE uint8_t %s_bulk[%d] = {\n' % (name, len(data)))
+        for i in range(0, len(data), 16):
+            f.write('    ' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',\n')
+        f.write('};\n')
+    print('%s: %d samples at %d Hz, %d bytes' % (args.format, len(samples), rate, len(data)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,314 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/***
+ * Host simulation of the changed span updates of the ST7567, PCD8544 and SSD1306 drivers
+ *
+ * The display is replaced by a model of its RAM that decodes the page and column
+ * address commands and stores the data bytes. The RAM starts with garbage. After each
+ * UpdateScreen the RAM must match the frame buffer of the driver, and an update without
+ * changes must not send any data. PCD8544_clear() must make the next update send the
+ * drawing again. Prints the bytes sent per update, exits with the
+ * number of failed checks.
+ *
+ *   ST7567:      gcc -std=gnu99 -D__HOST_SIM -D__CONF_MCU_MODEL=MCU_MODEL_STC8H3K32S2 -Iinclude \
+ *                    -Idemo/spi/st7567 -Idemo/spi/pcd8544_nokia5110_lcd -Idemo/i2c/ssd1306 \
+ *                    tools/display_ram_sim.c src/fw_[a-z]*.c -o display_ram_sim
+ *   PCD8544:     add -DSIM_DISPLAY_PCD8544
+ *   SSD1306:     add -DSIM_DISPLAY_SSD1306
+ */
+
+#include <stdio.h>
+
+#if defined (SIM_DISPLAY_PCD8544)
+
+#include "pcd8544.c"
+
+#define SIM_WIDTH               PCD8544_WIDTH
+#define SIM_PAGES               PCD8544_PAGES
+#define SIM_BUFFER              PCD8544_Buffer
+#define SIM_Update()            PCD8544_UpdateScreen()
+#define SIM_Fill(__C__)         PCD8544_Fill(__C__)
+#define SIM_DrawPixel           PCD8544_DrawPixel
+#define SIM_DrawLine            PCD8544_DrawLine
+#define SIM_GotoXY              PCD8544_GotoXY
+#define SIM_Puts                PCD8544_Puts
+
+static uint8_t sim_ram[SIM_PAGES][SIM_WIDTH], sim_page, sim_col, sim_ext;
+static long sim_bytes, sim_data;
+
+/**
+ * Horizontal addressing, X and Y are only set with the basic instruction set
+*/
+static uint8_t SIM_Xfer(uint8_t dat)
+{
+    sim_bytes++;
+    if (PCD8544_DC)
+    {
+        sim_data++;
+        sim_ram[sim_page][sim_col] = dat;
+        if (++sim_col == SIM_WIDTH)
+        {
+            sim_col = 0;
+            sim_page = (sim_page + 1) % SIM_PAGES;
+        }
+    }
+    else if ((dat & 0xF8) == PCD8544_FUNCTIONSET)
+    {
+        sim_ext = dat & PCD8544_EXT_INSTRUCTION;
+    }
+    else if (!sim_ext && (dat & 0x80))
+    {
+        sim_col = dat & 0x7F;
+    }
+    else if (!sim_ext && (dat & 0xF8) == PCD8544_SET_YADDR)
+    {
+        sim_page = dat & 0x07;
+    }
+    return 0;
+}
+
+static void SIM_Init(void)
+{
+    SIM_SPI_SetDevice(SIM_Xfer);
+    PCD8544_Init();
+}
+
+#elif defined (SIM_DISPLAY_SSD1306)
+
+#include "ssd1306.c"
+
+#define SIM_WIDTH               SSD1306_WIDTH
+#define SIM_PAGES               (SSD1306_HEIGHT / 8)
+#define SIM_BUFFER              SSD1306_Buffer_all
+#define SIM_Update()            SSD1306_UpdateScreen()
+#define SIM_Fill(__C__)         SSD1306_Fill(__C__)
+#define SIM_DrawPixel           SSD1306_DrawPixel
+#define SIM_DrawLine            SSD1306_DrawLine
+
+static uint8_t sim_ram[SIM_PAGES][SIM_WIDTH], sim_page, sim_col;
+static uint8_t sim_c0, sim_c1 = SIM_WIDTH - 1, sim_p0, sim_p1 = SIM_PAGES - 1;
+static uint8_t sim_first, sim_ctrl, sim_cmd[3], sim_ncmd;
+static long sim_bytes, sim_data;
+
+static void SIM_Start(uint8_t rw)
+{
+    (void)rw;
+    sim_first = 1;
+    sim_ncmd = 0;
+}
+
+/**
+ * Control byte first, then commands or data, 0x21/0x22 set the column and page window
+*/
+static uint8_t SIM_Write(uint8_t dat)
+{
+    sim_bytes++;
+    if (sim_first)
+    {
+        sim_first = 0;
+        sim_ctrl = dat;
+    }
+    else if (sim_ctrl == 0x00)
+    {
+        sim_cmd[sim_ncmd++] = dat;
+        if (sim_cmd[0] != 0x21 && sim_cmd[0] != 0x22)
+        {
+            sim_ncmd = 0;
+        }
+        else if (sim_ncmd == 3)
+        {
+            if (sim_cmd[0] == 0x21)
+            {
+                sim_c0 = sim_cmd[1];
+                sim_c1 = sim_cmd[2];
+                sim_col = sim_c0;
+            }
+            else
+            {
+                sim_p0 = sim_cmd[1];
+                sim_p1 = sim_cmd[2];
+                sim_page = sim_p0;
+            }
+            sim_ncmd = 0;
+        }
+    }
+    else
+    {
+        sim_data++;
+        sim_ram[sim_page][sim_col] = dat;
+        if (sim_col++ == sim_c1)
+        {
+            sim_col = sim_c0;
+            sim_page = (sim_page == sim_p1)? sim_p0 : sim_page + 1;
+        }
+    }
+    return 0;
+}
+
+static SIM_I2C_Device_t sim_dev = {SIM_Start, SIM_Write, NULL, NULL};
+
+static void SIM_Init(void)
+{
+    SIM_I2C_AttachDevice(SSD1306_I2C_ADDR, &sim_dev);
+    I2C_SetWorkMode(I2C_WorkMode_Master);
+    I2C_SetEnabled(HAL_State_ON);
+    SSD1306_Init();
+}
+
+#else
+
+#include "st7567.c"
+
+#define SIM_WIDTH               ST7567_WIDTH
+#define SIM_PAGES               ST7567_PAGES
+#define SIM_BUFFER              ST7567_Buffer_all
+#define SIM_Update()            ST7567_UpdateScreen()
+#define SIM_Fill(__C__)         ST7567_Fill(__C__)
+#define SIM_DrawPixel           ST7567_DrawPixel
+#define SIM_DrawLine            ST7567_DrawLine
+#define SIM_GotoXY              ST7567_GotoXY
+#define SIM_Puts                ST7567_Puts
+
+// The controller has 132 columns, the panel shows the first 128
+static uint8_t sim_ram[SIM_PAGES][132], sim_page, sim_col, sim_ev;
+static long sim_bytes, sim_data;
+
+/**
+ * Page and column address commands, the byte after SET_EV is its value
+*/
+static uint8_t SIM_Xfer(uint8_t dat)
+{
+    sim_bytes++;
+    if (ST7567_DC)
+    {
+        sim_data++;
+        if (sim_col < sizeof(sim_ram[0]))
+        {
+            sim_ram[sim_page][sim_col++] = dat;
+        }
+    }
+    else if (sim_ev)
+    {
+        sim_ev = 0;
+    }
+    else if (dat == ST7567_SET_EV)
+    {
+        sim_ev = 1;
+    }
+    else if ((dat & 0xF0) == ST7567_SET_PAGE_ADDRESS)
+    {
+        sim_page = dat & ST7567_SET_PAGE_ADDRESS_MASK;
+    }
+    else if ((dat & 0xF0) == ST7567_SET_COLUMN_ADDRESS_MSB)
+    {
+        sim_col = (sim_col & 0x0F) | ((dat & 0x0F) << 4);
+    }
+    else if ((dat & 0xF0) == ST7567_SET_COLUMN_ADDRESS_LSB)
+    {
+        sim_col = (sim_col & 0xF0) | (dat & 0x0F);
+    }
+    return 0;
+}
+
+static void SIM_Init(void)
+{
+    SIM_SPI_SetDevice(SIM_Xfer);
+    ST7567_Init();
+}
+
+#endif
+
+static int sim_failed;
+
+static void SIM_Check(int ok, const char *what, long v)
+{
+    if (!ok)
+    {
+        printf("FAIL %s %ld\n", what, v);
+        sim_failed++;
+    }
+}
+
+/**
+ * Send the changes, the display RAM must match the buffer. Prints the bytes sent since
+ * the last check, returns the data bytes among them
+*/
+static long SIM_Update_Check(const char *what)
+{
+    uint8_t page, x;
+    long data, mismatch = 0;
+
+    SIM_Update();
+    for (page = 0; page < SIM_PAGES; page++)
+    {
+        for (x = 0; x < SIM_WIDTH; x++)
+        {
+            mismatch += sim_ram[page][x] != SIM_BUFFER[page * SIM_WIDTH + x];
+        }
+    }
+    printf("%-24s %5ld bytes, %5ld data", what, sim_bytes, sim_data);
+    puts("");
+    SIM_Check(mismatch == 0, what, mismatch);
+    data = sim_data;
+    sim_bytes = 0;
+    sim_data = 0;
+    return data;
+}
+
+int main(void)
+{
+    memset(sim_ram, 0x55, sizeof(sim_ram));
+    SIM_Init();
+    SIM_Fill(0);
+    SIM_Check(SIM_Update_Check("init, full frame") >= SIM_PAGES * SIM_WIDTH,
+        "init sends a full frame", 0);
+    SIM_Check(SIM_Update_Check("no change") == 0, "no change sends nothing", 0);
+
+#if defined (SIM_GotoXY)
+    SIM_GotoXY(0, 0);
+    SIM_Puts("Temp 21.5C", &Font_5x7, 1);
+    SIM_Update_Check("text");
+    SIM_GotoXY(0, 0);
+    SIM_Puts("Temp 21.5C", &Font_5x7, 1);
+    SIM_Check(SIM_Update_Check("same text") == 0, "same text sends nothing", 0);
+    SIM_GotoXY(30, 0);
+    SIM_Puts("3", &Font_5x7, 1);
+    SIM_Update_Check("one digit");
+#endif
+    SIM_DrawLine(3, 5, 60, 40, 1);
+    SIM_Update_Check("line");
+    SIM_DrawLine(0, 20, SIM_WIDTH - 1, 20, 1);
+    SIM_Update_Check("horizontal line");
+    SIM_DrawPixel(SIM_WIDTH - 1, SIM_PAGES * 8 - 1, 1);
+    SIM_Update_Check("pixel");
+
+#if defined (SIM_DISPLAY_PCD8544)
+    // clear() blanks the display RAM behind the buffer, the same drawing must be sent again
+    PCD8544_clear();
+    SIM_DrawPixel(SIM_WIDTH - 1, SIM_PAGES * 8 - 1, 1);
+    SIM_Update_Check("clear, same drawing");
+#elif defined (SIM_DISPLAY_SSD1306)
+    SSD1306_ToggleInvert();
+    SIM_Update_Check("invert");
+#endif
+
+    SIM_Fill(0);
+    SIM_Update_Check("fill back");
+    SIM_Fill(1);
+    SIM_Update_Check("fill front");
+    printf("%s, %d failed\n", sim_failed? "FAIL" : "PASS", sim_failed);
+    return sim_failed;
+}
@@ -0,0 +1,190 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/***
+ * Host simulation of the multiple-ds18b20 bus manager on the UART 1-Wire transport
+ *
+ * Bus of 5 devices: four DS18B20 at 12 and 10 bits, one DS18S20 (family 0x10) that
+ * must be skipped. EEPROM is a 4 KB array behind the IAP macros. Checks the first
+ * search and table save, a round, SetResolution, a startup that loads the table
+ * without writing EEPROM, a removed sensor, and a corrupt table that must trigger a
+ * new search. Runs with and without DMA batches, exits with the number of failed
+ * checks.
+ *
+ *   gcc -std=gnu99 -D__HOST_SIM -D__CONF_MCU_MODEL=MCU_MODEL_STC8H8K64U -Iinclude -Isrc \
+ *       -Idemo/gpio/ds18b20/multiple-ds18b20 tools/ds18b20_bus_sim.c \
+ *       $(ls src/fw_[a-z]*.c | grep -v onewire) -o ds18b20_bus_sim
+ */
+
+#define DS18B20_USE_ONEWIRE     1
+
+#include "fw_hal.h"
+#include "fw_onewire.c"
+#include "onewire_model.h"
+
+static uint8_t sim_eeprom[4096];
+static int sim_eeprom_writes;
+
+#undef IAP_CmdRead
+#undef IAP_CmdWrite
+#undef IAP_CmdErase
+#define IAP_CmdRead(__ADDR__)   (IAP_DATA = sim_eeprom[__ADDR__])
+#define IAP_CmdWrite(__ADDR__)  (sim_eeprom[__ADDR__] &= IAP_DATA, sim_eeprom_writes++)
+#define IAP_CmdErase(__ADDR__)  memset(sim_eeprom + ((__ADDR__) & ~511), 0xFF, 512)
+
+// Blocking waits of the driver play the bus
+#define OW_Wait()               (SIM_OW_Run(), OW_GetStatus())
+
+#include "ds18b20.c"
+#include "ds18b20_bus.c"
+
+#define SIM_DEVICES     5
+
+static __CODE uint8_t sim_roms[SIM_DEVICES][7] = {
+    {0x28, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66},
+    {0x28, 0x11, 0x22, 0x33, 0x44, 0x55, 0x67},
+    {0x28, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x10, 0xAB, 0xCD, 0xEF, 0x01, 0x23, 0x45},
+    {0x28, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06},
+};
+// Table order is the search order, LSB first: device 2, 4, 0, 1
+static __CODE uint8_t sim_order[4] = {2, 4, 0, 1};
+static int sim_failed;
+
+static void SIM_Check(int ok, const char *what, int dma)
+{
+    if (!ok)
+    {
+        printf("FAIL dma %d: %s\n", dma, what);
+        sim_failed++;
+    }
+}
+
+static void SIM_SetRom(uint8_t i)
+{
+    sim_ow_dev[i].rom[7] = SIM_OW_Crc8(sim_ow_dev[i].rom, 7);
+}
+
+static void SIM_SetConfig(uint8_t i, uint8_t config)
+{
+    sim_ow_dev[i].sp[4] = config;
+    sim_ow_dev[i].sp[8] = SIM_OW_Crc8(sim_ow_dev[i].sp, 8);
+}
+
+static void SIM_Devices(void)
+{
+    uint8_t i;
+    sim_ow_count = SIM_DEVICES;
+    for (i = 0; i < SIM_DEVICES; i++)
+    {
+        memcpy(sim_ow_dev[i].rom, sim_roms[i], 7);
+        SIM_SetRom(i);
+        sim_ow_dev[i].sp[2] = 0x4B;
+        sim_ow_dev[i].sp[3] = 0x46;
+        sim_ow_dev[i].sp[5] = 0xFF;
+        sim_ow_dev[i].sp[6] = 0x0C;
+        sim_ow_dev[i].sp[7] = 0x10;
+        SIM_SetConfig(i, (i == 4)? 0x3F : 0x7F);
+        sim_ow_dev[i].temp = 0x0191 + i * 0x10 - ((i == 2)? 0x300 : 0);
+    }
+}
+
+/**
+ * One round, returns the status bits of the sensors, bit set for HAL_OK, and checks
+ * the readings against the device temperatures at their resolution
+*/
+static uint8_t SIM_Round(int dma)
+{
+    uint8_t i, ok = 0, shift;
+    uint16_t polls = 0;
+    int16_t raw;
+
+    sim_ow_bytes = 0;
+    SIM_Check(DS18B20_Bus_Start() == HAL_OK, "round start", dma);
+    while (DS18B20_Bus_Process() == HAL_BUSY)
+    {
+        polls++;
+    }
+    for (i = 0; i < DS18B20_Bus_GetCount(); i++)
+    {
+        if (DS18B20_Bus_GetTemperature(i, &raw) != HAL_OK)
+        {
+            continue;
+        }
+        ok |= 1 << i;
+        shift = 12 - DS18B20_Bus_GetResolution(i);
+        SIM_Check(raw == (sim_ow_dev[sim_order[i]].temp & ~((1 << shift) - 1)),
+            "temperature masked to the resolution", dma);
+    }
+    printf("dma %d: round %u polls, %ld slots\n", dma, polls, sim_ow_bytes);
+    return ok;
+}
+
+static void SIM_Bus(int dma)
+{
+    uint8_t i, rom[8];
+
+    memset(sim_eeprom, 0xFF, sizeof(sim_eeprom));
+    SIM_Devices();
+    OW_UART_Init(dma? HAL_State_ON : HAL_State_OFF);
+
+    // Empty EEPROM: search, skip the DS18S20, keep the 10-bit sensor at 10 bits
+    sim_eeprom_writes = 0;
+    SIM_Check(DS18B20_Bus_Init() == 4, "first init finds 4 DS18B20", dma);
+    SIM_Check(sim_eeprom_writes > 0, "first init saves the table", dma);
+    for (i = 0; i < DS18B20_Bus_GetCount(); i++)
+    {
+        DS18B20_Bus_GetRom(i, rom);
+        SIM_Check(memcmp(rom, sim_ow_dev[sim_order[i]].rom, 8) == 0, "table order", dma);
+        SIM_Check(DS18B20_Bus_GetResolution(i) ==
+            ((sim_order[i] == 4)? DS18B20_Resolution_10bits : DS18B20_Resolution_12bits),
+            "resolution read from the sensor", dma);
+    }
+    SIM_Check(SIM_Round(dma) == 0x0F, "round 1 reads all sensors", dma);
+
+    SIM_Check(DS18B20_Bus_SetResolution(0, DS18B20_Resolution_10bits) == HAL_OK,
+        "set resolution", dma);
+    SIM_Check(sim_ow_dev[2].sp[4] == 0x3F, "config written to the sensor", dma);
+    SIM_Check(DS18B20_Bus_SetResolution(9, DS18B20_Resolution_10bits) != HAL_OK,
+        "set resolution out of range", dma);
+    SIM_Check(SIM_Round(dma) == 0x0F, "round 2 reads all sensors", dma);
+
+    // Power cycle: sensor back at 12 bits, table restores 10 bits without a save
+    SIM_SetConfig(2, 0x7F);
+    sim_eeprom_writes = 0;
+    SIM_Check(DS18B20_Bus_Init() == 4, "init from table", dma);
+    SIM_Check(sim_eeprom_writes == 0, "init from table doesn't write EEPROM", dma);
+    SIM_Check(DS18B20_Bus_GetResolution(0) == DS18B20_Resolution_10bits
+        && sim_ow_dev[2].sp[4] == 0x3F, "table resolution restored", dma);
+
+    // Sensor 1 replaced by another ROM, its entry fails, the others still read
+    sim_ow_dev[1].rom[1] ^= 0xFF;
+    SIM_SetRom(1);
+    SIM_Check(SIM_Round(dma) == 0x07, "round 3 fails only the removed sensor", dma);
+
+    // Corrupt table: search again and save
+    sim_eeprom[DS18B20_BUS_EEPROM_ADDR + 5] ^= 0x01;
+    sim_eeprom_writes = 0;
+    SIM_Check(DS18B20_Bus_Init() == 4 && sim_eeprom_writes > 0, "corrupt table searches", dma);
+    SIM_Check(DS18B20_Bus_Process() == HAL_ERROR, "process without a round", dma);
+}
+
+int main(void)
+{
+    SIM_Bus(0);
+    SIM_Bus(1);
+    printf("%s, %d failed\n", sim_failed? "FAIL" : "PASS", sim_failed);
+    return sim_failed;
+}
@@ -0,0 +1,253 @@
+#!/usr/bin/env python3
+# Copyright 2021 IOsetting <iosetting(at)outlook.com>
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+ROM/RAM footprint report of library modules and demos across MCU models.
+
+For each model in the matrix:
+  1. compile src/*.c with SDCC and report CODE/DATA/IDATA/XDATA of each module,
+     read from the area sizes in the .rel files
+  2. archive the modules into a library, compile and link every demo against it,
+     and read the totals from the .mem file
+  3. check the totals against the budget of the model (flash, xdata, and the
+     stack space left in internal RAM), exit with 1 if any budget is exceeded
+
+A demo that doesn't build for a model is reported with the first compiler error. Demos
+written for another MCU type don't build on every model, so this fails the run only if
+the demo builds for none of the models, or for any model with --strict.
+
+Usage:
+  python3 tools/footprint.py
+  python3 tools/footprint.py --models STC8G1K08,STC8H1K08 --demos demo/gpio demo/spi/max7219
+  python3 tools/footprint.py --models STC8H8K64U --demos demo/dma --strict
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+DEFAULT_MODELS = [
+    'STC8A8K64D4',
+    'STC8G1K08',
+    'STC8G2K64',
+    'STC8H1K08',
+    'STC8H3K32S2',
+    'STC8H8K64U',
+]
+
+# SDCC area name -> memory class
+AREA_CLASS = {
+    'CSEG': 'CODE', 'CONST': 'CODE', 'HOME': 'CODE', 'GSINIT': 'CODE',
+    'GSINIT0': 'CODE', 'GSINIT1': 'CODE', 'GSINIT2': 'CODE', 'GSINIT3': 'CODE',
+    'GSINIT4': 'CODE', 'GSINIT5': 'CODE', 'GSFINAL': 'CODE', 'XINIT': 'CODE',
+    'DSEG': 'DATA', 'OSEG': 'DATA', 'BSEG': 'DATA',
+    'ISEG': 'IDATA', 'IABS': 'IDATA',
+    'XSEG': 'XDATA', 'XISEG': 'XDATA', 'PSEG': 'XDATA', 'XABS': 'XDATA',
+}
+CLASSES = ('CODE', 'DATA', 'IDATA', 'XDATA')
+
+
+def model_budget(model):
+    """
+    Budget from model name, STC8<x><ram>K<flash>, e.g. STC8H3K32S2: 3 KB xdata, 32 KB flash
+    """
+    m = re.match(r'STC8[AGH](\d+)K(\d+)', model)
+    if not m:
+        raise ValueError('unrecognized model: %s' % model)
+    return {'CODE': int(m.group(2)) * 1024, 'XDATA': int(m.group(1)) * 1024, 'IRAM': 256}
+
+
+def parse_rel(path):
+    """
+    Sum area sizes of one module, lines like "A CSEG size 1C flags 0 addr 0"
+    """
+    usage = dict.fromkeys(CLASSES, 0)
+    with open(path) as f:
+        for line in f:
+            m = re.match(r'A (\S+) size ([0-9A-Fa-f]+) flags ([0-9A-Fa-f]+)', line)
+            if not m or m.group(1) not in AREA_CLASS:
+                continue
+            size = int(m.group(2), 16)
+            if m.group(1) == 'BSEG':
+                size = (size + 7) // 8
+            usage[AREA_CLASS[m.group(1)]] += size
+    return usage
+
+
+def parse_mem(path):
+    """
+    Totals of a linked image from the .mem file
+    """
+    usage = {'CODE': 0, 'XDATA': 0, 'STACK': 0}
+    with open(path) as f:
+        for line in f:
+            m = re.search(r'with (\d+) bytes available', line)
+            if m:
+                usage['STACK'] = int(m.group(1))
+                continue
+            m = re.match(r'\s*(ROM/EPROM/FLASH|EXTERNAL RAM)\s+\S+\s+\S+\s+(\d+)', line)
+            if m:
+                usage['CODE' if m.group(1).startswith('ROM') else 'XDATA'] = int(m.group(2))
+    return usage
+
+
+def run(cmd, cwd):
+    p = subprocess.run(cmd, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                       universal_newlines=True)
+    return p.returncode, p.stdout
+
+
+def find_demos(paths):
+    """
+    One demo per file with main(), linked with the other .c files in the same directory
+    """
+    demos = []
+    for base in paths:
+        for dirpath, _, files in sorted(os.walk(os.path.join(ROOT, base))):
+            sources = sorted(os.path.join(dirpath, f) for f in files if f.endswith('.c'))
+            mains, others = [], []
+            for src in sources:
+                with open(src, errors='ignore') as f:
+                    (mains if re.search(r'\b(void|int)\s+main\s*\(', f.read()) else others).append(src)
+            for src in mains:
+                demos.append((os.path.relpath(src, ROOT), [src] + others))
+    return demos
+
+
+def first_error(log):
+    for line in log.splitlines():
+        if 'error' in line.lower():
+            return line.strip()
+    return log.strip().splitlines()[-1] if log.strip() else 'no output'
+
+
+def build_model(args, model, demos, built):
+    """
+    Returns False on a module error or a budget overflow, adds the demos that build to built
+    """
+    budget = model_budget(model)
+    out = os.path.join(os.path.abspath(args.out), model)
+    os.makedirs(out, exist_ok=True)
+    cflags = ['-mmcs51', '--std-c99', '--model-small',
+              '-D__CONF_MCU_MODEL=MCU_MODEL_%s' % model, '-D__CONF_FOSC=%s' % args.fosc,
+              '-I%s' % os.path.join(ROOT, 'include')]
+    lflags = ['--iram-size', str(budget['IRAM']), '--xram-size', str(budget['XDATA']),
+              '--code-size', str(budget['CODE'])]
+    failed = False
+
+    print('\n== %s (flash %d, xdata %d)' % (model, budget['CODE'], budget['XDATA']))
+    print('%-40s %7s %7s %7s %7s' % ('module', *CLASSES))
+    rels = []
+    for src in sorted(os.listdir(os.path.join(ROOT, 'src'))):
+        if not src.endswith('.c'):
+            continue
+        rel = os.path.join(out, src[:-2] + '.rel')
+        code, log = run([args.sdcc, '-c'] + cflags + [os.path.join(ROOT, 'src', src), '-o', rel], out)
+        if code != 0:
+            print('%-40s compile error\n%s' % (src, log))
+            failed = True
+            continue
+        usage = parse_rel(rel)
+        rels.append(rel)
+        print('%-40s %7d %7d %7d %7d' % (src, *(usage[c] for c in CLASSES)))
+    lib = os.path.join(out, 'fwlib.lib')
+    if os.path.exists(lib):
+        os.remove(lib)
+    code, log = run([args.sdar, '-rc', lib] + rels, out)
+    if code != 0:
+        print('%-40s archive error\n%s' % ('fwlib.lib', log))
+        return False
+
+    print('%-40s %7s %7s %7s %7s' % ('demo', 'CODE', 'XDATA', 'STACK', ''))
+    for name, sources in demos:
+        dout = os.path.join(out, re.sub(r'[\\/.]', '_', name))
+        os.makedirs(dout, exist_ok=True)
+        objs, ok, error = [], True, ''
+        for src in sources:
+            rel = os.path.join(dout, os.path.basename(src)[:-2] + '.rel')
+            code, log = run([args.sdcc, '-c'] + cflags + ['-I%s' % os.path.dirname(src), src, '-o', rel], dout)
+            if code != 0:
+                ok = False
+                error = first_error(log)
+                break
+            objs.append(rel)
+        ihx = os.path.join(dout, 'main.ihx')
+        mem = ihx[:-4] + '.mem'
+        if ok:
+            # A .mem left by an earlier run must not pass for this link
+            if os.path.exists(mem):
+                os.remove(mem)
+            code, log = run([args.sdcc] + cflags + lflags + objs + ['-L', out, '-l', 'fwlib.lib', '-o', ihx], dout)
+            # The linker exits with error on size overflow but still writes the .mem
+            ok = os.path.exists(mem)
+            linked = (code == 0)
+            if not ok:
+                error = 'link: %s' % first_error(log)
+        if not ok:
+            print('%-40s %7s %s' % (name, 'FAILED' if args.strict else 'n/a', error))
+            failed = failed or args.strict
+            continue
+        built.add(name)
+        usage = parse_mem(mem)
+        over = []
+        if usage['CODE'] > budget['CODE']:
+            over.append('CODE')
+        if usage['XDATA'] > budget['XDATA']:
+            over.append('XDATA')
+        if usage['STACK'] < args.min_stack:
+            over.append('STACK')
+        if not linked and not over:
+            over.append('LINK')
+        failed = failed or bool(over)
+        print('%-40s %7d %7d %7d %s' % (name, usage['CODE'], usage['XDATA'], usage['STACK'],
+                                        ('OVER: ' + ','.join(over)) if over else ''))
+    return not failed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    parser.add_argument('--models', default=','.join(DEFAULT_MODELS),
+                        help='comma separated models, without the MCU_MODEL_ prefix')
+    parser.add_argument('--demos', nargs='*', default=['demo'], help='demo directories')
+    parser.add_argument('--fosc', default='24000000UL')
+    parser.add_argument('--min-stack', type=int, default=16,
+                        help='minimum bytes left for stack in internal RAM')
+    parser.add_argument('--out', default=os.path.join(ROOT, 'build', 'footprint'))
+    parser.add_argument('--sdcc', default='sdcc')
+    parser.add_argument('--sdar', default='sdar')
+    parser.add_argument('--strict', action='store_true',
+                        help='fail if a demo does not build for any of the models')
+    args = parser.parse_args()
+
+    demos = find_demos(args.demos)
+    ok, built = True, set()
+    for model in args.models.split(','):
+        ok = build_model(args, model.strip(), demos, built) and ok
+    # Not built for any model is a broken demo, not one written for another MCU type
+    broken = [name for name, _ in demos if name not in built]
+    if broken:
+        print('\nFAILED, demos not built for any model:')
+        for name in broken:
+            print('  %s' % name)
+        ok = False
+    return 0 if ok else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,344 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __TOOLS_ONEWIRE_MODEL_H__
+#define __TOOLS_ONEWIRE_MODEL_H__
+
+/***
+ * Bit level model of 1-Wire slaves on the UART transport of src/fw_onewire.c
+ *
+ * Include after fw_onewire.c, the model reads its static state. Each device follows
+ * ROM commands SEARCH ROM, MATCH ROM and SKIP ROM, and the DS18B20 functions READ
+ * SCRATCHPAD, WRITE SCRATCHPAD and CONVERT T. A conversion holds read slots at 0 for
+ * 10 slots at 9 bits, doubling per resolution bit, then latches temp into the
+ * scratchpad with the undefined low bits set. The bus is the wired AND of the master
+ * and every device driving it.
+ *
+ * SIM_OW_Run() plays the UART2 and DMA hardware until the engine is idle: a byte
+ * interrupt echoes the slot byte, a DMA batch echoes every byte of ow_slots[]. Returns
+ * the number of interrupts, or -1 if the engine programs the hardware wrongly.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#define SIM_OW_MAX_DEVICES  8
+
+typedef enum
+{
+    SIM_OW_Idle,
+    SIM_OW_RomCmd,
+    SIM_OW_Search,
+    SIM_OW_Match,
+    SIM_OW_Function,
+    SIM_OW_ReadScratchpad,
+    SIM_OW_WriteScratchpad,
+    SIM_OW_Convert,
+} SIM_OW_State_t;
+
+typedef struct
+{
+    uint8_t rom[8];
+    uint8_t sp[9];
+    int16_t temp;
+    SIM_OW_State_t state;
+    uint8_t bit, sub, byte;
+    uint16_t busy;
+} SIM_OW_Device_t;
+
+static SIM_OW_Device_t sim_ow_dev[SIM_OW_MAX_DEVICES];
+static uint8_t sim_ow_count;
+static uint8_t sim_ow_absent;
+static long sim_ow_bytes, sim_ow_batches;
+
+static uint8_t SIM_OW_Crc8(const uint8_t *p, uint8_t len)
+{
+    uint8_t crc = 0, i, b;
+    while (len--)
+    {
+        b = *p++;
+        for (i = 0; i < 8; i++)
+        {
+            crc = ((crc ^ b) & 0x01)? (crc >> 1) ^ 0x8C : crc >> 1;
+            b >>= 1;
+        }
+    }
+    return crc;
+}
+
+static uint8_t SIM_OW_RomBit(SIM_OW_Device_t *d)
+{
+    return (d->rom[d->bit >> 3] >> (d->bit & 7)) & 0x01;
+}
+
+static void SIM_OW_Reset(void)
+{
+    uint8_t i;
+    for (i = 0; i < sim_ow_count; i++)
+    {
+        sim_ow_dev[i].state = SIM_OW_RomCmd;
+        sim_ow_dev[i].bit = 0;
+        sim_ow_dev[i].sub = 0;
+        sim_ow_dev[i].byte = 0;
+    }
+}
+
+/**
+ * Level a device drives in this slot, returns 0 if it leaves the bus released
+*/
+static uint8_t SIM_OW_Drive(SIM_OW_Device_t *d, uint8_t *level)
+{
+    switch (d->state)
+    {
+    case SIM_OW_Search:
+        // Bit, then its complement, then listen to the master
+        if (d->sub == 2)
+        {
+            return 0;
+        }
+        *level = SIM_OW_RomBit(d) ^ d->sub;
+        return 1;
+    case SIM_OW_ReadScratchpad:
+        *level = (d->sp[d->bit >> 3] >> (d->bit & 7)) & 0x01;
+        return 1;
+    case SIM_OW_Convert:
+        // Read slots return 0 until the conversion is done
+        *level = (d->busy == 0);
+        if (d->busy)
+        {
+            d->busy--;
+        }
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static void SIM_OW_Command(SIM_OW_Device_t *d)
+{
+    uint8_t res;
+    int16_t t;
+    switch (d->byte)
+    {
+    case 0xBE:
+        d->state = SIM_OW_ReadScratchpad;
+        break;
+    case 0x4E:
+        d->state = SIM_OW_WriteScratchpad;
+        d->sub = 0;
+        break;
+    case 0x44:
+        res = ((d->sp[4] >> 5) & 0x03) + 9;
+        t = d->temp | ((1 << (12 - res)) - 1);
+        d->sp[0] = t & 0xFF;
+        d->sp[1] = t >> 8;
+        d->sp[8] = SIM_OW_Crc8(d->sp, 8);
+        d->busy = 10 << (res - 9);
+        d->state = SIM_OW_Convert;
+        break;
+    default:
+        d->state = SIM_OW_Idle;
+        break;
+    }
+}
+
+static void SIM_OW_Listen(SIM_OW_Device_t *d, uint8_t level)
+{
+    switch (d->state)
+    {
+    case SIM_OW_RomCmd:
+    case SIM_OW_Function:
+        d->byte |= level << d->bit;
+        if (++d->bit < 8)
+        {
+            return;
+        }
+        d->bit = 0;
+        if (d->state == SIM_OW_Function)
+        {
+            SIM_OW_Command(d);
+        }
+        else if (d->byte == 0xF0)
+        {
+            d->state = SIM_OW_Search;
+            d->sub = 0;
+        }
+        else if (d->byte == 0x55)
+        {
+            d->state = SIM_OW_Match;
+        }
+        else if (d->byte == 0xCC)
+        {
+            d->state = SIM_OW_Function;
+        }
+        else
+        {
+            d->state = SIM_OW_Idle;
+        }
+        d->byte = 0;
+        break;
+    case SIM_OW_Match:
+        if (SIM_OW_RomBit(d) != level)
+        {
+            d->state = SIM_OW_Idle;
+        }
+        else if (++d->bit == 64)
+        {
+            d->bit = 0;
+            d->state = SIM_OW_Function;
+        }
+        break;
+    case SIM_OW_Search:
+        if (d->sub < 2)
+        {
+            d->sub++;
+            return;
+        }
+        d->sub = 0;
+        if (SIM_OW_RomBit(d) != level)
+        {
+            d->state = SIM_OW_Idle;
+        }
+        else if (++d->bit == 64)
+        {
+            d->state = SIM_OW_Idle;
+        }
+        break;
+    case SIM_OW_ReadScratchpad:
+        if (++d->bit == 72)
+        {
+            d->state = SIM_OW_Idle;
+        }
+        break;
+    case SIM_OW_WriteScratchpad:
+        // TH, TL, then config with only the resolution bits writable
+        d->byte |= level << d->bit;
+        if (++d->bit < 8)
+        {
+            return;
+        }
+        d->bit = 0;
+        d->sp[2 + d->sub] = (d->sub == 2)? (d->byte & 0x60) | 0x1F : d->byte;
+        d->byte = 0;
+        if (++d->sub == 3)
+        {
+            d->sp[8] = SIM_OW_Crc8(d->sp, 8);
+            d->state = SIM_OW_Idle;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * One time slot, master: 0 for a write 0 slot, 1 for a write 1 or read slot
+*/
+static uint8_t SIM_OW_Slot(uint8_t master)
+{
+    uint8_t i, level = master, drive;
+    for (i = 0; i < sim_ow_count; i++)
+    {
+        if (SIM_OW_Drive(&sim_ow_dev[i], &drive))
+        {
+            level &= drive;
+        }
+    }
+    for (i = 0; i < sim_ow_count; i++)
+    {
+        SIM_OW_Listen(&sim_ow_dev[i], level);
+    }
+    return level;
+}
+
+/**
+ * Byte echoed on RxD2 for a byte sent on TxD2
+*/
+static uint8_t SIM_OW_Echo(uint8_t tx, uint8_t reset)
+{
+    if (reset)
+    {
+        if (sim_ow_absent || sim_ow_count == 0)
+        {
+            return 0xF0;
+        }
+        // Presence pulse pulls the high nibble down
+        SIM_OW_Reset();
+        return 0xE0;
+    }
+    if (tx == 0x00)
+    {
+        SIM_OW_Slot(0);
+        return 0x00;
+    }
+    // A device holding the bus low pulls the echo down
+    return SIM_OW_Slot(1)? 0xFF : 0xFC;
+}
+
+static int SIM_OW_Run(void)
+{
+    int irqs = 0;
+    uint8_t i, amt;
+    while (ow_busy)
+    {
+        SFRX_ON();
+        if (DMA_UR2R_CR & 0x20)
+        {
+            amt = DMA_UR2R_AMT;
+            if (!(DMA_UR2T_CR & 0x40) || DMA_UR2T_AMT != amt)
+            {
+                SFRX_OFF();
+                printf("UR2T not started with the same length as UR2R\n");
+                return -1;
+            }
+            DMA_UR2R_CR = 0;
+            DMA_UR2T_CR = 0;
+            SFRX_OFF();
+            if (IE2 & 0x01)
+            {
+                printf("UART2 interrupt enabled during DMA batch\n");
+                return -1;
+            }
+            for (i = 0; i <= amt; i++)
+            {
+                ow_slots[i] = SIM_OW_Echo(ow_slots[i], 0);
+            }
+            sim_ow_bytes += amt + 1;
+            sim_ow_batches++;
+            DMA_Channel_Dispatch(DMA_Channel_UR2R);
+        }
+        else
+        {
+            SFRX_OFF();
+            if (!(IE2 & 0x01))
+            {
+                printf("UART2 interrupt disabled\n");
+                return -1;
+            }
+            if ((uint16_t)(T2H << 8 | T2L) != ((ow_slot == OW_SLOT_RESET)? ow_baud_reset : ow_baud_slot))
+            {
+                printf("Timer2 baud rate doesn't match the slot\n");
+                return -1;
+            }
+            S2BUF = SIM_OW_Echo(S2BUF, ow_slot == OW_SLOT_RESET);
+            S2CON |= 0x03;
+            OW_UART_IRQHandler();
+            sim_ow_bytes++;
+        }
+        irqs++;
+    }
+    return irqs;
+}
+
+#endif
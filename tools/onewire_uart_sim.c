@@ -0,0 +1,138 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/***
+ * Host simulation of the UART 1-Wire transport against a bus of 4 devices
+ *
+ * Runs with and without DMA batches: ROM search must find every device, MATCH ROM +
+ * READ SCRATCHPAD must return the scratchpad of the addressed device, a reset on an
+ * empty bus must fail, and single bit slots must walk one ROM. Prints the interrupts
+ * per scratchpad read, exits with the number of failed checks.
+ *
+ *   gcc -std=gnu99 -D__HOST_SIM -D__CONF_MCU_MODEL=MCU_MODEL_STC8H8K64U -Iinclude -Isrc \
+ *       tools/onewire_uart_sim.c $(ls src/fw_[a-z]*.c | grep -v onewire) -o onewire_uart_sim
+ */
+
+#include "fw_onewire.c"
+#include "onewire_model.h"
+
+static __CODE uint8_t sim_roms[4][8] = {
+    {0x28, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x01},
+    {0x28, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x81},
+    {0x28, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02},
+    {0x10, 0xAB, 0xCD, 0xEF, 0x01, 0x23, 0x45, 0x67},
+};
+static int sim_failed;
+
+static void SIM_Check(int ok, const char *what, int dma)
+{
+    if (!ok)
+    {
+        printf("FAIL dma %d: %s\n", dma, what);
+        sim_failed++;
+    }
+}
+
+static void SIM_Transport(int dma)
+{
+    uint8_t rom[8], buf[9], cmd = 0xBE, found = 0, bit, comp, i, k;
+    int irqs;
+
+    SIM_Check(OW_UART_Init(dma? HAL_State_ON : HAL_State_OFF) == HAL_OK, "init", dma);
+
+    // Search finds each device once
+    OW_Search_Reset();
+    while (OW_Search(OW_CMD_SEARCHROM, rom) == HAL_OK)
+    {
+        if (SIM_OW_Run() < 0 || OW_GetStatus() != HAL_OK)
+        {
+            break;
+        }
+        for (i = 0; i < sim_ow_count; i++)
+        {
+            if (memcmp(rom, sim_ow_dev[i].rom, 8) == 0)
+            {
+                found |= 1 << i;
+            }
+        }
+    }
+    SIM_Check(found == 0x0F, "search finds all devices", dma);
+
+    for (i = 0; i < sim_ow_count; i++)
+    {
+        sim_ow_bytes = sim_ow_batches = 0;
+        memset(buf, 0, sizeof(buf));
+        OW_Transfer(sim_ow_dev[i].rom, &cmd, 1, buf, 9);
+        irqs = SIM_OW_Run();
+        SIM_Check(OW_GetStatus() == HAL_OK && memcmp(buf, sim_ow_dev[i].sp, 9) == 0,
+            "MATCH ROM + READ SCRATCHPAD", dma);
+        if (i == 0)
+        {
+            printf("dma %d: scratchpad read %ld slots, %d interrupts, %ld batches\n",
+                dma, sim_ow_bytes, irqs, sim_ow_batches);
+        }
+    }
+
+    OW_Reset();
+    SIM_OW_Run();
+    SIM_Check(OW_GetStatus() == HAL_OK, "reset with devices", dma);
+    sim_ow_absent = 1;
+    OW_Reset();
+    SIM_OW_Run();
+    SIM_Check(OW_GetStatus() != HAL_OK, "reset on empty bus fails", dma);
+    sim_ow_absent = 0;
+
+    // Walk the 1 branches with single slots, ends at the highest ROM
+    cmd = OW_CMD_SEARCHROM;
+    OW_Reset();
+    SIM_OW_Run();
+    OW_Write(&cmd, 1);
+    SIM_OW_Run();
+    memset(rom, 0, sizeof(rom));
+    for (k = 0; k < 64; k++)
+    {
+        OW_ReadBit(&bit);
+        SIM_OW_Run();
+        OW_ReadBit(&comp);
+        SIM_OW_Run();
+        if (bit && comp)
+        {
+            break;
+        }
+        bit = bit || !comp;
+        rom[k >> 3] |= bit << (k & 7);
+        OW_WriteBit(bit);
+        SIM_OW_Run();
+    }
+    SIM_Check(k == 64 && memcmp(rom, sim_roms[1], 8) == 0, "bit slots walk one ROM", dma);
+}
+
+int main(void)
+{
+    uint8_t i, j;
+    sim_ow_count = 4;
+    for (i = 0; i < sim_ow_count; i++)
+    {
+        memcpy(sim_ow_dev[i].rom, sim_roms[i], 8);
+        for (j = 0; j < 9; j++)
+        {
+            sim_ow_dev[i].sp[j] = i * 16 + j;
+        }
+    }
+    SIM_Transport(0);
+    SIM_Transport(1);
+    printf("%s, %d failed\n", sim_failed? "FAIL" : "PASS", sim_failed);
+    return sim_failed;
+}
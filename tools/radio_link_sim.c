@@ -0,0 +1,261 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/***
+ * Host loopback simulation of the radio link layer
+ *
+ * Two nodes run demo/spi/radio/radio_link.c in one process, the link state is swapped
+ * between them and the radio API is replaced by a model of the air: each node sends one
+ * packet per LINK_FRAME_TIME from a 4-packet TX queue, a packet reaches the other node if
+ * it is tuned to the same channel, isn't sending at the same time and the packet is not
+ * lost to the loss rate of the channel.
+ *
+ * The sender sends SIM_MESSAGES messages of 1 KB, the receiver checks them. Each scenario
+ * prints goodput, fragments sent and repeated, SACK timeouts, hops and the loss scores.
+ *
+ *   gcc -std=gnu99 -D__HOST_SIM -D__CONF_MCU_MODEL=MCU_MODEL_STC8H3K32S2 -Iinclude \
+ *       -Idemo/spi/radio tools/radio_link_sim.c src/fw_[a-z]*.c -o radio_link_sim
+ *
+ * Add -DLINK_CHANNEL_BAD=255 to compare with blind hopping.
+ */
+
+#include "radio_link.c"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SIM_MESSAGES        100
+#define SIM_TX_QUEUE        4
+#define SIM_RX_QUEUE        6       // 3 in the chip, 3 in the software FIFO
+#define SIM_CHANNELS        128
+
+typedef struct
+{
+    uint8_t len;
+    uint8_t dat[RADIO_PLOAD_WIDTH];
+} SIM_Packet_t;
+
+typedef struct
+{
+    uint8_t channel;
+    SIM_Packet_t tx[SIM_TX_QUEUE];
+    uint8_t tx_count;
+    SIM_Packet_t rx[SIM_RX_QUEUE];
+    uint8_t rx_head, rx_count;
+    // Saved link layer
+    LINK_State_t link;
+    LINK_Stats_t stats;
+} SIM_Node_t;
+
+static SIM_Node_t nodes[2];
+static SIM_Node_t *node;
+static uint8_t sim_loss[SIM_CHANNELS];      // Percent
+
+static void SIM_Select(uint8_t index)
+{
+    if (node != NULL)
+    {
+        node->link = link;
+        node->stats = LINK_Stats;
+    }
+    node = &nodes[index];
+    link = node->link;
+    LINK_Stats = node->stats;
+}
+
+/**************************************************************************** /
+ * Radio API model
+*/
+
+HAL_StatusTypeDef RADIO_Send(const uint8_t *buf, uint8_t len, HAL_State_t ack)
+{
+    (void)ack;
+    if (node->tx_count == SIM_TX_QUEUE)
+    {
+        return HAL_BUSY;
+    }
+    node->tx[node->tx_count].len = len;
+    memcpy(node->tx[node->tx_count].dat, buf, len);
+    node->tx_count++;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef RADIO_GetTxStatus(void)
+{
+    return (node->tx_count > 0)? HAL_BUSY : HAL_OK;
+}
+
+uint8_t RADIO_GetTxFree(void)
+{
+    return SIM_TX_QUEUE - node->tx_count;
+}
+
+uint8_t RADIO_Receive(uint8_t *buf, uint8_t *pipe)
+{
+    SIM_Packet_t *packet;
+    (void)pipe;
+    if (node->rx_count == 0)
+    {
+        return 0;
+    }
+    packet = &node->rx[node->rx_head];
+    memcpy(buf, packet->dat, packet->len);
+    node->rx_head = (node->rx_head + 1) % SIM_RX_QUEUE;
+    node->rx_count--;
+    return packet->len;
+}
+
+HAL_StatusTypeDef RADIO_SetChannel(uint8_t channel)
+{
+    node->channel = channel;
+    return HAL_OK;
+}
+
+void RADIO_SetMode(RADIO_Mode_t mode)
+{
+    (void)mode;
+}
+
+/**
+ * One LINK_FRAME_TIME slot: both nodes send the head of their TX queue
+*/
+static void SIM_Air(void)
+{
+    uint8_t i;
+    SIM_Node_t *from, *to;
+    for (i = 0; i < 2; i++)
+    {
+        from = &nodes[i];
+        to = &nodes[i ^ 1];
+        if (from->tx_count == 0)
+        {
+            continue;
+        }
+        if (to->tx_count == 0
+            && to->channel == from->channel
+            && to->rx_count < SIM_RX_QUEUE
+            && rand() % 100 >= sim_loss[from->channel])
+        {
+            to->rx[(to->rx_head + to->rx_count) % SIM_RX_QUEUE] = from->tx[0];
+            to->rx_count++;
+        }
+        from->tx_count--;
+        memmove(from->tx, from->tx + 1, from->tx_count * sizeof(SIM_Packet_t));
+    }
+}
+
+/**************************************************************************** /
+ * Scenarios
+*/
+
+static uint8_t tx_msg[LINK_MSG_MAX], rx_msg[LINK_MSG_MAX];
+
+static void SIM_Run(const char *name, uint8_t base_loss, uint8_t band_first, uint8_t band_last, uint8_t band_loss)
+{
+    uint32_t slots = 0, ms, bytes = 0;
+    uint16_t sent = 0, received = 0, errors = 0, i, len;
+    uint8_t n;
+
+    for (i = 0; i < SIM_CHANNELS; i++)
+    {
+        sim_loss[i] = (i >= band_first && i <= band_last)? band_loss : base_loss;
+    }
+    memset(nodes, 0, sizeof(nodes));
+    node = NULL;
+    for (n = 0; n < 2; n++)
+    {
+        SIM_Select(n);
+        LINK_Init();
+    }
+    SIM_Select(1);
+    LINK_Listen(rx_msg, sizeof(rx_msg));
+
+    while (received + errors < SIM_MESSAGES && slots < 10000000UL)
+    {
+        // Sender
+        SIM_Select(0);
+        if (LINK_GetTxStatus() != HAL_BUSY && sent < SIM_MESSAGES)
+        {
+            if (sent > 0 && LINK_GetTxStatus() == HAL_TIMEOUT)
+            {
+                errors++;
+            }
+            for (i = 0; i < sizeof(tx_msg); i++)
+            {
+                tx_msg[i] = (uint8_t)(sent + i * 7);
+            }
+            LINK_Send(tx_msg, sizeof(tx_msg));
+            sent++;
+        }
+        LINK_Process();
+        // Receiver
+        SIM_Select(1);
+        LINK_Process();
+        len = LINK_Received();
+        if (len > 0)
+        {
+            // Messages given up by the sender are skipped
+            n = rx_msg[0];
+            for (i = 0; i < len; i++)
+            {
+                if (rx_msg[i] != (uint8_t)(n + i * 7))
+                {
+                    break;
+                }
+            }
+            if (len != sizeof(tx_msg) || i != len)
+            {
+                printf("%s: message %u corrupted at %u\n", name, n, i);
+                exit(1);
+            }
+            bytes += len;
+            received++;
+            LINK_Listen(rx_msg, sizeof(rx_msg));
+        }
+        SIM_Air();
+        slots++;
+        if (slots * LINK_FRAME_TIME / 1000 != (slots - 1) * LINK_FRAME_TIME / 1000)
+        {
+            LINK_TickHandler();
+        }
+    }
+
+    ms = slots * LINK_FRAME_TIME / 1000;
+    printf("%-12s %3u msgs %6lu ms goodput %5lu kbps", name, received, (unsigned long)ms,
+        (unsigned long)(bytes * 8 / (ms? ms : 1)));
+    SIM_Select(0);
+    printf(", frames %u repeats %u timeouts %u hops %u, failed %u\n", LINK_Stats.tx_frames,
+        LINK_Stats.tx_repeats, LINK_Stats.tx_timeouts, LINK_Stats.hops, errors);
+    SIM_Select(1);
+    printf("%-12s loss:", "");
+    for (n = 0; n < LINK_CHANNEL_NUM; n++)
+    {
+        printf(" %3u", LINK_GetChannelLoss(n));
+    }
+    puts("");
+}
+
+int main(void)
+{
+    srand(1);
+    // Upper bound: 27 of 32 bytes per LINK_FRAME_TIME
+    printf("air rate %u kbps, fragment payload %u bytes\n", 8 * RADIO_PLOAD_WIDTH * 1000 / LINK_FRAME_TIME,
+        LINK_FRAG_SIZE);
+    SIM_Run("clean", 0, 0, 0, 0);
+    SIM_Run("loss 5%", 5, 0, 0, 5);
+    SIM_Run("loss 20%", 20, 0, 0, 20);
+    // A WiFi channel over 2412 - 2432MHz, link channels 12 - 32
+    SIM_Run("wifi", 2, 10, 34, 90);
+    return 0;
+}
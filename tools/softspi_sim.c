@@ -0,0 +1,151 @@
+// Copyright 2021 IOsetting <iosetting(at)outlook.com>
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/***
+ * Host simulation of src/fw_softspi.c against a bit level SPI mode 0 slave
+ *
+ * The pins are mapped to a virtual port 9 whose accesses go through the slave model:
+ * the slave samples MOSI on the rising SCK edge and shifts its next bit out on the
+ * falling edge, onto MISO in 4-wire mode and onto the shared data pin in 3-wire mode.
+ * An edge is seen at the pin access after the one that made it. Every byte value is
+ * sent with Tx, read with Rx, and in 4-wire mode exchanged with TxRx. Exits with the
+ * number of failed checks.
+ *
+ * This covers the C path used by Keil and the host build, the SDCC assembly has to
+ * be checked on hardware.
+ *
+ *   3-wire:      gcc -std=gnu99 -D__HOST_SIM -D__CONF_MCU_MODEL=MCU_MODEL_STC8H8K64U -Iinclude \
+ *                    -Isrc tools/softspi_sim.c -o softspi_sim
+ *   4-wire:      add -DSIM_SOFTSPI_4WIRE
+ *   LSB first:   add -DSOFTSPI_LSB_FIRST=1
+ */
+
+#include <stdio.h>
+
+#define SOFTSPI_SCK_PIN             GPIO_PIN(9, 8)
+#define SOFTSPI_MOSI_PIN            GPIO_PIN(9, 9)
+#if defined (SIM_SOFTSPI_4WIRE)
+#define SOFTSPI_MISO_PIN            GPIO_PIN(9, 7)
+#endif
+
+static volatile unsigned char sim_sck, sim_mosi, sim_miso, sim_sck_last;
+static unsigned char sim_rx, sim_tx, sim_bits;
+
+#if defined (SIM_SOFTSPI_4WIRE)
+#define SIM_SLAVE_OUT               sim_miso
+#else
+#define SIM_SLAVE_OUT               sim_mosi
+#endif
+
+#if defined (SOFTSPI_LSB_FIRST) && (SOFTSPI_LSB_FIRST == 1)
+#define SIM_SHIFT_IN(__RX__, __BIT__)   (((__RX__) >> 1) | ((__BIT__) << 7))
+#define SIM_SHIFT_OUT(__TX__)           ((__TX__) >> 1)
+#define SIM_LEADING(__TX__)             ((__TX__) & 0x01)
+#else
+#define SIM_SHIFT_IN(__RX__, __BIT__)   (((__RX__) << 1) | (__BIT__))
+#define SIM_SHIFT_OUT(__TX__)           ((__TX__) << 1)
+#define SIM_LEADING(__TX__)             (((__TX__) >> 7) & 0x01)
+#endif
+
+static volatile unsigned char *SIM_Sck(void)
+{
+    if (sim_sck && !sim_sck_last)
+    {
+        sim_rx = SIM_SHIFT_IN(sim_rx, sim_mosi);
+    }
+    if (!sim_sck && sim_sck_last)
+    {
+        sim_tx = SIM_SHIFT_OUT(sim_tx);
+        sim_bits++;
+        SIM_SLAVE_OUT = SIM_LEADING(sim_tx);
+    }
+    sim_sck_last = sim_sck;
+    return &sim_sck;
+}
+
+static volatile unsigned char *SIM_Mosi(void)
+{
+    SIM_Sck();
+    return &sim_mosi;
+}
+
+#define P98                         (*SIM_Sck())
+#define P99                         (*SIM_Mosi())
+
+#if defined (SIM_SOFTSPI_4WIRE)
+static volatile unsigned char *SIM_Miso(void)
+{
+    SIM_Sck();
+    return &sim_miso;
+}
+
+#define P97                         (*SIM_Miso())
+#endif
+
+#define GPIO_P9_SetMode(__PINS__, __MODE__)     ((void)0)
+
+#include "fw_softspi.c"
+
+static int sim_failed;
+
+static void SIM_Check(int ok, const char *what, unsigned v)
+{
+    if (!ok)
+    {
+        printf("FAIL %s %02X\n", what, v);
+        sim_failed++;
+    }
+}
+
+/**
+ * Load the byte the slave shifts out, its leading bit is on the line before the first clock
+*/
+static void SIM_Select(unsigned char tx)
+{
+    SIM_Sck();
+    sim_tx = tx;
+    SIM_SLAVE_OUT = SIM_LEADING(tx);
+    sim_bits = 0;
+}
+
+int main(void)
+{
+    unsigned v;
+    uint8_t rx;
+
+    SOFTSPI_Init();
+    for (v = 0; v < 256; v++)
+    {
+        SIM_Select(v ^ 0x5A);
+        SOFTSPI_Tx(v);
+        SIM_Sck();
+        SIM_Check(sim_rx == v && sim_bits == 8, "Tx", v);
+
+        SIM_Select(v);
+        SOFTSPI_DataIn();
+        rx = SOFTSPI_Rx();
+        SOFTSPI_DataOut();
+        SIM_Sck();
+        SIM_Check(rx == v && sim_bits == 8, "Rx", v);
+#if defined (SIM_SOFTSPI_4WIRE)
+        SIM_Select(~v);
+        rx = SOFTSPI_TxRx(v);
+        SIM_Sck();
+        SIM_Check(rx == (uint8_t)~v && sim_rx == v && sim_bits == 8, "TxRx", v);
+#endif
+    }
+    printf("%s, %d failed\n", sim_failed? "FAIL" : "PASS", sim_failed);
+    return sim_failed;
+}